@@ -44,6 +44,22 @@ namespace Private
 	int32 QuickSortPartition(ComparerType& compare, ElementType* elements, int32 lowIndex, int32 highIndex)
 		requires IsComparer<ComparerType, ElementType>
 	{
+		// Move the median of the first, middle, and last elements into the pivot slot so that already sorted spans,
+		// such as objects gathered in allocation order, don't degrade to quadratic time
+		const int32 middleIndex = lowIndex + (highIndex - lowIndex) / 2;
+		if (compare(elements[middleIndex], elements[lowIndex]) == ECompareResult::LessThan)
+		{
+			Swap(elements[middleIndex], elements[lowIndex]);
+		}
+		if (compare(elements[highIndex], elements[lowIndex]) == ECompareResult::LessThan)
+		{
+			Swap(elements[highIndex], elements[lowIndex]);
+		}
+		if (compare(elements[middleIndex], elements[highIndex]) == ECompareResult::LessThan)
+		{
+			Swap(elements[middleIndex], elements[highIndex]);
+		}
+
 		const ElementType& pivot = elements[highIndex];
 
 		// Index of smaller element and indicate
@@ -80,15 +96,22 @@ namespace Private
 	void QuickSort(ComparerType& compare, ElementType* elements, int32 lowIndex, int32 highIndex)
 		requires IsComparer<ComparerType, ElementType>
 	{
-		if (highIndex <= lowIndex)
+		// Only recurse into the smaller partition and loop over the larger one, which keeps the stack depth logarithmic
+		while (lowIndex < highIndex)
 		{
-			return;
-		}
-
-		const int32 partitionIndex = ::Private::QuickSortPartition(compare, elements, lowIndex, highIndex);
+			const int32 partitionIndex = ::Private::QuickSortPartition(compare, elements, lowIndex, highIndex);
 
-		::Private::QuickSort(compare, elements, lowIndex,partitionIndex - 1);
-		::Private::QuickSort(compare, elements, partitionIndex + 1,highIndex);
+			if (partitionIndex - lowIndex < highIndex - partitionIndex)
+			{
+				::Private::QuickSort(compare, elements, lowIndex, partitionIndex - 1);
+				lowIndex = partitionIndex + 1;
+			}
+			else
+			{
+				::Private::QuickSort(compare, elements, partitionIndex + 1, highIndex);
+				highIndex = partitionIndex - 1;
+			}
+		}
 	}
 }
 
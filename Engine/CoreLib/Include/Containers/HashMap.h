@@ -14,7 +14,6 @@ template<typename TKey, typename TValue>
 class THashMap final : private THashTable<TKeyValuePair<TKey, TValue>>
 {
 	using Super = THashTable<TKeyValuePair<TKey, TValue>>;
-	using BucketType = typename Super::BucketType;
 	using TraitsType = TComparisonTraits<TKey>;
 
 public:
@@ -75,7 +74,7 @@ public:
 	template<typename SimilarKeyType>
 	[[nodiscard]] bool ContainsKey(const SimilarKeyType& key) const
 	{
-		return FindBucketForKey<SimilarKeyType>(key) != nullptr;
+		return FindPairForKey<SimilarKeyType>(key) != nullptr;
 	}
 
 	/**
@@ -88,10 +87,10 @@ public:
 	template<typename SimilarKeyType>
 	[[nodiscard]] const ValueType* Find(const SimilarKeyType& key) const
 	{
-		const BucketType* bucket = FindBucketForKey(key);
-		if (bucket && bucket->HasValue())
+		const PairType* pair = FindPairForKey(key);
+		if (pair)
 		{
-			return &bucket->GetValue().Value;
+			return &pair->Value;
 		}
 		return nullptr;
 	}
@@ -106,10 +105,10 @@ public:
 	template<typename SimilarKeyType>
 	[[nodiscard]] ValueType* Find(const SimilarKeyType& key)
 	{
-		BucketType* bucket = FindBucketForKey(key);
-		if (bucket && bucket->HasValue())
+		PairType* pair = FindPairForKey(key);
+		if (pair)
 		{
-			return &bucket->GetValue().Value;
+			return &pair->Value;
 		}
 		return nullptr;
 	}
@@ -124,10 +123,10 @@ public:
 	template<typename SimilarKeyType>
 	[[nodiscard]] const ValueType& FindRef(const SimilarKeyType& key) const
 	{
-		const BucketType* bucket = FindBucketForKey(key);
-		UM_ASSERT(bucket && bucket->HasValue(), "This map does not contain the specified key");
+		const PairType* pair = FindPairForKey(key);
+		UM_ASSERT(pair != nullptr, "This map does not contain the specified key");
 
-		return bucket->GetValue().Value;
+		return pair->Value;
 	}
 
 	/**
@@ -140,10 +139,10 @@ public:
 	template<typename SimilarKeyType>
 	[[nodiscard]] ValueType& FindRef(const SimilarKeyType& key)
 	{
-		BucketType* bucket = FindBucketForKey(key);
-		UM_ASSERT(bucket && bucket->HasValue(), "This map does not contain the specified key");
+		PairType* pair = FindPairForKey(key);
+		UM_ASSERT(pair != nullptr, "This map does not contain the specified key");
 
-		return bucket->GetValue().Value;
+		return pair->Value;
 	}
 
 	/**
@@ -156,9 +155,9 @@ public:
 	template<typename SimilarKeyType>
 	[[maybe_unused]] bool Remove(const SimilarKeyType& key)
 	{
-		if (BucketType* bucket = FindBucketForKey(key))
+		if (PairType* pair = FindPairForKey(key))
 		{
-			bucket->Reset();
+			Super::RemoveElement(pair);
 			return true;
 		}
 		return false;
@@ -203,10 +202,10 @@ public:
 		pairToAdd.Key = KeyType { key };
 		pairToAdd.Value = {};
 
-		BucketType* pairBucket = Super::AddValueAndGetBucket(MoveTemp(pairToAdd));
-		UM_ASSERT(pairBucket && pairBucket->HasValue(), "Failed to add key to hash map");
+		PairType* addedPair = Super::AddValueAndGetElement(MoveTemp(pairToAdd));
+		UM_ASSERT(addedPair != nullptr, "Failed to add key to hash map");
 
-		return pairBucket->GetValue().Value;
+		return addedPair->Value;
 	}
 
 	// STL compatibility BEGIN
@@ -215,44 +214,39 @@ public:
 	// STL compatibility END
 
 #if WITH_TESTING
-	using Super::DebugGetBuckets;
+	using Super::DebugGetControlBytes;
+	using Super::DebugGetSlotElement;
 #endif
 
 private:
 
 	/**
-	 * @brief Attempts to find the bucket for the given key.
+	 * @brief Attempts to find the pair for the given key.
 	 *
 	 * @param key The key.
-	 * @return The bucket corresponding to the key, otherwise nullptr.
+	 * @return The pair corresponding to the key, otherwise nullptr.
 	 */
 	template<typename SimilarKeyType>
-	const BucketType* FindBucketForKey(const SimilarKeyType& key) const
+	const PairType* FindPairForKey(const SimilarKeyType& key) const
 	{
 		using OtherTraitsType = TComparisonTraits<SimilarKeyType>;
 
 		const uint64 keyHash = GetHashCode(key);
-		return Super::FindBucketByPredicate(keyHash, [&key](const BucketType& bucket, const uint64 bucketHash)
+		return Super::FindElementByPredicate(keyHash, [&key](const PairType& pair)
 		{
-			if (bucket.CachedHash != bucketHash || bucket.HasValue() == false)
-			{
-				return false;
-			}
-
-			const PairType& bucketPair = bucket.GetValue();
-			return OtherTraitsType::Equals(static_cast<SimilarKeyType>(bucketPair.Key), key);
+			return OtherTraitsType::Equals(static_cast<SimilarKeyType>(pair.Key), key);
 		});
 	}
 
 	/**
-	 * @brief Attempts to find the bucket for the given key.
+	 * @brief Attempts to find the pair for the given key.
 	 *
 	 * @param key The key.
-	 * @return The bucket corresponding to the key, otherwise nullptr.
+	 * @return The pair corresponding to the key, otherwise nullptr.
 	 */
 	template<typename SimilarKeyType>
-	BucketType* FindBucketForKey(const SimilarKeyType& key)
+	PairType* FindPairForKey(const SimilarKeyType& key)
 	{
-		return const_cast<BucketType*>(const_cast<const THashMap*>(this)->template FindBucketForKey<SimilarKeyType>(key));
+		return const_cast<PairType*>(const_cast<const THashMap*>(this)->template FindPairForKey<SimilarKeyType>(key));
 	}
 };
\ No newline at end of file
@@ -1,144 +1,110 @@
 #pragma once
 
-#include "Containers/Array.h"
-#include "Containers/Optional.h"
-#include "Containers/StaticArray.h"
+#include "Containers/Span.h"
 #include "Engine/Assert.h"
 #include "Engine/Hashing.h"
+#include "Math/Math.h"
+#include "Memory/Memory.h"
 #include "Templates/ComparisonTraits.h"
+#include "Templates/Fill.h"
+#include "Templates/NumericLimits.h"
 #include "Templates/TypeTraits.h"
+#include <bit>
 #include <initializer_list>
 
+// Do not include SSE headers on ARM builds
+#if !UMBRAL_ARCH_IS_ARM
+#	include <emmintrin.h> /* For _mm_cmpeq_epi8 and _mm_movemask_epi8 */
+#endif
+
 namespace Private
 {
-	// clang-tidy off
-
 	/**
-	 * @brief A table of prime numbers to use for hash table sizes.
-	 *
-	 * @remarks Copied from the .NET Reference Source. See HashHelper class.
+	 * @brief The control byte of an empty hash table slot. The control byte of a full slot holds the low seven bits of
+	 *        its element's hash instead, so full slots never have their sign bit set.
 	 */
-	constexpr TStaticArray<int32, 72> PrimeTable
-	{{
-		3, 7, 11, 17, 23, 29, 37, 47, 59, 71, 89, 107, 131, 163, 197, 239, 293, 353, 431, 521, 631,
-		761, 919, 1103, 1327, 1597, 1931, 2333, 2801, 3371, 4049, 4861, 5839, 7013, 8419, 10103,
-		12143, 14591, 17519, 21023, 25229, 30293, 36353, 43627, 52361, 62851, 75431, 90523, 108631,
-		130363, 156437, 187751, 225307, 270371, 324449, 389357, 467237, 560689, 672827, 807403,
-		968897, 1162687, 1395263, 1674319, 2009191, 2411033, 2893249, 3471899, 4166287, 4999559,
-		5999471, 7199369
-	}};
-
-	// clang-tidy on
+	constexpr int8 HashTableEmptyControl = -128;
 
 	/**
-	 * @brief Gets the next prime capacity value at least two times the given current capacity.
-	 *
-	 * @param currentCapacity The current capacity.
-	 * @return The next capacity.
+	 * @brief The number of control bytes that are checked at once when probing a hash table.
 	 */
-	constexpr int32 GetNextPrime(const int32 currentCapacity)
-	{
-		int32 nextCapacityIndex = PrimeTable.IndexOfByPredicate([=](const int32 value)
-		{
-			return value > currentCapacity;
-		});
+	constexpr int32 HashTableGroupWidth = 16;
 
-		if (nextCapacityIndex == INDEX_NONE)
-		{
-			nextCapacityIndex = PrimeTable.Num() - 1;
-		}
-
-		return PrimeTable[nextCapacityIndex];
-	}
+	/**
+	 * @brief The number of low hash bits that are stored in a full slot's control byte.
+	 */
+	constexpr int32 HashTableNumControlHashBits = 7;
 
 	/**
-	 * @brief Defines a hash table bucket.
-	 *
-	 * @tparam T The bucket value type.
+	 * @brief Defines a group of consecutive hash table control bytes that can be matched against all at once.
 	 */
-	template<typename T>
-	class THashTableBucket
+	class FHashTableControlGroup
 	{
 	public:
 
-		using ElementType = T;
-
-		static constexpr uint64 InvalidHash = 0xFFFF'FFFF'FFFF'FFFFULL;
-
-		/** @brief The cached hash of this bucket's value. */
-		uint64 CachedHash = InvalidHash;
-
-		/** @brief This bucket's value. */
-		TOptional<ElementType> Value;
-
 		/**
-		 * @brief Gets a pointer to this bucket's value. Will assert if this bucket does not have a value.
+		 * @brief Loads a group of control bytes.
 		 *
-		 * @return This bucket's value.
+		 * @param controlBytes The first control byte in the group. Must be followed by at least HashTableGroupWidth - 1 more.
 		 */
-		[[nodiscard]] const ElementType* GetValueAsPointer() const
-		{
-			UM_ASSERT(Value.HasValue(), "Attempting to retrieve value from empty bucket");
-			return Value.GetValueAsPointer();
-		}
-
-		/**
-		 * @brief Gets a pointer to this bucket's value. Will assert if this bucket does not have a value.
-		 *
-		 * @return This bucket's value.
-		 */
-		[[nodiscard]] ElementType* GetValueAsPointer()
+		explicit FHashTableControlGroup(const int8* controlBytes)
+#if !UMBRAL_ARCH_IS_ARM
+			: m_ControlBytes { _mm_loadu_si128(reinterpret_cast<const __m128i*>(controlBytes)) }
+#else
+			: m_ControlBytes { controlBytes }
+#endif
 		{
-			UM_ASSERT(Value.HasValue(), "Attempting to retrieve value from empty bucket");
-			return Value.GetValueAsPointer();
 		}
 
 		/**
-		 * @brief Gets this bucket's value. Will assert if this bucket does not have a value.
+		 * @brief Finds the control bytes in this group that are equal to a given value.
 		 *
-		 * @return This bucket's value.
+		 * @param value The value to look for.
+		 * @return A bit mask where bit N is set if the Nth control byte in this group is equal to \p value.
 		 */
-		[[nodiscard]] const ElementType& GetValue() const
-		{
-			UM_ASSERT(Value.HasValue(), "Attempting to retrieve value from empty bucket");
-			return Value.GetValue();
+		[[nodiscard]] uint32 Match(const int8 value) const
+		{
+#if !UMBRAL_ARCH_IS_ARM
+			const __m128i matches = _mm_cmpeq_epi8(m_ControlBytes, _mm_set1_epi8(value));
+			return static_cast<uint32>(_mm_movemask_epi8(matches));
+#else
+			uint32 result = 0;
+			for (int32 idx = 0; idx < HashTableGroupWidth; ++idx)
+			{
+				result |= static_cast<uint32>(m_ControlBytes[idx] == value) << idx;
+			}
+			return result;
+#endif
 		}
 
 		/**
-		 * @brief Gets this bucket's value. Will assert if this bucket does not have a value.
+		 * @brief Finds the control bytes in this group that belong to empty slots.
 		 *
-		 * @return This bucket's value.
+		 * @return A bit mask where bit N is set if the Nth control byte in this group belongs to an empty slot.
 		 */
-		[[nodiscard]] ElementType& GetValue()
+		[[nodiscard]] uint32 MatchEmpty() const
 		{
-			UM_ASSERT(Value.HasValue(), "Attempting to retrieve value from empty bucket");
-			return Value.GetValue();
+			return Match(HashTableEmptyControl);
 		}
 
-		/**
-		 * @brief Gets a value indicating whether or not this bucket has a value.
-		 *
-		 * @return True if this bucket has a value, otherwise false.
-		 */
-		[[nodiscard]] bool HasValue() const
-		{
-			return Value.HasValue();
-		}
+	private:
 
-		/**
-		 * @brief Resets this bucket, clearing out any value it might have.
-		 */
-		void Reset()
-		{
-			CachedHash = InvalidHash;
-			Value.Reset();
-		}
+#if !UMBRAL_ARCH_IS_ARM
+		__m128i m_ControlBytes;
+#else
+		const int8* m_ControlBytes = nullptr;
+#endif
 	};
 }
 
 /**
  * @brief Defines a hash table, which can store unique values with fast insertion, look-up, and removal.
  *
+ * @remarks Elements are stored in a single power-of-two sized array of slots and found using linear probing. Each slot
+ *          has a control byte holding either an "empty" marker or seven bits of its element's hash, and probing checks
+ *          a whole group of control bytes at once so that most elements that are not a match are never touched. Removing
+ *          an element shifts the elements that follow it back into place, so there are no tombstones to clean up.
+ *
  * @tparam T The element type contained within the hash table.
  */
 template<typename T>
@@ -147,10 +113,19 @@ class THashTable
 public:
 
 	using ElementType = T;
-	using BucketType = Private::THashTableBucket<ElementType>;
-	using SizeType = typename TArray<BucketType>::SizeType;
+	using SizeType = int32;
 	using TraitsType = TComparisonTraits<ElementType>;
 
+	/**
+	 * @brief The minimum number of slots in a hash table that has allocated any.
+	 */
+	static constexpr SizeType MinCapacity = Private::HashTableGroupWidth;
+
+	/**
+	 * @brief The maximum ratio of elements to slots, as eighths, before a hash table grows.
+	 */
+	static constexpr SizeType MaxLoadFactorInEighths = 7;
+
 	/**
 	 * @brief Defines an iterator for this hash table.
 	 */
@@ -160,18 +135,20 @@ public:
 	public:
 
 		using ThisType = TIterator;
-		using BucketArrayType = typename TConditionalAddConst<IsConst, TArray<BucketType>>::Type;
+		using HashTableType = typename TConditionalAddConst<IsConst, THashTable>::Type;
 
 		/**
 		 * @brief Sets default values for this iterator's properties.
 		 *
 		 * @param hashTable The hash table to iterate.
+		 * @param index The slot index to start at. Moves on to the next full slot if this one is not full, unless it is
+		 *              already past the last slot.
 		 */
-		TIterator(BucketArrayType& buckets, SizeType index)
-			: m_Buckets { buckets }
+		TIterator(HashTableType& hashTable, SizeType index)
+			: m_HashTable { &hashTable }
 			, m_Index { index }
 		{
-			if (m_Buckets.IsValidIndex(m_Index) && m_Buckets[m_Index].HasValue())
+			if (m_Index >= m_HashTable->m_Capacity || (IsValid() && m_HashTable->IsSlotFull(m_Index)))
 			{
 				return;
 			}
@@ -186,7 +163,7 @@ public:
 		 */
 		[[nodiscard]] bool IsValid() const
 		{
-			return m_Buckets.IsValidIndex(m_Index);
+			return m_Index >= 0 && m_Index < m_HashTable->m_Capacity;
 		}
 
 		/**
@@ -198,7 +175,7 @@ public:
 			{
 				++m_Index;
 			}
-			while (m_Buckets.IsValidIndex(m_Index) && m_Buckets[m_Index].HasValue() == false);
+			while (IsValid() && m_HashTable->IsSlotFull(m_Index) == false);
 		}
 
 		/**
@@ -209,7 +186,7 @@ public:
 		 */
 		[[nodiscard]] bool operator==(const ThisType& other) const
 		{
-			return &m_Buckets == &other.m_Buckets && m_Index == other.m_Index;
+			return m_HashTable == other.m_HashTable && m_Index == other.m_Index;
 		}
 
 		/**
@@ -220,7 +197,7 @@ public:
 		 */
 		[[nodiscard]] bool operator!=(const ThisType& other) const
 		{
-			return &m_Buckets != &other.m_Buckets || m_Index != other.m_Index;
+			return m_HashTable != other.m_HashTable || m_Index != other.m_Index;
 		}
 
 		/**
@@ -263,7 +240,7 @@ public:
 		 */
 		const ElementType* operator->() const
 		{
-			return m_Buckets[m_Index].GetValueAsPointer();
+			return &m_HashTable->GetSlotElement(m_Index);
 		}
 
 		/**
@@ -274,7 +251,7 @@ public:
 		ElementType* operator->()
 		    requires(IsConst == false)
 		{
-			return m_Buckets[m_Index].GetValueAsPointer();
+			return &m_HashTable->GetSlotElement(m_Index);
 		}
 
 		/**
@@ -284,7 +261,7 @@ public:
 		 */
 		const ElementType& operator*() const
 		{
-			return m_Buckets[m_Index].GetValue();
+			return m_HashTable->GetSlotElement(m_Index);
 		}
 
 		/**
@@ -295,12 +272,12 @@ public:
 		ElementType& operator*()
 			requires(IsConst == false)
 		{
-			return m_Buckets[m_Index].GetValue();
+			return m_HashTable->GetSlotElement(m_Index);
 		}
 
 	private:
 
-		BucketArrayType& m_Buckets;
+		HashTableType* m_HashTable;
 		SizeType m_Index;
 	};
 
@@ -327,6 +304,34 @@ public:
 		}
 	}
 
+	/**
+	 * @brief Copies another hash table.
+	 *
+	 * @param other The other hash table.
+	 */
+	THashTable(const THashTable& other)
+	{
+		CopyFrom(other);
+	}
+
+	/**
+	 * @brief Takes ownership of another hash table's elements.
+	 *
+	 * @param other The other hash table.
+	 */
+	THashTable(THashTable&& other) noexcept
+	{
+		TakeFrom(other);
+	}
+
+	/**
+	 * @brief Destroys this hash table.
+	 */
+	~THashTable()
+	{
+		Clear();
+	}
+
 	/**
 	 * @brief Attempts to add the given element value.
 	 *
@@ -350,11 +355,18 @@ public:
 	}
 
 	/**
-	 * @brief Clears this hash table.
+	 * @brief Clears this hash table, releasing its memory.
 	 */
 	void Clear()
 	{
-		m_Buckets.Clear();
+		DestroyElements();
+
+		FMemory::Free(m_ControlBytes);
+		FMemory::Free(m_Slots);
+
+		m_ControlBytes = nullptr;
+		m_Slots = nullptr;
+		m_Capacity = 0;
 		m_NumItems = 0;
 	}
 
@@ -366,7 +378,7 @@ public:
 	 */
 	[[nodiscard]] bool Contains(const ElementType& element) const
 	{
-		return FindBucketForValue(element) != nullptr;
+		return FindElement(element) != nullptr;
 	}
 
 	/**
@@ -376,7 +388,7 @@ public:
 	 */
 	[[nodiscard]] ConstIteratorType CreateConstIterator() const
 	{
-		return ConstIteratorType { m_Buckets, INDEX_NONE };
+		return ConstIteratorType { *this, INDEX_NONE };
 	}
 
 	/**
@@ -386,7 +398,7 @@ public:
 	 */
 	[[nodiscard]] ConstIteratorType CreateIterator() const
 	{
-		return ConstIteratorType { m_Buckets, INDEX_NONE };
+		return ConstIteratorType { *this, INDEX_NONE };
 	}
 
 	/**
@@ -396,7 +408,7 @@ public:
 	 */
 	[[nodiscard]] IteratorType CreateIterator()
 	{
-		return IteratorType { m_Buckets, INDEX_NONE };
+		return IteratorType { *this, INDEX_NONE };
 	}
 
 	/**
@@ -406,7 +418,7 @@ public:
 	 */
 	[[nodiscard]] SizeType GetCapacity() const
 	{
-		return m_Buckets.GetCapacity();
+		return GetMaxNumItemsForCapacity(m_Capacity);
 	}
 
 	/**
@@ -416,7 +428,7 @@ public:
 	 */
 	[[nodiscard]] bool IsEmpty() const
 	{
-		return m_Buckets.IsEmpty();
+		return m_NumItems == 0;
 	}
 
 	/**
@@ -437,28 +449,27 @@ public:
 	 */
 	[[maybe_unused]] bool Remove(const ElementType& element)
 	{
-		if (BucketType* elementBucket = FindBucketForValue(element))
+		if (ElementType* foundElement = FindElement(element))
 		{
-			elementBucket->Reset();
+			RemoveElement(foundElement);
 			return true;
 		}
 		return false;
 	}
 
 	/**
-	 * @brief Reserves at least a certain number of buckets in this hash table.
+	 * @brief Reserves enough room in this hash table to contain at least a certain number of items without re-growing.
 	 *
-	 * @param count The minimum number of buckets to reserve.
+	 * @param count The minimum number of items to reserve room for.
 	 */
 	void Reserve(const SizeType count)
 	{
-		const SizeType actualCount = Private::GetNextPrime(count);
-		if (actualCount <= m_Buckets.GetCapacity())
+		if (count <= GetCapacity())
 		{
 			return;
 		}
 
-		GrowBucketsArrayToCapacity(m_Buckets, actualCount);
+		Rehash(GetCapacityForNumItems(count));
 	}
 
 	/**
@@ -466,26 +477,75 @@ public:
 	 */
 	void Reset()
 	{
-		m_Buckets.Reset();
+		DestroyElements();
+
+		if (m_ControlBytes != nullptr)
+		{
+			Fill(m_ControlBytes, GetNumControlBytes(m_Capacity), Private::HashTableEmptyControl);
+		}
+
 		m_NumItems = 0;
 	}
 
+	/**
+	 * @brief Copies another hash table.
+	 *
+	 * @param other The other hash table.
+	 * @return This hash table.
+	 */
+	THashTable& operator=(const THashTable& other)
+	{
+		if (&other != this)
+		{
+			Clear();
+			CopyFrom(other);
+		}
+		return *this;
+	}
+
+	/**
+	 * @brief Takes ownership of another hash table's elements.
+	 *
+	 * @param other The other hash table.
+	 * @return This hash table.
+	 */
+	THashTable& operator=(THashTable&& other) noexcept
+	{
+		if (&other != this)
+		{
+			Clear();
+			TakeFrom(other);
+		}
+		return *this;
+	}
+
 	// STL compatibility BEGIN
 	IteratorType      begin()       { return CreateIterator(); }
 	ConstIteratorType begin() const { return CreateConstIterator(); }
-	IteratorType      end()         { return IteratorType { m_Buckets, m_Buckets.Num() + 1 }; }
-	ConstIteratorType end()   const { return ConstIteratorType { m_Buckets, m_Buckets.Num() + 1 }; }
+	IteratorType      end()         { return IteratorType { *this, m_Capacity }; }
+	ConstIteratorType end()   const { return ConstIteratorType { *this, m_Capacity }; }
 	// STL compatibility END
 
 #if WITH_TESTING
 	/**
-	 * @brief Gets this hash table's bucket array.
+	 * @brief Gets this hash table's control bytes, one for each slot.
+	 *
+	 * @return This hash table's control bytes.
+	 */
+	[[nodiscard]] TSpan<const int8> DebugGetControlBytes() const
+	{
+		return TSpan<const int8> { m_ControlBytes, m_Capacity };
+	}
+
+	/**
+	 * @brief Gets the element in one of this hash table's slots.
 	 *
-	 * @return This hash table's bucket array.
+	 * @param index The slot index.
+	 * @return The element in the slot, or nullptr if the slot is empty.
 	 */
-	[[nodiscard]] const TArray<BucketType>& DebugGetBuckets() const
+	[[nodiscard]] const ElementType* DebugGetSlotElement(const SizeType index) const
 	{
-		return m_Buckets;
+		return IsSlotFull(index) ? &GetSlotElement(index) : nullptr;
 	}
 #endif
 
@@ -499,274 +559,414 @@ protected:
 	 */
 	[[nodiscard]] bool AddValue(ElementType value)
 	{
-		return AddValueAndGetBucket(MoveTemp(value)) != nullptr;
+		return AddValueAndGetElement(MoveTemp(value)) != nullptr;
 	}
 
 	/**
 	 * @brief Does the heavy lifting of adding a value to this hash table.
 	 *
 	 * @param value The value to add.
-	 * @return The value's bucket if it was added, otherwise nullptr.
+	 * @return The added element if the value was added, otherwise nullptr.
 	 */
-	[[nodiscard]] BucketType* AddValueAndGetBucket(ElementType value)
+	[[nodiscard]] ElementType* AddValueAndGetElement(ElementType value)
 	{
-		if (m_Buckets.IsEmpty() || m_NumItems >= m_Buckets.GetCapacity())
+		const uint64 hash = GetHashCode(value);
+		const bool alreadyContainsValue = FindElementByPredicate(hash, [&value](const ElementType& element)
 		{
-			ConditionalGrow();
-		}
+			return TraitsType::Equals(element, value);
+		}) != nullptr;
 
-		BucketType* valueBucket = AddValueToBucketsArray(m_Buckets, MoveTemp(value), [this]
+		if (alreadyContainsValue)
 		{
-			constexpr bool forceGrow = true;
-			ConditionalGrow(forceGrow);
-		});
+			return nullptr;
+		}
 
-		if (valueBucket)
+		if (m_NumItems >= GetCapacity())
 		{
-			++m_NumItems;
+			Rehash(m_Capacity == 0 ? MinCapacity : m_Capacity * 2);
 		}
 
-		return valueBucket;
+		const SizeType index = FindEmptySlotForHash(hash);
+		FMemory::ConstructObjectAt<ElementType>(m_Slots + index, MoveTemp(value));
+		SetControlByte(index, GetControlByteForHash(hash));
+		++m_NumItems;
+
+		return m_Slots + index;
 	}
 
 	/**
-	 * @brief Adds a value to a bucket array.
+	 * @brief Finds an element based on its hash and a predicate.
 	 *
-	 * @tparam GrowCallbackType The type of the grow callback.
-	 * @param buckets The bucket array.
-	 * @param value The value to add to the bucket array.
-	 * @param growCallback The callback to use when needing to grow the buckets array.
-	 * @return True if the value was newly added to the buckets array, otherwise false (if the element was already there).
+	 * @tparam PredicateType The type of the predicate.
+	 * @param hash The element's hash.
+	 * @param predicate The predicate, which is only called for elements whose hash could be equal to \p hash.
+	 * @return The element determined by the predicate, or nullptr if one could not be found.
 	 */
-	template<typename GrowCallbackType>
-	[[nodiscard]] static BucketType* AddValueToBucketsArray(TArray<BucketType>& buckets, ElementType value, GrowCallbackType growCallback)
+	template<typename PredicateType>
+	[[nodiscard]] const ElementType* FindElementByPredicate(const uint64 hash, PredicateType predicate) const
+		requires TIsCallable<bool, PredicateType, const ElementType&>::Value
 	{
-		const uint64 elementHash = GetHashCode(value);
-		uint64 hashForBucketLookup = elementHash;
+		if (m_NumItems == 0)
+		{
+			return nullptr;
+		}
+
+		const int8 controlByte = GetControlByteForHash(hash);
+		const SizeType indexMask = m_Capacity - 1;
 
+		SizeType groupIndex = GetHomeIndexForHash(hash);
 		while (true)
 		{
-			BucketType* bucket = FindBucketForAddFromHash(buckets, hashForBucketLookup);
-			if (bucket == nullptr)
-			{
-				hashForBucketLookup = RehashHashCode(hashForBucketLookup);
-			}
-			else if (bucket->HasValue() == false)
+			const Private::FHashTableControlGroup group { m_ControlBytes + groupIndex };
+
+			for (uint32 matches = group.Match(controlByte); matches != 0; matches &= matches - 1)
 			{
-				bucket->CachedHash = hashForBucketLookup;
-				bucket->Value = MoveTemp(value);
-				return bucket;
+				const SizeType index = (groupIndex + std::countr_zero(matches)) & indexMask;
+				if (predicate(m_Slots[index]))
+				{
+					return m_Slots + index;
+				}
 			}
-			else if (TraitsType::Equals(bucket->GetValue(), value))
+
+			// Elements always sit before the first empty slot after the slot their hash maps to
+			if (group.MatchEmpty() != 0)
 			{
 				return nullptr;
 			}
-			else
-			{
-				growCallback();
-			}
+
+			groupIndex = (groupIndex + Private::HashTableGroupWidth) & indexMask;
 		}
 	}
 
 	/**
-	 * @brief Grows this hash table if it needs to.
+	 * @brief Finds an element based on its hash and a predicate.
 	 *
-	 * @param forceGrow True to force a grow.
+	 * @tparam PredicateType The type of the predicate.
+	 * @param hash The element's hash.
+	 * @param predicate The predicate, which is only called for elements whose hash could be equal to \p hash.
+	 * @return The element determined by the predicate, or nullptr if one could not be found.
 	 */
-	void ConditionalGrow(const bool forceGrow = false)
+	template<typename PredicateType>
+	[[nodiscard]] ElementType* FindElementByPredicate(const uint64 hash, PredicateType predicate)
+		requires TIsCallable<bool, PredicateType, const ElementType&>::Value
 	{
-		if (m_NumItems < m_Buckets.GetCapacity() && forceGrow == false)
-		{
-			return;
-		}
-
-		GrowBucketsArray(m_Buckets);
+		return const_cast<ElementType*>(const_cast<const THashTable*>(this)->FindElementByPredicate(hash, MoveTemp(predicate)));
 	}
 
 	/**
-	 * @brief Finds a mutable bucket for use when adding to this hash table based on the element's hash.
+	 * @brief Finds an element that is equal to a given value.
 	 *
-	 * @param hash The hash.
-	 * @return The bucket for \p hash, or nullptr if there is no bucket for \p hash.
+	 * @param value The value.
+	 * @return The element equal to \p value, or nullptr if one could not be found.
 	 */
-	[[nodiscard]] static BucketType* FindBucketForAddFromHash(TArray<BucketType>& buckets, const uint64 hash)
+	[[nodiscard]] const ElementType* FindElement(const ElementType& value) const
 	{
-		const int32 index = GetBucketIndexForHash(buckets, hash);
-		UM_ASSERT(index != INDEX_NONE, "Hash table has not yet been initialized");
-
-		BucketType& bucket = buckets[index];
-		if (bucket.HasValue() == false || bucket.CachedHash == hash)
+		return FindElementByPredicate(GetHashCode(value), [&value](const ElementType& element)
 		{
-			return &bucket;
-		}
+			return TraitsType::Equals(element, value);
+		});
+	}
 
-		return nullptr;
+	/**
+	 * @brief Finds an element that is equal to a given value.
+	 *
+	 * @param value The value.
+	 * @return The element equal to \p value, or nullptr if one could not be found.
+	 */
+	[[nodiscard]] ElementType* FindElement(const ElementType& value)
+	{
+		return const_cast<ElementType*>(const_cast<const THashTable*>(this)->FindElement(value));
 	}
 
 	/**
-	 * @brief Finds the bucket for a given hash.
+	 * @brief Removes an element from this hash table.
 	 *
-	 * @param hash The hash.
-	 * @return The bucket for \p hash, or nullptr if there is no bucket for \p hash.
+	 * @param element The element to remove. Must have been found in this hash table.
 	 */
-	[[nodiscard]] const BucketType* FindBucketForHash(const uint64 hash) const
+	void RemoveElement(ElementType* element)
 	{
-		return FindBucketByPredicate(hash, [](const BucketType& bucket, const uint64 bucketHash)
+		SizeType emptyIndex = static_cast<SizeType>(element - m_Slots);
+		UM_ASSERT(emptyIndex >= 0 && emptyIndex < m_Capacity && IsSlotFull(emptyIndex), "Attempting to remove an element that is not in this hash table");
+
+		FMemory::DestructObject(element);
+		SetControlByte(emptyIndex, Private::HashTableEmptyControl);
+		--m_NumItems;
+
+		// Shift back every following element that would no longer be reachable from the slot its hash maps to. This
+		// keeps every element before the first empty slot after its home slot, which lookups rely on
+		const SizeType indexMask = m_Capacity - 1;
+		for (SizeType index = (emptyIndex + 1) & indexMask; IsSlotFull(index); index = (index + 1) & indexMask)
 		{
-			return bucket.CachedHash == bucketHash;
-		});
+			const SizeType homeIndex = GetHomeIndexForHash(GetHashCode(m_Slots[index]));
+
+			// The element can stay put if its home slot is cyclically within (emptyIndex, index]
+			const bool canStayPut = emptyIndex <= index
+				? (emptyIndex < homeIndex && homeIndex <= index)
+				: (emptyIndex < homeIndex || homeIndex <= index);
+			if (canStayPut)
+			{
+				continue;
+			}
+
+			FMemory::ConstructObjectAt<ElementType>(m_Slots + emptyIndex, MoveTemp(m_Slots[index]));
+			FMemory::DestructObject(m_Slots + index);
+			SetControlByte(emptyIndex, m_ControlBytes[index]);
+			SetControlByte(index, Private::HashTableEmptyControl);
+
+			emptyIndex = index;
+		}
 	}
 
+private:
+
 	/**
-	 * @brief Finds a bucket based on an initial hash and a predicate.
+	 * @brief Copies another hash table's elements into this empty hash table.
 	 *
-	 * @tparam PredicateType The type of the predicate.
-	 * @param initialHash The initial hash.
-	 * @param predicate The predicate.
-	 * @return The bucket determined by the predicate.
+	 * @param other The other hash table.
 	 */
-	template<typename PredicateType>
-	[[nodiscard]] const BucketType* FindBucketByPredicate(const uint64 initialHash, PredicateType predicate) const
-		requires TIsCallable<bool, PredicateType, const BucketType&, uint64>::Value
+	void CopyFrom(const THashTable& other)
 	{
-		if (m_Buckets.IsEmpty())
+		if (other.m_NumItems == 0)
 		{
-			return nullptr;
+			return;
 		}
 
-		uint64 bucketHash = initialHash;
-		int32 bucketIndex = GetBucketIndexForHash(m_Buckets, bucketHash);
-		if (bucketIndex == INDEX_NONE)
+		// Both tables have the same capacity, so every element can go into the same slot it's in within the other table
+		AllocateSlots(other.m_Capacity);
+		FMemory::Copy(m_ControlBytes, other.m_ControlBytes, GetNumControlBytes(m_Capacity));
+
+		for (SizeType index = 0; index < m_Capacity; ++index)
 		{
-			return nullptr;
+			if (IsSlotFull(index))
+			{
+				FMemory::ConstructObjectAt<ElementType>(m_Slots + index, other.m_Slots[index]);
+			}
 		}
 
-		// HACK The most common fail case for successfully adding something but then failing the contains check is
-		//      hitting the original bucket index with a different hash value. The extra probe count allows us to
-		//      iterate this loop at least once more in an attempt to find the correct bucket. This is labelled as
-		//      a hack, though, because that feels wrong...
-		int32 extraProbeCount = 1;
-		const int32 originalBucketIndex = bucketIndex;
-		do
+		m_NumItems = other.m_NumItems;
+	}
+
+	/**
+	 * @brief Destroys every element in this hash table without updating any control bytes.
+	 */
+	void DestroyElements()
+	{
+		for (SizeType index = 0; index < m_Capacity && m_NumItems > 0; ++index)
 		{
-			const BucketType& bucket = m_Buckets[bucketIndex];
-			if (predicate(bucket, bucketHash))
+			if (IsSlotFull(index))
 			{
-				return &bucket;
+				FMemory::DestructObject(m_Slots + index);
 			}
+		}
+	}
+
+	/**
+	 * @brief Allocates the slots and control bytes for this hash table, marking every slot as empty.
+	 *
+	 * @param capacity The number of slots to allocate.
+	 */
+	void AllocateSlots(const SizeType capacity)
+	{
+		UM_ASSERT(FMath::IsPowerOfTwo(capacity) && capacity >= MinCapacity, "Hash table capacity must be a power of two");
+
+		m_ControlBytes = static_cast<int8*>(FMemory::Allocate(GetNumControlBytes(capacity)));
+		m_Slots = static_cast<ElementType*>(FMemory::AllocateArray(capacity, sizeof(ElementType)));
+		m_Capacity = capacity;
 
-			bucketHash = RehashHashCode(bucketHash);
-			bucketIndex = GetBucketIndexForHash(m_Buckets, bucketHash);
+		Fill(m_ControlBytes, GetNumControlBytes(capacity), Private::HashTableEmptyControl);
+	}
+
+	/**
+	 * @brief Finds the first empty slot at or after the slot a hash maps to.
+	 *
+	 * @param hash The hash.
+	 * @return The index of the empty slot.
+	 */
+	[[nodiscard]] SizeType FindEmptySlotForHash(const uint64 hash) const
+	{
+		const SizeType indexMask = m_Capacity - 1;
 
-			if (originalBucketIndex == bucketIndex && extraProbeCount > 0)
+		SizeType groupIndex = GetHomeIndexForHash(hash);
+		while (true)
+		{
+			const Private::FHashTableControlGroup group { m_ControlBytes + groupIndex };
+			if (const uint32 emptySlots = group.MatchEmpty())
 			{
-				bucketIndex = (bucketIndex + 1) % m_Buckets.GetCapacity();
-				--extraProbeCount;
+				return (groupIndex + std::countr_zero(emptySlots)) & indexMask;
 			}
-		}
-		while (originalBucketIndex != bucketIndex);
 
-		return nullptr;
+			groupIndex = (groupIndex + Private::HashTableGroupWidth) & indexMask;
+		}
 	}
 
 	/**
-	 * @brief Finds the bucket for a given value.
+	 * @brief Gets the number of slots needed to hold a number of items without exceeding the maximum load factor.
 	 *
-	 * @param value The value.
-	 * @return The bucket for \p value, or nullptr if one could not be found.
+	 * @param numItems The number of items.
+	 * @return The number of slots.
 	 */
-	[[nodiscard]] const BucketType* FindBucketForValue(const ElementType& value) const
+	[[nodiscard]] static SizeType GetCapacityForNumItems(const SizeType numItems)
 	{
-		return FindBucketByPredicate(GetHashCode(value), [&value](const BucketType& bucket, const uint64 bucketHash)
+		SizeType capacity = MinCapacity;
+		while (GetMaxNumItemsForCapacity(capacity) < numItems)
 		{
-			return bucket.CachedHash == bucketHash && bucket.HasValue() && TraitsType::Equals(bucket.GetValue(), value);
-		});
+			UM_ASSERT(capacity <= TNumericLimits<SizeType>::MaxValue / 2, "Attempting to grow hash table too large");
+			capacity *= 2;
+		}
+		return capacity;
 	}
 
 	/**
-	 * @brief Finds the bucket for a given value.
+	 * @brief Gets the control byte for a full slot whose element has the given hash.
 	 *
-	 * @param value The value.
-	 * @return The bucket for \p value, or nullptr if one could not be found.
+	 * @param hash The hash.
+	 * @return The control byte.
 	 */
-	[[nodiscard]] BucketType* FindBucketForValue(const ElementType& value)
+	[[nodiscard]] static int8 GetControlByteForHash(const uint64 hash)
 	{
-		return const_cast<BucketType*>(const_cast<const THashTable*>(this)->FindBucketForValue(value));
+		constexpr uint64 controlHashMask = (1ULL << Private::HashTableNumControlHashBits) - 1;
+		return static_cast<int8>(hash & controlHashMask);
 	}
 
 	/**
-	 * @brief Gets the bucket index for the given hash.
+	 * @brief Gets the index of the slot that probing starts at for a hash.
 	 *
-	 * @param buckets The bucket array.
 	 * @param hash The hash.
-	 * @return The bucket index for \p hash.
+	 * @return The slot index.
 	 */
-	[[nodiscard]] static int32 GetBucketIndexForHash(const TArray<BucketType>& buckets, const uint64 hash)
+	[[nodiscard]] SizeType GetHomeIndexForHash(const uint64 hash) const
 	{
-		const SizeType bucketCapacity = buckets.GetCapacity();
-		UM_ASSERT(bucketCapacity > 2, "Hash table has not yet been initialized");
+		// The low bits are already used by control bytes, so use the ones above them to pick the slot
+		return static_cast<SizeType>((hash >> Private::HashTableNumControlHashBits) & static_cast<uint64>(m_Capacity - 1));
+	}
 
-		return static_cast<int32>(hash % static_cast<uint64>(bucketCapacity));
+	/**
+	 * @brief Gets the maximum number of items a number of slots can contain before needing to grow.
+	 *
+	 * @param capacity The number of slots.
+	 * @return The maximum number of items.
+	 */
+	[[nodiscard]] static constexpr SizeType GetMaxNumItemsForCapacity(const SizeType capacity)
+	{
+		return capacity / 8 * MaxLoadFactorInEighths;
 	}
 
 	/**
-	 * @brief Grows a bucket array.
+	 * @brief Gets the number of control bytes allocated for a number of slots.
 	 *
-	 * @param buckets The bucket array.
+	 * @param capacity The number of slots.
+	 * @return The number of control bytes.
 	 */
-	static void GrowBucketsArray(TArray<BucketType>& buckets)
+	[[nodiscard]] static constexpr SizeType GetNumControlBytes(const SizeType capacity)
 	{
-		const SizeType previousCapacity = buckets.GetCapacity();
-		const SizeType nextCapacity = Private::GetNextPrime(previousCapacity * 2);
-		UM_ASSERT(nextCapacity > previousCapacity, "Attempting to grow hash table too large");
+		// The first group of control bytes is mirrored past the end so that probing can load a whole group at any slot
+		return capacity + Private::HashTableGroupWidth;
+	}
 
-		GrowBucketsArrayToCapacity(buckets, nextCapacity);
+	/**
+	 * @brief Gets the element in a full slot.
+	 *
+	 * @param index The slot index.
+	 * @return The element in the slot.
+	 */
+	[[nodiscard]] const ElementType& GetSlotElement(const SizeType index) const
+	{
+		UM_ASSERT(IsSlotFull(index), "Attempting to retrieve value from empty hash table slot");
+		return m_Slots[index];
+	}
+
+	/**
+	 * @brief Gets the element in a full slot.
+	 *
+	 * @param index The slot index.
+	 * @return The element in the slot.
+	 */
+	[[nodiscard]] ElementType& GetSlotElement(const SizeType index)
+	{
+		UM_ASSERT(IsSlotFull(index), "Attempting to retrieve value from empty hash table slot");
+		return m_Slots[index];
+	}
+
+	/**
+	 * @brief Checks to see if a slot holds an element.
+	 *
+	 * @param index The slot index.
+	 * @return True if the slot holds an element, otherwise false.
+	 */
+	[[nodiscard]] bool IsSlotFull(const SizeType index) const
+	{
+		return m_ControlBytes[index] >= 0;
 	}
 
 	/**
-	 * @brief Grows a bucket array.
+	 * @brief Moves every element into a new set of slots.
 	 *
-	 * @param buckets The bucket array.
+	 * @param newCapacity The new number of slots.
 	 */
-	static void GrowBucketsArrayToCapacity(TArray<BucketType>& buckets, const SizeType newCapacity)
+	void Rehash(const SizeType newCapacity)
 	{
-		UM_ASSERT(newCapacity > buckets.GetCapacity(), "Attempting to grow hash table with smaller capacity");
+		UM_ASSERT(GetMaxNumItemsForCapacity(newCapacity) >= m_NumItems, "Attempting to rehash hash table with too small a capacity");
 
-		// We do in fact want to SetNum here so that all the elements are default-constructed
-		TArray<BucketType> newBuckets;
-		newBuckets.SetNum(newCapacity);
+		int8* oldControlBytes = m_ControlBytes;
+		ElementType* oldSlots = m_Slots;
+		const SizeType oldCapacity = m_Capacity;
 
-		for (const BucketType& oldBucket : buckets)
+		AllocateSlots(newCapacity);
+
+		for (SizeType oldIndex = 0; oldIndex < oldCapacity; ++oldIndex)
 		{
-			if (oldBucket.HasValue() == false)
+			if (oldControlBytes[oldIndex] < 0)
 			{
 				continue;
 			}
 
-			(void)AddValueToBucketsArray(newBuckets, oldBucket.GetValue(), []
-			{
-				// Why shouldn't this array be growing you may ask?
-				// Because this one is at least 2x+1 times the size of our current buckets array :)
-				UM_ASSERT_NOT_REACHED_MSG("This bucket array should not be growing!");
-			});
+			ElementType& element = oldSlots[oldIndex];
+			const SizeType newIndex = FindEmptySlotForHash(GetHashCode(element));
+
+			FMemory::ConstructObjectAt<ElementType>(m_Slots + newIndex, MoveTemp(element));
+			FMemory::DestructObject(&element);
+			SetControlByte(newIndex, oldControlBytes[oldIndex]);
 		}
 
-		buckets = MoveTemp(newBuckets);
+		FMemory::Free(oldControlBytes);
+		FMemory::Free(oldSlots);
 	}
 
 	/**
-	 * @brief Re-hashes a hash code.
+	 * @brief Sets a slot's control byte, keeping the mirrored group of control bytes past the end up to date.
 	 *
-	 * @param hash The hash code to re-hash.
-	 * @return The re-hashed hash code.
+	 * @param index The slot index.
+	 * @param controlByte The new control byte.
 	 */
-	[[nodiscard]] static uint64 RehashHashCode(const uint64 hash)
+	void SetControlByte(const SizeType index, const int8 controlByte)
 	{
-		return Private::HashBytes({ reinterpret_cast<const uint8*>(&hash), sizeof(hash) });
+		m_ControlBytes[index] = controlByte;
+		if (index < Private::HashTableGroupWidth)
+		{
+			m_ControlBytes[m_Capacity + index] = controlByte;
+		}
 	}
 
-private:
+	/**
+	 * @brief Takes ownership of another hash table's elements, leaving it empty. Assumes this hash table is empty.
+	 *
+	 * @param other The other hash table.
+	 */
+	void TakeFrom(THashTable& other)
+	{
+		m_ControlBytes = other.m_ControlBytes;
+		m_Slots = other.m_Slots;
+		m_Capacity = other.m_Capacity;
+		m_NumItems = other.m_NumItems;
+
+		other.m_ControlBytes = nullptr;
+		other.m_Slots = nullptr;
+		other.m_Capacity = 0;
+		other.m_NumItems = 0;
+	}
 
-	TArray<BucketType> m_Buckets;
+	int8* m_ControlBytes = nullptr;
+	ElementType* m_Slots = nullptr;
+	SizeType m_Capacity = 0;
 	SizeType m_NumItems = 0;
 };
\ No newline at end of file
@@ -0,0 +1,156 @@
+#pragma once
+
+#include "Containers/StringView.h"
+#include "Engine/Hashing.h"
+#include "Meta/TypeInfo.h"
+#include "Misc/StringFormatting.h"
+#include "Templates/ComparisonTraits.h"
+#include "Templates/IsZeroConstructible.h"
+
+class FString;
+class FStringBuilder;
+
+/**
+ * @brief Defines an interned, case-sensitive identifier.
+ *
+ * A name is an index into a global, append-only table of strings plus an optional number suffix, so names are cheap to
+ * copy, compare, and hash no matter how long they are. The string "Actor_12" can be stored as the string "Actor" with
+ * the number 12, which lets many numbered names share a single table entry. The table is safe to use from any thread,
+ * and strings in it are never freed, so views of them stay valid for the lifetime of the program.
+ */
+class FName
+{
+public:
+
+	/**
+	 * @brief The number of a name that has no number suffix.
+	 */
+	static constexpr uint32 NoNumber = 0;
+
+	/**
+	 * @brief Creates the empty name.
+	 */
+	constexpr FName() = default;
+
+	/**
+	 * @brief Creates a name from a string. The string is used as is, even if it ends in what looks like a number suffix.
+	 *
+	 * @param name The name's string.
+	 */
+	explicit FName(FStringView name);
+
+	/**
+	 * @brief Creates a name from a string and a number suffix.
+	 *
+	 * @param plainName The name's string, not including the number suffix.
+	 * @param number The number suffix, or NoNumber if the name should not have one.
+	 */
+	FName(FStringView plainName, uint32 number);
+
+	/**
+	 * @brief Compares this name to another name by their strings. This is much slower than checking for equality.
+	 *
+	 * @param other The other name.
+	 * @return The result of the comparison.
+	 */
+	[[nodiscard]] ECompareResult Compare(FName other) const;
+
+	/**
+	 * @brief Appends this name to a string builder.
+	 *
+	 * @param builder The string builder.
+	 */
+	void AppendToStringBuilder(FStringBuilder& builder) const;
+
+	/**
+	 * @brief Gets this name's number suffix.
+	 *
+	 * @return This name's number suffix, or NoNumber if this name does not have one.
+	 */
+	[[nodiscard]] constexpr uint32 GetNumber() const
+	{
+		return m_Number;
+	}
+
+	/**
+	 * @brief Gets this name's string without its number suffix.
+	 *
+	 * @return This name's string without its number suffix.
+	 */
+	[[nodiscard]] FStringView GetPlainName() const;
+
+	/**
+	 * @brief Checks to see if this is the empty name.
+	 *
+	 * @return True if this is the empty name, otherwise false.
+	 */
+	[[nodiscard]] constexpr bool IsNone() const
+	{
+		return m_Index == 0 && m_Number == NoNumber;
+	}
+
+	/**
+	 * @brief Builds this name's full string, including the number suffix.
+	 *
+	 * @return This name's full string.
+	 */
+	[[nodiscard]] FString ToString() const;
+
+	/**
+	 * @brief Gets the hash code for a name.
+	 *
+	 * @param value The name.
+	 * @return The hash code for \p value.
+	 */
+	[[nodiscard]] friend constexpr uint64 GetHashCode(const FName value)
+	{
+		return Private::HashInteger((static_cast<uint64>(value.m_Index) << 32) | value.m_Number);
+	}
+
+	[[nodiscard]] constexpr bool operator==(const FName other) const
+	{
+		return m_Index == other.m_Index && m_Number == other.m_Number;
+	}
+
+	[[nodiscard]] constexpr bool operator!=(const FName other) const
+	{
+		return operator==(other) == false;
+	}
+
+private:
+
+	uint32 m_Index = 0;
+	uint32 m_Number = NoNumber;
+};
+
+template<>
+struct TIsZeroConstructible<FName> : FTrueType
+{
+};
+
+template<>
+class TComparisonTraits<FName>
+{
+public:
+
+	using Type = FName;
+
+	static ECompareResult Compare(const FName left, const FName right)
+	{
+		return left.Compare(right);
+	}
+
+	static bool Equals(const FName first, const FName second)
+	{
+		return first == second;
+	}
+};
+
+DECLARE_PRIMITIVE_TYPE_DEFINITION(FName);
+
+template<>
+struct TFormatter<FName>
+{
+	void BuildString(const FName& value, FStringBuilder& builder) const;
+	bool Parse(FStringView formatString);
+};
\ No newline at end of file
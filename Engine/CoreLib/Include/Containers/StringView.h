@@ -329,7 +329,8 @@ public:
 	 */
 	[[nodiscard]] bool Equals(const FStringView other, EIgnoreCase ignoreCase = EIgnoreCase::No) const
 	{
-		return Compare(other, ignoreCase) == ECompareResult::Equals;
+		// Ordinal comparisons can only be equal if the lengths are, which saves comparing any characters at all
+		return Length() == other.Length() && Compare(other, ignoreCase) == ECompareResult::Equals;
 	}
 
 	/**
@@ -784,7 +785,7 @@ public:
  * @param value The string.
  * @return The hash code.
  */
-inline uint64 GetHashCode(const FStringView& value)
+constexpr uint64 GetHashCode(const FStringView& value)
 {
 	return GetHashCode(value.AsSpan());
 }
@@ -9,20 +9,199 @@
 #include "Templates/NumericLimits.h"
 #include "Templates/UnderlyingType.h"
 #include "Templates/VariadicTraits.h"
+#include <bit>
+#include <cstring>
+#include <type_traits>
 
 enum : uint64 { INVALID_HASH = static_cast<uint64>(-1) };
 
 namespace Private
 {
+	// Hashing is using the wyhash algorithm https://github.com/wangyi-fudan/wyhash
+	constexpr uint64 HashSecret0 = 0x2d358dccaa6c78a5ULL;
+	constexpr uint64 HashSecret1 = 0x8bb84b93962eacc9ULL;
+	constexpr uint64 HashSecret2 = 0x4b33a62ed433d4a3ULL;
+	constexpr uint64 HashSecret3 = 0x4d5a2da51de1aa47ULL;
+
+	/**
+	 * @brief The seed used when hashing bytes without an explicit seed.
+	 */
+	constexpr uint64 DefaultHashSeed = 0;
+
+	/**
+	 * @brief Multiplies two 64-bit values into a 128-bit value.
+	 *
+	 * @param first The first value. Receives the low 64 bits of the product.
+	 * @param second The second value. Receives the high 64 bits of the product.
+	 */
+	constexpr void MultiplyHashWords(uint64& first, uint64& second)
+	{
+#if defined(__SIZEOF_INT128__)
+		__extension__ using FUInt128 = unsigned __int128;
+		const FUInt128 product = static_cast<FUInt128>(first) * second;
+		first = static_cast<uint64>(product);
+		second = static_cast<uint64>(product >> 64);
+#else
+		const uint64 firstHigh = first >> 32;
+		const uint64 firstLow = first & 0xFFFF'FFFFULL;
+		const uint64 secondHigh = second >> 32;
+		const uint64 secondLow = second & 0xFFFF'FFFFULL;
+
+		const uint64 highHigh = firstHigh * secondHigh;
+		const uint64 highLow = firstHigh * secondLow;
+		const uint64 lowHigh = firstLow * secondHigh;
+		const uint64 lowLow = firstLow * secondLow;
+
+		const uint64 middle = (lowLow >> 32) + (highLow & 0xFFFF'FFFFULL) + (lowHigh & 0xFFFF'FFFFULL);
+		first = (middle << 32) | (lowLow & 0xFFFF'FFFFULL);
+		second = highHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32);
+#endif
+	}
+
+	/**
+	 * @brief Mixes two 64-bit values together by folding their 128-bit product.
+	 *
+	 * @param first The first value.
+	 * @param second The second value.
+	 * @return The mixed value.
+	 */
+	[[nodiscard]] constexpr uint64 MixHashWords(uint64 first, uint64 second)
+	{
+		MultiplyHashWords(first, second);
+		return first ^ second;
+	}
+
+	/**
+	 * @brief Reads a little-endian word from a sequence of bytes.
+	 *
+	 * @tparam NumBytes The number of bytes in the word.
+	 * @tparam ByteType The byte type.
+	 * @param bytes The bytes to read from.
+	 * @return The word.
+	 */
+	template<int32 NumBytes, typename ByteType>
+	[[nodiscard]] constexpr uint64 ReadHashWord(const ByteType* bytes)
+		requires(sizeof(ByteType) == 1 && (NumBytes == 4 || NumBytes == 8))
+	{
+		if (std::is_constant_evaluated() == false)
+		{
+			// Every platform we support is little-endian, so a plain load reads the same word as the loop below
+			if constexpr (NumBytes == 8)
+			{
+				uint64 word = 0;
+				std::memcpy(&word, bytes, sizeof(word));
+				return word;
+			}
+			else
+			{
+				uint32 word = 0;
+				std::memcpy(&word, bytes, sizeof(word));
+				return word;
+			}
+		}
+
+		uint64 word = 0;
+		for (int32 idx = 0; idx < NumBytes; ++idx)
+		{
+			word |= static_cast<uint64>(static_cast<uint8>(bytes[idx])) << (idx * 8);
+		}
+		return word;
+	}
+
+	/**
+	 * @brief Hashes a sequence of bytes. Can be evaluated at compile time, and gives the same result at run time.
+	 *
+	 * @tparam ByteType The byte type.
+	 * @param bytes The bytes to hash.
+	 * @param numBytes The number of bytes to hash.
+	 * @param seed The seed to hash with.
+	 * @return The hash code.
+	 */
+	template<typename ByteType>
+	[[nodiscard]] constexpr uint64 HashByteSequence(const ByteType* bytes, const int32 numBytes, uint64 seed)
+		requires(sizeof(ByteType) == 1)
+	{
+		const uint64 length = static_cast<uint64>(numBytes);
+		seed ^= MixHashWords(seed ^ HashSecret0, HashSecret1);
+
+		uint64 first = 0;
+		uint64 second = 0;
+		if (numBytes <= 16)
+		{
+			if (numBytes >= 4)
+			{
+				// Reads four possibly overlapping words that together cover every byte
+				const int32 offset = (numBytes >> 3) << 2;
+				first = (ReadHashWord<4>(bytes) << 32) | ReadHashWord<4>(bytes + offset);
+				second = (ReadHashWord<4>(bytes + numBytes - 4) << 32) | ReadHashWord<4>(bytes + numBytes - 4 - offset);
+			}
+			else if (numBytes > 0)
+			{
+				first = (static_cast<uint64>(static_cast<uint8>(bytes[0])) << 16) |
+				        (static_cast<uint64>(static_cast<uint8>(bytes[numBytes >> 1])) << 8) |
+				        static_cast<uint64>(static_cast<uint8>(bytes[numBytes - 1]));
+			}
+		}
+		else
+		{
+			int32 numBytesLeft = numBytes;
+			if (numBytesLeft >= 48)
+			{
+				// Three independent lanes keep the multipliers busy on longer inputs
+				uint64 secondSeed = seed;
+				uint64 thirdSeed = seed;
+				do
+				{
+					seed = MixHashWords(ReadHashWord<8>(bytes) ^ HashSecret1, ReadHashWord<8>(bytes + 8) ^ seed);
+					secondSeed = MixHashWords(ReadHashWord<8>(bytes + 16) ^ HashSecret2, ReadHashWord<8>(bytes + 24) ^ secondSeed);
+					thirdSeed = MixHashWords(ReadHashWord<8>(bytes + 32) ^ HashSecret3, ReadHashWord<8>(bytes + 40) ^ thirdSeed);
+					bytes += 48;
+					numBytesLeft -= 48;
+				}
+				while (numBytesLeft >= 48);
+
+				seed ^= secondSeed ^ thirdSeed;
+			}
+
+			while (numBytesLeft > 16)
+			{
+				seed = MixHashWords(ReadHashWord<8>(bytes) ^ HashSecret1, ReadHashWord<8>(bytes + 8) ^ seed);
+				bytes += 16;
+				numBytesLeft -= 16;
+			}
+
+			first = ReadHashWord<8>(bytes + numBytesLeft - 16);
+			second = ReadHashWord<8>(bytes + numBytesLeft - 8);
+		}
+
+		first ^= HashSecret1;
+		second ^= seed;
+		MultiplyHashWords(first, second);
+
+		return MixHashWords(first ^ HashSecret0 ^ length, second ^ HashSecret1);
+	}
+
 	/**
 	 * @brief Hashes a byte array with an initial hash value.
 	 *
+	 * @remarks Equivalent to HashBytesWithSeed, using the initial hash as the seed.
+	 *
 	 * @param bytes The byte array.
 	 * @param initialHash The initial hash.
 	 * @return The hash code.
 	 */
 	uint64 HashBytesWithInitialHash(TSpan<const uint8> bytes, uint64 initialHash);
 
+	/**
+	 * @brief Hashes a byte array with a seed. Using a seed that is not known ahead of time protects hash tables from
+	 *        inputs crafted to make their hashes collide.
+	 *
+	 * @param bytes The byte array.
+	 * @param seed The seed.
+	 * @return The hash code.
+	 */
+	uint64 HashBytesWithSeed(TSpan<const uint8> bytes, uint64 seed);
+
 	/**
 	 * @brief Hashes a byte array.
 	 *
@@ -32,13 +211,31 @@ namespace Private
 	uint64 HashBytes(TSpan<const uint8> bytes);
 
 	/**
-	 * @brief Combines two hash codes.
+	 * @brief Combines two hash codes. The order of the hash codes matters.
 	 *
 	 * @param firstHash The first hash code.
 	 * @param secondHash The second hash code.
 	 * @return The combined hash.
 	 */
-	uint64 HashCombine(uint64 firstHash, uint64 secondHash); // TODO Rename to CombineHashCodes
+	[[nodiscard]] constexpr uint64 HashCombine(const uint64 firstHash, const uint64 secondHash) // TODO Rename to CombineHashCodes
+	{
+		uint64 first = firstHash ^ HashSecret0;
+		uint64 second = secondHash ^ HashSecret1;
+		MultiplyHashWords(first, second);
+
+		return MixHashWords(first ^ HashSecret0, second ^ HashSecret1);
+	}
+
+	/**
+	 * @brief Hashes an integer value.
+	 *
+	 * @param value The value, widened to 64 bits.
+	 * @return The hash code.
+	 */
+	[[nodiscard]] constexpr uint64 HashInteger(const uint64 value)
+	{
+		return HashCombine(value, HashSecret2);
+	}
 
 	/**
 	 * @brief Casts a POD type to bytes.
@@ -77,9 +274,9 @@ namespace Private
  * @param value The value.
  * @return The hash code.
  */
-inline uint64 GetHashCode(const int8 value)
+constexpr uint64 GetHashCode(const int8 value)
 {
-	return Private::HashBytes(Private::CastToBytes(value));
+	return Private::HashInteger(static_cast<uint64>(value));
 }
 
 /**
@@ -88,9 +285,9 @@ inline uint64 GetHashCode(const int8 value)
  * @param value The value.
  * @return The hash code.
  */
-inline uint64 GetHashCode(const int16 value)
+constexpr uint64 GetHashCode(const int16 value)
 {
-	return Private::HashBytes(Private::CastToBytes(value));
+	return Private::HashInteger(static_cast<uint64>(value));
 }
 
 /**
@@ -99,9 +296,9 @@ inline uint64 GetHashCode(const int16 value)
  * @param value The value.
  * @return The hash code.
  */
-inline uint64 GetHashCode(const int32 value)
+constexpr uint64 GetHashCode(const int32 value)
 {
-	return Private::HashBytes(Private::CastToBytes(value));
+	return Private::HashInteger(static_cast<uint64>(value));
 }
 
 /**
@@ -110,9 +307,9 @@ inline uint64 GetHashCode(const int32 value)
  * @param value The value.
  * @return The hash code.
  */
-inline uint64 GetHashCode(const int64 value)
+constexpr uint64 GetHashCode(const int64 value)
 {
-	return Private::HashBytes(Private::CastToBytes(value));
+	return Private::HashInteger(static_cast<uint64>(value));
 }
 
 /**
@@ -121,9 +318,9 @@ inline uint64 GetHashCode(const int64 value)
  * @param value The value.
  * @return The hash code.
  */
-inline uint64 GetHashCode(const uint8 value)
+constexpr uint64 GetHashCode(const uint8 value)
 {
-	return Private::HashBytes(Private::CastToBytes(value));
+	return Private::HashInteger(static_cast<uint64>(value));
 }
 
 /**
@@ -132,9 +329,9 @@ inline uint64 GetHashCode(const uint8 value)
  * @param value The value.
  * @return The hash code.
  */
-inline uint64 GetHashCode(const uint16 value)
+constexpr uint64 GetHashCode(const uint16 value)
 {
-	return Private::HashBytes(Private::CastToBytes(value));
+	return Private::HashInteger(static_cast<uint64>(value));
 }
 
 /**
@@ -143,9 +340,9 @@ inline uint64 GetHashCode(const uint16 value)
  * @param value The value.
  * @return The hash code.
  */
-inline uint64 GetHashCode(const uint32 value)
+constexpr uint64 GetHashCode(const uint32 value)
 {
-	return Private::HashBytes(Private::CastToBytes(value));
+	return Private::HashInteger(static_cast<uint64>(value));
 }
 
 /**
@@ -154,9 +351,9 @@ inline uint64 GetHashCode(const uint32 value)
  * @param value The value.
  * @return The hash code.
  */
-inline uint64 GetHashCode(const uint64 value)
+constexpr uint64 GetHashCode(const uint64 value)
 {
-	return Private::HashBytes(Private::CastToBytes(value));
+	return Private::HashInteger(static_cast<uint64>(value));
 }
 
 /**
@@ -165,9 +362,9 @@ inline uint64 GetHashCode(const uint64 value)
  * @param value The value.
  * @return The hash code.
  */
-inline uint64 GetHashCode(const float value)
+constexpr uint64 GetHashCode(const float value)
 {
-	return Private::HashBytes(Private::CastToBytes(value));
+	return Private::HashInteger(std::bit_cast<uint32>(value));
 }
 
 /**
@@ -176,9 +373,9 @@ inline uint64 GetHashCode(const float value)
  * @param value The value.
  * @return The hash code.
  */
-inline uint64 GetHashCode(const double value)
+constexpr uint64 GetHashCode(const double value)
 {
-	return Private::HashBytes(Private::CastToBytes(value));
+	return Private::HashInteger(std::bit_cast<uint64>(value));
 }
 
 /**
@@ -187,9 +384,9 @@ inline uint64 GetHashCode(const double value)
  * @param value The value.
  * @return The hash code.
  */
-inline uint64 GetHashCode(const char value)
+constexpr uint64 GetHashCode(const char value)
 {
-	return static_cast<uint64>(value);
+	return Private::HashInteger(static_cast<uint64>(value));
 }
 
 /**
@@ -198,9 +395,9 @@ inline uint64 GetHashCode(const char value)
  * @param value The value.
  * @return The hash code.
  */
-inline uint64 GetHashCode(const char8_t value)
+constexpr uint64 GetHashCode(const char8_t value)
 {
-	return Private::HashBytes(Private::CastToBytes(value));
+	return Private::HashInteger(static_cast<uint64>(value));
 }
 
 /**
@@ -209,9 +406,9 @@ inline uint64 GetHashCode(const char8_t value)
  * @param value The value.
  * @return The hash code.
  */
-inline uint64 GetHashCode(const char16_t value)
+constexpr uint64 GetHashCode(const char16_t value)
 {
-	return Private::HashBytes(Private::CastToBytes(value));
+	return Private::HashInteger(static_cast<uint64>(value));
 }
 
 /**
@@ -220,9 +417,9 @@ inline uint64 GetHashCode(const char16_t value)
  * @param value The value.
  * @return The hash code.
  */
-inline uint64 GetHashCode(const char32_t value)
+constexpr uint64 GetHashCode(const char32_t value)
 {
-	return Private::HashBytes(Private::CastToBytes(value));
+	return Private::HashInteger(static_cast<uint64>(value));
 }
 
 /**
@@ -231,9 +428,9 @@ inline uint64 GetHashCode(const char32_t value)
  * @param value The value.
  * @return The hash code.
  */
-inline uint64 GetHashCode(const wchar_t value)
+constexpr uint64 GetHashCode(const wchar_t value)
 {
-	return Private::HashBytes(Private::CastToBytes(value));
+	return Private::HashInteger(static_cast<uint64>(value));
 }
 
 /**
@@ -256,11 +453,11 @@ inline uint64 GetHashCode(const void* value)
  * @return The hash code.
  */
 template<typename EnumType>
-inline uint64 GetHashCode(const EnumType value)
+constexpr uint64 GetHashCode(const EnumType value)
 	requires TIsEnum<EnumType>::Value
 {
 	const auto valueAsUnderlying = static_cast<typename TUnderlyingType<EnumType>::Type>(value);
-	return GetHashCode(Private::CastToBytes(valueAsUnderlying));
+	return Private::HashInteger(static_cast<uint64>(valueAsUnderlying));
 }
 
 /**
@@ -287,6 +484,29 @@ inline uint64 GetHashCode(const TSpan<const T> value)
 	return hash;
 }
 
+/**
+ * @brief Gets the hash code for the given span of characters. The characters are hashed as one sequence of bytes rather
+ *        than one character at a time.
+ *
+ * @tparam T The character type.
+ * @param value The span of characters.
+ * @return The hash code.
+ */
+template<typename T>
+constexpr uint64 GetHashCode(const TSpan<const T> value)
+	requires TIsChar<T>::Value
+{
+	if constexpr (sizeof(T) == 1)
+	{
+		if (std::is_constant_evaluated())
+		{
+			return Private::HashByteSequence(value.GetData(), value.Num(), Private::DefaultHashSeed);
+		}
+	}
+
+	return Private::HashBytes(Private::CastToBytes(value));
+}
+
 // TODO Rename the below overloads to HashCombine or just make them overloads of GetHashCode
 
 /**
@@ -62,6 +62,23 @@ namespace Private
 		 */
 		static ELogLevel GetLogLevel();
 
+		/**
+		 * @brief Checks to see if log messages are written asynchronously.
+		 *
+		 * @return True if log messages are written asynchronously, otherwise false.
+		 */
+		static bool IsAsyncLoggingEnabled();
+
+		/**
+		 * @brief Sets whether or not log messages are written asynchronously. When enabled, logging a message only copies
+		 *        it and its arguments into a buffer owned by the calling thread, and a background thread formats and writes
+		 *        messages in batches. Assertions and fatal errors are always written before returning, along with anything
+		 *        logged before them. Also enabled by passing -asynclog on the command line.
+		 *
+		 * @param enabled True to write log messages asynchronously, false to write them on the calling thread.
+		 */
+		static void SetAsyncLoggingEnabled(bool enabled);
+
 		/**
 		 * @brief Sets the lowest log level allowed to be printed.
 		 *
@@ -110,8 +127,16 @@ namespace Private
 		template<typename... ArgTypes>
 		void Write(const ELogLevel logLevel, const FStringView message, ArgTypes&&... messageArgs)
 		{
-			TArray<Private::FStringFormatArgument> formatArgs = Private::MakeFormatArgumentArray(Forward<ArgTypes>(messageArgs)...);
-			WriteImpl(logLevel, message, formatArgs.AsSpan());
+			if constexpr (sizeof...(ArgTypes) == 0)
+			{
+				WriteImpl(logLevel, message, {});
+			}
+			else
+			{
+				// Logging is frequent enough that the arguments are kept on the stack instead of in a heap allocated array
+				Private::FStringFormatArgument formatArgs[] { Private::FStringFormatArgument(Forward<ArgTypes>(messageArgs))... };
+				WriteImpl(logLevel, message, TSpan<Private::FStringFormatArgument> { formatArgs, static_cast<int32>(sizeof...(ArgTypes)) });
+			}
 		}
 
 	protected:
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Containers/Array.h"
+#include "HAL/FileStream.h"
+#include "Memory/SharedPtr.h"
+
+/**
+ * @brief Defines a file stream that buffers another file stream. Reads are served from a read-ahead buffer and writes
+ *        are gathered into a write-back buffer, so the underlying stream only sees large, infrequent calls.
+ */
+class FBufferedFileStream final : public IFileStream
+{
+	friend class FMemory;
+
+public:
+
+	/**
+	 * @brief The default size, in bytes, of a buffered file stream's buffer.
+	 */
+	static constexpr int32 DefaultBufferSize = 64 * 1024;
+
+	/**
+	 * @brief Sets default values for this buffered file stream's properties.
+	 *
+	 * @param stream The stream to buffer. Must be open.
+	 * @param accessMode The stream's access mode.
+	 * @param openMode The stream's open mode.
+	 * @param bufferSize The size, in bytes, of the buffer.
+	 */
+	FBufferedFileStream(TSharedPtr<IFileStream> stream, EFileAccess accessMode, EFileMode openMode, int32 bufferSize = DefaultBufferSize);
+
+	/**
+	 * @brief Destroys this buffered file stream.
+	 */
+	virtual ~FBufferedFileStream() override;
+
+	/** @copydoc IFileStream::Close */
+	virtual void Close() override;
+
+	/** @copydoc IFileStream::Flush */
+	virtual void Flush() override;
+
+	/**
+	 * @brief Gets the size, in bytes, of this stream's buffer.
+	 *
+	 * @return The size, in bytes, of this stream's buffer.
+	 */
+	[[nodiscard]] int32 GetBufferSize() const
+	{
+		return m_BufferSize;
+	}
+
+	/** @copydoc IFileStream::GetLength */
+	virtual int64 GetLength() const override;
+
+	/** @copydoc IFileStream::IsAtEnd */
+	virtual bool IsAtEnd() const override;
+
+	/** @copydoc IFileStream::IsOpen */
+	virtual bool IsOpen() const override;
+
+	/** @copydoc IFileStream::Read */
+	virtual void Read(void* data, uint64 dataSize) override;
+
+	/** @copydoc IFileStream::Seek */
+	virtual void Seek(ESeekOrigin origin, int64 offset) override;
+
+	/** @copydoc IFileStream::Sync */
+	virtual void Sync() override;
+
+	/** @copydoc IFileStream::Tell */
+	virtual int64 Tell() const override;
+
+	/** @copydoc IFileStream::Write */
+	virtual void Write(const void* data, uint64 dataSize) override;
+
+	using IFileStream::Write;
+
+private:
+
+	/**
+	 * @brief Refills the read buffer from the underlying stream.
+	 */
+	void FillReadBuffer();
+
+	/**
+	 * @brief Writes everything in the write buffer to the underlying stream.
+	 */
+	void FlushWriteBuffer();
+
+	TSharedPtr<IFileStream> m_Stream;
+	TArray<uint8> m_Buffer;
+	int64 m_StreamPosition = 0;
+	int32 m_BufferSize = DefaultBufferSize;
+	int32 m_ReadOffset = 0;
+};
\ No newline at end of file
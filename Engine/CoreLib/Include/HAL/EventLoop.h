@@ -1,10 +1,13 @@
 #pragma once
 
 #include "Containers/Array.h"
+#include "Containers/Function.h"
 #include "Memory/EnabledSharedFromThis.h"
 #include "Memory/SharedPtr.h"
 #include "Memory/UniquePtr.h"
 #include "Misc/Badge.h"
+#include "Threading/Mutex.h"
+#include <atomic>
 
 class FEventLoop;
 
@@ -76,6 +79,8 @@ class FEventLoop final : public TEnableSharedFromThis<FEventLoop>
 
 public:
 
+	using FPostedFunction = TFunction<void()>;
+
 	/**
 	 * @brief Sets default values for this event loop's properties.
 	 *
@@ -127,11 +132,11 @@ public:
 	/**
 	 * @brief Checks to see if this event loop is empty.
 	 *
-	 * @return True if there are no tasks being run in this event loop, otherwise false.
+	 * @return True if there are no tasks being run or functions waiting to be run in this event loop, otherwise false.
 	 */
 	[[nodiscard]] bool IsEmpty() const
 	{
-		return m_Tasks.IsEmpty();
+		return m_Tasks.IsEmpty() && m_NumPostedFunctions.load(std::memory_order_acquire) == 0;
 	}
 
 	/**
@@ -141,7 +146,7 @@ public:
 	 */
 	[[nodiscard]] bool IsRunning() const
 	{
-		return m_Tasks.Num() > 0;
+		return IsEmpty() == false;
 	}
 
 	/**
@@ -159,6 +164,13 @@ public:
 	 */
 	void PollTasks();
 
+	/**
+	 * @brief Posts a function to be run on the thread that polls this event loop. May be called from any thread.
+	 *
+	 * @param function The function to run.
+	 */
+	void Post(FPostedFunction function);
+
 	/**
 	 * @brief Removes the given task from this event loop.
 	 *
@@ -180,6 +192,14 @@ private:
 	 */
 	void RegisterTask(TSharedPtr<IEventTask> task);
 
+	/**
+	 * @brief Runs all functions that have been posted to this event loop so far.
+	 */
+	void RunPostedFunctions();
+
 	TArray<TSharedPtr<IEventTask>> m_Tasks;
 	FLoopHandle m_Loop;
+	FMutex m_PostedFunctionsMutex;
+	TArray<FPostedFunction> m_PostedFunctions;
+	std::atomic<int32> m_NumPostedFunctions = 0;
 };
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "HAL/DateTime.h"
 #include "Engine/Error.h"
 #include "HAL/FileStream.h"
+#include "Threading/AsyncTask.h"
 
 class FEventLoop;
 
@@ -125,6 +126,15 @@ public:
 	 */
 	static void ReadBytesAsync(FStringView filePath, const TSharedPtr<FEventLoop>& eventLoop, FReadBytesCallback callback, FErrorCallback errorCallback);
 
+	/**
+	 * @brief Reads a file as an array of bytes asynchronously.
+	 *
+	 * @param filePath The path of the file to read.
+	 * @param eventLoop The event loop to queue the read operation to.
+	 * @returns The task that finishes with the file's bytes, or an error if one occurred.
+	 */
+	[[nodiscard]] static TAsyncTask<TArray<uint8>> ReadBytesAsync(FStringView filePath, const TSharedPtr<FEventLoop>& eventLoop);
+
 	/**
 	 * @brief Attempts to read all lines of text from a file.
 	 *
@@ -161,6 +171,15 @@ public:
 	 */
 	static void ReadTextAsync(FStringView filePath, const TSharedPtr<FEventLoop>& eventLoop, FReadTextCallback callback, FErrorCallback errorCallback);
 
+	/**
+	 * @brief Reads a file as a string asynchronously.
+	 *
+	 * @param filePath The path of the file to read.
+	 * @param eventLoop The event loop to queue the read operation to.
+	 * @returns The task that finishes with the file's text, or an error if one occurred.
+	 */
+	[[nodiscard]] static TAsyncTask<FString> ReadTextAsync(FStringView filePath, const TSharedPtr<FEventLoop>& eventLoop);
+
 	/**
 	 * @brief Attempts to stat a file.
 	 *
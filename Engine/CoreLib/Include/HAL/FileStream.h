@@ -72,7 +72,8 @@ public:
 	virtual void Close() = 0;
 
 	/**
-	 * @brief Flushes this file stream.
+	 * @brief Flushes this file stream, handing anything it has buffered to the OS. This does not wait for the data to
+	 *        reach the disk; use Sync for that.
 	 */
 	virtual void Flush() = 0;
 
@@ -120,6 +121,12 @@ public:
 	 */
 	virtual void Seek(ESeekOrigin origin, int64 offset) = 0;
 
+	/**
+	 * @brief Flushes this file stream and then waits for the OS to write everything to the disk. This is comparatively
+	 *        slow, so it should only be used when the data needs to survive a crash or power loss.
+	 */
+	virtual void Sync() = 0;
+
 	/**
 	 * @brief Gets this stream's current position.
 	 *
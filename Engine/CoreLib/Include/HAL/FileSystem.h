@@ -2,6 +2,7 @@
 
 #include "Containers/StringView.h"
 #include "Engine/Error.h"
+#include "HAL/BufferedFileStream.h"
 #include "HAL/FileStream.h"
 #include "Memory/SharedPtr.h"
 #include "Misc/Badge.h"
@@ -52,22 +53,24 @@ public:
 	 * @brief Attempts to open a file for reading.
 	 *
 	 * @param path The path to the file.
+	 * @param bufferSize The size, in bytes, of the stream's read-ahead buffer. Zero opens the file unbuffered.
 	 * @return The file stream, or nullptr if the file could not be opened.
 	 */
-	[[nodiscard]] static TSharedPtr<IFileStream> OpenRead(FStringView path)
+	[[nodiscard]] static TSharedPtr<IFileStream> OpenRead(FStringView path, int32 bufferSize = FBufferedFileStream::DefaultBufferSize)
 	{
-		return Open(path, EFileMode::Open, EFileAccess::Read);
+		return Open(path, EFileMode::Open, EFileAccess::Read, bufferSize);
 	}
 
 	/**
 	 * @brief Attempts to open a file for writing.
 	 *
 	 * @param path The path to the file.
+	 * @param bufferSize The size, in bytes, of the stream's write-back buffer. Zero opens the file unbuffered.
 	 * @return The file stream, or nullptr if the file could not be opened.
 	 */
-	[[nodiscard]] static TSharedPtr<IFileStream> OpenWrite(FStringView path)
+	[[nodiscard]] static TSharedPtr<IFileStream> OpenWrite(FStringView path, int32 bufferSize = FBufferedFileStream::DefaultBufferSize)
 	{
-		return Open(path, EFileMode::Create, EFileAccess::Write);
+		return Open(path, EFileMode::Create, EFileAccess::Write, bufferSize);
 	}
 
 	/**
@@ -87,7 +90,8 @@ private:
 	 * @param path The path to the file.
 	 * @param mode The file open mode.
 	 * @param access The file access mode.
+	 * @param bufferSize The size, in bytes, of the stream's buffer. Zero opens the file unbuffered.
 	 * @return The file stream, or nullptr if the file could not be opened.
 	 */
-	[[nodiscard]] static TSharedPtr<IFileStream> Open(FStringView path, EFileMode mode, EFileAccess access);
+	[[nodiscard]] static TSharedPtr<IFileStream> Open(FStringView path, EFileMode mode, EFileAccess access, int32 bufferSize);
 };
\ No newline at end of file
@@ -0,0 +1,168 @@
+#pragma once
+
+#include "Engine/IntTypes.h"
+#include "Engine/MiscMacros.h"
+#include "Engine/Platform.h"
+#include "Memory/Memory.h"
+#include "Templates/IsDestructible.h"
+
+/**
+ * @brief Defines a bump allocator that hands out memory from large blocks and frees it all at once.
+ *
+ * Allocations only move a pointer forward, and nothing is freed until the allocator is reset or destroyed, so this is
+ * meant for many small, short-lived allocations that all share one lifetime. Objects are never destructed, so only
+ * trivially destructible types should be placed in a linear allocator. Memory handed out by an allocator stays where
+ * it is when the allocator is moved.
+ */
+class FLinearAllocator final
+{
+	UM_DISABLE_COPY(FLinearAllocator);
+
+public:
+
+	using SizeType = FMemory::SizeType;
+
+	/**
+	 * @brief The default size of the first block an allocator reserves.
+	 */
+	static constexpr SizeType DefaultBlockSize = 64 * 1024;
+
+	/**
+	 * @brief The largest size a block will grow to, unless a single allocation needs more.
+	 */
+	static constexpr SizeType MaxBlockSize = 16 * 1024 * 1024;
+
+	/**
+	 * @brief Sets default values for this allocator's properties.
+	 */
+	FLinearAllocator() = default;
+
+	/**
+	 * @brief Sets default values for this allocator's properties.
+	 *
+	 * @param initialBlockSize The size of the first block to reserve. Each block after it is twice as large as the one
+	 *                         before it, up to MaxBlockSize.
+	 */
+	explicit FLinearAllocator(SizeType initialBlockSize);
+
+	/**
+	 * @brief Assumes ownership of another allocator's blocks.
+	 *
+	 * @param other The other allocator.
+	 */
+	FLinearAllocator(FLinearAllocator&& other) noexcept;
+
+	/**
+	 * @brief Destroys this allocator, freeing all of its blocks.
+	 */
+	~FLinearAllocator();
+
+	/**
+	 * @brief Allocates zeroed memory.
+	 *
+	 * @param numBytes The number of bytes to allocate.
+	 * @param alignment The alignment of the memory. Must be a power of two.
+	 * @return The allocated memory.
+	 */
+	[[nodiscard]] void* Allocate(const SizeType numBytes, const SizeType alignment = alignof(void*))
+	{
+		const uintptr alignmentMask = static_cast<uintptr>(alignment) - 1;
+		uint8* result = reinterpret_cast<uint8*>((reinterpret_cast<uintptr>(m_Cursor) + alignmentMask) & ~alignmentMask);
+
+		if (UNLIKELY(result == nullptr || m_End - result < numBytes))
+		{
+			return AllocateFromNewBlock(numBytes, alignment);
+		}
+
+		m_Cursor = result + numBytes;
+		m_NumBytesAllocated += numBytes;
+
+		return result;
+	}
+
+	/**
+	 * @brief Allocates an array of zero-initialized elements.
+	 *
+	 * @tparam ElementType The element type.
+	 * @param numElements The number of elements to allocate.
+	 * @return The allocated elements.
+	 */
+	template<typename ElementType>
+	[[nodiscard]] ElementType* AllocateArray(const SizeType numElements)
+	{
+		static_assert(IsTriviallyDestructible<ElementType>, "Linear allocators never destruct what they allocate");
+
+		return static_cast<ElementType*>(Allocate(numElements * static_cast<SizeType>(sizeof(ElementType)), alignof(ElementType)));
+	}
+
+	/**
+	 * @brief Allocates and constructs an object.
+	 *
+	 * @tparam ElementType The object type.
+	 * @tparam ConstructTypes The types of the arguments to construct the object with.
+	 * @param args The arguments to construct the object with.
+	 * @return The constructed object.
+	 */
+	template<typename ElementType, typename... ConstructTypes>
+	[[nodiscard]] ElementType* AllocateObject(ConstructTypes&&... args)
+	{
+		static_assert(IsTriviallyDestructible<ElementType>, "Linear allocators never destruct what they allocate");
+
+		void* objectMemory = Allocate(sizeof(ElementType), alignof(ElementType));
+		FMemory::ConstructObjectAt<ElementType, ConstructTypes...>(objectMemory, Forward<ConstructTypes>(args)...);
+		return static_cast<ElementType*>(objectMemory);
+	}
+
+	/**
+	 * @brief Gets the number of bytes that have been handed out since this allocator was created or last reset.
+	 *
+	 * @return The number of bytes that have been handed out.
+	 */
+	[[nodiscard]] SizeType GetNumBytesAllocated() const
+	{
+		return m_NumBytesAllocated;
+	}
+
+	/**
+	 * @brief Gets the number of bytes this allocator has reserved from the heap, including block headers.
+	 *
+	 * @return The number of bytes this allocator has reserved.
+	 */
+	[[nodiscard]] SizeType GetNumBytesReserved() const
+	{
+		return m_NumBytesReserved;
+	}
+
+	/**
+	 * @brief Frees all blocks, invalidating everything this allocator has handed out.
+	 */
+	void Reset();
+
+	/**
+	 * @brief Assumes ownership of another allocator's blocks.
+	 *
+	 * @param other The other allocator.
+	 * @return This allocator.
+	 */
+	FLinearAllocator& operator=(FLinearAllocator&& other) noexcept;
+
+private:
+
+	struct FBlockHeader;
+
+	/**
+	 * @brief Reserves a new block and allocates memory from it. This is the slow path of Allocate.
+	 *
+	 * @param numBytes The number of bytes to allocate.
+	 * @param alignment The alignment of the memory.
+	 * @return The allocated memory.
+	 */
+	[[nodiscard]] void* AllocateFromNewBlock(SizeType numBytes, SizeType alignment);
+
+	FBlockHeader* m_Blocks = nullptr;
+	uint8* m_Cursor = nullptr;
+	uint8* m_End = nullptr;
+	SizeType m_NextBlockSize = DefaultBlockSize;
+	SizeType m_NumBytesAllocated = 0;
+	SizeType m_NumBytesReserved = 0;
+};
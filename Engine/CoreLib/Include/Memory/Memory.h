@@ -172,6 +172,15 @@ public:
 		Free(object);
 	}
 
+	/**
+	 * @brief Checks to see if a location lies within memory handed out by this allocator, as opposed to memory on a
+	 *        thread's stack or in static storage.
+	 *
+	 * @param location The location.
+	 * @return True if \p location lies within memory handed out by this allocator, otherwise false.
+	 */
+	[[nodiscard]] static bool IsAllocatedMemory(const void* location);
+
 	/**
 	 * @brief Moves memory from one location to another.
 	 *
@@ -33,6 +33,30 @@ public:
 	 */
 	[[nodiscard]] const FTypeInfo* GetElementType() const;
 
+	/**
+	 * @brief Gets a pointer to the first element of an array of this type.
+	 *
+	 * @param array The array.
+	 * @return A pointer to the first element of \p array.
+	 */
+	[[nodiscard]] virtual void* GetData(void* array) const = 0;
+
+	/**
+	 * @brief Gets the number of elements in an array of this type.
+	 *
+	 * @param array The array.
+	 * @return The number of elements in \p array.
+	 */
+	[[nodiscard]] virtual int32 GetNum(const void* array) const = 0;
+
+	/**
+	 * @brief Replaces the contents of an array of this type with default-constructed elements.
+	 *
+	 * @param array The array.
+	 * @param numElements The number of elements \p array should have.
+	 */
+	virtual void ResetToNum(void* array, int32 numElements) const = 0;
+
 private:
 
 	/**
@@ -146,16 +170,60 @@ private:
 	FString m_FormattedName;
 };
 
+/**
+ * @brief Defines type information for an array.
+ *
+ * @tparam T The type of each element in the array.
+ */
+template<typename T>
+class TArrayTypeInfo final : public FArrayTypeInfo
+{
+public:
+
+	using ArrayType = TArray<T>;
+
+	/**
+	 * @brief Sets default values for this array type info's properties.
+	 */
+	TArrayTypeInfo()
+		: FArrayTypeInfo(sizeof(ArrayType), alignof(ArrayType), ::GetType<T>())
+	{
+	}
+
+	/**
+	 * @brief Destroys this array type info.
+	 */
+	virtual ~TArrayTypeInfo() override = default;
+
+	/** @copydoc FArrayTypeInfo::GetData */
+	[[nodiscard]] virtual void* GetData(void* array) const override
+	{
+		return static_cast<ArrayType*>(array)->GetData();
+	}
+
+	/** @copydoc FArrayTypeInfo::GetNum */
+	[[nodiscard]] virtual int32 GetNum(const void* array) const override
+	{
+		return static_cast<const ArrayType*>(array)->Num();
+	}
+
+	/** @copydoc FArrayTypeInfo::ResetToNum */
+	virtual void ResetToNum(void* array, const int32 numElements) const override
+	{
+		ArrayType& typedArray = *static_cast<ArrayType*>(array);
+		typedArray.Reset();
+		(void)typedArray.AddDefault(numElements);
+	}
+};
+
 namespace Private
 {
 	template<typename T>
 	struct TTypeDefinition<TArray<T>>
 	{
-		using ArrayType = TArray<T>;
-
 		static const FArrayTypeInfo* Get()
 		{
-			static const FArrayTypeInfo arrayTypeInfo { sizeof(ArrayType), alignof(ArrayType), ::GetType<T>() };
+			static const TArrayTypeInfo<T> arrayTypeInfo;
 			return &arrayTypeInfo;
 		}
 	};
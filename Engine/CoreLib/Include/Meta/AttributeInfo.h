@@ -2,6 +2,22 @@
 
 #include "Containers/Array.h"
 #include "Containers/StringView.h"
+#include "Misc/EnumMacros.h"
+
+/**
+ * @brief An enumeration of attributes that the engine itself checks for. These are recognized when they are added to
+ *        an attribute collection so that checking for them does not require any string comparisons.
+ *
+ * The entries can't share their attribute's name because the attribute names are also defined as macros.
+ */
+enum class EKnownAttributes : uint32
+{
+	None        = 0,
+	IsAbstract  = (1 << 0),
+	IsChildOf   = (1 << 1)
+};
+
+ENUM_FLAG_OPERATORS(EKnownAttributes)
 
 /**
  * @brief Defines information about an attribute.
@@ -104,6 +120,27 @@ public:
 	 */
 	[[nodiscard]] int32 GetNumAttributes() const;
 
+	/**
+	 * @brief Gets the well-known attributes in this collection.
+	 *
+	 * @return The well-known attributes in this collection.
+	 */
+	[[nodiscard]] EKnownAttributes GetKnownAttributes() const
+	{
+		return m_KnownAttributes;
+	}
+
+	/**
+	 * @brief Checks to see if this collection has any of the given well-known attributes.
+	 *
+	 * @param attributes The well-known attributes.
+	 * @return True if this collection has any of \p attributes, otherwise false.
+	 */
+	[[nodiscard]] bool HasAttribute(const EKnownAttributes attributes) const
+	{
+		return ::HasFlag(m_KnownAttributes, attributes);
+	}
+
 	/**
 	 * @brief Checks to see if there is an attribute with the given name.
 	 *
@@ -115,4 +152,5 @@ public:
 private:
 
 	TArray<FAttributeInfo> m_Attributes;
+	EKnownAttributes m_KnownAttributes = EKnownAttributes::None;
 };
\ No newline at end of file
@@ -0,0 +1,161 @@
+#pragma once
+
+#include "Containers/Function.h"
+#include "Containers/HashMap.h"
+#include "Containers/String.h"
+#include "Meta/TypeInfo.h"
+
+/**
+ * @brief Defines type information for a hash map.
+ */
+class FHashMapTypeInfo : public FTypeInfo
+{
+public:
+
+	/**
+	 * @brief Sets default values for this hash map type info's properties.
+	 *
+	 * @param name The type's name.
+	 * @param size The type's size.
+	 * @param alignment The type's alignment.
+	 * @param keyType The type of each key in the hash map.
+	 * @param valueType The type of each value in the hash map.
+	 */
+	FHashMapTypeInfo(const FStringView name, const int32 size, const int32 alignment, const FTypeInfo* keyType, const FTypeInfo* valueType)
+		: FTypeInfo(name, size, alignment)
+		, m_KeyType { keyType }
+		, m_ValueType { valueType }
+	{
+	}
+
+	/**
+	 * @brief Destroys this hash map type info.
+	 */
+	virtual ~FHashMapTypeInfo() override = default;
+
+	/**
+	 * @brief Calls a function for each key-value pair in a hash map of this type.
+	 *
+	 * @param map The hash map.
+	 * @param function The function to call with a pointer to each key and its value.
+	 */
+	virtual void ForEachPair(const void* map, TFunction<void(const void*, const void*)> function) const = 0;
+
+	/**
+	 * @brief Gets the type of each key in the hash map.
+	 *
+	 * @return The type of each key in the hash map.
+	 */
+	[[nodiscard]] const FTypeInfo* GetKeyType() const
+	{
+		return m_KeyType;
+	}
+
+	/**
+	 * @brief Gets the number of key-value pairs in a hash map of this type.
+	 *
+	 * @param map The hash map.
+	 * @return The number of key-value pairs in \p map.
+	 */
+	[[nodiscard]] virtual int32 GetNum(const void* map) const = 0;
+
+	/**
+	 * @brief Gets the type of each value in the hash map.
+	 *
+	 * @return The type of each value in the hash map.
+	 */
+	[[nodiscard]] const FTypeInfo* GetValueType() const
+	{
+		return m_ValueType;
+	}
+
+	/**
+	 * @brief Replaces the contents of a hash map of this type with new key-value pairs.
+	 *
+	 * @param map The hash map.
+	 * @param numPairs The number of key-value pairs to add.
+	 * @param initializePair The function to call with a pointer to each default-constructed key and value before the
+	 *                       pair is added to \p map.
+	 */
+	virtual void ResetToPairs(void* map, int32 numPairs, TFunction<void(void*, void*)> initializePair) const = 0;
+
+private:
+
+	const FTypeInfo* m_KeyType = nullptr;
+	const FTypeInfo* m_ValueType = nullptr;
+};
+
+/**
+ * @brief Defines type information for a hash map.
+ *
+ * @tparam K The type of each key in the hash map.
+ * @tparam V The type of each value in the hash map.
+ */
+template<typename K, typename V>
+class THashMapTypeInfo final : public FHashMapTypeInfo
+{
+public:
+
+	using MapType = THashMap<K, V>;
+
+	/**
+	 * @brief Sets default values for this hash map type info's properties.
+	 *
+	 * @param name The type's name.
+	 */
+	explicit THashMapTypeInfo(const FStringView name)
+		: FHashMapTypeInfo(name, sizeof(MapType), alignof(MapType), ::GetType<K>(), ::GetType<V>())
+	{
+	}
+
+	/**
+	 * @brief Destroys this hash map type info.
+	 */
+	virtual ~THashMapTypeInfo() override = default;
+
+	/** @copydoc FHashMapTypeInfo::ForEachPair */
+	virtual void ForEachPair(const void* map, TFunction<void(const void*, const void*)> function) const override
+	{
+		for (auto iter = static_cast<const MapType*>(map)->CreateConstIterator(); iter; ++iter)
+		{
+			function(&iter->Key, &iter->Value);
+		}
+	}
+
+	/** @copydoc FHashMapTypeInfo::GetNum */
+	[[nodiscard]] virtual int32 GetNum(const void* map) const override
+	{
+		return static_cast<const MapType*>(map)->Num();
+	}
+
+	/** @copydoc FHashMapTypeInfo::ResetToPairs */
+	virtual void ResetToPairs(void* map, const int32 numPairs, TFunction<void(void*, void*)> initializePair) const override
+	{
+		MapType& typedMap = *static_cast<MapType*>(map);
+		typedMap.Reset();
+		typedMap.Reserve(numPairs);
+
+		for (int32 idx = 0; idx < numPairs; ++idx)
+		{
+			K key {};
+			V value {};
+			initializePair(&key, &value);
+
+			(void)typedMap.Add(MoveTemp(key), MoveTemp(value));
+		}
+	}
+};
+
+namespace Private
+{
+	template<typename K, typename V>
+	struct TTypeDefinition<THashMap<K, V>>
+	{
+		static const FHashMapTypeInfo* Get()
+		{
+			static const FString typeName = FString::Format("THashMap<{}, {}>"_sv, ::GetType<K>()->GetName(), ::GetType<V>()->GetName());
+			static const THashMapTypeInfo<K, V> hashMapTypeInfo { typeName.AsStringView() };
+			return &hashMapTypeInfo;
+		}
+	};
+}
\ No newline at end of file
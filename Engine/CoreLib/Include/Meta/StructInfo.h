@@ -37,6 +37,21 @@ public:
 	 */
 	[[nodiscard]] FPropertyInfo& AddProperty(FStringView name, const FTypeInfo* valueType, int32 offset);
 
+	/**
+	 * @brief Builds the table used to look up this struct's properties by name. Should be called once every property
+	 *        has been added. Properties can still be looked up before then, just not in constant time.
+	 */
+	void Finalize();
+
+	/**
+	 * @brief Finds the closest type in this struct's inheritance chain, starting with this struct, that has any of
+	 *        the given well-known attributes.
+	 *
+	 * @param attributes The well-known attributes.
+	 * @return The closest type with any of \p attributes, or null if there is no such type.
+	 */
+	[[nodiscard]] const FStructInfo* FindTypeWithAttribute(EKnownAttributes attributes) const;
+
 	/**
 	 * @brief Gets the struct's base type (if one exists).
 	 *
@@ -44,6 +59,16 @@ public:
 	 */
 	[[nodiscard]] const FStructInfo* GetBaseType() const;
 
+	/**
+	 * @brief Gets the number of types this struct inherits from.
+	 *
+	 * @return The number of types this struct inherits from.
+	 */
+	[[nodiscard]] int32 GetInheritanceDepth() const
+	{
+		return m_Ancestors.Num();
+	}
+
 	/**
 	 * @brief Gets the number of properties in the struct.
 	 *
@@ -83,10 +108,58 @@ public:
 	 * @param type The type to check.
 	 * @return True if the struct inherits from the type defined by \p type, otherwise false.
 	 */
-	[[nodiscard]] bool IsA(const FStructInfo* type) const;
+	[[nodiscard]] bool IsA(const FStructInfo* type) const
+	{
+		// A type's ancestors are stored root first, so a type can only be an ancestor of this struct if it is found
+		// at the same depth in this struct's ancestors as it has ancestors of its own
+		if (type == this)
+		{
+			return true;
+		}
+
+		return type != nullptr && m_Ancestors.IsValidIndex(type->GetInheritanceDepth()) && m_Ancestors[type->GetInheritanceDepth()] == type;
+	}
 
 private:
 
+	/**
+	 * @brief Defines an entry in a struct's property lookup table.
+	 */
+	struct FPropertyLookupEntry
+	{
+		uint32 NameHash = 0;
+		int16 OwnerDepth = INDEX_NONE;
+		int16 PropertyIndex = INDEX_NONE;
+	};
+
+	/**
+	 * @brief Gets the type in this struct's inheritance chain at the given depth.
+	 *
+	 * @param depth The depth. Must be no greater than this struct's inheritance depth.
+	 * @return The type at \p depth.
+	 */
+	[[nodiscard]] const FStructInfo* GetTypeAtDepth(const int32 depth) const
+	{
+		return depth == m_Ancestors.Num() ? this : m_Ancestors[depth];
+	}
+
+	/**
+	 * @brief Gets the slot in the property lookup table for a name hash.
+	 *
+	 * @param nameHash The name hash.
+	 * @param seed The seed to mix in to the hash.
+	 * @param numSlots The number of slots in the table. Must be a power of two.
+	 * @return The slot for \p nameHash.
+	 */
+	[[nodiscard]] static int32 GetPropertyLookupSlot(uint64 nameHash, uint64 seed, int32 numSlots);
+
+	// NOTE Struct infos are returned by value from the functions that build them, so nothing here may point back into
+	//      this struct info. Ancestors are stored root first and properties are referenced by their owner's depth
 	TArray<FPropertyInfo> m_Properties;
+	TArray<const FStructInfo*> m_Ancestors;
+	TArray<FPropertyLookupEntry> m_PropertyLookupTable;
 	const FStructInfo* m_BaseType = nullptr;
+	uint64 m_PropertyLookupSeed = 0;
+	int32 m_NumInheritedProperties = 0;
+	EKnownAttributes m_InheritedKnownAttributes = EKnownAttributes::None;
 };
\ No newline at end of file
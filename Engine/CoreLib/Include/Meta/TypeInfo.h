@@ -2,6 +2,7 @@
 
 #include "Containers/Array.h"
 #include "Containers/StringView.h"
+#include "Engine/MiscMacros.h"
 #include "Meta/AttributeInfo.h"
 #include "Templates/Decay.h"
 #include "Templates/IsBaseOf.h"
@@ -37,6 +38,14 @@ public:
 	 */
 	[[nodiscard]] int32 GetAlignment() const;
 
+	/**
+	 * @brief Gets this type's ID. The ID is a hash of the type's name, so it is the same from run to run and from
+	 *        build to build for as long as the type keeps its name.
+	 *
+	 * @return This type's ID.
+	 */
+	[[nodiscard]] uint64 GetId() const;
+
 	/**
 	 * @brief Gets this type's name.
 	 *
@@ -54,10 +63,67 @@ public:
 private:
 
 	FStringView m_Name;
+	uint64 m_Id = 0;
 	int32 m_Size;
 	int32 m_Alignment;
 };
 
+/**
+ * @brief A function that gets a type's info.
+ */
+using FGetTypeInfoFunction = const FTypeInfo*(*)();
+
+/**
+ * @brief Defines a registration of a type with the type registry. Registrations are expected to be static objects, and
+ *        they are linked together as they are constructed so that registering a type never allocates. A registration
+ *        unregisters its type when it is destroyed, such as when the module that defines it is unloaded.
+ */
+class FTypeRegistration final
+{
+	UM_DISABLE_COPY(FTypeRegistration);
+	UM_DISABLE_MOVE(FTypeRegistration);
+
+public:
+
+	/**
+	 * @brief Registers a type with the type registry.
+	 *
+	 * @param getTypeInfo The function to get the type's info. This is not called until the type registry is built,
+	 *                    so the type's info does not need to exist yet.
+	 */
+	explicit FTypeRegistration(FGetTypeInfoFunction getTypeInfo);
+
+	/**
+	 * @brief Unregisters the type from the type registry.
+	 */
+	~FTypeRegistration();
+
+	/**
+	 * @brief Gets the function to get the registered type's info.
+	 *
+	 * @return The function to get the registered type's info.
+	 */
+	[[nodiscard]] FGetTypeInfoFunction GetTypeInfoFunction() const
+	{
+		return m_GetTypeInfo;
+	}
+
+	/**
+	 * @brief Gets the registration made before this one.
+	 *
+	 * @return The registration made before this one, or nullptr if this is the first registration.
+	 */
+	[[nodiscard]] const FTypeRegistration* GetPrevious() const
+	{
+		return m_Previous;
+	}
+
+private:
+
+	FGetTypeInfoFunction m_GetTypeInfo = nullptr;
+	FTypeRegistration* m_Previous = nullptr;
+};
+
 namespace Private
 {
 	template<typename T>
@@ -80,7 +146,12 @@ namespace Private
 	const FTypeInfo* ::Private::TTypeDefinition<Type>::Get()    \
 	{                                                           \
 		return &UM_JOIN(GTypeInfo_, Type);                      \
-	}
+	}                                                           \
+	static const FTypeRegistration                              \
+	UM_JOIN(GTypeRegistration_, Type)                           \
+	{                                                           \
+		&::Private::TTypeDefinition<Type>::Get                  \
+	};
 
 DECLARE_PRIMITIVE_TYPE_DEFINITION(void);
 DECLARE_PRIMITIVE_TYPE_DEFINITION(bool);
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Containers/Span.h"
+#include "Containers/StringView.h"
+#include "Engine/Cast.h"
+#include "Meta/TypeInfo.h"
+
+class FStructInfo;
+
+/**
+ * @brief Defines the global registry of every type that has registered itself through an FTypeRegistration.
+ *
+ * The registry is built from the registrations the first time it is queried, and it is immutable after that. Spans it
+ * returns stay valid for the lifetime of the program. If more types register afterwards, such as when a module is
+ * loaded, the next query builds a new registry that includes them. Likewise, types that unregister when their module
+ * is unloaded are left out of the next registry, but they must not be used through spans handed out before then.
+ */
+class FTypeRegistry
+{
+public:
+
+	/**
+	 * @brief Attempts to find a type by its ID.
+	 *
+	 * @param id The type's ID.
+	 * @return The type, or nullptr if no registered type has the ID \p id.
+	 */
+	[[nodiscard]] static const FTypeInfo* FindTypeById(uint64 id);
+
+	/**
+	 * @brief Attempts to find a type by its name.
+	 *
+	 * @param name The type's name.
+	 * @return The type, or nullptr if no registered type is named \p name.
+	 */
+	[[nodiscard]] static const FTypeInfo* FindTypeByName(FStringView name);
+
+	/**
+	 * @brief Attempts to find a type by its name.
+	 *
+	 * @tparam TypeInfoType The kind of type info to find, such as FClassInfo.
+	 * @param name The type's name.
+	 * @return The type, or nullptr if no registered type is named \p name or the type is not a \p TypeInfoType.
+	 */
+	template<typename TypeInfoType>
+	[[nodiscard]] static const TypeInfoType* FindTypeByName(const FStringView name)
+	{
+		return Cast<TypeInfoType>(FindTypeByName(name));
+	}
+
+	/**
+	 * @brief Gets every registered type, sorted by name.
+	 *
+	 * @return Every registered type.
+	 */
+	[[nodiscard]] static TSpan<const FTypeInfo* const> GetAllTypes();
+
+	/**
+	 * @brief Gets every registered type that derives from the given type, not including the type itself.
+	 *
+	 * Types are stored so that every type is immediately followed by all of the types that derive from it, which makes
+	 * this a lookup instead of a search.
+	 *
+	 * @param type The base type.
+	 * @return Every registered type that derives from \p type, or an empty span if \p type is not registered.
+	 */
+	[[nodiscard]] static TSpan<const FStructInfo* const> GetDerivedTypes(const FStructInfo* type);
+};
\ No newline at end of file
@@ -1,11 +1,114 @@
 #pragma once
 
 #include "Containers/Array.h"
+#include "Containers/StaticArray.h"
 #include "Containers/String.h"
 #include "Engine/Error.h"
 
 namespace Base64
 {
+	/**
+	 * @brief Gets the number of base-64 characters that a number of bytes encodes to, including padding.
+	 *
+	 * @param numBytes The number of bytes.
+	 * @return The number of base-64 characters.
+	 */
+	[[nodiscard]] constexpr int32 GetEncodedLength(const int32 numBytes)
+	{
+		return (numBytes + 2) / 3 * 4;
+	}
+
+	/**
+	 * @brief Gets the largest number of bytes that a number of base-64 characters can decode to.
+	 *
+	 * @param numChars The number of base-64 characters.
+	 * @return The largest number of decoded bytes.
+	 */
+	[[nodiscard]] constexpr int32 GetMaxDecodedLength(const int32 numChars)
+	{
+		return (numChars + 3) / 4 * 3;
+	}
+
+	/**
+	 * @brief Defines a way to encode bytes into base-64 one chunk at a time, without holding all of the output at once.
+	 */
+	class FStreamEncoder
+	{
+	public:
+
+		/**
+		 * @brief Encodes a chunk of bytes. Bytes at the end of the chunk that do not make up a whole group of three are
+		 *        held until the next chunk or until the encoder is finished.
+		 *
+		 * @param bytes The chunk of bytes.
+		 * @param chars The characters to write to. Must have room for at least GetEncodedLength(bytes.Num()) characters.
+		 * @return The number of characters that were written.
+		 */
+		[[nodiscard]] int32 Encode(TSpan<const uint8> bytes, TSpan<char> chars);
+
+		/**
+		 * @brief Encodes any held bytes along with padding, and then resets the encoder.
+		 *
+		 * @param chars The characters to write to. Must have room for at least four characters.
+		 * @return The number of characters that were written.
+		 */
+		[[nodiscard]] int32 Finish(TSpan<char> chars);
+
+	private:
+
+		TStaticArray<uint8, 3> m_PendingBytes { 0, 0, 0 };
+		int32 m_NumPendingBytes = 0;
+	};
+
+	/**
+	 * @brief Defines a way to decode base-64 characters one chunk at a time, without holding all of the input at once.
+	 *
+	 * Padding is optional at the end of the input, but nothing may come after it.
+	 */
+	class FStreamDecoder
+	{
+	public:
+
+		/**
+		 * @brief Decodes a chunk of characters. Characters at the end of the chunk that do not make up a whole group of
+		 *        four are held until the next chunk or until the decoder is finished.
+		 *
+		 * @param chars The chunk of characters.
+		 * @param bytes The bytes to write to. Must have room for at least GetMaxDecodedLength(chars.Length()) bytes.
+		 * @return The number of bytes that were written, or the error if \p chars is not valid base-64.
+		 */
+		[[nodiscard]] TErrorOr<int32> Decode(FStringView chars, TSpan<uint8> bytes);
+
+		/**
+		 * @brief Decodes any held characters, and then resets the decoder.
+		 *
+		 * @param bytes The bytes to write to. Must have room for at least three bytes.
+		 * @return The number of bytes that were written, or the error if the input ended in the middle of a byte.
+		 */
+		[[nodiscard]] TErrorOr<int32> Finish(TSpan<uint8> bytes);
+
+		/**
+		 * @brief Resets the decoder so that it can decode new input. This is necessary after an error.
+		 */
+		void Reset();
+
+	private:
+
+		/**
+		 * @brief Decodes a group of four characters that may contain padding.
+		 *
+		 * @param chars The four characters.
+		 * @param bytes The bytes to write to. Must have room for at least three bytes.
+		 * @return The number of bytes that were written, or the error if the group is not valid base-64.
+		 */
+		[[nodiscard]] TErrorOr<int32> DecodePaddedGroup(const char* chars, uint8* bytes);
+
+		TStaticArray<char, 4> m_PendingChars { 0, 0, 0, 0 };
+		int32 m_NumPendingChars = 0;
+		int32 m_NumCharsDecoded = 0;
+		bool m_FoundPadding = false;
+	};
+
 	/**
 	 * @brief Encodes the given span of bytes into base-64.
 	 *
@@ -107,7 +107,7 @@ public:
 	}
 
 	/**
-	 * @brief Compares two strings, ignoring case.
+	 * @brief Compares two strings, ignoring case. Only ASCII letters are treated as having case.
 	 *
 	 * @param first The first string.
 	 * @param second The second string.
@@ -117,7 +117,7 @@ public:
 	static ECompareResult StrCaseCmp(const CharType* first, const CharType* second, SizeType numChars);
 
 	/**
-	 * @brief Compares two strings.
+	 * @brief Compares two strings. Null characters do not end the comparison early.
 	 *
 	 * @param first The first string.
 	 * @param second The second string.
@@ -183,6 +183,15 @@ public:
 		return StrCmp(first, second, numChars) == ECompareResult::Equals;
 	}
 
+	/**
+	 * @brief Sets a number of characters to the same value.
+	 *
+	 * @param chars The characters to set.
+	 * @param ch The value to set each character to.
+	 * @param numChars The number of characters to set.
+	 */
+	static void StrFill(CharType* chars, CharType ch, SizeType numChars);
+
 	/**
 	 * @brief Finds the index of a substring in a string.
 	 *
@@ -368,6 +368,16 @@ namespace Private
 		 */
 		void BuildString(FStringView formatString, FStringBuilder& builder);
 
+		/**
+		 * @brief Gets the underlying value.
+		 *
+		 * @return The underlying value.
+		 */
+		[[nodiscard]] const ValueType& GetValue() const
+		{
+			return m_Value;
+		}
+
 	private:
 
 		ValueType m_Value;
@@ -24,6 +24,17 @@ namespace Unicode
 	FCountCodePointsResult CountCodePoints(const char32_t* chars);
 	FCountCodePointsResult CountCodePoints(TSpan<const char32_t> charSpan);
 
+	/**
+	 * @brief Checks to see if a string is well-formed UTF-8, as defined by RFC 3629.
+	 *
+	 * This is stricter than decoding: overlong encodings, encoded surrogates, and code points above U+10FFFF are all
+	 * rejected. Runs of ASCII characters are checked a whole block at a time.
+	 *
+	 * @param charSpan The string.
+	 * @return True if \p charSpan is well-formed UTF-8, otherwise false.
+	 */
+	[[nodiscard]] bool IsValidUtf8(TSpan<const char> charSpan);
+
 	struct FToUtf8Result
 	{
 		TArray<char> Chars;
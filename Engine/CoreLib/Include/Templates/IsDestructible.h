@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Engine/Platform.h"
+#include "Templates/IntegralConstant.h"
+
+// https://en.cppreference.com/w/cpp/types/is_destructible
+
+#if UMBRAL_COMPILER == UMBRAL_COMPILER_GCC && __GNUC__ < 14
+// GCC only gained __is_trivially_destructible in GCC 14, and unlike Clang it does not deprecate the older builtin
+template<typename T>
+using TIsTriviallyDestructible = TBoolConstant<__has_trivial_destructor(T)>;
+#else
+template<typename T>
+using TIsTriviallyDestructible = TBoolConstant<__is_trivially_destructible(T)>;
+#endif
+
+template<typename T>
+inline constexpr bool IsTriviallyDestructible = TIsTriviallyDestructible<T>::Value;
\ No newline at end of file
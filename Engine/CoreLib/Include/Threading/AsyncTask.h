@@ -1,13 +1,507 @@
 #pragma once
 
-#include "Threading/Promise.h"
+#include "Containers/Array.h"
+#include "Containers/Function.h"
+#include "Containers/Optional.h"
+#include "Containers/Span.h"
+#include "Engine/Assert.h"
+#include "Engine/Error.h"
+#include "Memory/EnabledSharedFromThis.h"
+#include "Memory/SharedPtr.h"
+#include "Templates/Decay.h"
+#include "Templates/Declval.h"
+#include "Templates/IsVoid.h"
+#include "Templates/Swap.h"
+#include "Threading/Executor.h"
+#include "Threading/LockGuard.h"
+#include "Threading/Mutex.h"
+#include <atomic>
+
+template<typename T>
+class TAsyncTask;
+
+namespace Private
+{
+	/**
+	 * @brief Defines the state shared between a promise and the tasks that observe it.
+	 *
+	 * @tparam T The type of the result's value.
+	 */
+	template<typename T>
+	class TAsyncTaskState final : public TEnableSharedFromThis<TAsyncTaskState<T>>
+	{
+		UM_DISABLE_COPY(TAsyncTaskState);
+		UM_DISABLE_MOVE(TAsyncTaskState);
+
+	public:
+
+		using ResultType = TErrorOr<T>;
+		using FContinuation = TFunction<void(const TSharedPtr<TAsyncTaskState>&)>;
+
+		/**
+		 * @brief Sets default values for this state's properties.
+		 */
+		TAsyncTaskState() = default;
+
+		/**
+		 * @brief Adds a function to call once this state has a result. If it already has one, the function is called
+		 *        immediately on the calling thread.
+		 *
+		 * @param continuation The function to call.
+		 */
+		void AddContinuation(FContinuation continuation)
+		{
+			{
+				FScopedLockGuard lock { m_Mutex };
+				if (IsReady() == false)
+				{
+					m_Continuations.Add(MoveTemp(continuation));
+					return;
+				}
+			}
+
+			continuation(this->AsShared());
+		}
+
+		/**
+		 * @brief Gets the result. Will assert if there is no result yet.
+		 *
+		 * @return The result.
+		 */
+		[[nodiscard]] const ResultType& GetResult() const
+		{
+			UM_ASSERT(IsReady(), "Attempting to get the result of an async task that has not finished");
+			return m_Result.GetValue();
+		}
+
+		/**
+		 * @brief Checks to see if this state has a result.
+		 *
+		 * @return True if this state has a result, otherwise false.
+		 */
+		[[nodiscard]] bool IsReady() const
+		{
+			return m_IsReady.load(std::memory_order_acquire);
+		}
+
+		/**
+		 * @brief Sets the result if one has not already been set, then calls all pending continuations.
+		 *
+		 * @param result The result.
+		 * @return True if the result was set, false if there already was one.
+		 */
+		[[maybe_unused]] bool TrySetResult(ResultType result)
+		{
+			TArray<FContinuation> continuations;
+			{
+				FScopedLockGuard lock { m_Mutex };
+				if (IsReady())
+				{
+					return false;
+				}
+
+				(void)m_Result.EmplaceValue(MoveTemp(result));
+				m_IsReady.store(true, std::memory_order_release);
+				Swap(continuations, m_Continuations);
+			}
+
+			m_IsReady.notify_all();
+
+			// Continuations are called outside of the lock so they are free to add more continuations
+			const TSharedPtr<TAsyncTaskState> self = this->AsShared();
+			for (FContinuation& continuation : continuations)
+			{
+				continuation(self);
+			}
+
+			return true;
+		}
+
+		/**
+		 * @brief Blocks the calling thread until this state has a result.
+		 */
+		void Wait() const
+		{
+			while (IsReady() == false)
+			{
+				m_IsReady.wait(false, std::memory_order_acquire);
+			}
+		}
+
+	private:
+
+		FMutex m_Mutex;
+		TOptional<ResultType> m_Result;
+		TArray<FContinuation> m_Continuations;
+		std::atomic<bool> m_IsReady = false;
+	};
+
+	/**
+	 * @brief Gets the value type of the task returned by a continuation that returns T.
+	 */
+	template<typename T>
+	struct TAsyncTaskContinuationTraits
+	{
+		using ValueType = T;
+	};
+
+	template<typename T>
+	struct TAsyncTaskContinuationTraits<TErrorOr<T>>
+	{
+		using ValueType = T;
+	};
+
+	template<typename T>
+	struct TAsyncTaskContinuationTraits<TAsyncTask<T>>
+	{
+		using ValueType = T;
+	};
+
+	/**
+	 * @brief Checks to see if T is an async task.
+	 */
+	template<typename T>
+	inline constexpr bool IsAsyncTask = false;
+
+	template<typename T>
+	inline constexpr bool IsAsyncTask<TAsyncTask<T>> = true;
+
+	/**
+	 * @brief Gets the value type of the task returned by WhenAll for tasks with values of type T.
+	 */
+	template<typename T>
+	struct TWhenAllTraits
+	{
+		using ValueType = TArray<T>;
+	};
+
+	template<>
+	struct TWhenAllTraits<void>
+	{
+		using ValueType = void;
+	};
+}
 
 /**
- * @brief Defines an asynchronous task.
+ * @brief Defines a handle to the eventual result of an asynchronous operation.
+ *
+ * Tasks are cheap to copy, and every copy observes the same result. A task's result is either a value or an error, and
+ * continuations attached with Then are run once the result is available on an executor of the caller's choosing.
  *
  * @tparam T The task's expected result type.
  */
 template<typename T>
-class TAsyncTask
+class TAsyncTask final
+{
+	template<typename U>
+	friend class TAsyncTask;
+
+	using StateType = Private::TAsyncTaskState<T>;
+
+public:
+
+	using ValueType = T;
+	using ResultType = TErrorOr<T>;
+
+	/**
+	 * @brief Sets default values for this task's properties. Default constructed tasks are invalid.
+	 */
+	TAsyncTask() = default;
+
+	/**
+	 * @brief Sets default values for this task's properties. Used by promises and task combinators.
+	 *
+	 * @param state The state to observe.
+	 */
+	explicit TAsyncTask(TSharedPtr<Private::TAsyncTaskState<T>> state)
+		: m_State { MoveTemp(state) }
+	{
+	}
+
+	/**
+	 * @brief Creates a task that has already finished with the given result.
+	 *
+	 * @param result The result.
+	 * @return The task.
+	 */
+	[[nodiscard]] static TAsyncTask FromResult(ResultType result)
+	{
+		TSharedPtr<StateType> state = MakeShared<StateType>();
+		(void)state->TrySetResult(MoveTemp(result));
+		return TAsyncTask { MoveTemp(state) };
+	}
+
+	/**
+	 * @brief Gets this task's result, blocking the calling thread until it is available.
+	 *
+	 * @return This task's result.
+	 */
+	[[nodiscard]] const ResultType& GetResult() const
+	{
+		Wait();
+		return m_State->GetResult();
+	}
+
+	/**
+	 * @brief Checks to see if this task has finished.
+	 *
+	 * @return True if this task has finished, otherwise false.
+	 */
+	[[nodiscard]] bool IsReady() const
+	{
+		return m_State.IsValid() && m_State->IsReady();
+	}
+
+	/**
+	 * @brief Checks to see if this task refers to an asynchronous operation.
+	 *
+	 * @return True if this task refers to an asynchronous operation, otherwise false.
+	 */
+	[[nodiscard]] bool IsValid() const
+	{
+		return m_State.IsValid();
+	}
+
+	/**
+	 * @brief Attaches a continuation that is run on the thread that finishes this task.
+	 *
+	 * @tparam FunctionType The type of the continuation.
+	 * @param function The continuation. Receives this task's result and may return nothing, a value, a TErrorOr, or
+	 *                 another task, which is flattened into the returned task.
+	 * @return The task for the continuation's result.
+	 */
+	template<typename FunctionType>
+	[[nodiscard]] auto Then(FunctionType function) const
+	{
+		return Then(FInlineExecutor::Get(), MoveTemp(function));
+	}
+
+	/**
+	 * @brief Attaches a continuation that is run on an executor once this task finishes.
+	 *
+	 * @tparam FunctionType The type of the continuation.
+	 * @param executor The executor to run the continuation on. Must outlive this task.
+	 * @param function The continuation. Receives this task's result and may return nothing, a value, a TErrorOr, or
+	 *                 another task, which is flattened into the returned task.
+	 * @return The task for the continuation's result.
+	 */
+	template<typename FunctionType>
+	[[nodiscard]] auto Then(IExecutor& executor, FunctionType function) const
+	{
+		using ReturnType = typename TDecay<decltype(declval<FunctionType&>()(declval<const ResultType&>()))>::Type;
+		using NextValueType = typename Private::TAsyncTaskContinuationTraits<ReturnType>::ValueType;
+		using NextStateType = Private::TAsyncTaskState<NextValueType>;
+
+		UM_ASSERT(IsValid(), "Attempting to add a continuation to an invalid async task");
+
+		TSharedPtr<NextStateType> nextState = MakeShared<NextStateType>();
+		m_State->AddContinuation([&executor, nextState, function = MoveTemp(function)](const TSharedPtr<StateType>& state) mutable
+		{
+			executor.Execute([nextState = MoveTemp(nextState), function = MoveTemp(function), state]() mutable
+			{
+				InvokeContinuation(nextState, function, state->GetResult());
+			});
+		});
+
+		return TAsyncTask<NextValueType> { MoveTemp(nextState) };
+	}
+
+	/**
+	 * @brief Blocks the calling thread until this task finishes.
+	 */
+	void Wait() const
+	{
+		UM_ASSERT(IsValid(), "Attempting to wait on an invalid async task");
+		m_State->Wait();
+	}
+
+private:
+
+	/**
+	 * @brief Invokes a continuation and stores its result in the state of the continuation's task.
+	 *
+	 * @tparam NextValueType The type of the continuation task's value.
+	 * @tparam FunctionType The type of the continuation.
+	 * @param nextState The state of the continuation's task.
+	 * @param function The continuation.
+	 * @param result The result of this task.
+	 */
+	template<typename NextValueType, typename FunctionType>
+	static void InvokeContinuation(const TSharedPtr<Private::TAsyncTaskState<NextValueType>>& nextState, FunctionType& function, const ResultType& result)
+	{
+		using ReturnType = typename TDecay<decltype(function(result))>::Type;
+
+		if constexpr (IsVoid<ReturnType>)
+		{
+			function(result);
+			(void)nextState->TrySetResult(TErrorOr<void> {});
+		}
+		else if constexpr (Private::IsAsyncTask<ReturnType>)
+		{
+			const ReturnType innerTask = function(result);
+			if (innerTask.IsValid() == false)
+			{
+				(void)nextState->TrySetResult(MAKE_ERROR("Async task continuation returned an invalid task"));
+				return;
+			}
+
+			innerTask.m_State->AddContinuation([nextState](const TSharedPtr<Private::TAsyncTaskState<NextValueType>>& innerState)
+			{
+				(void)nextState->TrySetResult(innerState->GetResult());
+			});
+		}
+		else
+		{
+			(void)nextState->TrySetResult(function(result));
+		}
+	}
+
+	TSharedPtr<StateType> m_State;
+};
+
+/**
+ * @brief Creates a task that runs a function on an executor.
+ *
+ * @tparam FunctionType The type of the function.
+ * @param executor The executor to run the function on. Must outlive the task.
+ * @param function The function. May return nothing, a value, a TErrorOr, or another task.
+ * @return The task for the function's result.
+ */
+template<typename FunctionType>
+[[nodiscard]] auto Async(IExecutor& executor, FunctionType function)
+{
+	return TAsyncTask<void>::FromResult({}).Then(executor, [function = MoveTemp(function)](const TErrorOr<void>&) mutable
+	{
+		return function();
+	});
+}
+
+/**
+ * @brief Creates a task that finishes once all the given tasks have finished.
+ *
+ * @tparam T The value type of the tasks.
+ * @param tasks The tasks.
+ * @return A task with every task's value in order, or the error of the first task (by index) that failed.
+ */
+template<typename T>
+[[nodiscard]] auto WhenAll(const TSpan<const TAsyncTask<T>> tasks)
+{
+	using ResultValueType = typename Private::TWhenAllTraits<T>::ValueType;
+
+	using ResultStateType = Private::TAsyncTaskState<ResultValueType>;
+
+	struct FWhenAllContext
+	{
+		TArray<TAsyncTask<T>> Tasks;
+		TSharedPtr<ResultStateType> State = MakeShared<ResultStateType>();
+		std::atomic<int32> NumRemaining = 0;
+	};
+
+	TSharedPtr<FWhenAllContext> context = MakeShared<FWhenAllContext>();
+	context->Tasks = TArray<TAsyncTask<T>> { tasks };
+	context->NumRemaining.store(tasks.Num() + 1, std::memory_order_relaxed);
+
+	const auto onTaskFinished = [](FWhenAllContext& context)
+	{
+		if (context.NumRemaining.fetch_sub(1, std::memory_order_acq_rel) != 1)
+		{
+			return;
+		}
+
+		for (const TAsyncTask<T>& task : context.Tasks)
+		{
+			if (task.GetResult().IsError())
+			{
+				(void)context.State->TrySetResult(task.GetResult().GetError());
+				return;
+			}
+		}
+
+		if constexpr (IsVoid<T>)
+		{
+			(void)context.State->TrySetResult(TErrorOr<void> {});
+		}
+		else
+		{
+			ResultValueType values;
+			values.Reserve(context.Tasks.Num());
+			for (const TAsyncTask<T>& task : context.Tasks)
+			{
+				values.Add(task.GetResult().GetValue());
+			}
+
+			(void)context.State->TrySetResult(MoveTemp(values));
+		}
+	};
+
+	TAsyncTask<ResultValueType> resultTask { context->State };
+	for (const TAsyncTask<T>& task : context->Tasks)
+	{
+		UM_ASSERT(task.IsValid(), "Cannot wait on an invalid async task");
+
+		(void)task.Then([context, onTaskFinished](const TErrorOr<T>&)
+		{
+			onTaskFinished(*context);
+		});
+	}
+
+	// The extra count keeps the context from finishing while continuations are still being attached
+	onTaskFinished(*context);
+
+	return resultTask;
+}
+
+/**
+ * @brief Creates a task that finishes once all the given tasks have finished.
+ *
+ * @tparam T The value type of the tasks.
+ * @param tasks The tasks.
+ * @return A task with every task's value in order, or the error of the first task (by index) that failed.
+ */
+template<typename T>
+[[nodiscard]] auto WhenAll(const TArray<TAsyncTask<T>>& tasks)
+{
+	return WhenAll(tasks.AsSpan());
+}
+
+/**
+ * @brief Creates a task that finishes once any of the given tasks has finished.
+ *
+ * @tparam T The value type of the tasks.
+ * @param tasks The tasks.
+ * @return A task with the index of the first task that finished. Check that task for its result.
+ */
+template<typename T>
+[[nodiscard]] TAsyncTask<int32> WhenAny(const TSpan<const TAsyncTask<T>> tasks)
+{
+	if (tasks.IsEmpty())
+	{
+		return TAsyncTask<int32>::FromResult(MAKE_ERROR("Cannot wait on any of zero async tasks"));
+	}
+
+	TSharedPtr<Private::TAsyncTaskState<int32>> state = MakeShared<Private::TAsyncTaskState<int32>>();
+	for (int32 idx = 0; idx < tasks.Num(); ++idx)
+	{
+		UM_ASSERT(tasks[idx].IsValid(), "Cannot wait on an invalid async task");
+
+		(void)tasks[idx].Then([state, idx](const TErrorOr<T>&)
+		{
+			(void)state->TrySetResult(idx);
+		});
+	}
+
+	return TAsyncTask<int32> { MoveTemp(state) };
+}
+
+/**
+ * @brief Creates a task that finishes once any of the given tasks has finished.
+ *
+ * @tparam T The value type of the tasks.
+ * @param tasks The tasks.
+ * @return A task with the index of the first task that finished. Check that task for its result.
+ */
+template<typename T>
+[[nodiscard]] TAsyncTask<int32> WhenAny(const TArray<TAsyncTask<T>>& tasks)
 {
-};
\ No newline at end of file
+	return WhenAny(tasks.AsSpan());
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/Function.h"
+#include "Memory/SharedPtr.h"
+#include "Threading/Mutex.h"
+
+class FEventLoop;
+class FThreadPool;
+
+/**
+ * @brief Defines the base for all objects that decide where and when a function is run.
+ */
+class IExecutor
+{
+public:
+
+	using FExecuteFunction = TFunction<void()>;
+
+	/**
+	 * @brief Destroys this executor.
+	 */
+	virtual ~IExecutor() = default;
+
+	/**
+	 * @brief Runs, or arranges for something else to run, the given function.
+	 *
+	 * @param function The function.
+	 */
+	virtual void Execute(FExecuteFunction function) = 0;
+};
+
+/**
+ * @brief Defines an executor that immediately runs functions on the calling thread.
+ */
+class FInlineExecutor final : public IExecutor
+{
+public:
+
+	/**
+	 * @brief Gets the shared inline executor.
+	 *
+	 * @return The shared inline executor.
+	 */
+	[[nodiscard]] static FInlineExecutor& Get();
+
+	/**
+	 * @brief Immediately runs the given function on the calling thread.
+	 *
+	 * @param function The function.
+	 */
+	virtual void Execute(FExecuteFunction function) override;
+};
+
+/**
+ * @brief Defines an executor that schedules functions as jobs on a thread pool.
+ */
+class FThreadPoolExecutor final : public IExecutor
+{
+public:
+
+	/**
+	 * @brief Sets default values for this executor's properties.
+	 *
+	 * @param threadPool The thread pool to schedule functions on. Must outlive this executor.
+	 */
+	explicit FThreadPoolExecutor(FThreadPool& threadPool);
+
+	/**
+	 * @brief Schedules the given function as a job on the thread pool.
+	 *
+	 * @param function The function.
+	 */
+	virtual void Execute(FExecuteFunction function) override;
+
+private:
+
+	FThreadPool& m_ThreadPool;
+};
+
+/**
+ * @brief Defines an executor that queues functions until a specific thread, such as the main thread, runs them.
+ */
+class FQueuedExecutor final : public IExecutor
+{
+public:
+
+	/**
+	 * @brief Queues the given function. May be called from any thread.
+	 *
+	 * @param function The function.
+	 */
+	virtual void Execute(FExecuteFunction function) override;
+
+	/**
+	 * @brief Runs all functions queued so far on the calling thread.
+	 *
+	 * @return The number of functions that were run.
+	 */
+	[[maybe_unused]] int32 ExecutePending();
+
+	/**
+	 * @brief Checks to see if there are functions waiting to be run.
+	 *
+	 * @return True if there are functions waiting to be run, otherwise false.
+	 */
+	[[nodiscard]] bool HasPending() const;
+
+private:
+
+	mutable FMutex m_FunctionsMutex;
+	TArray<FExecuteFunction> m_Functions;
+};
+
+/**
+ * @brief Defines an executor that runs functions the next time an event loop is polled.
+ */
+class FEventLoopExecutor final : public IExecutor
+{
+public:
+
+	/**
+	 * @brief Sets default values for this executor's properties.
+	 *
+	 * @param eventLoop The event loop to run functions on.
+	 */
+	explicit FEventLoopExecutor(TSharedPtr<FEventLoop> eventLoop);
+
+	/**
+	 * @brief Posts the given function to the event loop. May be called from any thread.
+	 *
+	 * @param function The function.
+	 */
+	virtual void Execute(FExecuteFunction function) override;
+
+private:
+
+	TSharedPtr<FEventLoop> m_EventLoop;
+};
\ No newline at end of file
@@ -37,6 +37,13 @@ public:
 	 */
 	[[nodiscard]] bool IsLocked() const;
 
+	/**
+	 * @brief Checks to see if this mutex is locked by the calling thread.
+	 *
+	 * @return True if this mutex is locked by the calling thread, otherwise false.
+	 */
+	[[nodiscard]] bool IsLockedByCallingThread() const;
+
 	/**
 	 * @brief Checks to see if this mutex is valid.
 	 *
@@ -51,6 +58,8 @@ public:
 
 	/**
 	 * @brief Attempts to unlock this mutex.
+	 *
+	 * @remark This mutex must be locked by the calling thread.
 	 */
 	void Unlock();
 
@@ -1,21 +1,162 @@
 #pragma once
 
-#include "Misc/Badge.h"
+#include "Threading/AsyncTask.h"
 
 /**
- * @brief Defines a way to check on the result of an async operation.
+ * @brief Defines the producing side of an async operation, which eventually fulfills its task with a result.
+ *
+ * Promises are cheap to copy, and every copy fulfills the same task. Only the first result given is kept.
  *
  * @tparam T The type of the result of the async operation.
  */
 template<typename T>
 class TPromise
 {
+	using StateType = Private::TAsyncTaskState<T>;
+
+public:
+
+	using ResultType = TErrorOr<T>;
+
+	/**
+	 * @brief Sets default values for this promise's properties.
+	 */
+	TPromise()
+		: m_State { MakeShared<StateType>() }
+	{
+	}
+
+	/**
+	 * @brief Gets the task that is fulfilled by this promise.
+	 *
+	 * @return The task that is fulfilled by this promise.
+	 */
+	[[nodiscard]] TAsyncTask<T> GetTask() const
+	{
+		return TAsyncTask<T> { m_State };
+	}
+
+	/**
+	 * @brief Checks to see if this promise has been fulfilled.
+	 *
+	 * @return True if this promise has been fulfilled, otherwise false.
+	 */
+	[[nodiscard]] bool IsFulfilled() const
+	{
+		return m_State->IsReady();
+	}
+
+	/**
+	 * @brief Fulfills this promise with an error.
+	 *
+	 * @param error The error.
+	 * @return True if this promise was fulfilled, false if it already had been.
+	 */
+	[[maybe_unused]] bool SetError(FError error)
+	{
+		return m_State->TrySetResult(MoveTemp(error));
+	}
+
+	/**
+	 * @brief Fulfills this promise with a result.
+	 *
+	 * @param result The result.
+	 * @return True if this promise was fulfilled, false if it already had been.
+	 */
+	[[maybe_unused]] bool SetResult(ResultType result)
+	{
+		return m_State->TrySetResult(MoveTemp(result));
+	}
+
+	/**
+	 * @brief Fulfills this promise with a value.
+	 *
+	 * @param value The value.
+	 * @return True if this promise was fulfilled, false if it already had been.
+	 */
+	[[maybe_unused]] bool SetValue(T value)
+	{
+		return m_State->TrySetResult(ResultType { MoveTemp(value) });
+	}
+
+private:
+
+	TSharedPtr<StateType> m_State;
 };
 
 /**
- * @brief Defines a way to check on the result of an async operation.
+ * @brief Defines the producing side of an async operation that does not produce a value.
  */
 template<>
 class TPromise<void>
 {
+	using StateType = Private::TAsyncTaskState<void>;
+
+public:
+
+	using ResultType = TErrorOr<void>;
+
+	/**
+	 * @brief Sets default values for this promise's properties.
+	 */
+	TPromise()
+		: m_State { MakeShared<StateType>() }
+	{
+	}
+
+	/**
+	 * @brief Gets the task that is fulfilled by this promise.
+	 *
+	 * @return The task that is fulfilled by this promise.
+	 */
+	[[nodiscard]] TAsyncTask<void> GetTask() const
+	{
+		return TAsyncTask<void> { m_State };
+	}
+
+	/**
+	 * @brief Checks to see if this promise has been fulfilled.
+	 *
+	 * @return True if this promise has been fulfilled, otherwise false.
+	 */
+	[[nodiscard]] bool IsFulfilled() const
+	{
+		return m_State->IsReady();
+	}
+
+	/**
+	 * @brief Fulfills this promise with an error.
+	 *
+	 * @param error The error.
+	 * @return True if this promise was fulfilled, false if it already had been.
+	 */
+	[[maybe_unused]] bool SetError(FError error)
+	{
+		return m_State->TrySetResult(MoveTemp(error));
+	}
+
+	/**
+	 * @brief Fulfills this promise with a result.
+	 *
+	 * @param result The result.
+	 * @return True if this promise was fulfilled, false if it already had been.
+	 */
+	[[maybe_unused]] bool SetResult(ResultType result)
+	{
+		return m_State->TrySetResult(MoveTemp(result));
+	}
+
+	/**
+	 * @brief Fulfills this promise successfully.
+	 *
+	 * @return True if this promise was fulfilled, false if it already had been.
+	 */
+	[[maybe_unused]] bool SetValue()
+	{
+		return m_State->TrySetResult(ResultType {});
+	}
+
+private:
+
+	TSharedPtr<StateType> m_State;
 };
\ No newline at end of file
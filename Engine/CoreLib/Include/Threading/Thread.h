@@ -63,6 +63,13 @@ public:
 		return Create(MoveTemp(voidFunction));
 	}
 
+	/**
+	 * @brief Gets the number of logical processors available to this process.
+	 *
+	 * @return The number of logical processors. Will always be at least one.
+	 */
+	[[nodiscard]] static int32 GetNumLogicalProcessors();
+
 	/**
 	 * @brief Checks to see if this thread is valid.
 	 *
@@ -75,6 +82,11 @@ public:
 	 */
 	void Join();
 
+	/**
+	 * @brief Hints to the processor that the calling thread is spin-waiting.
+	 */
+	static void RelaxProcessor();
+
 	/**
 	 * @brief Sleeps the calling thread for the given duration.
 	 *
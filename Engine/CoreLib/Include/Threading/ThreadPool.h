@@ -0,0 +1,245 @@
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/Function.h"
+#include "Containers/Span.h"
+#include "Memory/SharedPtr.h"
+#include "Memory/UniquePtr.h"
+#include "Threading/Mutex.h"
+#include "Threading/Thread.h"
+#include <atomic>
+
+class FThreadPool;
+
+namespace Private
+{
+	class FThreadPoolJob;
+	class FThreadPoolWorker;
+}
+
+/**
+ * @brief Defines a counter that tracks how many jobs associated with it have yet to finish.
+ *
+ * Jobs may be scheduled to run only once one or more counters reach zero, which is how dependencies between jobs are
+ * expressed. A counter may be shared by many jobs to wait on all of them at once.
+ */
+class FJobCounter final
+{
+	UM_DISABLE_COPY(FJobCounter);
+	UM_DISABLE_MOVE(FJobCounter);
+
+	friend class FThreadPool;
+
+public:
+
+	/**
+	 * @brief Sets default values for this job counter's properties.
+	 */
+	FJobCounter();
+
+	/**
+	 * @brief Destroys this job counter. Any dependent jobs that never got to run are cancelled, and their own counters
+	 *        are signaled as if they had finished.
+	 */
+	~FJobCounter();
+
+	/**
+	 * @brief Gets the number of jobs associated with this counter that have yet to finish.
+	 *
+	 * @return The number of pending jobs.
+	 */
+	[[nodiscard]] int32 GetNumPendingJobs() const;
+
+	/**
+	 * @brief Checks to see if all jobs associated with this counter have finished.
+	 *
+	 * @return True if all jobs associated with this counter have finished, otherwise false.
+	 */
+	[[nodiscard]] bool IsComplete() const;
+
+	/**
+	 * @brief Blocks the calling thread until all jobs associated with this counter have finished.
+	 *
+	 * @remark This does not help execute jobs. Prefer FThreadPool::WaitForCounter when calling from a worker thread.
+	 */
+	void Wait() const;
+
+private:
+
+	std::atomic<int32> m_NumPendingJobs = 0;
+	FMutex m_DependentJobsMutex;
+	TArray<Private::FThreadPoolJob*> m_DependentJobs;
+};
+
+/**
+ * @brief Defines a shareable handle to a job counter.
+ */
+using FJobHandle = TSharedPtr<FJobCounter>;
+
+/**
+ * @brief Defines a work stealing job system.
+ *
+ * Every worker thread owns a queue it pushes to and pops from, and idle workers steal from the other workers' queues.
+ * Jobs scheduled from threads that are not workers of this pool go into a shared injection queue.
+ */
+class FThreadPool final
+{
+	UM_DISABLE_COPY(FThreadPool);
+	UM_DISABLE_MOVE(FThreadPool);
+
+	friend class FJobCounter;
+
+public:
+
+	using FJobFunction = TFunction<void()>;
+	using FParallelForFunction = TFunction<void(int32)>;
+
+	/**
+	 * @brief Creates a thread pool.
+	 *
+	 * @param numWorkers The number of worker threads to create. When zero or less, one worker per logical processor
+	 *                   (minus one for the calling thread) is created.
+	 */
+	explicit FThreadPool(int32 numWorkers = 0);
+
+	/**
+	 * @brief Destroys this thread pool. Jobs that are already queued are finished before the workers exit.
+	 */
+	~FThreadPool();
+
+	/**
+	 * @brief Gets the number of worker threads in this pool.
+	 *
+	 * @return The number of worker threads.
+	 */
+	[[nodiscard]] int32 GetNumWorkers() const;
+
+	/**
+	 * @brief Checks to see if the calling thread is one of this pool's worker threads.
+	 *
+	 * @return True if the calling thread is one of this pool's worker threads, otherwise false.
+	 */
+	[[nodiscard]] bool IsInWorkerThread() const;
+
+	/**
+	 * @brief Splits a range of indices into batches and schedules a job for each batch.
+	 *
+	 * @param numItems The number of items to process.
+	 * @param batchSize The number of items each job processes. When zero or less, a batch size is chosen automatically.
+	 * @param function The function to call for each item index.
+	 * @return The handle to wait on for all batches to finish.
+	 */
+	[[nodiscard]] FJobHandle ParallelFor(int32 numItems, int32 batchSize, FParallelForFunction function);
+
+	/**
+	 * @brief Schedules a job to run.
+	 *
+	 * @param function The job's function.
+	 * @return The handle to wait on for the job to finish.
+	 */
+	[[maybe_unused]] FJobHandle Schedule(FJobFunction function);
+
+	/**
+	 * @brief Schedules a job to run once another job has finished.
+	 *
+	 * @param function The job's function.
+	 * @param dependency The handle of the job that must finish first.
+	 * @return The handle to wait on for the job to finish.
+	 */
+	[[maybe_unused]] FJobHandle Schedule(FJobFunction function, const FJobHandle& dependency);
+
+	/**
+	 * @brief Schedules a job to run once other jobs have finished.
+	 *
+	 * @param function The job's function.
+	 * @param dependencies The handles of the jobs that must finish first.
+	 * @return The handle to wait on for the job to finish.
+	 */
+	[[maybe_unused]] FJobHandle Schedule(FJobFunction function, TSpan<const FJobHandle> dependencies);
+
+	/**
+	 * @brief Schedules a job to run once other jobs have finished, associating it with an existing counter.
+	 *
+	 * @param counter The counter to associate the job with.
+	 * @param function The job's function.
+	 * @param dependencies The handles of the jobs that must finish first.
+	 */
+	void ScheduleWithCounter(const FJobHandle& counter, FJobFunction function, TSpan<const FJobHandle> dependencies = {});
+
+	/**
+	 * @brief Waits for all jobs associated with a counter to finish, executing other jobs while waiting.
+	 *
+	 * This is safe to call from both worker threads and any other thread, such as the main thread.
+	 *
+	 * @param counter The counter to wait on.
+	 */
+	void WaitForCounter(const FJobHandle& counter);
+
+private:
+
+	/**
+	 * @brief Marks one of a counter's jobs as finished, releasing the counter's dependent jobs if it reaches zero.
+	 *
+	 * @param counter The counter.
+	 */
+	void DecrementCounter(FJobCounter& counter);
+
+	/**
+	 * @brief Frees a cancelled job without running it, signaling its counter as if it had finished.
+	 *
+	 * @param job The job.
+	 */
+	void CancelJob(Private::FThreadPoolJob* job);
+
+	/**
+	 * @brief Queues a job whose dependencies have all finished.
+	 *
+	 * @param job The job.
+	 */
+	void EnqueueJob(Private::FThreadPoolJob* job);
+
+	/**
+	 * @brief Executes and frees a job.
+	 *
+	 * @param job The job.
+	 */
+	void ExecuteJob(Private::FThreadPoolJob* job);
+
+	/**
+	 * @brief Finds a job for the calling thread to execute.
+	 *
+	 * @return The job, or null if there are currently no jobs to execute.
+	 */
+	[[nodiscard]] Private::FThreadPoolJob* FindJob();
+
+	/**
+	 * @brief Checks to see if any of this pool's queues appear to have jobs in them.
+	 *
+	 * @return True if any of this pool's queues appear to have jobs in them, otherwise false.
+	 */
+	[[nodiscard]] bool HasQueuedJobs() const;
+
+	/**
+	 * @brief Marks one of a job's dependencies as finished, queueing the job if it was the last one. Cancelled jobs
+	 *        are freed instead of queued.
+	 *
+	 * @param job The job.
+	 */
+	void ResolveDependency(Private::FThreadPoolJob* job);
+
+	/**
+	 * @brief Runs the main loop of a worker thread.
+	 *
+	 * @param workerIndex The index of the worker.
+	 */
+	void RunWorker(int32 workerIndex);
+
+	TArray<TUniquePtr<Private::FThreadPoolWorker>> m_Workers;
+	TArray<Private::FThreadPoolJob*> m_InjectedJobs;
+	int32 m_InjectedJobsHead = 0;
+	FMutex m_InjectedJobsMutex;
+	std::atomic<int32> m_NumInjectedJobs = 0;
+	std::atomic<int32> m_NumWaitingThreads = 0;
+	std::atomic<uint32> m_WorkEpoch = 0;
+	std::atomic<bool> m_IsRunning = true;
+};
\ No newline at end of file
@@ -0,0 +1,248 @@
+#pragma once
+
+#include "Containers/Array.h"
+#include "Engine/Assert.h"
+#include "Memory/Memory.h"
+#include <atomic>
+
+namespace Private
+{
+	/**
+	 * @brief Defines a fixed-capacity circular array used as the backing storage for a work stealing queue.
+	 *
+	 * @tparam T The type of the element pointers stored in the array.
+	 */
+	template<typename T>
+	class TWorkStealingRingArray final
+	{
+		UM_DISABLE_COPY(TWorkStealingRingArray);
+		UM_DISABLE_MOVE(TWorkStealingRingArray);
+
+	public:
+
+		/**
+		 * @brief Sets default values for this ring array's properties.
+		 *
+		 * @param capacity The capacity of the array. Must be a power of two.
+		 */
+		explicit TWorkStealingRingArray(const int64 capacity)
+			: m_Capacity { capacity }
+		{
+			UM_ASSERT(capacity > 0 && (capacity & (capacity - 1)) == 0, "Work stealing ring array capacity must be a power of two");
+
+			// FMemory zeroes its allocations, which is a valid initial state for the atomic pointers
+			m_Elements = FMemory::AllocateArray<std::atomic<T*>>(capacity);
+		}
+
+		/**
+		 * @brief Destroys this ring array.
+		 */
+		~TWorkStealingRingArray()
+		{
+			FMemory::Free(m_Elements);
+		}
+
+		/**
+		 * @brief Gets the element at the given (unwrapped) index.
+		 *
+		 * @param index The index.
+		 * @return The element at the index.
+		 */
+		[[nodiscard]] T* Get(const int64 index) const
+		{
+			return m_Elements[index & (m_Capacity - 1)].load(std::memory_order_relaxed);
+		}
+
+		/**
+		 * @brief Gets this array's capacity.
+		 *
+		 * @return This array's capacity.
+		 */
+		[[nodiscard]] int64 GetCapacity() const
+		{
+			return m_Capacity;
+		}
+
+		/**
+		 * @brief Creates a new array with double the capacity and copies the elements in [top, bottom) to it.
+		 *
+		 * @param top The queue's top index.
+		 * @param bottom The queue's bottom index.
+		 * @return The new array.
+		 */
+		[[nodiscard]] TWorkStealingRingArray* Grow(const int64 top, const int64 bottom) const
+		{
+			TWorkStealingRingArray* newArray = FMemory::AllocateObject<TWorkStealingRingArray>(m_Capacity * 2);
+			for (int64 idx = top; idx < bottom; ++idx)
+			{
+				newArray->Put(idx, Get(idx));
+			}
+
+			return newArray;
+		}
+
+		/**
+		 * @brief Sets the element at the given (unwrapped) index.
+		 *
+		 * @param index The index.
+		 * @param element The element.
+		 */
+		void Put(const int64 index, T* element)
+		{
+			m_Elements[index & (m_Capacity - 1)].store(element, std::memory_order_relaxed);
+		}
+
+	private:
+
+		std::atomic<T*>* m_Elements = nullptr;
+		int64 m_Capacity = 0;
+	};
+
+	/**
+	 * @brief Defines a Chase-Lev work stealing queue.
+	 *
+	 * The owning thread pushes and pops at the bottom of the queue in LIFO order while any other thread may steal from
+	 * the top of the queue in FIFO order. Only the owning thread may call Push and Pop.
+	 *
+	 * @tparam T The type of the element pointers stored in the queue.
+	 */
+	template<typename T>
+	class TWorkStealingQueue final
+	{
+		UM_DISABLE_COPY(TWorkStealingQueue);
+		UM_DISABLE_MOVE(TWorkStealingQueue);
+
+		using FRingArray = TWorkStealingRingArray<T>;
+
+	public:
+
+		/**
+		 * @brief Sets default values for this queue's properties.
+		 *
+		 * @param initialCapacity The initial capacity of the queue. Must be a power of two.
+		 */
+		explicit TWorkStealingQueue(const int64 initialCapacity = 256)
+		{
+			m_Array.store(FMemory::AllocateObject<FRingArray>(initialCapacity), std::memory_order_relaxed);
+		}
+
+		/**
+		 * @brief Destroys this queue. Any elements remaining in the queue are not freed.
+		 */
+		~TWorkStealingQueue()
+		{
+			FMemory::FreeObject(m_Array.load(std::memory_order_relaxed));
+
+			for (FRingArray* retiredArray : m_RetiredArrays)
+			{
+				FMemory::FreeObject(retiredArray);
+			}
+		}
+
+		/**
+		 * @brief Checks to see if this queue appears to be empty. The result may be stale by the time it is used.
+		 *
+		 * @return True if this queue appears to be empty, otherwise false.
+		 */
+		[[nodiscard]] bool IsEmpty() const
+		{
+			const int64 bottom = m_Bottom.load(std::memory_order_relaxed);
+			const int64 top = m_Top.load(std::memory_order_relaxed);
+			return bottom <= top;
+		}
+
+		/**
+		 * @brief Pops the most recently pushed element from the bottom of this queue. Owning thread only.
+		 *
+		 * @return The element, or null if this queue was empty.
+		 */
+		[[nodiscard]] T* Pop()
+		{
+			const int64 bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+			FRingArray* array = m_Array.load(std::memory_order_relaxed);
+			m_Bottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			int64 top = m_Top.load(std::memory_order_relaxed);
+			if (top > bottom)
+			{
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			T* element = array->Get(bottom);
+			if (top == bottom)
+			{
+				// This is the last element, so we need to race any thieves for it
+				if (m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed) == false)
+				{
+					element = nullptr;
+				}
+
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+
+			return element;
+		}
+
+		/**
+		 * @brief Pushes an element onto the bottom of this queue. Owning thread only.
+		 *
+		 * @param element The element.
+		 */
+		void Push(T* element)
+		{
+			const int64 bottom = m_Bottom.load(std::memory_order_relaxed);
+			const int64 top = m_Top.load(std::memory_order_acquire);
+			FRingArray* array = m_Array.load(std::memory_order_relaxed);
+
+			if (bottom - top > array->GetCapacity() - 1)
+			{
+				// Thieves may still be reading from the old array, so it can only be freed alongside the queue
+				m_RetiredArrays.Add(array);
+
+				array = array->Grow(top, bottom);
+				m_Array.store(array, std::memory_order_release);
+			}
+
+			array->Put(bottom, element);
+			std::atomic_thread_fence(std::memory_order_release);
+			m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+		}
+
+		/**
+		 * @brief Attempts to steal the oldest element from the top of this queue. May be called from any thread.
+		 *
+		 * @return The element, or null if this queue was empty or another thread won the race for the element.
+		 */
+		[[nodiscard]] T* Steal()
+		{
+			int64 top = m_Top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const int64 bottom = m_Bottom.load(std::memory_order_acquire);
+
+			if (top >= bottom)
+			{
+				return nullptr;
+			}
+
+			const FRingArray* array = m_Array.load(std::memory_order_acquire);
+			T* element = array->Get(top);
+			if (m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed) == false)
+			{
+				return nullptr;
+			}
+
+			return element;
+		}
+
+	private:
+
+		// Thieves hammer on the top index while the owner works the bottom, so keep them on separate cache lines
+		std::atomic<int64> m_Top = 0;
+		uint8 m_CacheLinePadding[64 - sizeof(std::atomic<int64>)] {};
+		std::atomic<int64> m_Bottom = 0;
+		std::atomic<FRingArray*> m_Array = nullptr;
+		TArray<FRingArray*> m_RetiredArrays;
+	};
+}
\ No newline at end of file
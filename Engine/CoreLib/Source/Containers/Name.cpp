@@ -0,0 +1,255 @@
+#include "Containers/HashMap.h"
+#include "Containers/Name.h"
+#include "Containers/String.h"
+#include "Memory/Memory.h"
+#include "Misc/StringBuilder.h"
+#include "Threading/LockGuard.h"
+#include "Threading/Mutex.h"
+#include <atomic>
+
+namespace Private
+{
+	DEFINE_PRIMITIVE_TYPE_DEFINITION(FName)
+}
+
+/**
+ * @brief Defines an entry in the name table.
+ */
+struct FNameEntry
+{
+	/** @brief The entry's characters. These are never freed. */
+	const char* Chars = nullptr;
+
+	/** @brief The number of characters in the entry. */
+	int32 Length = 0;
+};
+
+/**
+ * @brief Defines the global table of name strings.
+ *
+ * Entries live in fixed-size blocks that are never moved or freed, so an entry can be read by index without a lock.
+ * Looking up a string takes a lock on only one of several shards, which keeps threads creating names at the same time
+ * from waiting on each other most of the time.
+ */
+class FNameTable final
+{
+	UM_DISABLE_COPY(FNameTable);
+	UM_DISABLE_MOVE(FNameTable);
+
+public:
+
+	/**
+	 * @brief Gets the name table.
+	 *
+	 * @return The name table.
+	 */
+	[[nodiscard]] static FNameTable& Get()
+	{
+		static FNameTable GNameTable;
+		return GNameTable;
+	}
+
+	/**
+	 * @brief Gets the string of the entry at the given index.
+	 *
+	 * @param index The entry's index.
+	 * @return The entry's string.
+	 */
+	[[nodiscard]] FStringView GetString(const uint32 index) const
+	{
+		if (index == 0)
+		{
+			return {};
+		}
+
+		const FNameEntry* block = m_EntryBlocks[index >> EntriesPerBlockBits].load(std::memory_order_acquire);
+		UM_ASSERT(block != nullptr, "Invalid name index");
+
+		const FNameEntry& entry = block[index & (EntriesPerBlock - 1)];
+		return FStringView { entry.Chars, entry.Length };
+	}
+
+	/**
+	 * @brief Finds the index of the entry for a string, adding an entry if there is not one yet.
+	 *
+	 * @param string The string.
+	 * @return The index of the entry for \p string.
+	 */
+	[[nodiscard]] uint32 FindOrAdd(const FStringView string)
+	{
+		if (string.IsEmpty())
+		{
+			return 0;
+		}
+
+		FNameTableShard& shard = m_Shards[GetHashCode(string) % NumShards];
+		FScopedLockGuard shardLock { shard.Mutex };
+
+		if (const uint32* existingIndex = shard.Indices.Find(string))
+		{
+			return *existingIndex;
+		}
+
+		const uint32 index = AddEntry(string);
+		(void)shard.Indices.Add(GetString(index), index);
+		return index;
+	}
+
+private:
+
+	static constexpr uint32 EntriesPerBlockBits = 16;
+	static constexpr uint32 EntriesPerBlock = 1 << EntriesPerBlockBits;
+	static constexpr uint32 MaxEntryBlocks = 1024;
+	static constexpr int32 CharBlockSize = 64 * 1024;
+	static constexpr uint32 NumShards = 16;
+
+	/**
+	 * @brief Defines a shard of the lookup from strings to entry indices.
+	 */
+	struct FNameTableShard
+	{
+		FMutex Mutex;
+		THashMap<FStringView, uint32> Indices;
+	};
+
+	/**
+	 * @brief Sets default values for the name table's properties.
+	 */
+	FNameTable()
+	{
+		// Index zero is reserved for the empty name
+		m_NumEntries = 1;
+	}
+
+	/**
+	 * @brief Adds an entry for a string.
+	 *
+	 * @param string The string.
+	 * @return The new entry's index.
+	 */
+	[[nodiscard]] uint32 AddEntry(const FStringView string)
+	{
+		FScopedLockGuard entryLock { m_EntryMutex };
+
+		const uint32 index = m_NumEntries;
+		const uint32 blockIndex = index >> EntriesPerBlockBits;
+		UM_ASSERT(blockIndex < MaxEntryBlocks, "Ran out of name table entries");
+
+		FNameEntry* block = m_EntryBlocks[blockIndex].load(std::memory_order_relaxed);
+		if (block == nullptr)
+		{
+			block = FMemory::AllocateArray<FNameEntry>(EntriesPerBlock);
+			m_EntryBlocks[blockIndex].store(block, std::memory_order_release);
+		}
+
+		FNameEntry& entry = block[index & (EntriesPerBlock - 1)];
+		entry.Chars = CopyChars(string);
+		entry.Length = string.Length();
+
+		++m_NumEntries;
+		return index;
+	}
+
+	/**
+	 * @brief Copies a string's characters into storage that is never freed.
+	 *
+	 * @param string The string.
+	 * @return The copied characters.
+	 */
+	[[nodiscard]] const char* CopyChars(const FStringView string)
+	{
+		// Long strings get their own allocation so that they don't waste the rest of a block
+		if (string.Length() > CharBlockSize / 4)
+		{
+			char* chars = static_cast<char*>(FMemory::Allocate(string.Length()));
+			FMemory::Copy(chars, string.GetChars(), string.Length());
+			return chars;
+		}
+
+		if (m_CharBlock == nullptr || m_CharBlockOffset + string.Length() > CharBlockSize)
+		{
+			m_CharBlock = static_cast<char*>(FMemory::Allocate(CharBlockSize));
+			m_CharBlockOffset = 0;
+		}
+
+		char* chars = m_CharBlock + m_CharBlockOffset;
+		FMemory::Copy(chars, string.GetChars(), string.Length());
+		m_CharBlockOffset += string.Length();
+		return chars;
+	}
+
+	std::atomic<FNameEntry*> m_EntryBlocks[MaxEntryBlocks] = {};
+	FNameTableShard m_Shards[NumShards];
+	FMutex m_EntryMutex;
+	char* m_CharBlock = nullptr;
+	int32 m_CharBlockOffset = 0;
+	uint32 m_NumEntries = 0;
+};
+
+FName::FName(const FStringView name)
+	: m_Index { FNameTable::Get().FindOrAdd(name) }
+{
+}
+
+FName::FName(const FStringView plainName, const uint32 number)
+	: m_Index { FNameTable::Get().FindOrAdd(plainName) }
+	, m_Number { number }
+{
+}
+
+ECompareResult FName::Compare(const FName other) const
+{
+	if (m_Index != other.m_Index)
+	{
+		const ECompareResult plainNameResult = GetPlainName().Compare(other.GetPlainName());
+		if (plainNameResult != ECompareResult::Equals)
+		{
+			return plainNameResult;
+		}
+	}
+
+	if (m_Number == other.m_Number)
+	{
+		return ECompareResult::Equals;
+	}
+
+	return m_Number < other.m_Number ? ECompareResult::LessThan : ECompareResult::GreaterThan;
+}
+
+void FName::AppendToStringBuilder(FStringBuilder& builder) const
+{
+	builder.Append(GetPlainName());
+
+	if (m_Number != NoNumber)
+	{
+		builder.Append('_');
+		builder.Append(static_cast<uint64>(m_Number));
+	}
+}
+
+FStringView FName::GetPlainName() const
+{
+	return FNameTable::Get().GetString(m_Index);
+}
+
+FString FName::ToString() const
+{
+	if (m_Number == NoNumber)
+	{
+		return FString { GetPlainName() };
+	}
+
+	FStringBuilder builder;
+	AppendToStringBuilder(builder);
+	return builder.ReleaseString();
+}
+
+void TFormatter<FName>::BuildString(const FName& value, FStringBuilder& builder) const
+{
+	value.AppendToStringBuilder(builder);
+}
+
+bool TFormatter<FName>::Parse(const FStringView /*formatString*/)
+{
+	return true;
+}
\ No newline at end of file
@@ -7,6 +7,21 @@
 
 ECompareResult FStringView::Compare(const FStringView other, const EStringComparison comparison) const
 {
+	if (comparison == EStringComparison::Ordinal || comparison == EStringComparison::OrdinalIgnoreCase)
+	{
+		const SizeType lengthToCompare = Length() < other.Length() ? Length() : other.Length();
+		const ECompareResult result = comparison == EStringComparison::OrdinalIgnoreCase
+		                            ? FCString::StrCaseCmp(GetChars(), other.GetChars(), lengthToCompare)
+		                            : FCString::StrCmp(GetChars(), other.GetChars(), lengthToCompare);
+
+		if (result != ECompareResult::Equals || Length() == other.Length())
+		{
+			return result;
+		}
+
+		return Length() < other.Length() ? ECompareResult::LessThan : ECompareResult::GreaterThan;
+	}
+
 	TErrorOr<ECompareResult> result = FInternationalization::CompareStrings(AsSpan(), other.AsSpan(), comparison);
 
 	if (result.IsError())
@@ -38,15 +53,8 @@ FStringView::SizeType FStringView::IndexOf(const CharType value, const SizeType
 		return INDEX_NONE;
 	}
 
-	for (SizeType idx = startIndex; idx < startIndex + count; ++idx)
-	{
-		if (At(idx) == value)
-		{
-			return idx;
-		}
-	}
-
-	return INDEX_NONE;
+	const SizeType foundIndex = FCString::StrChr(GetChars() + startIndex, count, value);
+	return foundIndex == INDEX_NONE ? INDEX_NONE : foundIndex + startIndex;
 }
 
 FStringView::SizeType FStringView::IndexOf(const FStringView value, const SizeType startIndex, const SizeType count, const EStringComparison comparison) const
@@ -61,6 +61,10 @@ namespace Private::SeriouslyDontTouch
 	{
 		// TODO We may need to only shut down the logging subsystem
 		// TODO Allow the application to shutdown?
+
+		// Log files are buffered, so make sure whatever explains the crash actually makes it out
+		Private::FLogger::GetInstance().Flush();
+
 		std::terminate();
 	}
 }
\ No newline at end of file
@@ -3,31 +3,22 @@
 
 namespace Private
 {
-	// Hashing is using the FNV-1a algorithm http://www.isthe.com/chongo/tech/comp/fnv/
-	constexpr uint64 HashInit = 14695981039346656037ULL;
-	constexpr uint64 HashPrime = 0x100000001b3ULL;
-
 	uint64 HashBytesWithInitialHash(const TSpan<const uint8> bytes, const uint64 initialHash)
 	{
-		uint64 hash = initialHash;
-		for (const uint8 byte : bytes)
-		{
-			hash ^= byte;
-			hash *= HashPrime;
-		}
+		return HashBytesWithSeed(bytes, initialHash);
+	}
+
+	uint64 HashBytesWithSeed(const TSpan<const uint8> bytes, const uint64 seed)
+	{
+		const uint64 hash = HashByteSequence(bytes.GetData(), bytes.Num(), seed);
 
 		UM_ASSERT(hash != INVALID_HASH, "Somehow hashed a byte array into the invalid hash value");
 
 		return hash;
 	}
 
-	uint64 HashBytes(TSpan<const uint8> bytes)
-	{
-		return HashBytesWithInitialHash(bytes, HashInit);
-	}
-
-	uint64 HashCombine(uint64 firstHash, uint64 secondHash)
+	uint64 HashBytes(const TSpan<const uint8> bytes)
 	{
-		return HashBytesWithInitialHash(CastToBytes(secondHash), firstHash);
+		return HashBytesWithSeed(bytes, DefaultHashSeed);
 	}
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "Containers/InternalString.h"
+#include "Engine/CommandLine.h"
 #include "Engine/InternalLogging.h"
 #include "Engine/Logging/DynamicLoggerInstance.h"
 #include "HAL/DateTime.h"
@@ -13,6 +14,16 @@ namespace Private
 		return GLoggerInstance;
 	}
 
+	bool FLogger::IsAsyncLoggingEnabled()
+	{
+		return GLoggerInstance.IsAsyncWritingEnabled();
+	}
+
+	void FLogger::SetAsyncLoggingEnabled(const bool enabled)
+	{
+		GLoggerInstance.SetAsyncWritingEnabled(enabled);
+	}
+
 	constexpr FStringView GetLogTagForLogLevel(const ELogLevel logLevel)
 	{
 		switch (logLevel)
@@ -42,6 +53,11 @@ namespace Private
 	}
 
 	FString CreateLogString(ELogLevel logLevel, FStringView message, const TSpan<Private::FStringFormatArgument> messageArgs)
+	{
+		return CreateLogString(logLevel, FDateTime::Now(), message, messageArgs);
+	}
+
+	FString CreateLogString(ELogLevel logLevel, const FDateTime time, FStringView message, const TSpan<Private::FStringFormatArgument> messageArgs)
 	{
 		FStringBuilder builder;
 		builder.Reserve(message.Length() + messageArgs.Num() * 4 + 20);
@@ -49,7 +65,7 @@ namespace Private
 		// Append the log time
 		TFormatter<FDateTime> dateTimeFormatter;
 		dateTimeFormatter.Parse("%H:%M:%S.%s"_sv);
-		dateTimeFormatter.BuildString(FDateTime::Now(), builder);
+		dateTimeFormatter.BuildString(time, builder);
 
 		// Append the log tag
 		builder.Append(" "_sv);
@@ -70,6 +86,15 @@ namespace Private
 		}
 
 		GLoggerInstance.Initialize();
+
+		for (const FStringView argument : FCommandLine::GetArguments())
+		{
+			if (argument == "-asynclog"_sv)
+			{
+				GLoggerInstance.SetAsyncWritingEnabled(true);
+				break;
+			}
+		}
 	}
 
 	void ShutdownLogging()
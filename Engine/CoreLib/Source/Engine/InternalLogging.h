@@ -3,6 +3,7 @@
 #include "Containers/String.h"
 #include "Engine/Error.h"
 #include "Engine/Logging.h"
+#include "HAL/DateTime.h"
 #include "Misc/StringFormatting.h"
 
 namespace Private
@@ -26,6 +27,17 @@ namespace Private
 	 */
 	FString CreateLogString(ELogLevel logLevel, FStringView message, TSpan<Private::FStringFormatArgument> messageArgs);
 
+	/**
+	 * @brief Creates a formatted string for logging.
+	 *
+	 * @param logLevel The log level.
+	 * @param time The time the message was logged at.
+	 * @param message The log message.
+	 * @param messageArgs The arguments to use when formatting the message.
+	 * @return The log string.
+	 */
+	FString CreateLogString(ELogLevel logLevel, FDateTime time, FStringView message, TSpan<Private::FStringFormatArgument> messageArgs);
+
 	/**
 	 * @brief Attempts to initialize the logging system.
 	 *
@@ -141,8 +141,7 @@ TErrorOr<ECompareResult> FInternationalization::CompareStrings(const CharSpanTyp
 	{
 		// TODO Log here if GCollator is null?
 
-		// Kinda hacky, but EIgnoreCase inherits from bool, so...
-		const EIgnoreCase ignoreCase = static_cast<EIgnoreCase>(IsCaseSensitiveComparison(comparison));
+		const EIgnoreCase ignoreCase = IsCaseSensitiveComparison(comparison) ? EIgnoreCase::No : EIgnoreCase::Yes;
 		return Private::OrdinalCompareCharSpans(first, second, ignoreCase);
 	}
 
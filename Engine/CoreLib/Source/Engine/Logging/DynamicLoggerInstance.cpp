@@ -4,10 +4,67 @@
 #include "Engine/InternalLogging.h"
 #include "HAL/Path.h"
 #include "Memory/Memory.h"
+#include "Threading/LockGuard.h"
+
+// The number of times the writer thread checks for new messages before going to sleep
+static constexpr int32 GNumIdleSpinsBeforeSleeping = 64;
+
+// Set while the calling thread is writing to the listeners so that anything it logs in the meantime is written
+// straight away instead of waiting on the writer mutex it already holds
+static thread_local bool GIsWritingToListeners = false;
+
+// Reused by each thread to encode the messages it logs
+static thread_local TArray<uint8> GEncodedLogRecord;
+
+/**
+ * @brief Defines a scoped lock on the writer mutex that also marks the calling thread as writing to the listeners.
+ */
+class FScopedListenerWriteLock final
+{
+	UM_DISABLE_COPY(FScopedListenerWriteLock);
+	UM_DISABLE_MOVE(FScopedListenerWriteLock);
+
+public:
+
+	/**
+	 * @brief Locks the writer mutex.
+	 *
+	 * @param mutex The writer mutex.
+	 */
+	explicit FScopedListenerWriteLock(FMutex& mutex)
+		: m_Lock { mutex }
+	{
+		GIsWritingToListeners = true;
+	}
+
+	/**
+	 * @brief Unlocks the writer mutex.
+	 */
+	~FScopedListenerWriteLock()
+	{
+		GIsWritingToListeners = false;
+	}
+
+private:
+
+	FScopedLockGuard m_Lock;
+};
+
+FDynamicLoggerInstance::~FDynamicLoggerInstance()
+{
+	SetAsyncWritingEnabled(false);
+}
+
+void FDynamicLoggerInstance::AddListener(TUniquePtr<ILogListener> listener)
+{
+	UM_ASSERT(IsAsyncWritingEnabled() == false, "Attempting to add a log listener while writing asynchronously");
+
+	m_Listeners.Add(MoveTemp(listener));
+}
 
 bool FDynamicLoggerInstance::Initialize()
 {
-	m_Listeners.Add(MakeUnique<FStdLogListener>());
+	AddListener(MakeUnique<FStdLogListener>());
 
 	// TODO VisualStudioLogListener
 
@@ -15,7 +72,7 @@ bool FDynamicLoggerInstance::Initialize()
 	const FString fileLogName = FPath::GetExecutableName() + ".log"_sv;
 	if (fileLogger->Open(fileLogName))
 	{
-		m_Listeners.Add(MoveTemp(fileLogger));
+		AddListener(MoveTemp(fileLogger));
 	}
 	else
 	{
@@ -27,25 +84,198 @@ bool FDynamicLoggerInstance::Initialize()
 
 void FDynamicLoggerInstance::Flush()
 {
+	if (IsAsyncWritingEnabled() && GIsWritingToListeners == false)
+	{
+		FScopedListenerWriteLock lock { m_WriterMutex };
+		(void)WriteRecordedMessages();
+
+		for (TUniquePtr<ILogListener>& listener : m_Listeners)
+		{
+			listener->Flush();
+		}
+
+		return;
+	}
+
 	for (TUniquePtr<ILogListener>& listener : m_Listeners)
 	{
 		listener->Flush();
 	}
 }
 
+void FDynamicLoggerInstance::SetAsyncWritingEnabled(const bool enabled)
+{
+	if (enabled == IsAsyncWritingEnabled())
+	{
+		return;
+	}
+
+	if (enabled)
+	{
+		m_ShouldWriterThreadStop.store(false, std::memory_order_seq_cst);
+		m_WriterThread = MakeUnique<FThread>(FThread::Create([this]()
+		{
+			RunWriterThread();
+		}));
+
+		m_IsAsyncWritingEnabled.store(true, std::memory_order_release);
+		return;
+	}
+
+	m_IsAsyncWritingEnabled.store(false, std::memory_order_release);
+	m_ShouldWriterThreadStop.store(true, std::memory_order_seq_cst);
+	WakeWriterThread();
+
+	m_WriterThread->Join();
+	m_WriterThread.Reset();
+
+	// Anything recorded while the writer thread was shutting down still needs to be written
+	Flush();
+}
+
 void FDynamicLoggerInstance::Shutdown()
 {
+	SetAsyncWritingEnabled(false);
+
 	m_Listeners.Clear();
 }
 
 void FDynamicLoggerInstance::WriteImpl(const ELogLevel logLevel, const FStringView message, const TSpan<Private::FStringFormatArgument> messageArgs)
 {
-	const FString formattedMessage = Private::CreateLogString(logLevel, message, messageArgs);
+	if (IsAsyncWritingEnabled() == false || GIsWritingToListeners)
+	{
+		WriteToListeners(logLevel, FDateTime::Now(), message, messageArgs);
+#if UMBRAL_DEBUG
+		for (TUniquePtr<ILogListener>& listener : m_Listeners)
+		{
+			listener->Flush();
+		}
+#endif
+		return;
+	}
+
+	const FDateTime time = FDateTime::Now();
+
+	// Assertions and fatal errors are about to take the application down, so they need to be written out along with
+	// everything that was logged before them while there's still a chance
+	if (logLevel >= ELogLevel::Assert)
+	{
+		WriteImmediately(logLevel, time, message, messageArgs);
+		return;
+	}
+
+	EncodeLogRecord(logLevel, time, message, messageArgs, GEncodedLogRecord);
+	if (GEncodedLogRecord.Num() > FLogRecordRingBuffer::MaxRecordSize)
+	{
+		WriteImmediately(logLevel, time, message, messageArgs);
+		return;
+	}
+
+	while (m_RecordQueue.TryWrite(GEncodedLogRecord.AsSpan()) == false)
+	{
+		if (IsAsyncWritingEnabled() == false)
+		{
+			WriteImmediately(logLevel, time, message, messageArgs);
+			return;
+		}
+
+		// The writer thread is falling behind, so make sure it's awake and give it a chance to catch up
+		WakeWriterThread();
+		FThread::RelaxProcessor();
+	}
+
+	WakeWriterThread();
+}
+
+int32 FDynamicLoggerInstance::WriteRecordedMessages()
+{
+	return m_RecordQueue.ReadAll([this](const TSpan<const uint8> recordBytes)
+	{
+		DecodeLogRecord(recordBytes, m_Record);
+		WriteToListeners(m_Record.LogLevel, m_Record.Time, m_Record.Message, m_Record.MessageArgs.AsSpan());
+	});
+}
+
+void FDynamicLoggerInstance::WriteToListeners(const ELogLevel logLevel, const FDateTime time, const FStringView message, const TSpan<Private::FStringFormatArgument> messageArgs)
+{
+	const FString formattedMessage = Private::CreateLogString(logLevel, time, message, messageArgs);
 	for (TUniquePtr<ILogListener>& listener : m_Listeners)
 	{
 		listener->Write(logLevel, formattedMessage);
-#if UMBRAL_DEBUG
+	}
+}
+
+void FDynamicLoggerInstance::WriteImmediately(const ELogLevel logLevel, const FDateTime time, const FStringView message, const TSpan<Private::FStringFormatArgument> messageArgs)
+{
+	FScopedListenerWriteLock lock { m_WriterMutex };
+	(void)WriteRecordedMessages();
+
+	WriteToListeners(logLevel, time, message, messageArgs);
+	for (TUniquePtr<ILogListener>& listener : m_Listeners)
+	{
 		listener->Flush();
-#endif
 	}
+}
+
+void FDynamicLoggerInstance::RunWriterThread()
+{
+	int32 numIdleSpins = 0;
+	while (true)
+	{
+		int32 numMessagesWritten = 0;
+		{
+			FScopedListenerWriteLock lock { m_WriterMutex };
+			numMessagesWritten = WriteRecordedMessages();
+
+			// Listeners are only flushed once per batch instead of once per message
+			if (numMessagesWritten > 0)
+			{
+				for (TUniquePtr<ILogListener>& listener : m_Listeners)
+				{
+					listener->Flush();
+				}
+			}
+		}
+
+		if (numMessagesWritten > 0)
+		{
+			numIdleSpins = 0;
+			continue;
+		}
+
+		if (m_ShouldWriterThreadStop.load(std::memory_order_seq_cst))
+		{
+			break;
+		}
+
+		if (numIdleSpins < GNumIdleSpinsBeforeSleeping)
+		{
+			++numIdleSpins;
+			FThread::RelaxProcessor();
+			continue;
+		}
+
+		// Anything recorded after we say we're sleeping is guaranteed to either be seen by the check below or to wake us
+		const uint32 epoch = m_WriterThreadEpoch.load(std::memory_order_acquire);
+		m_IsWriterThreadSleeping.store(true, std::memory_order_seq_cst);
+
+		if (m_RecordQueue.HasPendingRecords() == false && m_ShouldWriterThreadStop.load(std::memory_order_seq_cst) == false)
+		{
+			m_WriterThreadEpoch.wait(epoch, std::memory_order_acquire);
+		}
+
+		m_IsWriterThreadSleeping.store(false, std::memory_order_relaxed);
+		numIdleSpins = 0;
+	}
+}
+
+void FDynamicLoggerInstance::WakeWriterThread()
+{
+	if (m_IsWriterThreadSleeping.load(std::memory_order_seq_cst) == false)
+	{
+		return;
+	}
+
+	(void)m_WriterThreadEpoch.fetch_add(1, std::memory_order_release);
+	m_WriterThreadEpoch.notify_one();
 }
\ No newline at end of file
@@ -2,7 +2,11 @@
 
 #include "Containers/Array.h"
 #include "Engine/Logging/LogListener.h"
+#include "Engine/Logging/LogRecordQueue.h"
 #include "Memory/UniquePtr.h"
+#include "Threading/Mutex.h"
+#include "Threading/Thread.h"
+#include <atomic>
 
 /**
  * @brief Defines a logger instance that accepts a dynamic number of log listeners.
@@ -11,9 +15,33 @@ class FDynamicLoggerInstance : public Private::ILoggerInstance
 {
 public:
 
+	/**
+	 * @brief Destroys this dynamic logger instance.
+	 */
+	virtual ~FDynamicLoggerInstance() override;
+
+	/**
+	 * @brief Adds a listener that every log message will be written to.
+	 *
+	 * @remark Listeners cannot be added while log messages are being written asynchronously.
+	 *
+	 * @param listener The listener.
+	 */
+	void AddListener(TUniquePtr<ILogListener> listener);
+
 	/** @inheritdoc */
 	virtual bool Initialize() override;
 
+	/**
+	 * @brief Checks to see if log messages are written asynchronously.
+	 *
+	 * @return True if log messages are written asynchronously, otherwise false.
+	 */
+	[[nodiscard]] bool IsAsyncWritingEnabled() const
+	{
+		return m_IsAsyncWritingEnabled.load(std::memory_order_acquire);
+	}
+
 	/**
 	 * @brief Checks to see if this dynamic logger instance is initialized.
 	 *
@@ -27,6 +55,14 @@ public:
 	/** @inheritdoc */
 	virtual void Flush() override;
 
+	/**
+	 * @brief Sets whether or not log messages are written asynchronously. When enabled, writing a message only records
+	 *        it, and a background thread formats and writes recorded messages to the listeners in batches.
+	 *
+	 * @param enabled True to write log messages asynchronously, false to write them on the calling thread.
+	 */
+	void SetAsyncWritingEnabled(bool enabled);
+
 	/** @inheritdoc */
 	virtual void Shutdown() override;
 
@@ -35,5 +71,51 @@ public:
 
 private:
 
+	/**
+	 * @brief Writes every recorded message to the listeners. The writer mutex must be locked by the calling thread.
+	 *
+	 * @return The number of messages that were written.
+	 */
+	int32 WriteRecordedMessages();
+
+	/**
+	 * @brief Formats a message and writes it to the listeners.
+	 *
+	 * @param logLevel The log level.
+	 * @param time The time the message was logged at.
+	 * @param message The message.
+	 * @param messageArgs The message formatting arguments.
+	 */
+	void WriteToListeners(ELogLevel logLevel, FDateTime time, FStringView message, TSpan<Private::FStringFormatArgument> messageArgs);
+
+	/**
+	 * @brief Writes every recorded message followed by the given message, then flushes the listeners. Used for messages
+	 *        that need to be written out immediately while writing asynchronously.
+	 *
+	 * @param logLevel The log level.
+	 * @param time The time the message was logged at.
+	 * @param message The message.
+	 * @param messageArgs The message formatting arguments.
+	 */
+	void WriteImmediately(ELogLevel logLevel, FDateTime time, FStringView message, TSpan<Private::FStringFormatArgument> messageArgs);
+
+	/**
+	 * @brief Runs the background writer thread until it is asked to stop.
+	 */
+	void RunWriterThread();
+
+	/**
+	 * @brief Wakes the background writer thread up if it is sleeping.
+	 */
+	void WakeWriterThread();
+
 	TArray<TUniquePtr<ILogListener>> m_Listeners;
+	FLogRecordQueue m_RecordQueue;
+	FLogRecord m_Record;
+	FMutex m_WriterMutex;
+	TUniquePtr<FThread> m_WriterThread;
+	std::atomic<uint32> m_WriterThreadEpoch = 0;
+	std::atomic<bool> m_IsWriterThreadSleeping = false;
+	std::atomic<bool> m_ShouldWriterThreadStop = false;
+	std::atomic<bool> m_IsAsyncWritingEnabled = false;
 };
\ No newline at end of file
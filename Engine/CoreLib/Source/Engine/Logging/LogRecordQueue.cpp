@@ -0,0 +1,436 @@
+#include "Containers/InternalString.h"
+#include "Engine/Logging/LogRecordQueue.h"
+#include "Math/Math.h"
+#include "Memory/Memory.h"
+#include "Misc/StringBuilder.h"
+#include "Templates/NumericLimits.h"
+#include "Threading/LockGuard.h"
+
+/**
+ * @brief An enumeration of the types of arguments that can be stored in an encoded log record.
+ */
+enum class ELogRecordArgumentType : uint8
+{
+	Bool,
+	Char,
+	Int64,
+	UInt64,
+	Float,
+	Double,
+	String,
+	Pointer
+};
+
+/**
+ * @brief Defines the calling thread's ring buffer in the current log record queue.
+ *
+ * The thread shares ownership of its ring buffer with the queue, so it can always let the ring buffer know it has exited
+ * without having to know whether or not the queue still exists.
+ */
+struct FThreadLogRecordRingBuffer
+{
+	/**
+	 * @brief Destroys this thread's ring buffer reference, letting the queue know it can free the ring buffer.
+	 */
+	~FThreadLogRecordRingBuffer();
+
+	/** @brief The queue the ring buffer belongs to. */
+	const FLogRecordQueue* Queue = nullptr;
+
+	/** @brief The ring buffer. */
+	TSharedPtr<FLogRecordRingBuffer> RingBuffer;
+
+	/** @brief The queue generation the ring buffer was created in. */
+	uint64 Generation = 0;
+};
+
+// Incremented whenever a log record queue is destroyed so that threads don't mistake a new queue at the same
+// address for the old one
+static std::atomic<uint64> GLogRecordQueueGeneration = 1;
+static thread_local FThreadLogRecordRingBuffer GThreadRingBuffer;
+
+FThreadLogRecordRingBuffer::~FThreadLogRecordRingBuffer()
+{
+	if (RingBuffer.IsValid())
+	{
+		RingBuffer->MarkOwnerExited();
+	}
+}
+
+/**
+ * @brief Appends the bytes of a value to an encoded log record.
+ *
+ * @tparam T The type of the value.
+ * @param bytes The encoded log record.
+ * @param value The value.
+ */
+template<typename T>
+static void AppendLogRecordValue(TArray<uint8>& bytes, const T& value)
+{
+	bytes.Append(reinterpret_cast<const uint8*>(&value), static_cast<int32>(sizeof(T)));
+}
+
+/**
+ * @brief Appends a string to an encoded log record.
+ *
+ * @param bytes The encoded log record.
+ * @param value The string.
+ */
+static void AppendLogRecordString(TArray<uint8>& bytes, const FStringView value)
+{
+	AppendLogRecordValue(bytes, value.Length());
+	bytes.Append(reinterpret_cast<const uint8*>(value.GetChars()), value.Length());
+}
+
+/**
+ * @brief Appends a string formatting argument to an encoded log record.
+ *
+ * @param bytes The encoded log record.
+ * @param argument The string formatting argument. Must not use a custom type formatter.
+ */
+static void AppendLogRecordArgument(TArray<uint8>& bytes, const Private::FStringFormatArgument& argument)
+{
+	const auto appendTypedValue = [&bytes](const ELogRecordArgumentType type, const auto& value)
+	{
+		AppendLogRecordValue(bytes, type);
+		AppendLogRecordValue(bytes, value);
+	};
+
+	const Private::FStringFormatArgument::ValueType& value = argument.GetValue();
+	if (value.Is<bool>())
+	{
+		appendTypedValue(ELogRecordArgumentType::Bool, value.GetValue<bool>());
+	}
+	else if (value.Is<char>())
+	{
+		appendTypedValue(ELogRecordArgumentType::Char, value.GetValue<char>());
+	}
+	else if (value.Is<int64>())
+	{
+		appendTypedValue(ELogRecordArgumentType::Int64, value.GetValue<int64>());
+	}
+	else if (value.Is<uint64>())
+	{
+		appendTypedValue(ELogRecordArgumentType::UInt64, value.GetValue<uint64>());
+	}
+	else if (value.Is<float>())
+	{
+		appendTypedValue(ELogRecordArgumentType::Float, value.GetValue<float>());
+	}
+	else if (value.Is<double>())
+	{
+		appendTypedValue(ELogRecordArgumentType::Double, value.GetValue<double>());
+	}
+	else if (value.Is<FStringView>())
+	{
+		AppendLogRecordValue(bytes, ELogRecordArgumentType::String);
+		AppendLogRecordString(bytes, value.GetValue<FStringView>());
+	}
+	else if (value.Is<const void*>())
+	{
+		appendTypedValue(ELogRecordArgumentType::Pointer, value.GetValue<const void*>());
+	}
+	else
+	{
+		UM_ASSERT_NOT_REACHED_MSG("Attempting to encode a log record argument that cannot be copied");
+	}
+}
+
+/**
+ * @brief Checks to see if a log message can be formatted after the arguments it was given have gone away.
+ *
+ * @param messageArgs The arguments for the message.
+ * @return True if the message can be formatted later, otherwise false.
+ */
+static bool CanDeferLogRecordFormatting(const TSpan<Private::FStringFormatArgument> messageArgs)
+{
+	if (messageArgs.Num() > static_cast<int32>(TNumericLimits<uint8>::MaxValue))
+	{
+		return false;
+	}
+
+	for (const Private::FStringFormatArgument& argument : messageArgs)
+	{
+		const Private::FStringFormatArgument::ValueType& value = argument.GetValue();
+		if (value.Is<FEmptyType>() || value.Is<TUniquePtr<Private::ITypeFormatter>>())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief Defines a way to read values back out of an encoded log record.
+ */
+class FLogRecordReader
+{
+public:
+
+	/**
+	 * @brief Sets default values for this reader's properties.
+	 *
+	 * @param bytes The encoded log record.
+	 */
+	explicit FLogRecordReader(const TSpan<const uint8> bytes)
+		: m_Bytes { bytes }
+	{
+	}
+
+	/**
+	 * @brief Reads a string.
+	 *
+	 * @return The string. Points into the encoded log record.
+	 */
+	[[nodiscard]] FStringView ReadString()
+	{
+		const int32 length = ReadValue<int32>();
+		UM_ASSERT(m_Offset + length <= m_Bytes.Num(), "Encoded log record string is out of bounds");
+
+		const FStringView result { reinterpret_cast<const char*>(m_Bytes.GetData() + m_Offset), length };
+		m_Offset += length;
+		return result;
+	}
+
+	/**
+	 * @brief Reads a value.
+	 *
+	 * @tparam T The type of the value.
+	 * @return The value.
+	 */
+	template<typename T>
+	[[nodiscard]] T ReadValue()
+	{
+		UM_ASSERT(m_Offset + static_cast<int32>(sizeof(T)) <= m_Bytes.Num(), "Encoded log record value is out of bounds");
+
+		T result;
+		FMemory::Copy(&result, m_Bytes.GetData() + m_Offset, sizeof(T));
+		m_Offset += static_cast<int32>(sizeof(T));
+		return result;
+	}
+
+private:
+
+	TSpan<const uint8> m_Bytes;
+	int32 m_Offset = 0;
+};
+
+void EncodeLogRecord(const ELogLevel logLevel, const FDateTime time, const FStringView message, const TSpan<Private::FStringFormatArgument> messageArgs, TArray<uint8>& bytes)
+{
+	bytes.Reset();
+	AppendLogRecordValue(bytes, logLevel);
+	AppendLogRecordValue(bytes, time.GetTicks());
+
+	if (CanDeferLogRecordFormatting(messageArgs))
+	{
+		AppendLogRecordValue(bytes, static_cast<uint8>(messageArgs.Num()));
+		AppendLogRecordString(bytes, message);
+
+		for (const Private::FStringFormatArgument& argument : messageArgs)
+		{
+			AppendLogRecordArgument(bytes, argument);
+		}
+
+		return;
+	}
+
+	// Custom type formatters may reference values that are about to go away, so the message has to be formatted now
+	FStringBuilder builder;
+	builder.Reserve(message.Length() + messageArgs.Num() * 4);
+	Private::AppendFormattedString(builder, message, messageArgs);
+
+	AppendLogRecordValue(bytes, static_cast<uint8>(1));
+	AppendLogRecordString(bytes, "{}"_sv);
+	AppendLogRecordValue(bytes, ELogRecordArgumentType::String);
+	AppendLogRecordString(bytes, builder.AsStringView());
+}
+
+void DecodeLogRecord(const TSpan<const uint8> bytes, FLogRecord& record)
+{
+	FLogRecordReader reader { bytes };
+	record.LogLevel = reader.ReadValue<ELogLevel>();
+	record.Time = FDateTime { reader.ReadValue<int64>() };
+
+	const int32 numMessageArgs = reader.ReadValue<uint8>();
+	record.Message = reader.ReadString();
+
+	record.MessageArgs.Reset();
+	for (int32 idx = 0; idx < numMessageArgs; ++idx)
+	{
+		switch (reader.ReadValue<ELogRecordArgumentType>())
+		{
+		case ELogRecordArgumentType::Bool:
+			(void)record.MessageArgs.Emplace(reader.ReadValue<bool>());
+			break;
+		case ELogRecordArgumentType::Char:
+			(void)record.MessageArgs.Emplace(reader.ReadValue<char>());
+			break;
+		case ELogRecordArgumentType::Int64:
+			(void)record.MessageArgs.Emplace(reader.ReadValue<int64>());
+			break;
+		case ELogRecordArgumentType::UInt64:
+			(void)record.MessageArgs.Emplace(reader.ReadValue<uint64>());
+			break;
+		case ELogRecordArgumentType::Float:
+			(void)record.MessageArgs.Emplace(reader.ReadValue<float>());
+			break;
+		case ELogRecordArgumentType::Double:
+			(void)record.MessageArgs.Emplace(reader.ReadValue<double>());
+			break;
+		case ELogRecordArgumentType::String:
+			(void)record.MessageArgs.Emplace(reader.ReadString());
+			break;
+		case ELogRecordArgumentType::Pointer:
+			(void)record.MessageArgs.Emplace(reader.ReadValue<const void*>());
+			break;
+		default:
+			UM_ASSERT_NOT_REACHED_MSG("Encountered unknown argument type in encoded log record");
+		}
+	}
+}
+
+bool FLogRecordRingBuffer::IsEmpty() const
+{
+	// Sequentially consistent so that the writer thread can't miss a record while deciding whether or not to sleep
+	const uint64 writePosition = m_WritePosition.load(std::memory_order_seq_cst);
+	return m_ReadPosition.load(std::memory_order_acquire) == writePosition;
+}
+
+bool FLogRecordRingBuffer::TryRead(TArray<uint8>& record)
+{
+	const uint64 readPosition = m_ReadPosition.load(std::memory_order_relaxed);
+	const uint64 writePosition = m_WritePosition.load(std::memory_order_acquire);
+	if (readPosition == writePosition)
+	{
+		return false;
+	}
+
+	int32 recordSize = 0;
+	CopyFromBuffer(readPosition, &recordSize, sizeof(int32));
+
+	record.Reset();
+	(void)record.AddUninitialized(recordSize);
+	CopyFromBuffer(readPosition + sizeof(int32), record.GetData(), recordSize);
+
+	m_ReadPosition.store(readPosition + sizeof(int32) + static_cast<uint64>(recordSize), std::memory_order_release);
+	return true;
+}
+
+bool FLogRecordRingBuffer::TryWrite(const TSpan<const uint8> record)
+{
+	UM_ASSERT(record.Num() <= MaxRecordSize, "Attempting to write a log record that is too large for a ring buffer");
+
+	const int32 recordSize = record.Num();
+	const uint64 numBytesNeeded = sizeof(int32) + static_cast<uint64>(recordSize);
+
+	const uint64 writePosition = m_WritePosition.load(std::memory_order_relaxed);
+	const uint64 readPosition = m_ReadPosition.load(std::memory_order_acquire);
+	if (writePosition - readPosition + numBytesNeeded > static_cast<uint64>(Capacity))
+	{
+		return false;
+	}
+
+	CopyToBuffer(writePosition, &recordSize, sizeof(int32));
+	CopyToBuffer(writePosition + sizeof(int32), record.GetData(), recordSize);
+
+	// Sequentially consistent so that the writer thread can't miss this record while deciding whether or not to sleep
+	m_WritePosition.store(writePosition + numBytesNeeded, std::memory_order_seq_cst);
+	return true;
+}
+
+void FLogRecordRingBuffer::CopyFromBuffer(const uint64 position, void* destination, const int32 numBytes) const
+{
+	const int32 offset = static_cast<int32>(position & static_cast<uint64>(Capacity - 1));
+	const int32 numBytesBeforeEnd = FMath::Min(numBytes, Capacity - offset);
+
+	FMemory::Copy(destination, m_Bytes.GetData() + offset, numBytesBeforeEnd);
+	if (numBytesBeforeEnd < numBytes)
+	{
+		FMemory::Copy(static_cast<uint8*>(destination) + numBytesBeforeEnd, m_Bytes.GetData(), numBytes - numBytesBeforeEnd);
+	}
+}
+
+void FLogRecordRingBuffer::CopyToBuffer(const uint64 position, const void* source, const int32 numBytes)
+{
+	const int32 offset = static_cast<int32>(position & static_cast<uint64>(Capacity - 1));
+	const int32 numBytesBeforeEnd = FMath::Min(numBytes, Capacity - offset);
+
+	FMemory::Copy(m_Bytes.GetData() + offset, source, numBytesBeforeEnd);
+	if (numBytesBeforeEnd < numBytes)
+	{
+		FMemory::Copy(m_Bytes.GetData(), static_cast<const uint8*>(source) + numBytesBeforeEnd, numBytes - numBytesBeforeEnd);
+	}
+}
+
+FLogRecordQueue::~FLogRecordQueue()
+{
+	(void)GLogRecordQueueGeneration.fetch_add(1, std::memory_order_acq_rel);
+}
+
+bool FLogRecordQueue::HasPendingRecords()
+{
+	FScopedLockGuard lock { m_RingBuffersMutex };
+
+	for (const TSharedPtr<FLogRecordRingBuffer>& ringBuffer : m_RingBuffers)
+	{
+		if (ringBuffer->IsEmpty() == false)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool FLogRecordQueue::TryWrite(const TSpan<const uint8> record)
+{
+	return GetRingBufferForCurrentThread().TryWrite(record);
+}
+
+void FLogRecordQueue::CollectRingBuffers()
+{
+	FScopedLockGuard lock { m_RingBuffersMutex };
+
+	m_ReadableRingBuffers.Reset();
+	for (int32 idx = m_RingBuffers.Num() - 1; idx >= 0; --idx)
+	{
+		// The owner can't write anything else once it has exited, so checking for that first means an empty ring buffer
+		// is guaranteed to stay empty
+		FLogRecordRingBuffer* ringBuffer = m_RingBuffers[idx].Get();
+		if (ringBuffer->HasOwnerExited() && ringBuffer->IsEmpty())
+		{
+			m_RingBuffers.RemoveAt(idx);
+			continue;
+		}
+
+		m_ReadableRingBuffers.Add(ringBuffer);
+	}
+}
+
+FLogRecordRingBuffer& FLogRecordQueue::GetRingBufferForCurrentThread()
+{
+	const uint64 generation = GLogRecordQueueGeneration.load(std::memory_order_acquire);
+	if (GThreadRingBuffer.Queue == this && GThreadRingBuffer.Generation == generation)
+	{
+		return *GThreadRingBuffer.RingBuffer;
+	}
+
+	// If this thread was writing to another queue, let it know the old ring buffer can be freed
+	if (GThreadRingBuffer.RingBuffer.IsValid())
+	{
+		GThreadRingBuffer.RingBuffer->MarkOwnerExited();
+	}
+
+	TSharedPtr<FLogRecordRingBuffer> ringBuffer = MakeShared<FLogRecordRingBuffer>();
+	{
+		FScopedLockGuard lock { m_RingBuffersMutex };
+		m_RingBuffers.Add(ringBuffer);
+	}
+
+	GThreadRingBuffer.Queue = this;
+	GThreadRingBuffer.RingBuffer = MoveTemp(ringBuffer);
+	GThreadRingBuffer.Generation = generation;
+
+	return *GThreadRingBuffer.RingBuffer;
+}
\ No newline at end of file
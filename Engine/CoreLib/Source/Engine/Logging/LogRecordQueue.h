@@ -0,0 +1,226 @@
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/StaticArray.h"
+#include "Containers/StringView.h"
+#include "Engine/Logging.h"
+#include "HAL/DateTime.h"
+#include "Memory/SharedPtr.h"
+#include "Threading/Mutex.h"
+#include <atomic>
+
+/**
+ * @brief Defines a log record whose message has not been formatted yet.
+ */
+struct FLogRecord
+{
+	/** @brief The record's log level. */
+	ELogLevel LogLevel = ELogLevel::Info;
+
+	/** @brief The time the record was logged at. */
+	FDateTime Time;
+
+	/** @brief The record's message format string. Points into the bytes the record was decoded from. */
+	FStringView Message;
+
+	/** @brief The arguments to use when formatting the record's message. */
+	TArray<Private::FStringFormatArgument> MessageArgs;
+};
+
+/**
+ * @brief Encodes a log record so that it can be formatted later, possibly on another thread.
+ *
+ * Scalar and string arguments are copied as-is so that formatting can be deferred. Arguments that rely on custom type
+ * formatters cannot be copied safely, so any record that has one is formatted immediately and stored as a plain string.
+ *
+ * @param logLevel The log level.
+ * @param time The time the record was logged at.
+ * @param message The message format string.
+ * @param messageArgs The arguments to use when formatting the message.
+ * @param bytes The array to write the encoded record to. Any existing contents are discarded.
+ */
+void EncodeLogRecord(ELogLevel logLevel, FDateTime time, FStringView message, TSpan<Private::FStringFormatArgument> messageArgs, TArray<uint8>& bytes);
+
+/**
+ * @brief Decodes a log record that was encoded with EncodeLogRecord.
+ *
+ * @param bytes The encoded record. Must outlive the decoded record.
+ * @param record The record to decode into. Its argument array is reused.
+ */
+void DecodeLogRecord(TSpan<const uint8> bytes, FLogRecord& record);
+
+/**
+ * @brief Defines a fixed-size ring buffer of encoded log records with a single producer and a single consumer.
+ */
+class FLogRecordRingBuffer final
+{
+	UM_DISABLE_COPY(FLogRecordRingBuffer);
+	UM_DISABLE_MOVE(FLogRecordRingBuffer);
+
+public:
+
+	/** @brief The number of bytes in a ring buffer. Must be a power of two. */
+	static constexpr int32 Capacity = 64 * 1024;
+
+	/** @brief The largest encoded record that can be written to a ring buffer. */
+	static constexpr int32 MaxRecordSize = Capacity / 4;
+
+	/**
+	 * @brief Sets default values for this ring buffer's properties.
+	 */
+	FLogRecordRingBuffer() = default;
+
+	/**
+	 * @brief Checks to see if this ring buffer has no records in it.
+	 *
+	 * @return True if this ring buffer has no records in it, otherwise false.
+	 */
+	[[nodiscard]] bool IsEmpty() const;
+
+	/**
+	 * @brief Checks to see if the thread that writes to this ring buffer has exited.
+	 *
+	 * @return True if the thread that writes to this ring buffer has exited, otherwise false.
+	 */
+	[[nodiscard]] bool HasOwnerExited() const
+	{
+		return m_HasOwnerExited.load(std::memory_order_acquire);
+	}
+
+	/**
+	 * @brief Marks that the thread that writes to this ring buffer has exited.
+	 */
+	void MarkOwnerExited()
+	{
+		m_HasOwnerExited.store(true, std::memory_order_release);
+	}
+
+	/**
+	 * @brief Attempts to read the oldest record from this ring buffer. May only be called by the consumer.
+	 *
+	 * @param record The array to copy the record into. Any existing contents are discarded.
+	 * @return True if a record was read, otherwise false.
+	 */
+	[[nodiscard]] bool TryRead(TArray<uint8>& record);
+
+	/**
+	 * @brief Attempts to write a record to this ring buffer. May only be called by the producer.
+	 *
+	 * @param record The encoded record. Cannot be larger than MaxRecordSize.
+	 * @return True if the record was written, false if there is not enough space for it.
+	 */
+	[[nodiscard]] bool TryWrite(TSpan<const uint8> record);
+
+private:
+
+	/**
+	 * @brief Copies bytes out of this ring buffer, wrapping around the end if necessary.
+	 *
+	 * @param position The position to start copying from.
+	 * @param destination The destination.
+	 * @param numBytes The number of bytes to copy.
+	 */
+	void CopyFromBuffer(uint64 position, void* destination, int32 numBytes) const;
+
+	/**
+	 * @brief Copies bytes into this ring buffer, wrapping around the end if necessary.
+	 *
+	 * @param position The position to start copying to.
+	 * @param source The source.
+	 * @param numBytes The number of bytes to copy.
+	 */
+	void CopyToBuffer(uint64 position, const void* source, int32 numBytes);
+
+	// The positions only ever increase and are masked when indexing. They're padded out to their own cache lines so
+	// that the producer and the consumer don't fight over them
+	std::atomic<uint64> m_WritePosition = 0;
+	uint8 m_WritePositionPadding[64 - sizeof(std::atomic<uint64>)] {};
+	std::atomic<uint64> m_ReadPosition = 0;
+	uint8 m_ReadPositionPadding[64 - sizeof(std::atomic<uint64>)] {};
+	std::atomic<bool> m_HasOwnerExited = false;
+	TStaticArray<uint8, Capacity> m_Bytes;
+};
+
+/**
+ * @brief Defines a queue of encoded log records made up of one ring buffer per thread that writes to it. Writing a
+ *        record never takes a lock except for the first time a thread writes to the queue.
+ *
+ * Records written by the same thread are read back in the order they were written. There is no ordering between
+ * records written by different threads. Only one log record queue is expected to be in use at a time.
+ */
+class FLogRecordQueue final
+{
+	UM_DISABLE_COPY(FLogRecordQueue);
+	UM_DISABLE_MOVE(FLogRecordQueue);
+
+public:
+
+	/**
+	 * @brief Sets default values for this queue's properties.
+	 */
+	FLogRecordQueue() = default;
+
+	/**
+	 * @brief Destroys this queue, discarding any records that have not been read yet.
+	 */
+	~FLogRecordQueue();
+
+	/**
+	 * @brief Checks to see if any thread has records in this queue that have not been read yet.
+	 *
+	 * @return True if there are records that have not been read yet, otherwise false.
+	 */
+	[[nodiscard]] bool HasPendingRecords();
+
+	/**
+	 * @brief Reads every record that is currently in this queue. Only one thread may read from the queue at a time.
+	 *
+	 * @tparam FunctionType The type of the function to call for each record.
+	 * @param function The function to call with the bytes of each record.
+	 * @return The number of records that were read.
+	 */
+	template<typename FunctionType>
+	int32 ReadAll(FunctionType function)
+	{
+		CollectRingBuffers();
+
+		int32 numRecords = 0;
+		for (FLogRecordRingBuffer* ringBuffer : m_ReadableRingBuffers)
+		{
+			while (ringBuffer->TryRead(m_RecordBytes))
+			{
+				function(m_RecordBytes.AsSpan());
+				++numRecords;
+			}
+		}
+
+		return numRecords;
+	}
+
+	/**
+	 * @brief Attempts to write a record to the calling thread's ring buffer.
+	 *
+	 * @param record The encoded record. Cannot be larger than FLogRecordRingBuffer::MaxRecordSize.
+	 * @return True if the record was written, false if the calling thread's ring buffer is full.
+	 */
+	[[nodiscard]] bool TryWrite(TSpan<const uint8> record);
+
+private:
+
+	/**
+	 * @brief Gathers the ring buffers to read from, freeing those that are empty and whose thread has exited.
+	 */
+	void CollectRingBuffers();
+
+	/**
+	 * @brief Gets the calling thread's ring buffer, creating it if necessary.
+	 *
+	 * @return The calling thread's ring buffer.
+	 */
+	FLogRecordRingBuffer& GetRingBufferForCurrentThread();
+
+	FMutex m_RingBuffersMutex;
+	TArray<TSharedPtr<FLogRecordRingBuffer>> m_RingBuffers;
+	TArray<FLogRecordRingBuffer*> m_ReadableRingBuffers;
+	TArray<uint8> m_RecordBytes;
+};
\ No newline at end of file
@@ -41,12 +41,7 @@ void FAppleFileStream::Close()
 
 void FAppleFileStream::Flush()
 {
-	if (m_Descriptor == INDEX_NONE)
-	{
-		return;
-	}
-
-	::fsync(m_Descriptor);
+	// Writes are handed straight to the OS, so there is nothing buffered to push
 }
 
 int64 FAppleFileStream::GetLength() const
@@ -185,6 +180,16 @@ void FAppleFileStream::Seek(const ESeekOrigin origin, const int64 offset)
 	::lseek(m_Descriptor, static_cast<off_t>(offset), seekMode);
 }
 
+void FAppleFileStream::Sync()
+{
+	if (m_Descriptor == INDEX_NONE)
+	{
+		return;
+	}
+
+	::fsync(m_Descriptor);
+}
+
 int64 FAppleFileStream::Tell() const
 {
 	UM_ENSURE(IsOpen());
@@ -0,0 +1,229 @@
+#include "Engine/Logging.h"
+#include "HAL/BufferedFileStream.h"
+#include "Math/Math.h"
+#include "Memory/Memory.h"
+
+FBufferedFileStream::FBufferedFileStream(TSharedPtr<IFileStream> stream, const EFileAccess accessMode, const EFileMode openMode, const int32 bufferSize)
+	: IFileStream(FString { stream->GetPath() }, accessMode, openMode)
+	, m_Stream { MoveTemp(stream) }
+	, m_BufferSize { bufferSize }
+{
+	UM_ASSERT(m_Stream.IsValid() && m_Stream->IsOpen(), "Buffered file streams require an open stream to buffer");
+	UM_ASSERT(m_BufferSize > 0, "Buffered file streams require a buffer size greater than zero");
+
+	m_StreamPosition = m_Stream->Tell();
+	m_Buffer.Reserve(m_BufferSize);
+}
+
+FBufferedFileStream::~FBufferedFileStream()
+{
+	Close();
+}
+
+void FBufferedFileStream::Close()
+{
+	if (IsOpen() == false)
+	{
+		return;
+	}
+
+	if (CanWrite())
+	{
+		FlushWriteBuffer();
+	}
+
+	m_Stream->Close();
+	m_Buffer.Clear();
+	m_ReadOffset = 0;
+}
+
+void FBufferedFileStream::Flush()
+{
+	if (CanWrite() == false)
+	{
+		return;
+	}
+
+	FlushWriteBuffer();
+	m_Stream->Flush();
+}
+
+int64 FBufferedFileStream::GetLength() const
+{
+	if (CanWrite())
+	{
+		return FMath::Max(m_Stream->GetLength(), Tell());
+	}
+
+	return m_Stream->GetLength();
+}
+
+bool FBufferedFileStream::IsAtEnd() const
+{
+	return Tell() >= GetLength();
+}
+
+bool FBufferedFileStream::IsOpen() const
+{
+	return m_Stream.IsValid() && m_Stream->IsOpen();
+}
+
+void FBufferedFileStream::Read(void* data, const uint64 dataSize)
+{
+	UM_ENSURE(CanRead());
+
+	uint8* destination = static_cast<uint8*>(data);
+	uint64 numBytesLeft = dataSize;
+	while (numBytesLeft > 0)
+	{
+		const int32 numBufferedBytes = m_Buffer.Num() - m_ReadOffset;
+		if (numBufferedBytes > 0)
+		{
+			const int32 numBytesToCopy = static_cast<int32>(FMath::Min(numBytesLeft, static_cast<uint64>(numBufferedBytes)));
+			FMemory::Copy(destination, m_Buffer.GetData() + m_ReadOffset, numBytesToCopy);
+
+			destination += numBytesToCopy;
+			numBytesLeft -= static_cast<uint64>(numBytesToCopy);
+			m_ReadOffset += numBytesToCopy;
+			continue;
+		}
+
+		// Large reads would only be copied straight back out of the buffer, so they skip it entirely
+		if (numBytesLeft >= static_cast<uint64>(m_BufferSize))
+		{
+			const int64 numBytesLeftInStream = m_Stream->GetLength() - m_StreamPosition;
+			const int64 numBytesToRead = FMath::Min(static_cast<int64>(numBytesLeft), numBytesLeftInStream);
+			if (numBytesToRead > 0)
+			{
+				m_Stream->Read(destination, static_cast<uint64>(numBytesToRead));
+				m_StreamPosition += numBytesToRead;
+			}
+
+			m_Buffer.Reset();
+			m_ReadOffset = 0;
+			return;
+		}
+
+		FillReadBuffer();
+		if (m_Buffer.IsEmpty())
+		{
+			return;
+		}
+	}
+}
+
+void FBufferedFileStream::Seek(const ESeekOrigin origin, const int64 offset)
+{
+	UM_ENSURE(IsOpen());
+
+	int64 position = offset;
+	switch (origin)
+	{
+	case ESeekOrigin::Beginning:
+		break;
+
+	case ESeekOrigin::Current:
+		position += Tell();
+		break;
+
+	case ESeekOrigin::End:
+		position += GetLength();
+		break;
+
+	default:
+		UM_ASSERT_NOT_REACHED_MSG("Unhandled seek mode");
+		break;
+	}
+
+	if (CanRead())
+	{
+		// Seeking within what has already been read ahead doesn't need to touch the underlying stream at all
+		const int64 bufferStartPosition = m_StreamPosition - m_Buffer.Num();
+		if (position >= bufferStartPosition && position <= m_StreamPosition)
+		{
+			m_ReadOffset = static_cast<int32>(position - bufferStartPosition);
+			return;
+		}
+
+		m_Buffer.Reset();
+		m_ReadOffset = 0;
+	}
+	else
+	{
+		FlushWriteBuffer();
+	}
+
+	m_Stream->Seek(ESeekOrigin::Beginning, position);
+	m_StreamPosition = position;
+}
+
+void FBufferedFileStream::Sync()
+{
+	if (CanWrite() == false)
+	{
+		return;
+	}
+
+	Flush();
+	m_Stream->Sync();
+}
+
+int64 FBufferedFileStream::Tell() const
+{
+	if (CanWrite())
+	{
+		return m_StreamPosition + m_Buffer.Num();
+	}
+
+	return m_StreamPosition - m_Buffer.Num() + m_ReadOffset;
+}
+
+void FBufferedFileStream::Write(const void* data, const uint64 dataSize)
+{
+	UM_ENSURE(CanWrite());
+
+	if (static_cast<uint64>(m_Buffer.Num()) + dataSize > static_cast<uint64>(m_BufferSize))
+	{
+		FlushWriteBuffer();
+	}
+
+	// Large writes would only be copied straight back out of the buffer, so they skip it entirely
+	if (dataSize >= static_cast<uint64>(m_BufferSize))
+	{
+		m_Stream->Write(data, dataSize);
+		m_StreamPosition += static_cast<int64>(dataSize);
+		return;
+	}
+
+	m_Buffer.Append(static_cast<const uint8*>(data), static_cast<int32>(dataSize));
+}
+
+void FBufferedFileStream::FillReadBuffer()
+{
+	const int64 numBytesLeftInStream = m_Stream->GetLength() - m_StreamPosition;
+	const int32 numBytesToRead = static_cast<int32>(FMath::Clamp(numBytesLeftInStream, int64(0), static_cast<int64>(m_BufferSize)));
+
+	m_Buffer.Reset();
+	m_ReadOffset = 0;
+
+	if (numBytesToRead == 0)
+	{
+		return;
+	}
+
+	(void)m_Buffer.AddUninitialized(numBytesToRead);
+	m_Stream->Read(m_Buffer.GetData(), static_cast<uint64>(numBytesToRead));
+	m_StreamPosition += numBytesToRead;
+}
+
+void FBufferedFileStream::FlushWriteBuffer()
+{
+	if (m_Buffer.IsEmpty())
+	{
+		return;
+	}
+
+	m_Stream->Write(m_Buffer.GetData(), static_cast<uint64>(m_Buffer.Num()));
+	m_StreamPosition += m_Buffer.Num();
+	m_Buffer.Reset();
+}
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "Engine/CommandLine.h"
 #include "Engine/Logging.h"
 #include "HAL/EventLoop.h"
+#include "Threading/LockGuard.h"
 #include <uv.h>
 
 namespace libuv
@@ -117,6 +118,8 @@ TSharedPtr<FEventLoop> FEventLoop::Create()
 
 void FEventLoop::PollTasks()
 {
+	RunPostedFunctions();
+
 	if (m_Tasks.IsEmpty())
 	{
 		return;
@@ -134,6 +137,18 @@ void FEventLoop::PollTasks()
 	});
 }
 
+void FEventLoop::Post(FPostedFunction function)
+{
+	if (function.IsValid() == false)
+	{
+		return;
+	}
+
+	FScopedLockGuard lock { m_PostedFunctionsMutex };
+	m_PostedFunctions.Add(MoveTemp(function));
+	m_NumPostedFunctions.fetch_add(1, std::memory_order_release);
+}
+
 void FEventLoop::RegisterTask(TSharedPtr<IEventTask> task)
 {
 	if (task.IsNull())
@@ -147,6 +162,28 @@ void FEventLoop::RegisterTask(TSharedPtr<IEventTask> task)
 	m_Tasks.Add(MoveTemp(task));
 }
 
+void FEventLoop::RunPostedFunctions()
+{
+	if (m_NumPostedFunctions.load(std::memory_order_acquire) == 0)
+	{
+		return;
+	}
+
+	// Posted functions may post more functions, so run a snapshot of them outside of the lock
+	TArray<FPostedFunction> functions;
+	{
+		FScopedLockGuard lock { m_PostedFunctionsMutex };
+		Swap(functions, m_PostedFunctions);
+	}
+
+	for (FPostedFunction& function : functions)
+	{
+		function();
+	}
+
+	m_NumPostedFunctions.fetch_sub(functions.Num(), std::memory_order_release);
+}
+
 void FEventLoop::RemoveTask(TBadge<IEventTask>, IEventTask* task)
 {
 	UM_ENSURE(task != nullptr);
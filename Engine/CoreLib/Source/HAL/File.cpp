@@ -7,6 +7,7 @@
 #include "HAL/InternalTime.h"
 #include "Misc/StringBuilder.h"
 #include "Templates/NumericLimits.h"
+#include "Threading/Promise.h"
 #if UMBRAL_PLATFORM_IS_WINDOWS
 #	include "HAL/Windows/WindowsFileSystem.h"
 #elif UMBRAL_PLATFORM_IS_APPLE
@@ -550,6 +551,23 @@ void FFile::ReadBytesAsync(const FStringView filePath, const TSharedPtr<FEventLo
 	task->ReadFile(filePath);
 }
 
+TAsyncTask<TArray<uint8>> FFile::ReadBytesAsync(const FStringView filePath, const TSharedPtr<FEventLoop>& eventLoop)
+{
+	TPromise<TArray<uint8>> promise;
+	ReadBytesAsync(filePath, eventLoop,
+		[promise](TArray<uint8> bytes) mutable
+		{
+			promise.SetValue(MoveTemp(bytes));
+		},
+		[promise](FError error) mutable
+		{
+			promise.SetError(MoveTemp(error));
+		}
+	);
+
+	return promise.GetTask();
+}
+
 bool FFile::ReadLines(const FStringView fileName, TArray<FString>& lines)
 {
 	FString fileText;
@@ -641,6 +659,23 @@ void FFile::ReadTextAsync(const FStringView filePath, const TSharedPtr<FEventLoo
 	task->ReadFile(filePath);
 }
 
+TAsyncTask<FString> FFile::ReadTextAsync(const FStringView filePath, const TSharedPtr<FEventLoop>& eventLoop)
+{
+	TPromise<FString> promise;
+	ReadTextAsync(filePath, eventLoop,
+		[promise](FString text) mutable
+		{
+			promise.SetValue(MoveTemp(text));
+		},
+		[promise](FError error) mutable
+		{
+			promise.SetError(MoveTemp(error));
+		}
+	);
+
+	return promise.GetTask();
+}
+
 void FFile::Stat(const FStringView fileNameAsView, FFileStats& stats)
 {
 	const FString fileName { fileNameAsView };
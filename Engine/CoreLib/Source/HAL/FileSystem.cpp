@@ -164,7 +164,7 @@ bool FFileSystem::Mount(const FStringView directoryAsView, const FStringView mou
 	return true;
 }
 
-TSharedPtr<IFileStream> FFileSystem::Open(const FStringView path, const EFileMode mode, const EFileAccess access)
+TSharedPtr<IFileStream> FFileSystem::Open(const FStringView path, const EFileMode mode, const EFileAccess access, const int32 bufferSize)
 {
 	const FString absolutePath = ResolveFilePathWithMountPoints(path);
 	/*if (FFile::Exists(absolutePath) == false)
@@ -179,7 +179,13 @@ TSharedPtr<IFileStream> FFileSystem::Open(const FStringView path, const EFileMod
 		return nullptr;
 	}
 
-	return FNativeFileStream::Open(absolutePath, mode, access);
+	TSharedPtr<IFileStream> fileStream = FNativeFileStream::Open(absolutePath, mode, access);
+	if (fileStream.IsNull() || bufferSize <= 0)
+	{
+		return fileStream;
+	}
+
+	return MakeShared<FBufferedFileStream>(MoveTemp(fileStream), access, mode, bufferSize);
 }
 
 void FFileSystem::SetCanAccessFilesAnywhere(const bool canAccessFilesAnywhere)
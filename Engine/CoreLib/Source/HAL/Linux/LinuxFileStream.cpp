@@ -38,12 +38,7 @@ void FLinuxFileStream::Close()
 
 void FLinuxFileStream::Flush()
 {
-	if (m_Descriptor == INDEX_NONE)
-	{
-		return;
-	}
-
-	::fsync(m_Descriptor);
+	// Writes are handed straight to the OS, so there is nothing buffered to push
 }
 
 int64 FLinuxFileStream::GetLength() const
@@ -182,6 +177,16 @@ void FLinuxFileStream::Seek(const ESeekOrigin origin, const int64 offset)
 	::lseek(m_Descriptor, static_cast<off_t>(offset), seekMode);
 }
 
+void FLinuxFileStream::Sync()
+{
+	if (m_Descriptor == INDEX_NONE)
+	{
+		return;
+	}
+
+	::fsync(m_Descriptor);
+}
+
 int64 FLinuxFileStream::Tell() const
 {
 	UM_ENSURE(IsOpen());
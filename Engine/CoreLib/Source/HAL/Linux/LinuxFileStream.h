@@ -58,6 +58,9 @@ public:
 	/** @copydoc IFileStream::Seek */
 	virtual void Seek(ESeekOrigin origin, int64 offset) override;
 
+	/** @copydoc IFileStream::Sync */
+	virtual void Sync() override;
+
 	/** @copydoc IFileStream::Tell */
 	virtual int64 Tell() const override;
 
@@ -45,12 +45,7 @@ void FWindowsFileStream::Close()
 
 void FWindowsFileStream::Flush()
 {
-	if (CanWrite() == false)
-	{
-		return;
-	}
-
-	::FlushFileBuffers(m_Handle);
+	// Writes are handed straight to the OS, so there is nothing buffered to push
 }
 
 int64 FWindowsFileStream::GetLength() const
@@ -170,6 +165,16 @@ void FWindowsFileStream::Seek(const ESeekOrigin origin, const int64 offset)
 	UM_ASSERT(result != INVALID_SET_FILE_POINTER, "Failed to seek file");
 }
 
+void FWindowsFileStream::Sync()
+{
+	if (CanWrite() == false)
+	{
+		return;
+	}
+
+	::FlushFileBuffers(m_Handle);
+}
+
 int64 FWindowsFileStream::Tell() const
 {
 	UM_ENSURE(IsOpen());
@@ -0,0 +1,107 @@
+#include "Engine/Assert.h"
+#include "Math/Math.h"
+#include "Memory/LinearAllocator.h"
+#include "Templates/Exchange.h"
+
+struct FLinearAllocator::FBlockHeader
+{
+	FBlockHeader* Next = nullptr;
+	SizeType Size = 0;
+};
+
+FLinearAllocator::FLinearAllocator(const SizeType initialBlockSize)
+	: m_NextBlockSize { FMath::Clamp(initialBlockSize, static_cast<SizeType>(sizeof(FBlockHeader)) * 8, MaxBlockSize) }
+{
+}
+
+FLinearAllocator::FLinearAllocator(FLinearAllocator&& other) noexcept
+	: m_Blocks { Exchange(other.m_Blocks, nullptr) }
+	, m_Cursor { Exchange(other.m_Cursor, nullptr) }
+	, m_End { Exchange(other.m_End, nullptr) }
+	, m_NextBlockSize { other.m_NextBlockSize }
+	, m_NumBytesAllocated { Exchange(other.m_NumBytesAllocated, 0) }
+	, m_NumBytesReserved { Exchange(other.m_NumBytesReserved, 0) }
+{
+}
+
+FLinearAllocator::~FLinearAllocator()
+{
+	Reset();
+}
+
+void FLinearAllocator::Reset()
+{
+	FBlockHeader* block = m_Blocks;
+	while (block != nullptr)
+	{
+		FBlockHeader* nextBlock = block->Next;
+		FMemory::Free(block);
+		block = nextBlock;
+	}
+
+	m_Blocks = nullptr;
+	m_Cursor = nullptr;
+	m_End = nullptr;
+	m_NumBytesAllocated = 0;
+	m_NumBytesReserved = 0;
+}
+
+FLinearAllocator& FLinearAllocator::operator=(FLinearAllocator&& other) noexcept
+{
+	if (this == &other)
+	{
+		return *this;
+	}
+
+	Reset();
+
+	m_Blocks = Exchange(other.m_Blocks, nullptr);
+	m_Cursor = Exchange(other.m_Cursor, nullptr);
+	m_End = Exchange(other.m_End, nullptr);
+	m_NextBlockSize = other.m_NextBlockSize;
+	m_NumBytesAllocated = Exchange(other.m_NumBytesAllocated, 0);
+	m_NumBytesReserved = Exchange(other.m_NumBytesReserved, 0);
+
+	return *this;
+}
+
+void* FLinearAllocator::AllocateFromNewBlock(const SizeType numBytes, const SizeType alignment)
+{
+	UM_ASSERT(numBytes >= 0, "Attempting to allocate a negative number of bytes");
+	UM_ASSERT(FMath::IsPowerOfTwo(alignment), "Linear allocator alignment must be a power of two");
+
+	const uintptr alignmentMask = static_cast<uintptr>(alignment) - 1;
+	const SizeType numBytesNeeded = static_cast<SizeType>(sizeof(FBlockHeader)) + numBytes + alignment;
+
+	// Allocations that would fill most of a regular block get a block of their own, which is linked in behind the
+	// current block so that whatever is left of the current block can still be used
+	const bool dedicatedBlock = numBytesNeeded > m_NextBlockSize / 4;
+	const SizeType blockSize = dedicatedBlock ? numBytesNeeded : m_NextBlockSize;
+
+	FBlockHeader* block = static_cast<FBlockHeader*>(FMemory::Allocate(blockSize));
+	block->Size = blockSize;
+	m_NumBytesReserved += blockSize;
+	m_NumBytesAllocated += numBytes;
+
+	uint8* blockData = reinterpret_cast<uint8*>(block + 1);
+	uint8* result = reinterpret_cast<uint8*>((reinterpret_cast<uintptr>(blockData) + alignmentMask) & ~alignmentMask);
+
+	if (dedicatedBlock && m_Blocks != nullptr)
+	{
+		block->Next = m_Blocks->Next;
+		m_Blocks->Next = block;
+		return result;
+	}
+
+	block->Next = m_Blocks;
+	m_Blocks = block;
+	m_Cursor = result + numBytes;
+	m_End = reinterpret_cast<uint8*>(block) + blockSize;
+
+	if (dedicatedBlock == false)
+	{
+		m_NextBlockSize = FMath::Min(m_NextBlockSize * 2, MaxBlockSize);
+	}
+
+	return result;
+}
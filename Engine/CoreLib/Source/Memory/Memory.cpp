@@ -89,6 +89,11 @@ void FMemory::FreeAligned(void* memory)
 	mi_free(memory);
 }
 
+bool FMemory::IsAllocatedMemory(const void* location)
+{
+	return location != nullptr && mi_is_in_heap_region(location);
+}
+
 void FMemory::Move(void* destination, const void* source, const SizeType numBytes)
 {
 	UM_ASSERT(numBytes >= 0, "Attempting to move a negative number of bytes");
@@ -1,5 +1,26 @@
 #include "Meta/AttributeInfo.h"
 
+/**
+ * @brief Gets the well-known attribute with the given name.
+ *
+ * @param name The attribute's name.
+ * @return The well-known attribute, or None if \p name is not the name of a well-known attribute.
+ */
+static EKnownAttributes GetKnownAttributeByName(const FStringView name)
+{
+	if (name == "Abstract"_sv)
+	{
+		return EKnownAttributes::IsAbstract;
+	}
+
+	if (name == "ChildOf"_sv)
+	{
+		return EKnownAttributes::IsChildOf;
+	}
+
+	return EKnownAttributes::None;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // FAttributeInfo
 
@@ -34,11 +55,13 @@ bool FAttributeInfo::HasValue() const
 
 FAttributeInfo& FAttributeCollectionInfo::FAttributeCollectionInfo::AddAttribute(FStringView name)
 {
+	m_KnownAttributes |= GetKnownAttributeByName(name);
 	return m_Attributes.Emplace(name);
 }
 
 FAttributeInfo& FAttributeCollectionInfo::AddAttribute(FStringView name, FStringView value)
 {
+	m_KnownAttributes |= GetKnownAttributeByName(name);
 	return m_Attributes.Emplace(name, value);
 }
 
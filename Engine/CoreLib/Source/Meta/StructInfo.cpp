@@ -1,16 +1,144 @@
+#include "Engine/Hashing.h"
 #include "Meta/StructInfo.h"
+#include "Templates/NumericLimits.h"
 
 FStructInfo::FStructInfo(const FStringView name, const int32 size, const int32 alignment, const FStructInfo* baseType)
 	: FTypeInfo(name, size, alignment)
 	, m_BaseType { baseType }
 {
+	// Base types are always built before the types that derive from them, so everything can be copied from them here
+	if (m_BaseType != nullptr)
+	{
+		m_Ancestors.Reserve(m_BaseType->m_Ancestors.Num() + 1);
+		m_Ancestors.Append(m_BaseType->m_Ancestors.GetData(), m_BaseType->m_Ancestors.Num());
+		m_Ancestors.Add(m_BaseType);
+
+		m_NumInheritedProperties = m_BaseType->GetNumProperties();
+		m_InheritedKnownAttributes = m_BaseType->m_InheritedKnownAttributes | m_BaseType->GetKnownAttributes();
+	}
 }
 
 FPropertyInfo& FStructInfo::AddProperty(const FStringView name, const FTypeInfo* valueType, const int32 offset)
 {
+	UM_ASSERT(m_PropertyLookupTable.IsEmpty(), "Cannot add properties to a struct info after it has been finalized");
+
 	return m_Properties.Emplace(name, valueType, offset);
 }
 
+void FStructInfo::Finalize()
+{
+	UM_ASSERT(m_Ancestors.Num() <= TNumericLimits<int16>::MaxValue, "Struct info has too many ancestors to finalize");
+
+	// Gather every property that can be found by name. Properties closer to this struct hide those with the same name
+	// further up the inheritance chain, which matches how the lookup worked before there was a table
+	TArray<FPropertyLookupEntry> entries;
+	TArray<uint64> entryNameHashes;
+	for (int32 depth = m_Ancestors.Num(); depth >= 0; --depth)
+	{
+		const FStructInfo* owner = GetTypeAtDepth(depth);
+		for (int32 propertyIdx = 0; propertyIdx < owner->m_Properties.Num(); ++propertyIdx)
+		{
+			const FStringView propertyName = owner->m_Properties[propertyIdx].GetName();
+			const uint64 nameHash = GetHashCode(propertyName);
+
+			bool isHidden = false;
+			for (int32 entryIdx = 0; entryIdx < entries.Num() && isHidden == false; ++entryIdx)
+			{
+				const FPropertyLookupEntry& entry = entries[entryIdx];
+				isHidden = entryNameHashes[entryIdx] == nameHash &&
+				           GetTypeAtDepth(entry.OwnerDepth)->m_Properties[entry.PropertyIndex].GetName() == propertyName;
+			}
+
+			if (isHidden)
+			{
+				continue;
+			}
+
+			UM_ASSERT(propertyIdx <= TNumericLimits<int16>::MaxValue, "Struct info has too many properties to finalize");
+
+			FPropertyLookupEntry& entry = entries.Emplace();
+			entry.NameHash = static_cast<uint32>(nameHash);
+			entry.OwnerDepth = static_cast<int16>(depth);
+			entry.PropertyIndex = static_cast<int16>(propertyIdx);
+			entryNameHashes.Add(nameHash);
+		}
+	}
+
+	// Search for a seed that gives every property its own slot so that a lookup only ever has to check one slot. The
+	// table starts out with twice as many slots as there are properties and grows if no seed can be found
+	constexpr uint64 maxSeedsPerTableSize = 64;
+
+	int32 numSlots = 1;
+	while (numSlots < entries.Num() * 2)
+	{
+		numSlots *= 2;
+	}
+
+	TArray<bool> isSlotTaken;
+	for (;;)
+	{
+		for (uint64 seed = 0; seed < maxSeedsPerTableSize; ++seed)
+		{
+			isSlotTaken.Reset();
+			isSlotTaken.AddZeroed(numSlots);
+
+			bool hasCollision = false;
+			for (int32 entryIdx = 0; entryIdx < entries.Num() && hasCollision == false; ++entryIdx)
+			{
+				const int32 slot = GetPropertyLookupSlot(entryNameHashes[entryIdx], seed, numSlots);
+				hasCollision = isSlotTaken[slot];
+				isSlotTaken[slot] = true;
+			}
+
+			if (hasCollision)
+			{
+				continue;
+			}
+
+			m_PropertyLookupTable.Reset();
+			m_PropertyLookupTable.Reserve(numSlots);
+			for (int32 slot = 0; slot < numSlots; ++slot)
+			{
+				(void)m_PropertyLookupTable.Emplace();
+			}
+
+			for (int32 entryIdx = 0; entryIdx < entries.Num(); ++entryIdx)
+			{
+				const int32 slot = GetPropertyLookupSlot(entryNameHashes[entryIdx], seed, numSlots);
+				m_PropertyLookupTable[slot] = entries[entryIdx];
+			}
+
+			m_PropertyLookupSeed = seed;
+			return;
+		}
+
+		numSlots *= 2;
+	}
+}
+
+const FStructInfo* FStructInfo::FindTypeWithAttribute(const EKnownAttributes attributes) const
+{
+	if (HasAttribute(attributes))
+	{
+		return this;
+	}
+
+	if (HasFlag(m_InheritedKnownAttributes, attributes) == false)
+	{
+		return nullptr;
+	}
+
+	for (int32 depth = m_Ancestors.Num() - 1; depth >= 0; --depth)
+	{
+		if (m_Ancestors[depth]->HasAttribute(attributes))
+		{
+			return m_Ancestors[depth];
+		}
+	}
+
+	UM_ASSERT_NOT_REACHED_MSG("Inherited attributes are out of sync with ancestors");
+}
+
 const FStructInfo* FStructInfo::GetBaseType() const
 {
 	return m_BaseType;
@@ -18,12 +146,7 @@ const FStructInfo* FStructInfo::GetBaseType() const
 
 int32 FStructInfo::GetNumProperties() const
 {
-	int32 numProperties = m_Properties.Num();
-	if (m_BaseType)
-	{
-		numProperties += m_BaseType->GetNumProperties();
-	}
-	return numProperties;
+	return m_Properties.Num() + m_NumInheritedProperties;
 }
 
 const FPropertyInfo* FStructInfo::GetProperty(const int32 index) const
@@ -43,36 +166,35 @@ const FPropertyInfo* FStructInfo::GetProperty(const int32 index) const
 
 const FPropertyInfo* FStructInfo::GetPropertyByName(FStringView name) const
 {
-	const FPropertyInfo* property = m_Properties.FindByPredicate([name](const FPropertyInfo& property)
+	if (m_PropertyLookupTable.IsEmpty())
 	{
-		return property.GetName() == name;
-	});
+		const FPropertyInfo* property = m_Properties.FindByPredicate([name](const FPropertyInfo& property)
+		{
+			return property.GetName() == name;
+		});
 
-	if (property == nullptr && m_BaseType != nullptr)
-	{
-		property = m_BaseType->GetPropertyByName(name);
+		if (property == nullptr && m_BaseType != nullptr)
+		{
+			property = m_BaseType->GetPropertyByName(name);
+		}
+
+		return property;
 	}
 
-	return property;
-}
+	const uint64 nameHash = GetHashCode(name);
+	const int32 slot = GetPropertyLookupSlot(nameHash, m_PropertyLookupSeed, m_PropertyLookupTable.Num());
 
-bool FStructInfo::IsA(const FStructInfo* type) const
-{
-	if (type == nullptr)
+	const FPropertyLookupEntry& entry = m_PropertyLookupTable[slot];
+	if (entry.PropertyIndex == INDEX_NONE || entry.NameHash != static_cast<uint32>(nameHash))
 	{
-		return false;
+		return nullptr;
 	}
 
-	const FStructInfo* typeToCompareTo = this;
-	while (typeToCompareTo != nullptr)
-	{
-		if (typeToCompareTo == type)
-		{
-			return true;
-		}
-
-		typeToCompareTo = typeToCompareTo->GetBaseType();
-	}
+	const FPropertyInfo& property = GetTypeAtDepth(entry.OwnerDepth)->m_Properties[entry.PropertyIndex];
+	return property.GetName() == name ? &property : nullptr;
+}
 
-	return false;
+int32 FStructInfo::GetPropertyLookupSlot(const uint64 nameHash, const uint64 seed, const int32 numSlots)
+{
+	return static_cast<int32>(Private::HashCombine(nameHash, seed) & static_cast<uint64>(numSlots - 1));
 }
\ No newline at end of file
@@ -7,6 +7,7 @@ namespace Private
 	{
 		return &GTypeInfo_void;
 	}
+	static const FTypeRegistration GTypeRegistration_void { &TTypeDefinition<void>::Get };
 
 	DEFINE_PRIMITIVE_TYPE_DEFINITION(bool)
 	DEFINE_PRIMITIVE_TYPE_DEFINITION(int8)
@@ -31,6 +32,7 @@ namespace Private
 
 FTypeInfo::FTypeInfo(const FStringView name, const int32 size, const int32 alignment)
 	: m_Name { name }
+	, m_Id { GetHashCode(name) }
 	, m_Size { size }
 	, m_Alignment { alignment }
 {
@@ -41,6 +43,11 @@ int32 FTypeInfo::GetAlignment() const
 	return m_Alignment;
 }
 
+uint64 FTypeInfo::GetId() const
+{
+	return m_Id;
+}
+
 FStringView FTypeInfo::GetName() const
 {
 	return m_Name;
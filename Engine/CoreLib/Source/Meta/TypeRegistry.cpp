@@ -0,0 +1,307 @@
+#include "Containers/HashMap.h"
+#include "Engine/Logging.h"
+#include "Memory/UniquePtr.h"
+#include "Meta/StructInfo.h"
+#include "Meta/TypeRegistry.h"
+#include "Threading/LockGuard.h"
+#include "Threading/Mutex.h"
+#include <atomic>
+
+/**
+ * @brief Defines the type registry as built from every registration made up to a point.
+ */
+struct FTypeRegistrySnapshot
+{
+	/** @brief The registry generation this snapshot was built from. */
+	uint64 Generation = 0;
+
+	/** @brief Every registered type, sorted by name. */
+	TArray<const FTypeInfo*> Types;
+
+	/** @brief Maps type names to their index in Types. */
+	THashMap<FStringView, int32> TypeIndicesByName;
+
+	/** @brief Maps type IDs to their index in Types. */
+	THashMap<uint64, int32> TypeIndicesById;
+
+	/** @brief Every registered struct, where each struct is immediately followed by all of the structs derived from it. */
+	TArray<const FStructInfo*> StructHierarchy;
+
+	/** @brief The number of structs derived from the struct at the same index in StructHierarchy. */
+	TArray<int32> NumDerivedStructs;
+
+	/** @brief Maps structs to their index in StructHierarchy. */
+	THashMap<const FStructInfo*, int32> StructHierarchyIndices;
+};
+
+/**
+ * @brief Defines the registrations that the type registry is built from.
+ */
+struct FTypeRegistryState
+{
+	/** @brief Guards the list of registrations and the snapshots built from it. */
+	FMutex Mutex;
+
+	/** @brief The most recent type registration. Each registration links to the one made before it. */
+	FTypeRegistration* LatestRegistration = nullptr;
+
+	/** @brief Incremented every time a type is registered or unregistered, so snapshots know when they are stale. */
+	std::atomic<uint64> Generation = 0;
+
+	/** @brief The most recently built snapshot. */
+	std::atomic<const FTypeRegistrySnapshot*> CurrentSnapshot = nullptr;
+
+	/** @brief Every snapshot that has been built. Previous snapshots are kept alive so that spans handed out from them stay valid. */
+	TArray<TUniquePtr<FTypeRegistrySnapshot>> Snapshots;
+};
+
+/**
+ * @brief Gets the type registry's state. The state is created by the first registration, which guarantees that it is
+ *        destroyed after the last registration is.
+ *
+ * @return The type registry's state.
+ */
+static FTypeRegistryState& GetTypeRegistryState()
+{
+	static FTypeRegistryState GState;
+	return GState;
+}
+
+/**
+ * @brief Appends a struct and every struct derived from it to a snapshot's struct hierarchy.
+ *
+ * @param snapshot The snapshot being built.
+ * @param structs The registered structs, sorted by name.
+ * @param firstChildIndices The index in \p childIndices of each struct's first child, followed by the total number of children.
+ * @param childIndices The indices in \p structs of each struct's children, grouped by parent.
+ * @param structIndex The index in \p structs of the struct to append.
+ */
+static void AppendStructHierarchy(FTypeRegistrySnapshot& snapshot,
+                                  const TArray<const FStructInfo*>& structs,
+                                  const TArray<int32>& firstChildIndices,
+                                  const TArray<int32>& childIndices,
+                                  const int32 structIndex)
+{
+	const int32 hierarchyIndex = snapshot.StructHierarchy.Num();
+	snapshot.StructHierarchy.Add(structs[structIndex]);
+	snapshot.NumDerivedStructs.Add(0);
+
+	for (int32 childIndex = firstChildIndices[structIndex]; childIndex < firstChildIndices[structIndex + 1]; ++childIndex)
+	{
+		AppendStructHierarchy(snapshot, structs, firstChildIndices, childIndices, childIndices[childIndex]);
+	}
+
+	snapshot.NumDerivedStructs[hierarchyIndex] = snapshot.StructHierarchy.Num() - hierarchyIndex - 1;
+}
+
+/**
+ * @brief Builds a snapshot of the type registry. The registry's mutex must be held while doing so.
+ *
+ * @param latestRegistration The most recent registration to include.
+ * @param generation The registry generation \p latestRegistration belongs to.
+ * @return The snapshot.
+ */
+static TUniquePtr<FTypeRegistrySnapshot> BuildTypeRegistrySnapshot(const FTypeRegistration* latestRegistration, const uint64 generation)
+{
+	TUniquePtr<FTypeRegistrySnapshot> snapshot = MakeUnique<FTypeRegistrySnapshot>();
+	snapshot->Generation = generation;
+
+	TArray<const FTypeInfo*> registeredTypes;
+	for (const FTypeRegistration* registration = latestRegistration; registration != nullptr; registration = registration->GetPrevious())
+	{
+		if (const FTypeInfo* type = registration->GetTypeInfoFunction()())
+		{
+			registeredTypes.Add(type);
+		}
+	}
+
+	registeredTypes.Sort([](const FTypeInfo* left, const FTypeInfo* right)
+	{
+		return left->GetName().Compare(right->GetName());
+	});
+
+	snapshot->Types.Reserve(registeredTypes.Num());
+	for (const FTypeInfo* type : registeredTypes)
+	{
+		// The same type may be registered more than once if it is defined in a header, so only distinct types with
+		// the same name or ID are worth mentioning
+		if (const int32* existingIndex = snapshot->TypeIndicesByName.Find(type->GetName()))
+		{
+			if (snapshot->Types[*existingIndex] != type)
+			{
+				UM_LOG(Warning, "Multiple types named \"{}\" were registered; only one can be found by name", type->GetName());
+			}
+			continue;
+		}
+
+		if (const int32* existingIndex = snapshot->TypeIndicesById.Find(type->GetId()))
+		{
+			UM_LOG(Warning, "Types \"{}\" and \"{}\" have the same ID; only \"{}\" can be found", snapshot->Types[*existingIndex]->GetName(), type->GetName(), snapshot->Types[*existingIndex]->GetName());
+			continue;
+		}
+
+		const int32 typeIndex = snapshot->Types.Add(type);
+		(void)snapshot->TypeIndicesByName.Add(type->GetName(), typeIndex);
+		(void)snapshot->TypeIndicesById.Add(type->GetId(), typeIndex);
+	}
+
+	TArray<const FStructInfo*> structs;
+	THashMap<const FStructInfo*, int32> structIndices;
+	for (const FTypeInfo* type : snapshot->Types)
+	{
+		if (const FStructInfo* structType = Cast<FStructInfo>(type))
+		{
+			(void)structIndices.Add(structType, structs.Num());
+			structs.Add(structType);
+		}
+	}
+
+	// Group the structs by their base type so that each struct's children are contiguous
+	TArray<int32> parentIndices;
+	TArray<int32> firstChildIndices;
+	parentIndices.AddDefault(structs.Num());
+	firstChildIndices.AddZeroed(structs.Num() + 1);
+	for (int32 structIndex = 0; structIndex < structs.Num(); ++structIndex)
+	{
+		const int32* parentIndex = structIndices.Find(structs[structIndex]->GetBaseType());
+		parentIndices[structIndex] = parentIndex == nullptr ? INDEX_NONE : *parentIndex;
+		if (parentIndex != nullptr)
+		{
+			++firstChildIndices[*parentIndex + 1];
+		}
+	}
+
+	for (int32 structIndex = 0; structIndex < structs.Num(); ++structIndex)
+	{
+		firstChildIndices[structIndex + 1] += firstChildIndices[structIndex];
+	}
+
+	TArray<int32> childIndices;
+	TArray<int32> nextChildIndices = firstChildIndices;
+	childIndices.AddDefault(firstChildIndices.Last());
+	for (int32 structIndex = 0; structIndex < structs.Num(); ++structIndex)
+	{
+		if (parentIndices[structIndex] != INDEX_NONE)
+		{
+			childIndices[nextChildIndices[parentIndices[structIndex]]++] = structIndex;
+		}
+	}
+
+	snapshot->StructHierarchy.Reserve(structs.Num());
+	snapshot->NumDerivedStructs.Reserve(structs.Num());
+	for (int32 structIndex = 0; structIndex < structs.Num(); ++structIndex)
+	{
+		if (parentIndices[structIndex] == INDEX_NONE)
+		{
+			AppendStructHierarchy(*snapshot, structs, firstChildIndices, childIndices, structIndex);
+		}
+	}
+
+	for (int32 hierarchyIndex = 0; hierarchyIndex < snapshot->StructHierarchy.Num(); ++hierarchyIndex)
+	{
+		(void)snapshot->StructHierarchyIndices.Add(snapshot->StructHierarchy[hierarchyIndex], hierarchyIndex);
+	}
+
+	return snapshot;
+}
+
+/**
+ * @brief Gets the type registry, building it if types have been registered or unregistered since it was last built.
+ *
+ * @return The type registry.
+ */
+static const FTypeRegistrySnapshot& GetTypeRegistrySnapshot()
+{
+	FTypeRegistryState& state = GetTypeRegistryState();
+
+	uint64 generation = state.Generation.load(std::memory_order_acquire);
+	const FTypeRegistrySnapshot* snapshot = state.CurrentSnapshot.load(std::memory_order_acquire);
+	if (snapshot != nullptr && snapshot->Generation == generation)
+	{
+		return *snapshot;
+	}
+
+	FScopedLockGuard lock { state.Mutex };
+
+	// Registrations can only change while the lock is held, so the generation can't move out from under the build
+	generation = state.Generation.load(std::memory_order_relaxed);
+	snapshot = state.CurrentSnapshot.load(std::memory_order_relaxed);
+	if (snapshot != nullptr && snapshot->Generation == generation)
+	{
+		return *snapshot;
+	}
+
+	const int32 snapshotIndex = state.Snapshots.Add(BuildTypeRegistrySnapshot(state.LatestRegistration, generation));
+	snapshot = state.Snapshots[snapshotIndex].Get();
+	state.CurrentSnapshot.store(snapshot, std::memory_order_release);
+
+	return *snapshot;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// FTypeRegistration
+
+FTypeRegistration::FTypeRegistration(const FGetTypeInfoFunction getTypeInfo)
+	: m_GetTypeInfo { getTypeInfo }
+{
+	FTypeRegistryState& state = GetTypeRegistryState();
+	FScopedLockGuard lock { state.Mutex };
+
+	m_Previous = state.LatestRegistration;
+	state.LatestRegistration = this;
+	state.Generation.fetch_add(1, std::memory_order_release);
+}
+
+FTypeRegistration::~FTypeRegistration()
+{
+	FTypeRegistryState& state = GetTypeRegistryState();
+	FScopedLockGuard lock { state.Mutex };
+
+	// Registrations are only removed when a module is unloaded, so a walk through the list is fine
+	for (FTypeRegistration** link = &state.LatestRegistration; *link != nullptr; link = &(*link)->m_Previous)
+	{
+		if (*link == this)
+		{
+			*link = m_Previous;
+			break;
+		}
+	}
+
+	// The current snapshot may point at the type being unregistered, so it must not be handed out again
+	state.CurrentSnapshot.store(nullptr, std::memory_order_release);
+	state.Generation.fetch_add(1, std::memory_order_release);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// FTypeRegistry
+
+const FTypeInfo* FTypeRegistry::FindTypeById(const uint64 id)
+{
+	const FTypeRegistrySnapshot& snapshot = GetTypeRegistrySnapshot();
+	const int32* typeIndex = snapshot.TypeIndicesById.Find(id);
+	return typeIndex == nullptr ? nullptr : snapshot.Types[*typeIndex];
+}
+
+const FTypeInfo* FTypeRegistry::FindTypeByName(const FStringView name)
+{
+	const FTypeRegistrySnapshot& snapshot = GetTypeRegistrySnapshot();
+	const int32* typeIndex = snapshot.TypeIndicesByName.Find(name);
+	return typeIndex == nullptr ? nullptr : snapshot.Types[*typeIndex];
+}
+
+TSpan<const FTypeInfo* const> FTypeRegistry::GetAllTypes()
+{
+	return GetTypeRegistrySnapshot().Types.AsSpan();
+}
+
+TSpan<const FStructInfo* const> FTypeRegistry::GetDerivedTypes(const FStructInfo* type)
+{
+	const FTypeRegistrySnapshot& snapshot = GetTypeRegistrySnapshot();
+	const int32* hierarchyIndex = snapshot.StructHierarchyIndices.Find(type);
+	if (hierarchyIndex == nullptr)
+	{
+		return {};
+	}
+
+	return TSpan<const FStructInfo* const> { snapshot.StructHierarchy.GetData() + *hierarchyIndex + 1, snapshot.NumDerivedStructs[*hierarchyIndex] };
+}
\ No newline at end of file
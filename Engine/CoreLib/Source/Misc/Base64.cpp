@@ -1,11 +1,28 @@
-#include "Containers/Pair.h"
 #include "Containers/StaticArray.h"
 #include "Engine/Assert.h"
 #include "Engine/Logging.h"
+#include "Engine/Platform.h"
 #include "Misc/Base64.h"
 #include "Misc/StringBuilder.h"
+#include <SDL_cpuinfo.h>
+
+// Only x86 has the SSSE3 kernels. They are compiled for SSSE3 regardless of the build's target instruction set, and
+// are only called when the CPU supports them
+#if UMBRAL_ARCH_IS_X86 || UMBRAL_ARCH_IS_AMD64
+#	include <tmmintrin.h> /* For _mm_shuffle_epi8 and _mm_maddubs_epi16 */
+#	define WITH_SSSE3 1
+#	if UMBRAL_COMPILER == UMBRAL_COMPILER_MSVC
+#		define SSSE3_FUNCTION
+#	else
+#		define SSSE3_FUNCTION __attribute__((target("ssse3")))
+#	endif
+#else
+#	define WITH_SSSE3 0
+#endif
 
 // https://en.wikipedia.org/wiki/Base64
+// http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html
+// http://0x80.pl/notesen/2016-01-17-sse-base64-decoding.html
 
 namespace Base64
 {
@@ -21,153 +38,450 @@ namespace Base64
 		'4', '5', '6', '7', '8', '9', '+', '/'
 	}};
 
-	FString Encode(TSpan<const uint8> bytes)
+	/**
+	 * @brief The sextet value of every character, or -1 if the character is not a base-64 character.
+	 */
+	constexpr TStaticArray<int8, 256> SextetTable = []()
 	{
-		FStringBuilder result;
+		TStaticArray<int8, 256> result {};
+		for (int32 idx = 0; idx < 256; ++idx)
+		{
+			result[idx] = -1;
+		}
+		for (int32 idx = 0; idx < CharacterTable.Num(); ++idx)
+		{
+			result[static_cast<uint8>(CharacterTable[idx])] = static_cast<int8>(idx);
+		}
+		return result;
+	}();
+}
+
+#if WITH_SSSE3
+// SDL2 has no SDL_HasSSSE3, so SSE4.1 stands in for it. Every CPU with SSE4.1 also has SSSE3, and the few that only
+// have SSSE3 simply fall back to the scalar path
+static const bool GCanUseSsse3 = SDL_HasSSE41() == SDL_TRUE;
+#endif
+
+/**
+ * @brief Encodes a group of three bytes into four base-64 characters.
+ *
+ * @param bytes The three bytes.
+ * @param chars The characters to write to.
+ */
+static void EncodeGroup(const uint8* bytes, char* chars)
+{
+	const uint32 value = (static_cast<uint32>(bytes[0]) << 16) | (static_cast<uint32>(bytes[1]) << 8) | bytes[2];
+
+	chars[0] = Base64::CharacterTable[(value >> 18) & 0b111111];
+	chars[1] = Base64::CharacterTable[(value >> 12) & 0b111111];
+	chars[2] = Base64::CharacterTable[(value >> 6) & 0b111111];
+	chars[3] = Base64::CharacterTable[value & 0b111111];
+}
+
+/**
+ * @brief Decodes a group of four base-64 characters into three bytes.
+ *
+ * @param chars The four characters.
+ * @param bytes The bytes to write to.
+ * @return True if the characters were decoded, or false if any of them are padding or not base-64 characters.
+ */
+[[nodiscard]] static bool DecodeGroup(const char* chars, uint8* bytes)
+{
+	const int32 first = Base64::SextetTable[static_cast<uint8>(chars[0])];
+	const int32 second = Base64::SextetTable[static_cast<uint8>(chars[1])];
+	const int32 third = Base64::SextetTable[static_cast<uint8>(chars[2])];
+	const int32 fourth = Base64::SextetTable[static_cast<uint8>(chars[3])];
+	if ((first | second | third | fourth) < 0)
+	{
+		return false;
+	}
+
+	const uint32 value = (static_cast<uint32>(first) << 18) | (static_cast<uint32>(second) << 12) | (static_cast<uint32>(third) << 6) | static_cast<uint32>(fourth);
+	bytes[0] = static_cast<uint8>(value >> 16);
+	bytes[1] = static_cast<uint8>(value >> 8);
+	bytes[2] = static_cast<uint8>(value);
+	return true;
+}
+
+#if WITH_SSSE3
+/**
+ * @brief Encodes groups of bytes sixteen characters at a time.
+ *
+ * @param bytes The bytes.
+ * @param numGroups The number of groups of three bytes.
+ * @param chars The characters to write to.
+ * @return The number of groups that were encoded.
+ */
+SSSE3_FUNCTION static int32 EncodeGroupsSsse3(const uint8* bytes, const int32 numGroups, char* chars)
+{
+	// Each iteration loads sixteen bytes but only encodes twelve of them, so stop before reading past the end
+	int32 groupIdx = 0;
+	for (; (numGroups - groupIdx) * 3 >= 16; groupIdx += 4)
+	{
+		const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + groupIdx * 3));
+
+		// Put each group's bytes in the order [b1, b0, b2, b1] so that every sextet can be shifted into its own byte
+		const __m128i groups = _mm_shuffle_epi8(input, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+		const __m128i firstAndThird = _mm_mulhi_epu16(_mm_and_si128(groups, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+		const __m128i secondAndFourth = _mm_mullo_epi16(_mm_and_si128(groups, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+		const __m128i sextets = _mm_or_si128(firstAndThird, secondAndFourth);
 
-		// Every three byte octets are encoded as four base-64 sextets
-		// TODO If `bytes` is big enough, this will cause an overflow to negative
-		result.Reserve(bytes.Num() * 4 / 3);
+		// Map each sextet range to the offset that turns it into its character. Sextets 0 - 25 map to slot 13, 26 - 51
+		// map to slot 0, and 52 - 63 map to slots 1 - 12
+		const __m128i offsetTable = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+		                                          '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+		                                          '/' - 63, 'A', 0, 0);
+		__m128i offsetIndices = _mm_subs_epu8(sextets, _mm_set1_epi8(51));
+		offsetIndices = _mm_or_si128(offsetIndices, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), sextets), _mm_set1_epi8(13)));
 
-		// We encode three octets / four sextets at a time
-		for (int32 idx = 0; idx < bytes.Num(); idx += 3)
+		const __m128i output = _mm_add_epi8(sextets, _mm_shuffle_epi8(offsetTable, offsetIndices));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(chars + groupIdx * 4), output);
+	}
+
+	return groupIdx;
+}
+
+/**
+ * @brief Decodes groups of base-64 characters sixteen characters at a time. Stops at the first block that contains
+ *        padding or a character that is not a base-64 character.
+ *
+ * @param chars The characters.
+ * @param numGroups The number of groups of four characters.
+ * @param bytes The bytes to write to. Sixteen bytes are written for every twelve that are decoded.
+ * @return The number of groups that were decoded.
+ */
+SSSE3_FUNCTION static int32 DecodeGroupsSsse3(const char* chars, const int32 numGroups, uint8* bytes)
+{
+	int32 groupIdx = 0;
+	for (; numGroups - groupIdx >= 4; groupIdx += 4)
+	{
+		const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + groupIdx * 4));
+
+		// Characters are compared as signed bytes, so anything outside of ASCII is never in range
+		const auto inRange = [&input](const char first, const char last)
 		{
-			const char firstChar = [&]()
-			{
-				const int32 charIndex = static_cast<int32>(bytes[idx] & 0b11111100) >> 2;
-				return CharacterTable[charIndex];
-			}();
-			const char secondChar = [&]()
-			{
-				int32 charIndex = static_cast<int32>(bytes[idx] & 0b00000011);
-				if (bytes.IsValidIndex(idx + 1))
-				{
-					charIndex <<= 4;
-					charIndex  |= static_cast<int32>(bytes[idx + 1] & 0b11110000) >> 4;
-				}
-				return CharacterTable[charIndex];
-			}();
-			const char thirdChar = [&]()
-			{
-				if (bytes.IsValidIndex(idx + 1) == false)
-				{
-					return '=';
-				}
-
-				int32 charIndex = static_cast<int32>(bytes[idx + 1] & 0b00001111);
-				if (bytes.IsValidIndex(idx + 2))
-				{
-					charIndex <<= 2;
-					charIndex  |= static_cast<int32>(bytes[idx + 2] & 0b11000000) >> 6;
-				}
-				return CharacterTable[charIndex];
-			}();
-			const char fourthChar = [&]()
-			{
-				if (bytes.IsValidIndex(idx + 2) == false)
-				{
-					return '=';
-				}
+			return _mm_and_si128(_mm_cmpgt_epi8(input, _mm_set1_epi8(first - 1)), _mm_cmplt_epi8(input, _mm_set1_epi8(last + 1)));
+		};
 
-				const int32 charIndex = static_cast<int32>(bytes[idx + 2] & 0b00111111);
-				return CharacterTable[charIndex];
-			}();
+		const __m128i isUpper = inRange('A', 'Z');
+		const __m128i isLower = inRange('a', 'z');
+		const __m128i isDigit = inRange('0', '9');
+		const __m128i isPlus = _mm_cmpeq_epi8(input, _mm_set1_epi8('+'));
+		const __m128i isSlash = _mm_cmpeq_epi8(input, _mm_set1_epi8('/'));
 
-			result.Append(firstChar);
-			result.Append(secondChar);
-			result.Append(thirdChar);
-			result.Append(fourthChar);
+		const __m128i isValid = _mm_or_si128(_mm_or_si128(_mm_or_si128(isUpper, isLower), _mm_or_si128(isDigit, isPlus)), isSlash);
+		if (_mm_movemask_epi8(isValid) != 0xFFFF)
+		{
+			break;
 		}
 
-		return result.ReleaseString();
+		__m128i offsets = _mm_and_si128(isUpper, _mm_set1_epi8(-'A'));
+		offsets = _mm_or_si128(offsets, _mm_and_si128(isLower, _mm_set1_epi8(26 - 'a')));
+		offsets = _mm_or_si128(offsets, _mm_and_si128(isDigit, _mm_set1_epi8(52 - '0')));
+		offsets = _mm_or_si128(offsets, _mm_and_si128(isPlus, _mm_set1_epi8(62 - '+')));
+		offsets = _mm_or_si128(offsets, _mm_and_si128(isSlash, _mm_set1_epi8(63 - '/')));
+		const __m128i sextets = _mm_add_epi8(input, offsets);
+
+		// Merge pairs of sextets into twelve bits, and then pairs of those into the 24 bits of each group
+		const __m128i pairs = _mm_maddubs_epi16(sextets, _mm_set1_epi32(0x01400140));
+		const __m128i groups = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+		const __m128i output = _mm_shuffle_epi8(groups, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(bytes + groupIdx * 3), output);
 	}
 
-	TErrorOr<TArray<uint8>> Decode(const FStringView chars)
+	return groupIdx;
+}
+#endif
+
+/**
+ * @brief Encodes whole groups of three bytes.
+ *
+ * @param bytes The bytes.
+ * @param numGroups The number of groups of three bytes.
+ * @param chars The characters to write to.
+ */
+static void EncodeGroups(const uint8* bytes, const int32 numGroups, char* chars)
+{
+	int32 groupIdx = 0;
+
+#if WITH_SSSE3
+	if (GCanUseSsse3)
 	{
-		TArray<uint8> result;
-		result.Reserve(chars.Length());
+		groupIdx = EncodeGroupsSsse3(bytes, numGroups, chars);
+	}
+#endif
+
+	for (; groupIdx < numGroups; ++groupIdx)
+	{
+		EncodeGroup(bytes + groupIdx * 3, chars + groupIdx * 4);
+	}
+}
+
+/**
+ * @brief Decodes whole groups of four base-64 characters, stopping at the first group that contains padding or a
+ *        character that is not a base-64 character.
+ *
+ * @param chars The characters.
+ * @param numGroups The number of groups of four characters.
+ * @param bytes The bytes to write to. Must have room for at least GetMaxDecodedLength(numGroups * 4) bytes.
+ * @return The number of groups that were decoded.
+ */
+[[nodiscard]] static int32 DecodeGroups(const char* chars, const int32 numGroups, uint8* bytes)
+{
+	int32 groupIdx = 0;
+
+#if WITH_SSSE3
+	// Each iteration writes sixteen bytes but only decodes twelve, so leave room for the extra four
+	if (GCanUseSsse3 && numGroups >= 6)
+	{
+		groupIdx = DecodeGroupsSsse3(chars, numGroups - 2, bytes);
+	}
+#endif
+
+	for (; groupIdx < numGroups; ++groupIdx)
+	{
+		if (DecodeGroup(chars + groupIdx * 4, bytes + groupIdx * 3) == false)
+		{
+			break;
+		}
+	}
+
+	return groupIdx;
+}
+
+namespace Base64
+{
+	int32 FStreamEncoder::Encode(const TSpan<const uint8> bytes, const TSpan<char> chars)
+	{
+		UM_ASSERT(chars.Num() >= GetEncodedLength(bytes.Num()), "Not enough room to encode base-64 characters");
 
-		// We decode four sextets / three octets at a time
-		for (int32 idx = 0; idx < chars.Length(); idx += 4)
+		const uint8* input = bytes.GetData();
+		int32 numInputBytes = bytes.Num();
+		char* output = chars.GetData();
+
+		if (m_NumPendingBytes > 0)
 		{
-			// Verify that the current sextet quad are all valid characters
-			for (int32 sextetIdx = 0; sextetIdx < 4 && chars.IsValidIndex(idx + sextetIdx); ++sextetIdx)
+			while (m_NumPendingBytes < 3 && numInputBytes > 0)
 			{
-				const int32 sextetCharIndex = CharacterTable.IndexOf(chars[idx + sextetIdx]);
-				if (sextetCharIndex == INDEX_NONE)
-				{
-					// '=' is allowed for the third and fourth sextet char
-					if (sextetIdx > 1 && chars[idx + sextetIdx] == '=')
-					{
-						continue;
-					}
-					return MAKE_ERROR("Invalid base-64 character {} at index {}", chars[idx + sextetIdx], idx + sextetIdx);
-				}
+				m_PendingBytes[m_NumPendingBytes++] = *input;
+				++input;
+				--numInputBytes;
 			}
 
-			const char firstChar  = chars.At(idx);
-			const char secondChar = chars.AtOrDefault(idx + 1);
-			const char thirdChar  = chars.AtOrDefault(idx + 2, '=');
-			const char fourthChar = chars.AtOrDefault(idx + 3, '=');
+			if (m_NumPendingBytes < 3)
+			{
+				return 0;
+			}
+
+			EncodeGroup(m_PendingBytes.GetData(), output);
+			output += 4;
+			m_NumPendingBytes = 0;
+		}
+
+		const int32 numGroups = numInputBytes / 3;
+		EncodeGroups(input, numGroups, output);
+		output += numGroups * 4;
+		input += numGroups * 3;
+		numInputBytes -= numGroups * 3;
+
+		while (numInputBytes > 0)
+		{
+			m_PendingBytes[m_NumPendingBytes++] = *input;
+			++input;
+			--numInputBytes;
+		}
+
+		return static_cast<int32>(output - chars.GetData());
+	}
+
+	int32 FStreamEncoder::Finish(const TSpan<char> chars)
+	{
+		if (m_NumPendingBytes == 0)
+		{
+			return 0;
+		}
+
+		UM_ASSERT(chars.Num() >= 4, "Not enough room to encode base-64 characters");
 
-			const int32 firstCharIndex  = CharacterTable.IndexOf(firstChar);
-			const int32 secondCharIndex = CharacterTable.IndexOf(secondChar);
-			const int32 thirdCharIndex  = CharacterTable.IndexOf(thirdChar);
-			const int32 fourthCharIndex = CharacterTable.IndexOf(fourthChar);
+		const int32 numPendingBytes = m_NumPendingBytes;
+		for (int32 idx = numPendingBytes; idx < 3; ++idx)
+		{
+			m_PendingBytes[idx] = 0;
+		}
+
+		char* output = chars.GetData();
+		EncodeGroup(m_PendingBytes.GetData(), output);
 
-			// First byte HAS to exist because we're guaranteed at least one sextet
-			result.Add([&]()
+		// One byte only needs two sextets and two bytes only need three
+		for (int32 idx = numPendingBytes + 1; idx < 4; ++idx)
+		{
+			output[idx] = '=';
+		}
+
+		m_NumPendingBytes = 0;
+		return 4;
+	}
+
+	TErrorOr<int32> FStreamDecoder::Decode(const FStringView chars, const TSpan<uint8> bytes)
+	{
+		UM_ASSERT(bytes.Num() >= GetMaxDecodedLength(chars.Length()), "Not enough room to decode base-64 bytes");
+
+		const char* input = chars.GetChars();
+		int32 numInputChars = chars.Length();
+		uint8* output = bytes.GetData();
+
+		if (m_NumPendingChars > 0)
+		{
+			while (m_NumPendingChars < 4 && numInputChars > 0)
 			{
-				// First character in the quartet has six bits of the first byte
-				uint8 firstByte = static_cast<uint8>(firstCharIndex & 0b111111);
-
-				// Second character has two bits of the first byte
-				if (secondCharIndex != INDEX_NONE)
-				{
-					firstByte <<= 2;
-					firstByte  |= static_cast<uint8>(secondCharIndex & 0b110000) >> 4;
-				}
-
-				return firstByte;
-			}());
-
-			// The base-64 string would technically be ill-formed if there wasn't a second sextet here, but
-			// for the sake of supporting non-conformant generators we'll just break here if it is absent.
-			// The third character being '=' also means that the second sextet was only necessary for the
-			// final two bits of the first byte
-			if (secondCharIndex == INDEX_NONE || thirdChar == '=')
+				m_PendingChars[m_NumPendingChars++] = *input;
+				++input;
+				--numInputChars;
+			}
+
+			if (m_NumPendingChars < 4)
 			{
-				break;
+				return 0;
 			}
 
-			// Second character has four bits of the second byte
-			uint8 secondByte = static_cast<uint8>(secondCharIndex & 0b001111);
+			TRY_EVAL(const int32 numBytes, DecodePaddedGroup(m_PendingChars.GetData(), output));
+			output += numBytes;
+			m_NumPendingChars = 0;
+		}
 
-			// Third character has the remaining four bits
-			if (thirdCharIndex != INDEX_NONE)
+		while (numInputChars >= 4)
+		{
+			if (m_FoundPadding)
 			{
-				secondByte <<= 4;
-				secondByte  |= static_cast<uint8>(thirdCharIndex & 0b111100) >> 2;
+				return MAKE_ERROR("Unexpected base-64 character {} at index {} after padding", *input, m_NumCharsDecoded);
 			}
-			result.Add(secondByte);
 
-			// Third byte being '=' means that we don't need to include it in any more bytes
-			if (thirdCharIndex == INDEX_NONE || fourthChar == '=')
+			const int32 numGroups = DecodeGroups(input, numInputChars / 4, output);
+			output += numGroups * 3;
+			input += numGroups * 4;
+			numInputChars -= numGroups * 4;
+			m_NumCharsDecoded += numGroups * 4;
+
+			// The fast path stops at a group with padding or a bad character, so find out which it was
+			if (numInputChars >= 4)
 			{
-				break;
+				TRY_EVAL(const int32 numBytes, DecodePaddedGroup(input, output));
+				output += numBytes;
+				input += 4;
+				numInputChars -= 4;
 			}
-			// Third character has two bits of the third byte
-			uint8 thirdByte = static_cast<uint8>(thirdCharIndex & 0b000011);
+		}
+
+		if (numInputChars > 0 && m_FoundPadding)
+		{
+			return MAKE_ERROR("Unexpected base-64 character {} at index {} after padding", *input, m_NumCharsDecoded);
+		}
+
+		while (numInputChars > 0)
+		{
+			m_PendingChars[m_NumPendingChars++] = *input;
+			++input;
+			--numInputChars;
+		}
+
+		return static_cast<int32>(output - bytes.GetData());
+	}
+
+	TErrorOr<int32> FStreamDecoder::Finish(const TSpan<uint8> bytes)
+	{
+		if (m_NumPendingChars == 0)
+		{
+			Reset();
+			return 0;
+		}
+
+		if (m_NumPendingChars == 1)
+		{
+			return MAKE_ERROR("Base-64 string ended in the middle of a byte at index {}", m_NumCharsDecoded);
+		}
 
-			// Fourth character has the remaining six bits
-			if (fourthCharIndex != INDEX_NONE)
+		UM_ASSERT(bytes.Num() >= 3, "Not enough room to decode base-64 bytes");
+
+		// Padding is optional, so treat the missing characters as if they were padding
+		for (int32 idx = m_NumPendingChars; idx < 4; ++idx)
+		{
+			m_PendingChars[idx] = '=';
+		}
+
+		TRY_EVAL(const int32 numBytes, DecodePaddedGroup(m_PendingChars.GetData(), bytes.GetData()));
+
+		Reset();
+		return numBytes;
+	}
+
+	void FStreamDecoder::Reset()
+	{
+		m_NumPendingChars = 0;
+		m_NumCharsDecoded = 0;
+		m_FoundPadding = false;
+	}
+
+	TErrorOr<int32> FStreamDecoder::DecodePaddedGroup(const char* chars, uint8* bytes)
+	{
+		// Padding may only take the place of the third and fourth characters, and the fourth must be padding if the third is
+		int32 numSextets = 4;
+		if (chars[3] == '=')
+		{
+			numSextets = chars[2] == '=' ? 2 : 3;
+		}
+
+		uint32 value = 0;
+		for (int32 idx = 0; idx < numSextets; ++idx)
+		{
+			const int32 sextet = SextetTable[static_cast<uint8>(chars[idx])];
+			if (sextet < 0)
 			{
-				thirdByte <<= 6;
-				thirdByte  |= static_cast<uint8>(fourthCharIndex & 0b111111);
+				return MAKE_ERROR("Invalid base-64 character {} at index {}", chars[idx], m_NumCharsDecoded + idx);
 			}
-			result.Add(thirdByte);
+
+			value |= static_cast<uint32>(sextet) << (18 - idx * 6);
+		}
+
+		const int32 numBytes = numSextets - 1;
+		for (int32 idx = 0; idx < numBytes; ++idx)
+		{
+			bytes[idx] = static_cast<uint8>(value >> (16 - idx * 8));
 		}
 
+		m_NumCharsDecoded += 4;
+		m_FoundPadding = numSextets < 4;
+		return numBytes;
+	}
+
+	FString Encode(const TSpan<const uint8> bytes)
+	{
+		if (bytes.IsEmpty())
+		{
+			return {};
+		}
+
+		const int32 numChars = GetEncodedLength(bytes.Num());
+
+		FStringBuilder result;
+		const TSpan<char> chars { result.AddZeroed(numChars), numChars };
+
+		FStreamEncoder encoder;
+		const int32 numEncodedChars = encoder.Encode(bytes, chars);
+		(void)encoder.Finish(TSpan<char> { chars.GetData() + numEncodedChars, numChars - numEncodedChars });
+
+		return result.ReleaseString();
+	}
+
+	TErrorOr<TArray<uint8>> Decode(const FStringView chars)
+	{
+		TArray<uint8> result;
+		result.AddUninitialized(GetMaxDecodedLength(chars.Length()));
+
+		FStreamDecoder decoder;
+		TRY_EVAL(const int32 numDecodedBytes, decoder.Decode(chars, result.AsSpan()));
+		TRY_EVAL(const int32 numFinishedBytes, decoder.Finish(TSpan<uint8> { result.GetData() + numDecodedBytes, result.Num() - numDecodedBytes }));
+
+		result.SetNum(numDecodedBytes + numFinishedBytes);
 		return result;
 	}
 
@@ -194,4 +508,4 @@ namespace Base64
 		}
 		return false;
 	}
-}
+}
\ No newline at end of file
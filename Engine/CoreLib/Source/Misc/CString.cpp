@@ -1,11 +1,22 @@
+#include "Containers/StringView.h"
 #include "Engine/Assert.h"
+#include "Engine/Platform.h"
 #include "Memory/Memory.h"
 #include "Misc/CString.h"
 #include "Templates/IsInt.h"
 #include "Templates/NumericLimits.h"
+#include <bit>
 #include <cstring>
 #include <SDL_stdinc.h>
 
+// Do not include SSE headers on ARM builds
+#if !UMBRAL_ARCH_IS_ARM
+#	include <emmintrin.h> /* For _mm_cmpeq_epi8 and _mm_movemask_epi8 */
+#	define WITH_SSE2 1
+#else
+#	define WITH_SSE2 0
+#endif
+
 #if UMBRAL_PLATFORM_IS_WINDOWS
 #	include <Shlwapi.h>
 #	undef StrChr
@@ -21,6 +32,245 @@
 #	define WITH_STRINGS_HEADER 0
 #endif
 
+/** @brief The number of characters that the vectorized string kernels process at once. */
+static constexpr FCString::SizeType GCharBlockSize = 16;
+
+/**
+ * @brief Folds a character to uppercase if case is being ignored. Only ASCII letters are folded.
+ *
+ * @tparam IgnoreCase Whether or not case is being ignored.
+ * @param ch The character.
+ * @return The folded character.
+ */
+template<EIgnoreCase IgnoreCase>
+[[nodiscard]] static FCString::CharType FoldChar(const FCString::CharType ch)
+{
+	if constexpr (IgnoreCase == EIgnoreCase::Yes)
+	{
+		return Private::CharToUpper(ch);
+	}
+	else
+	{
+		return ch;
+	}
+}
+
+#if WITH_SSE2
+/**
+ * @brief Loads a block of characters, folding them to uppercase if case is being ignored.
+ *
+ * @tparam IgnoreCase Whether or not case is being ignored.
+ * @param chars The first character in the block. Must be followed by at least GCharBlockSize - 1 more.
+ * @return The loaded block.
+ */
+template<EIgnoreCase IgnoreCase>
+[[nodiscard]] static __m128i LoadCharBlock(const FCString::CharType* chars)
+{
+	const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars));
+	if constexpr (IgnoreCase == EIgnoreCase::Yes)
+	{
+		// Characters are compared as signed, so bytes outside of ASCII never fall into the lowercase range
+		const __m128i isAfterLowerA = _mm_cmpgt_epi8(block, _mm_set1_epi8('a' - 1));
+		const __m128i isBeforeLowerZ = _mm_cmplt_epi8(block, _mm_set1_epi8('z' + 1));
+		const __m128i caseBits = _mm_and_si128(_mm_and_si128(isAfterLowerA, isBeforeLowerZ), _mm_set1_epi8('a' - 'A'));
+		return _mm_sub_epi8(block, caseBits);
+	}
+	else
+	{
+		return block;
+	}
+}
+
+/**
+ * @brief Gets a bit mask of which characters in two blocks are equal.
+ *
+ * @param first The first block.
+ * @param second The second block.
+ * @return A bit mask where bit N is set if the Nth characters in \p first and \p second are equal.
+ */
+[[nodiscard]] static uint32 MatchCharBlocks(const __m128i first, const __m128i second)
+{
+	return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(first, second)));
+}
+#endif
+
+/**
+ * @brief Finds the index of the first character that differs between two strings.
+ *
+ * @tparam IgnoreCase Whether or not case is being ignored.
+ * @param first The first string.
+ * @param second The second string.
+ * @param numChars The number of characters to check.
+ * @return The index of the first character that differs, or INDEX_NONE if the strings are equal.
+ */
+template<EIgnoreCase IgnoreCase>
+[[nodiscard]] static FCString::SizeType FindFirstMismatch(const FCString::CharType* first, const FCString::CharType* second, const FCString::SizeType numChars)
+{
+	FCString::SizeType idx = 0;
+
+#if WITH_SSE2
+	for (; idx + GCharBlockSize <= numChars; idx += GCharBlockSize)
+	{
+		const uint32 matchMask = MatchCharBlocks(LoadCharBlock<IgnoreCase>(first + idx), LoadCharBlock<IgnoreCase>(second + idx));
+		if (matchMask != 0xFFFF)
+		{
+			return idx + std::countr_one(matchMask);
+		}
+	}
+#endif
+
+	for (; idx < numChars; ++idx)
+	{
+		if (FoldChar<IgnoreCase>(first[idx]) != FoldChar<IgnoreCase>(second[idx]))
+		{
+			return idx;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+/**
+ * @brief Compares two strings.
+ *
+ * @tparam IgnoreCase Whether or not case is being ignored.
+ * @param first The first string.
+ * @param second The second string.
+ * @param numChars The number of characters to compare.
+ * @return The comparison result.
+ */
+template<EIgnoreCase IgnoreCase>
+[[nodiscard]] static ECompareResult CompareChars(const FCString::CharType* first, const FCString::CharType* second, const FCString::SizeType numChars)
+{
+	const FCString::SizeType mismatchIndex = FindFirstMismatch<IgnoreCase>(first, second, numChars);
+	if (mismatchIndex == INDEX_NONE)
+	{
+		return ECompareResult::Equals;
+	}
+
+	// This matches the ordering of Private::OrdinalCompareCharSpans so that constant-evaluated comparisons agree
+	const FCString::CharType firstChar = FoldChar<IgnoreCase>(first[mismatchIndex]);
+	const FCString::CharType secondChar = FoldChar<IgnoreCase>(second[mismatchIndex]);
+	return firstChar < secondChar ? ECompareResult::LessThan : ECompareResult::GreaterThan;
+}
+
+/**
+ * @brief Finds the index of a character in a string.
+ *
+ * @tparam IgnoreCase Whether or not case is being ignored.
+ * @param haystack The string.
+ * @param haystackLength The length of the string being searched.
+ * @param needle The character.
+ * @return The index of the character in the string, or INDEX_NONE if it was not found.
+ */
+template<EIgnoreCase IgnoreCase>
+[[nodiscard]] static FCString::SizeType FindChar(const FCString::CharType* haystack, const FCString::SizeType haystackLength, FCString::CharType needle)
+{
+	needle = FoldChar<IgnoreCase>(needle);
+
+	FCString::SizeType idx = 0;
+
+#if WITH_SSE2
+	const __m128i needleBlock = _mm_set1_epi8(needle);
+	for (; idx + GCharBlockSize <= haystackLength; idx += GCharBlockSize)
+	{
+		const uint32 matchMask = MatchCharBlocks(LoadCharBlock<IgnoreCase>(haystack + idx), needleBlock);
+		if (matchMask != 0)
+		{
+			return idx + std::countr_zero(matchMask);
+		}
+	}
+#endif
+
+	for (; idx < haystackLength; ++idx)
+	{
+		if (FoldChar<IgnoreCase>(haystack[idx]) == needle)
+		{
+			return idx;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+/**
+ * @brief Finds the index of a substring in a string.
+ *
+ * Candidate positions are found by matching the needle's first and last characters against a whole block of positions
+ * at once, so the full comparison only runs where both of them already match.
+ *
+ * @tparam IgnoreCase Whether or not case is being ignored.
+ * @param haystack The string being searched.
+ * @param haystackLength The length of the string being searched.
+ * @param needle The string to search for.
+ * @param needleLength The length of the string to search for.
+ * @return The index of the substring in the string, or INDEX_NONE if it was not found.
+ */
+template<EIgnoreCase IgnoreCase>
+[[nodiscard]] static FCString::SizeType FindSubstring(const FCString::CharType* haystack,
+                                                      const FCString::SizeType haystackLength,
+                                                      const FCString::CharType* needle,
+                                                      const FCString::SizeType needleLength)
+{
+	using UnsignedSizeType = MakeUnsigned<FCString::SizeType>;
+
+	if (static_cast<UnsignedSizeType>(needleLength) > static_cast<UnsignedSizeType>(haystackLength))
+	{
+		return INDEX_NONE;
+	}
+
+	if (needleLength == 0)
+	{
+		return haystackLength > 0 ? 0 : INDEX_NONE;
+	}
+
+	if (needleLength == 1)
+	{
+		return FindChar<IgnoreCase>(haystack, haystackLength, needle[0]);
+	}
+
+	const FCString::CharType firstNeedleChar = FoldChar<IgnoreCase>(needle[0]);
+	const FCString::CharType lastNeedleChar = FoldChar<IgnoreCase>(needle[needleLength - 1]);
+	const FCString::SizeType lastNeedleOffset = needleLength - 1;
+	const FCString::SizeType numPositions = haystackLength - needleLength + 1;
+
+	FCString::SizeType idx = 0;
+
+#if WITH_SSE2
+	const __m128i firstNeedleBlock = _mm_set1_epi8(firstNeedleChar);
+	const __m128i lastNeedleBlock = _mm_set1_epi8(lastNeedleChar);
+	for (; idx + GCharBlockSize <= numPositions; idx += GCharBlockSize)
+	{
+		const uint32 firstMatchMask = MatchCharBlocks(LoadCharBlock<IgnoreCase>(haystack + idx), firstNeedleBlock);
+		const uint32 lastMatchMask = MatchCharBlocks(LoadCharBlock<IgnoreCase>(haystack + idx + lastNeedleOffset), lastNeedleBlock);
+
+		uint32 candidateMask = firstMatchMask & lastMatchMask;
+		while (candidateMask != 0)
+		{
+			const FCString::SizeType candidateIndex = idx + std::countr_zero(candidateMask);
+			if (FindFirstMismatch<IgnoreCase>(haystack + candidateIndex + 1, needle + 1, needleLength - 2) == INDEX_NONE)
+			{
+				return candidateIndex;
+			}
+
+			candidateMask &= candidateMask - 1;
+		}
+	}
+#endif
+
+	for (; idx < numPositions; ++idx)
+	{
+		if (FoldChar<IgnoreCase>(haystack[idx]) == firstNeedleChar &&
+		    FoldChar<IgnoreCase>(haystack[idx + lastNeedleOffset]) == lastNeedleChar &&
+		    FindFirstMismatch<IgnoreCase>(haystack + idx + 1, needle + 1, needleLength - 2) == INDEX_NONE)
+		{
+			return idx;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
 void FCString::FCStringDeleter::Delete(char* chars)
 {
 	FMemory::Free(chars);
@@ -57,80 +307,46 @@ bool FCString::IsNumeric(CharType ch)
 	return ch >= '0' && ch <= '9';
 }
 
-ECompareResult FCString::StrCaseCmp(const CharType* first, const CharType* second, SizeType numChars)
+ECompareResult FCString::StrCaseCmp(const CharType* first, const CharType* second, const SizeType numChars)
 {
 	UM_ASSERT(numChars >= 0, "Invalid number of characters supplied");
 
-	const int32 result = SDL_strncasecmp(first, second, static_cast<size_t>(numChars));
-	if (result < 0)
-	{
-		return ECompareResult::LessThan;
-	}
-	if (result > 0)
-	{
-		return ECompareResult::GreaterThan;
-	}
-	return ECompareResult::Equals;
+	return CompareChars<EIgnoreCase::Yes>(first, second, numChars);
 }
 
-ECompareResult FCString::StrCmp(const CharType* first, const CharType* second, SizeType numChars)
+ECompareResult FCString::StrCmp(const CharType* first, const CharType* second, const SizeType numChars)
 {
 	UM_ASSERT(numChars >= 0, "Invalid number of characters supplied");
 
-	const int32 result = SDL_strncmp(first, second, static_cast<size_t>(numChars));
-	if (result < 0)
-	{
-		return ECompareResult::LessThan;
-	}
-	if (result > 0)
-	{
-		return ECompareResult::GreaterThan;
-	}
-	return ECompareResult::Equals;
+	return CompareChars<EIgnoreCase::No>(first, second, numChars);
 }
 
 FCString::SizeType FCString::StrCaseChr(const CharType* haystack, const SizeType haystackLength, const CharType needle)
 {
-	return StrCaseStr(haystack, haystackLength, &needle, 1);
+	return FindChar<EIgnoreCase::Yes>(haystack, haystackLength, needle);
 }
 
 FCString::SizeType FCString::StrChr(const CharType* haystack, const SizeType haystackLength, const CharType needle)
 {
-	return StrStr(haystack, haystackLength, &needle, 1);
+	return FindChar<EIgnoreCase::No>(haystack, haystackLength, needle);
 }
 
-static FCString::SizeType FindSubstringIndex(const FCString::CharType* haystack,
-                                             const FCString::SizeType haystackLength,
-                                             const FCString::CharType* needle,
-                                             const FCString::SizeType needleLength,
-                                             const FCString::StringCompareFunction compareFunction)
+FCString::SizeType FCString::StrCaseStr(const CharType* haystack, const SizeType haystackLength, const CharType* needle, const SizeType needleLength)
 {
-	using UnsignedSizeType = MakeUnsigned<FCString::SizeType>;
-
-	if (static_cast<UnsignedSizeType>(needleLength) > static_cast<UnsignedSizeType>(haystackLength))
-	{
-		return INDEX_NONE;
-	}
-
-	for (FCString::SizeType idx = 0; idx < haystackLength; ++idx)
-	{
-		if (compareFunction(haystack + idx, needle, needleLength) == ECompareResult::Equals)
-		{
-			return idx;
-		}
-	}
-
-	return INDEX_NONE;
+	return FindSubstring<EIgnoreCase::Yes>(haystack, haystackLength, needle, needleLength);
 }
 
-FCString::SizeType FCString::StrCaseStr(const CharType* haystack, const SizeType haystackLength, const CharType* needle, const SizeType needleLength)
+void FCString::StrFill(CharType* chars, const CharType ch, const SizeType numChars)
 {
-	return FindSubstringIndex(haystack, haystackLength, needle, needleLength, StrCaseCmp);
+	UM_ASSERT(numChars >= 0, "Invalid number of characters supplied");
+
+	// The C runtime's memset is already vectorized for every platform we support
+	std::memset(chars, ch, static_cast<size_t>(numChars));
 }
 
 FCString::SizeType FCString::StrStr(const CharType* haystack, const SizeType haystackLength, const CharType* needle, const SizeType needleLength)
 {
-	return FindSubstringIndex(haystack, haystackLength, needle, needleLength, StrCmp);
+	return FindSubstring<EIgnoreCase::No>(haystack, haystackLength, needle, needleLength);
 }
 
 FCString::CharType FCString::ToLower(CharType ch)
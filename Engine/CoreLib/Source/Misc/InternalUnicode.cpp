@@ -134,12 +134,12 @@ namespace Utf8
 		}
 		else if (codePoint < 0x200000)
 		{
-			result.WriteComponent(static_cast<uint8>(0b11111000 | (codePoint >> 18)));
+			result.WriteComponent(static_cast<uint8>(0b11110000 | (codePoint >> 18)));
 			numExtraChars = 3;
 		}
 		else if (codePoint < 0x4000000)
 		{
-			result.WriteComponent(static_cast<uint8>(0b11111100 | (codePoint >> 24)));
+			result.WriteComponent(static_cast<uint8>(0b11111000 | (codePoint >> 24)));
 			numExtraChars = 4;
 		}
 		else if (codePoint < 0x80000000)
@@ -1,5 +1,6 @@
 #include "Containers/InternalString.h"
 #include "Containers/StringOrStringView.h"
+#include "Misc/CString.h"
 #include "Misc/StringBuilder.h"
 
 FStringBuilder::CharType* FStringBuilder::AddZeroed(const SizeType numChars)
@@ -36,18 +37,16 @@ FStringBuilder& FStringBuilder::Append(const CharType* chars, const SizeType num
 	return *this;
 }
 
-FStringBuilder& FStringBuilder::Append(const CharType ch, SizeType numChars)
+FStringBuilder& FStringBuilder::Append(const CharType ch, const SizeType numChars)
 {
-	// TODO Add an overload to TArray to do this in bulk
-
-	int32 index = m_Chars.AddZeroed(numChars);
-	while (numChars > 0)
+	if (numChars <= 0)
 	{
-		m_Chars[index] = ch;
-		++index;
-		--numChars;
+		return *this;
 	}
 
+	const SizeType index = m_Chars.AddUninitialized(numChars);
+	FCString::StrFill(m_Chars.GetData() + index, ch, numChars);
+
 	return *this;
 }
 
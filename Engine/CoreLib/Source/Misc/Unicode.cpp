@@ -1,9 +1,244 @@
 #include "Engine/Logging.h"
+#include "Engine/Platform.h"
 #include "Misc/InternalUnicode.h"
 #include "Misc/Unicode.h"
 #include "Templates/CharTraits.h"
+#include <bit>
 #include <cstdio>
 
+// Do not include SSE headers on ARM builds
+#if !UMBRAL_ARCH_IS_ARM
+#	include <emmintrin.h> /* For _mm_packus_epi16 and _mm_unpacklo_epi8 */
+#	define WITH_SSE2 1
+#else
+#	define WITH_SSE2 0
+#endif
+
+/** @brief The number of code units that are checked for ASCII at once. */
+static constexpr int32 GAsciiBlockSize = 16;
+
+/**
+ * @brief Checks to see if a code unit is an ASCII character.
+ *
+ * @tparam CharType The code unit type.
+ * @param ch The code unit.
+ * @return True if \p ch is an ASCII character, otherwise false.
+ */
+template<typename CharType>
+[[nodiscard]] static bool IsAsciiChar(const CharType ch)
+{
+	if constexpr (sizeof(CharType) == 1)
+	{
+		return static_cast<uint8>(ch) < 0x80;
+	}
+	else
+	{
+		return static_cast<uint32>(ch) < 0x80;
+	}
+}
+
+#if WITH_SSE2
+/**
+ * @brief Loads a block of code units and narrows them to bytes.
+ *
+ * @tparam CharType The code unit type.
+ * @param chars The first code unit in the block. Must be followed by at least GAsciiBlockSize - 1 more.
+ * @param bytes The narrowed code units. Only meaningful if every code unit is an ASCII character.
+ * @return True if every code unit in the block is an ASCII character, otherwise false.
+ */
+template<typename CharType>
+[[nodiscard]] static bool LoadAsciiBlock(const CharType* chars, __m128i& bytes)
+{
+	const __m128i* blocks = reinterpret_cast<const __m128i*>(chars);
+	const __m128i zero = _mm_setzero_si128();
+
+	if constexpr (sizeof(CharType) == 1)
+	{
+		bytes = _mm_loadu_si128(blocks);
+		return _mm_movemask_epi8(bytes) == 0;
+	}
+	else if constexpr (sizeof(CharType) == 2)
+	{
+		const __m128i first = _mm_loadu_si128(blocks);
+		const __m128i second = _mm_loadu_si128(blocks + 1);
+		const __m128i nonAsciiBits = _mm_and_si128(_mm_or_si128(first, second), _mm_set1_epi16(static_cast<int16>(0xFF80)));
+
+		bytes = _mm_packus_epi16(first, second);
+		return _mm_movemask_epi8(_mm_cmpeq_epi8(nonAsciiBits, zero)) == 0xFFFF;
+	}
+	else
+	{
+		const __m128i first = _mm_loadu_si128(blocks);
+		const __m128i second = _mm_loadu_si128(blocks + 1);
+		const __m128i third = _mm_loadu_si128(blocks + 2);
+		const __m128i fourth = _mm_loadu_si128(blocks + 3);
+		const __m128i allBits = _mm_or_si128(_mm_or_si128(first, second), _mm_or_si128(third, fourth));
+		const __m128i nonAsciiBits = _mm_and_si128(allBits, _mm_set1_epi32(static_cast<int32>(0xFFFFFF80)));
+
+		bytes = _mm_packus_epi16(_mm_packs_epi32(first, second), _mm_packs_epi32(third, fourth));
+		return _mm_movemask_epi8(_mm_cmpeq_epi8(nonAsciiBits, zero)) == 0xFFFF;
+	}
+}
+
+/**
+ * @brief Widens a block of ASCII bytes to code units and stores them.
+ *
+ * @tparam CharType The code unit type.
+ * @param bytes The ASCII bytes.
+ * @param chars The code units to store to. Must have room for GAsciiBlockSize code units.
+ */
+template<typename CharType>
+static void StoreAsciiBlock(const __m128i bytes, CharType* chars)
+{
+	__m128i* blocks = reinterpret_cast<__m128i*>(chars);
+	const __m128i zero = _mm_setzero_si128();
+
+	if constexpr (sizeof(CharType) == 1)
+	{
+		_mm_storeu_si128(blocks, bytes);
+	}
+	else if constexpr (sizeof(CharType) == 2)
+	{
+		_mm_storeu_si128(blocks, _mm_unpacklo_epi8(bytes, zero));
+		_mm_storeu_si128(blocks + 1, _mm_unpackhi_epi8(bytes, zero));
+	}
+	else
+	{
+		const __m128i low = _mm_unpacklo_epi8(bytes, zero);
+		const __m128i high = _mm_unpackhi_epi8(bytes, zero);
+
+		_mm_storeu_si128(blocks, _mm_unpacklo_epi16(low, zero));
+		_mm_storeu_si128(blocks + 1, _mm_unpackhi_epi16(low, zero));
+		_mm_storeu_si128(blocks + 2, _mm_unpacklo_epi16(high, zero));
+		_mm_storeu_si128(blocks + 3, _mm_unpackhi_epi16(high, zero));
+	}
+}
+#endif
+
+/**
+ * @brief Counts the ASCII characters at the start of a UTF-8 string.
+ *
+ * @param chars The UTF-8 string.
+ * @param numChars The number of code units in the string.
+ * @return The number of ASCII characters before the first non-ASCII character.
+ */
+[[nodiscard]] static int32 CountAsciiChars(const char* chars, const int32 numChars)
+{
+	int32 idx = 0;
+
+#if WITH_SSE2
+	for (; idx + GAsciiBlockSize <= numChars; idx += GAsciiBlockSize)
+	{
+		const uint32 nonAsciiMask = static_cast<uint32>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + idx))));
+		if (nonAsciiMask != 0)
+		{
+			return idx + std::countr_zero(nonAsciiMask);
+		}
+	}
+#endif
+
+	while (idx < numChars && IsAsciiChar(chars[idx]))
+	{
+		++idx;
+	}
+
+	return idx;
+}
+
+/**
+ * @brief Copies the ASCII characters at the start of a string to the end of an array, converting each code unit.
+ *
+ * ASCII characters are encoded the same way in UTF-8, UTF-16, and UTF-32, so runs of them can be converted a whole
+ * block at a time instead of being decoded and encoded one code point at a time.
+ *
+ * @tparam ResultCharType The code unit type being converted to.
+ * @tparam SourceCharType The code unit type being converted from.
+ * @param chars The string.
+ * @param numChars The number of code units in the string.
+ * @param result The array to append to.
+ * @return The number of code units that were copied.
+ */
+template<typename ResultCharType, typename SourceCharType>
+static int32 CopyAsciiChars(const SourceCharType* chars, const int32 numChars, TArray<ResultCharType>& result)
+{
+	int32 idx = 0;
+
+#if WITH_SSE2
+	for (; idx + GAsciiBlockSize <= numChars; idx += GAsciiBlockSize)
+	{
+		__m128i bytes;
+		if (LoadAsciiBlock(chars + idx, bytes) == false)
+		{
+			break;
+		}
+
+		const int32 resultIndex = result.AddUninitialized(GAsciiBlockSize);
+		StoreAsciiBlock(bytes, result.GetData() + resultIndex);
+	}
+#endif
+
+	for (; idx < numChars && IsAsciiChar(chars[idx]); ++idx)
+	{
+		result.Add(static_cast<ResultCharType>(chars[idx]));
+	}
+
+	return idx;
+}
+
+/**
+ * @brief Gets the width of a well-formed UTF-8 code unit sequence, as defined by RFC 3629.
+ *
+ * Overlong encodings, encoded surrogates, and code points above U+10FFFF are all ill-formed.
+ *
+ * @param chars The first code unit in the sequence. Must not be an ASCII character.
+ * @param numChars The number of code units remaining in the string.
+ * @return The sequence's width, or zero if the sequence is ill-formed.
+ */
+[[nodiscard]] static int32 GetWellFormedUtf8SequenceWidth(const uint8* chars, const int32 numChars)
+{
+	// See table 3-7 in the Unicode Standard
+	const uint8 leadChar = chars[0];
+	uint8 minSecondChar = 0x80;
+	uint8 maxSecondChar = 0xBF;
+	int32 width = 0;
+
+	if (leadChar >= 0xC2 && leadChar <= 0xDF)
+	{
+		width = 2;
+	}
+	else if (leadChar >= 0xE0 && leadChar <= 0xEF)
+	{
+		width = 3;
+		minSecondChar = leadChar == 0xE0 ? 0xA0 : minSecondChar;
+		maxSecondChar = leadChar == 0xED ? 0x9F : maxSecondChar;
+	}
+	else if (leadChar >= 0xF0 && leadChar <= 0xF4)
+	{
+		width = 4;
+		minSecondChar = leadChar == 0xF0 ? 0x90 : minSecondChar;
+		maxSecondChar = leadChar == 0xF4 ? 0x8F : maxSecondChar;
+	}
+	else
+	{
+		return 0;
+	}
+
+	if (width > numChars || chars[1] < minSecondChar || chars[1] > maxSecondChar)
+	{
+		return 0;
+	}
+
+	for (int32 idx = 2; idx < width; ++idx)
+	{
+		if ((chars[idx] & 0b11000000) != 0b10000000)
+		{
+			return 0;
+		}
+	}
+
+	return width;
+}
+
 namespace Unicode
 {
 	FCountCodePointsResult CountCodePoints(const char* chars)
@@ -24,6 +259,14 @@ namespace Unicode
 		const char* chars = charSpan.GetData();
 		for (int32 idx = 0; idx < charSpan.Num(); /* empty */)
 		{
+			if (IsAsciiChar(chars[idx]))
+			{
+				const int32 numAsciiChars = CountAsciiChars(chars + idx, charSpan.Num() - idx);
+				result.NumCodePoints += numAsciiChars;
+				idx += numAsciiChars;
+				continue;
+			}
+
 			const Utf8::FDecodeResult decodeResult = Utf8::DecodeChar(chars + idx);
 			if (decodeResult.bValid == false)
 			{
@@ -127,6 +370,31 @@ namespace Unicode
 		return result;
 	}
 
+	bool IsValidUtf8(const TSpan<const char> charSpan)
+	{
+		const char* chars = charSpan.GetData();
+		const int32 numChars = charSpan.Num();
+
+		for (int32 idx = 0; idx < numChars; /* empty */)
+		{
+			if (IsAsciiChar(chars[idx]))
+			{
+				idx += CountAsciiChars(chars + idx, numChars - idx);
+				continue;
+			}
+
+			const int32 width = GetWellFormedUtf8SequenceWidth(reinterpret_cast<const uint8*>(chars + idx), numChars - idx);
+			if (width == 0)
+			{
+				return false;
+			}
+
+			idx += width;
+		}
+
+		return true;
+	}
+
 	FToUtf8Result ToUtf8(TSpan<const wchar_t> charSpan)
 	{
 		if constexpr (sizeof(wchar_t) == 2)
@@ -147,9 +415,19 @@ namespace Unicode
 			return result;
 		}
 
+		result.Chars.Reserve(charSpan.Num() + 1);
+
 		const char16_t* chars = charSpan.GetData();
 		for (int32 idx = 0; idx < charSpan.Num(); /* intentionally empty */)
 		{
+			if (IsAsciiChar(*chars))
+			{
+				const int32 numAsciiChars = CopyAsciiChars(chars, charSpan.Num() - idx, result.Chars);
+				chars += numAsciiChars;
+				idx += numAsciiChars;
+				continue;
+			}
+
 			const Utf16::FDecodeResult decodeResult = Utf16::DecodeChar(chars);
 			if (decodeResult.bValid == false)
 			{
@@ -181,8 +459,16 @@ namespace Unicode
 			return result;
 		}
 
-		for (int32 idx = 0; idx < charSpan.Num(); ++idx)
+		result.Chars.Reserve(charSpan.Num() + 1);
+
+		for (int32 idx = 0; idx < charSpan.Num(); /* intentionally empty */)
 		{
+			if (IsAsciiChar(charSpan[idx]))
+			{
+				idx += CopyAsciiChars(charSpan.GetData() + idx, charSpan.Num() - idx, result.Chars);
+				continue;
+			}
+
 			const uint32 codePoint = static_cast<uint32>(charSpan[idx]);
 			const Utf8::FEncodeResult encodeResult = Utf8::EncodeChar(codePoint);
 			if (encodeResult.bValid == false)
@@ -191,6 +477,7 @@ namespace Unicode
 			}
 
 			result.Chars.Append(encodeResult.GetCharSpan());
+			++idx;
 		}
 
 		result.Chars.Add(TCharTraits<char>::NullChar);
@@ -206,9 +493,19 @@ namespace Unicode
 			return result;
 		}
 
+		result.Chars.Reserve(charSpan.Num() + 1);
+
 		const char* chars = charSpan.GetData();
 		for (int32 idx = 0; idx < charSpan.Num(); /* intentionally empty */)
 		{
+			if (IsAsciiChar(*chars))
+			{
+				const int32 numAsciiChars = CopyAsciiChars(chars, charSpan.Num() - idx, result.Chars);
+				chars += numAsciiChars;
+				idx += numAsciiChars;
+				continue;
+			}
+
 			const Utf8::FDecodeResult decodeResult = Utf8::DecodeChar(chars);
 			if (decodeResult.bValid == false)
 			{
@@ -252,8 +549,16 @@ namespace Unicode
 			return result;
 		}
 
-		for (int32 idx = 0; idx < charSpan.Num(); ++idx)
+		result.Chars.Reserve(charSpan.Num() + 1);
+
+		for (int32 idx = 0; idx < charSpan.Num(); /* intentionally empty */)
 		{
+			if (IsAsciiChar(charSpan[idx]))
+			{
+				idx += CopyAsciiChars(charSpan.GetData() + idx, charSpan.Num() - idx, result.Chars);
+				continue;
+			}
+
 			const Utf16::FEncodeResult encodeResult = Utf16::EncodeChar(charSpan[idx]);
 			if (encodeResult.bValid == false)
 			{
@@ -261,6 +566,7 @@ namespace Unicode
 			}
 
 			result.Chars.Append(encodeResult.GetCharSpan());
+			++idx;
 		}
 
 		result.Chars.Add(TCharTraits<char16_t>::NullChar);
@@ -276,9 +582,19 @@ namespace Unicode
 			return result;
 		}
 
+		result.Chars.Reserve(charSpan.Num() + 1);
+
 		const char* chars = charSpan.GetData();
 		for (int32 idx = 0; idx < charSpan.Num(); /* intentionally empty */)
 		{
+			if (IsAsciiChar(*chars))
+			{
+				const int32 numAsciiChars = CopyAsciiChars(chars, charSpan.Num() - idx, result.Chars);
+				chars += numAsciiChars;
+				idx += numAsciiChars;
+				continue;
+			}
+
 			const Utf8::FDecodeResult decodeResult = Utf8::DecodeChar(chars);
 			if (decodeResult.bValid == false)
 			{
@@ -317,9 +633,19 @@ namespace Unicode
 			return result;
 		}
 
+		result.Chars.Reserve(charSpan.Num() + 1);
+
 		const char16_t* chars = charSpan.GetData();
 		for (int32 Idx = 0; Idx < charSpan.Num(); /* intentionally empty */)
 		{
+			if (IsAsciiChar(*chars))
+			{
+				const int32 numAsciiChars = CopyAsciiChars(chars, charSpan.Num() - Idx, result.Chars);
+				chars += numAsciiChars;
+				Idx += numAsciiChars;
+				continue;
+			}
+
 			const Utf16::FDecodeResult decodeChar = Utf16::DecodeChar(chars);
 			if (decodeChar.bValid == false)
 			{
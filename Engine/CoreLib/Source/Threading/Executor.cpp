@@ -0,0 +1,69 @@
+#include "Engine/Assert.h"
+#include "HAL/EventLoop.h"
+#include "Threading/Executor.h"
+#include "Threading/LockGuard.h"
+#include "Threading/ThreadPool.h"
+
+FInlineExecutor& FInlineExecutor::Get()
+{
+	static FInlineExecutor executor;
+	return executor;
+}
+
+void FInlineExecutor::Execute(FExecuteFunction function)
+{
+	if (function.IsValid())
+	{
+		function();
+	}
+}
+
+FThreadPoolExecutor::FThreadPoolExecutor(FThreadPool& threadPool)
+	: m_ThreadPool { threadPool }
+{
+}
+
+void FThreadPoolExecutor::Execute(FExecuteFunction function)
+{
+	(void)m_ThreadPool.Schedule(MoveTemp(function));
+}
+
+void FQueuedExecutor::Execute(FExecuteFunction function)
+{
+	FScopedLockGuard lock { m_FunctionsMutex };
+	m_Functions.Add(MoveTemp(function));
+}
+
+int32 FQueuedExecutor::ExecutePending()
+{
+	// Swap the functions out before running them so they can queue more functions without dead-locking
+	TArray<FExecuteFunction> functions;
+	{
+		FScopedLockGuard lock { m_FunctionsMutex };
+		Swap(functions, m_Functions);
+	}
+
+	for (FExecuteFunction& function : functions)
+	{
+		function();
+	}
+
+	return functions.Num();
+}
+
+bool FQueuedExecutor::HasPending() const
+{
+	FScopedLockGuard lock { m_FunctionsMutex };
+	return m_Functions.Num() > 0;
+}
+
+FEventLoopExecutor::FEventLoopExecutor(TSharedPtr<FEventLoop> eventLoop)
+	: m_EventLoop { MoveTemp(eventLoop) }
+{
+	UM_ASSERT(m_EventLoop.IsValid(), "Event loop executors require a valid event loop");
+}
+
+void FEventLoopExecutor::Execute(FExecuteFunction function)
+{
+	m_EventLoop->Post(MoveTemp(function));
+}
\ No newline at end of file
@@ -5,7 +5,7 @@
 FScopedLockGuard::FScopedLockGuard(FMutex& mutex)
 	: m_Mutex { mutex }
 {
-	UM_ASSERT(m_Mutex.IsLocked() == false, "Attempting to lock an already locked mutex");
+	UM_ASSERT(m_Mutex.IsLockedByCallingThread() == false, "Attempting to lock a mutex already locked by the calling thread");
 
 	m_Mutex.Lock();
 }
@@ -1,13 +1,13 @@
 #include "Engine/Assert.h"
 #include "Engine/Logging.h"
 #include "Threading/Mutex.h"
+#include <atomic>
 #include <pthread.h>
 
-enum class EMutexLockState : bool
-{
-	Unlocked,
-	Locked
-};
+/**
+ * @brief A per-thread variable whose address uniquely identifies the calling thread.
+ */
+static thread_local uint8 GMutexThreadIdentity = 0;
 
 class FMutex::FMutexImpl final
 {
@@ -16,8 +16,8 @@ public:
 	/** @brief The mutex handle. */
 	pthread_mutex_t MutexHandle = PTHREAD_MUTEX_INITIALIZER;
 
-	/** @brief The mutex's lock state. */
-	EMutexLockState LockState = EMutexLockState::Unlocked;
+	/** @brief Identifies the thread currently holding the lock, or null if the mutex is unlocked. */
+	std::atomic<const uint8*> OwningThread = nullptr;
 
 	/**
 	 * @brief Creates a new mutex implementation.
@@ -70,7 +70,12 @@ FMutex::~FMutex()
 
 bool FMutex::IsLocked() const
 {
-	return m_Impl.IsValid() && m_Impl->LockState == EMutexLockState::Locked;
+	return m_Impl.IsValid() && m_Impl->OwningThread.load() != nullptr;
+}
+
+bool FMutex::IsLockedByCallingThread() const
+{
+	return m_Impl.IsValid() && m_Impl->OwningThread.load() == &GMutexThreadIdentity;
 }
 
 bool FMutex::IsValid() const
@@ -81,23 +86,19 @@ bool FMutex::IsValid() const
 void FMutex::Lock()
 {
 	UM_ASSERT(m_Impl.IsValid(), "Attempting to lock invalid mutex");
-	UM_ASSERT(m_Impl->LockState != EMutexLockState::Locked, "Attempting to lock an already locked mutex");
+	UM_ASSERT(IsLockedByCallingThread() == false, "Attempting to lock a mutex already locked by the calling thread");
 
 	pthread_mutex_lock(&m_Impl->MutexHandle);
-	m_Impl->LockState = EMutexLockState::Locked;
+	m_Impl->OwningThread.store(&GMutexThreadIdentity);
 }
 
 void FMutex::Unlock()
 {
 	UM_ASSERT(m_Impl.IsValid(), "Attempting to unlock invalid mutex");
+	UM_ASSERT(IsLockedByCallingThread(), "Attempting to unlock a mutex not locked by the calling thread");
 
-	if (m_Impl->LockState == EMutexLockState::Unlocked)
-	{
-		return;
-	}
-
+	m_Impl->OwningThread.store(nullptr);
 	pthread_mutex_unlock(&m_Impl->MutexHandle);
-	m_Impl->LockState = EMutexLockState::Unlocked;
 }
 
 FMutex& FMutex::operator=(FMutex&& other) noexcept
@@ -1,7 +1,16 @@
 #include "Engine/Logging.h"
 #include "HAL/InternalTime.h"
 #include "Threading/Thread.h"
+#include <atomic>
 #include <pthread.h>
+#if !UMBRAL_PLATFORM_IS_WINDOWS
+#	include <unistd.h>
+#endif
+#if !UMBRAL_ARCH_IS_ARM
+#	include <immintrin.h> /* For _mm_pause */
+#elif UMBRAL_COMPILER == UMBRAL_COMPILER_MSVC
+#	include <intrin.h> /* For __yield */
+#endif
 
 enum class EThreadState : uint8
 {
@@ -30,7 +39,8 @@ public:
 	 */
 	~FThreadImpl()
 	{
-		UM_ASSERT(m_State == EThreadState::Finished || m_State == EThreadState::Joined, "Destroying thread implementation without joining");
+		const EThreadState state = m_State.load();
+		UM_ASSERT(state != EThreadState::Running && state != EThreadState::Finished, "Destroying thread implementation without joining");
 	}
 
 	/**
@@ -38,7 +48,9 @@ public:
 	 */
 	void Join()
 	{
-		if (m_State != EThreadState::Running)
+		// The thread may have finished running its function, but it still needs to be joined to release its resources
+		const EThreadState state = m_State.load();
+		if (state != EThreadState::Running && state != EThreadState::Finished)
 		{
 			return;
 		}
@@ -73,7 +85,9 @@ public:
 		const int32 result = pthread_create(&m_ThreadHandle, &threadAttr, RunThreadFunction, this);
 		if (result == 0)
 		{
-			m_State = EThreadState::Running;
+			// The thread may have already finished by the time we get here
+			EThreadState expectedState = EThreadState::WaitingToRun;
+			m_State.compare_exchange_strong(expectedState, EThreadState::Running);
 			return;
 		}
 
@@ -105,7 +119,7 @@ private:
 
 	pthread_t m_ThreadHandle {};
 	TFunction<void()> m_Function;
-	EThreadState m_State = EThreadState::WaitingToRun;
+	std::atomic<EThreadState> m_State = EThreadState::WaitingToRun;
 };
 
 FThread::FThread() = default;
@@ -132,6 +146,17 @@ FThread FThread::Create(TFunction<void()> function)
 	return thread;
 }
 
+int32 FThread::GetNumLogicalProcessors()
+{
+#if UMBRAL_PLATFORM_IS_WINDOWS
+	const int32 numProcessors = pthread_num_processors_np();
+#else
+	const int32 numProcessors = static_cast<int32>(::sysconf(_SC_NPROCESSORS_ONLN));
+#endif
+
+	return numProcessors > 0 ? numProcessors : 1;
+}
+
 bool FThread::IsValid() const
 {
 	return m_Impl.IsValid();
@@ -155,6 +180,19 @@ static struct timespec TimeSpanToTimeSpec(const FTimeSpan timeSpan)
 	return duration;
 }
 
+void FThread::RelaxProcessor()
+{
+#if UMBRAL_ARCH_IS_ARM
+#	if UMBRAL_COMPILER == UMBRAL_COMPILER_MSVC
+	__yield();
+#	else
+	__asm__ __volatile__("yield");
+#	endif
+#else
+	_mm_pause();
+#endif
+}
+
 void FThread::Sleep(const FTimeSpan duration)
 {
 	if (duration.GetTicks() <= 0)
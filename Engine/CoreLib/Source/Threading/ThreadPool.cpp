@@ -0,0 +1,459 @@
+#include "Engine/Assert.h"
+#include "Math/Math.h"
+#include "Threading/LockGuard.h"
+#include "Threading/ThreadPool.h"
+#include "Threading/WorkStealingQueue.h"
+
+/** @brief The thread pool that owns the calling thread, if the calling thread is a worker. */
+static thread_local FThreadPool* GCurrentThreadPool = nullptr;
+
+/** @brief The index of the calling thread in its thread pool, if the calling thread is a worker. */
+static thread_local int32 GCurrentWorkerIndex = INDEX_NONE;
+
+/** @brief The number of times an idle worker looks for jobs before going to sleep. */
+static constexpr int32 GNumIdleSpinsBeforeSleeping = 64;
+
+namespace Private
+{
+	/**
+	 * @brief Defines a job that has been scheduled on a thread pool.
+	 */
+	class FThreadPoolJob final
+	{
+	public:
+
+		/**
+		 * @brief Sets default values for this job's properties.
+		 *
+		 * @param function The job's function.
+		 * @param counter The counter to decrement once the job has finished.
+		 * @param pool The thread pool the job was scheduled on.
+		 */
+		FThreadPoolJob(FThreadPool::FJobFunction function, FJobHandle counter, FThreadPool* pool)
+			: Function { MoveTemp(function) }
+			, Counter { MoveTemp(counter) }
+			, Pool { pool }
+		{
+		}
+
+		/** @brief The job's function. */
+		FThreadPool::FJobFunction Function;
+
+		/** @brief The counter to decrement once the job has finished. */
+		FJobHandle Counter;
+
+		/** @brief The thread pool the job was scheduled on. */
+		FThreadPool* Pool = nullptr;
+
+		/** @brief The number of dependencies that must finish before this job can be queued. */
+		std::atomic<int32> NumUnresolvedDependencies = 0;
+
+		/** @brief Whether or not the job should be skipped instead of queued once its dependencies have finished. */
+		std::atomic<bool> IsCancelled = false;
+	};
+
+	/**
+	 * @brief Defines the per-worker state of a thread pool.
+	 */
+	class FThreadPoolWorker final
+	{
+	public:
+
+		/** @brief The worker's job queue. */
+		TWorkStealingQueue<FThreadPoolJob> Queue;
+
+		/** @brief The worker's thread. */
+		TUniquePtr<FThread> Thread;
+	};
+}
+
+FJobCounter::FJobCounter() = default;
+
+FJobCounter::~FJobCounter()
+{
+	// Nothing can finish our pending jobs anymore, so our dependent jobs are cancelled instead of being left to wait
+	// forever. They may still be waiting on other counters, so their pools free them once their last dependency is gone
+	for (Private::FThreadPoolJob* job : m_DependentJobs)
+	{
+		job->IsCancelled.store(true, std::memory_order_release);
+		job->Pool->ResolveDependency(job);
+	}
+}
+
+int32 FJobCounter::GetNumPendingJobs() const
+{
+	return m_NumPendingJobs.load(std::memory_order_acquire);
+}
+
+bool FJobCounter::IsComplete() const
+{
+	return GetNumPendingJobs() == 0;
+}
+
+void FJobCounter::Wait() const
+{
+	for (int32 numPendingJobs = GetNumPendingJobs(); numPendingJobs > 0; numPendingJobs = GetNumPendingJobs())
+	{
+		m_NumPendingJobs.wait(numPendingJobs, std::memory_order_acquire);
+	}
+}
+
+FThreadPool::FThreadPool(int32 numWorkers)
+{
+	if (numWorkers <= 0)
+	{
+		numWorkers = FMath::Max(FThread::GetNumLogicalProcessors() - 1, 1);
+	}
+
+	// All workers need to exist before any of them start so that they can safely steal from each other
+	m_Workers.Reserve(numWorkers);
+	for (int32 idx = 0; idx < numWorkers; ++idx)
+	{
+		m_Workers.Add(MakeUnique<Private::FThreadPoolWorker>());
+	}
+
+	for (int32 idx = 0; idx < numWorkers; ++idx)
+	{
+		m_Workers[idx]->Thread = MakeUnique<FThread>(FThread::Create([this, idx]()
+		{
+			RunWorker(idx);
+		}));
+	}
+}
+
+FThreadPool::~FThreadPool()
+{
+	m_IsRunning.store(false);
+	m_WorkEpoch.fetch_add(1);
+	m_WorkEpoch.notify_all();
+
+	for (TUniquePtr<Private::FThreadPoolWorker>& worker : m_Workers)
+	{
+		worker->Thread->Join();
+	}
+
+	UM_ASSERT(m_NumInjectedJobs.load() == 0, "Thread pool destroyed with jobs still queued");
+}
+
+int32 FThreadPool::GetNumWorkers() const
+{
+	return m_Workers.Num();
+}
+
+bool FThreadPool::IsInWorkerThread() const
+{
+	return GCurrentThreadPool == this;
+}
+
+FJobHandle FThreadPool::ParallelFor(const int32 numItems, int32 batchSize, FParallelForFunction function)
+{
+	FJobHandle counter = MakeShared<FJobCounter>();
+	if (numItems <= 0)
+	{
+		return counter;
+	}
+
+	if (batchSize <= 0)
+	{
+		// Aim for a few batches per worker so that stealing can even out uneven batches
+		batchSize = FMath::Max(numItems / (GetNumWorkers() * 4), 1);
+	}
+
+	TSharedPtr<FParallelForFunction> sharedFunction = MakeShared<FParallelForFunction>(MoveTemp(function));
+	for (int32 batchStart = 0; batchStart < numItems; batchStart += batchSize)
+	{
+		const int32 batchEnd = FMath::Min(batchStart + batchSize, numItems);
+		ScheduleWithCounter(counter, [sharedFunction, batchStart, batchEnd]()
+		{
+			for (int32 idx = batchStart; idx < batchEnd; ++idx)
+			{
+				sharedFunction->Invoke(idx);
+			}
+		});
+	}
+
+	return counter;
+}
+
+FJobHandle FThreadPool::Schedule(FJobFunction function)
+{
+	return Schedule(MoveTemp(function), TSpan<const FJobHandle> {});
+}
+
+FJobHandle FThreadPool::Schedule(FJobFunction function, const FJobHandle& dependency)
+{
+	return Schedule(MoveTemp(function), TSpan<const FJobHandle> { &dependency, 1 });
+}
+
+FJobHandle FThreadPool::Schedule(FJobFunction function, const TSpan<const FJobHandle> dependencies)
+{
+	FJobHandle counter = MakeShared<FJobCounter>();
+	ScheduleWithCounter(counter, MoveTemp(function), dependencies);
+	return counter;
+}
+
+void FThreadPool::ScheduleWithCounter(const FJobHandle& counter, FJobFunction function, const TSpan<const FJobHandle> dependencies)
+{
+	UM_ASSERT(counter.IsValid(), "Attempting to schedule a job with an invalid counter");
+	UM_ASSERT(function.IsValid(), "Attempting to schedule an invalid job function");
+
+	counter->m_NumPendingJobs.fetch_add(1, std::memory_order_relaxed);
+
+	Private::FThreadPoolJob* job = FMemory::AllocateObject<Private::FThreadPoolJob>(MoveTemp(function), counter, this);
+
+	// The extra dependency keeps the job from being queued while we are still registering it with its dependencies
+	job->NumUnresolvedDependencies.store(dependencies.Num() + 1, std::memory_order_relaxed);
+
+	for (const FJobHandle& dependency : dependencies)
+	{
+		UM_ASSERT(dependency.Get() != counter.Get(), "Attempting to make a job depend on its own counter");
+
+		if (dependency.IsValid())
+		{
+			FScopedLockGuard lock { dependency->m_DependentJobsMutex };
+			if (dependency->m_NumPendingJobs.load(std::memory_order_acquire) > 0)
+			{
+				dependency->m_DependentJobs.Add(job);
+				continue;
+			}
+		}
+
+		job->NumUnresolvedDependencies.fetch_sub(1, std::memory_order_acq_rel);
+	}
+
+	ResolveDependency(job);
+}
+
+void FThreadPool::WaitForCounter(const FJobHandle& counter)
+{
+	if (counter.IsNull())
+	{
+		return;
+	}
+
+	int32 numIdleSpins = 0;
+	while (counter->IsComplete() == false)
+	{
+		if (Private::FThreadPoolJob* job = FindJob())
+		{
+			ExecuteJob(job);
+			numIdleSpins = 0;
+			continue;
+		}
+
+		if (numIdleSpins < GNumIdleSpinsBeforeSleeping)
+		{
+			FThread::RelaxProcessor();
+			++numIdleSpins;
+			continue;
+		}
+
+		// Sleep until either more work shows up or one of the pool's counters reaches zero
+		m_NumWaitingThreads.fetch_add(1);
+		const uint32 workEpoch = m_WorkEpoch.load();
+		if (counter->IsComplete() == false && HasQueuedJobs() == false)
+		{
+			m_WorkEpoch.wait(workEpoch);
+		}
+		m_NumWaitingThreads.fetch_sub(1);
+	}
+}
+
+void FThreadPool::DecrementCounter(FJobCounter& counter)
+{
+	if (counter.m_NumPendingJobs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+	{
+		return;
+	}
+
+	counter.m_NumPendingJobs.notify_all();
+
+	TArray<Private::FThreadPoolJob*> dependentJobs;
+	{
+		FScopedLockGuard lock { counter.m_DependentJobsMutex };
+
+		// The counter may have been reused for more jobs since we decremented it
+		if (counter.m_NumPendingJobs.load(std::memory_order_acquire) == 0)
+		{
+			dependentJobs = MoveTemp(counter.m_DependentJobs);
+		}
+	}
+
+	for (Private::FThreadPoolJob* job : dependentJobs)
+	{
+		ResolveDependency(job);
+	}
+
+	if (m_NumWaitingThreads.load() > 0)
+	{
+		m_WorkEpoch.fetch_add(1);
+		m_WorkEpoch.notify_all();
+	}
+}
+
+void FThreadPool::CancelJob(Private::FThreadPoolJob* job)
+{
+	// Signal the job's counter as if the job had run so that nothing waiting on it hangs
+	FJobHandle counter = MoveTemp(job->Counter);
+	FMemory::FreeObject(job);
+
+	DecrementCounter(*counter);
+}
+
+void FThreadPool::EnqueueJob(Private::FThreadPoolJob* job)
+{
+	if (GCurrentThreadPool == this)
+	{
+		m_Workers[GCurrentWorkerIndex]->Queue.Push(job);
+	}
+	else
+	{
+		FScopedLockGuard lock { m_InjectedJobsMutex };
+		m_InjectedJobs.Add(job);
+		m_NumInjectedJobs.fetch_add(1);
+	}
+
+	m_WorkEpoch.fetch_add(1);
+	m_WorkEpoch.notify_one();
+}
+
+void FThreadPool::ExecuteJob(Private::FThreadPoolJob* job)
+{
+	job->Function.Invoke();
+
+	// Hold on to the counter until we are done with it because the job owns the only guaranteed reference to it
+	FJobHandle counter = MoveTemp(job->Counter);
+	FMemory::FreeObject(job);
+
+	DecrementCounter(*counter);
+}
+
+Private::FThreadPoolJob* FThreadPool::FindJob()
+{
+	const bool isWorkerThread = GCurrentThreadPool == this;
+	if (isWorkerThread)
+	{
+		if (Private::FThreadPoolJob* job = m_Workers[GCurrentWorkerIndex]->Queue.Pop())
+		{
+			return job;
+		}
+	}
+
+	if (m_NumInjectedJobs.load() > 0)
+	{
+		FScopedLockGuard lock { m_InjectedJobsMutex };
+		if (m_InjectedJobsHead < m_InjectedJobs.Num())
+		{
+			Private::FThreadPoolJob* job = m_InjectedJobs[m_InjectedJobsHead];
+			++m_InjectedJobsHead;
+
+			if (m_InjectedJobsHead == m_InjectedJobs.Num())
+			{
+				m_InjectedJobs.Clear();
+				m_InjectedJobsHead = 0;
+			}
+
+			m_NumInjectedJobs.fetch_sub(1);
+			return job;
+		}
+	}
+
+	const int32 numWorkers = m_Workers.Num();
+	const int32 firstVictimIndex = isWorkerThread ? GCurrentWorkerIndex + 1 : 0;
+	for (int32 idx = 0; idx < numWorkers; ++idx)
+	{
+		const int32 victimIndex = (firstVictimIndex + idx) % numWorkers;
+		if (isWorkerThread && victimIndex == GCurrentWorkerIndex)
+		{
+			continue;
+		}
+
+		// A failed steal only means another thread won the race, so keep trying while the victim still has work
+		Private::TWorkStealingQueue<Private::FThreadPoolJob>& victimQueue = m_Workers[victimIndex]->Queue;
+		while (victimQueue.IsEmpty() == false)
+		{
+			if (Private::FThreadPoolJob* job = victimQueue.Steal())
+			{
+				return job;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+bool FThreadPool::HasQueuedJobs() const
+{
+	if (m_NumInjectedJobs.load() > 0)
+	{
+		return true;
+	}
+
+	for (const TUniquePtr<Private::FThreadPoolWorker>& worker : m_Workers)
+	{
+		if (worker->Queue.IsEmpty() == false)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FThreadPool::ResolveDependency(Private::FThreadPoolJob* job)
+{
+	if (job->NumUnresolvedDependencies.fetch_sub(1, std::memory_order_acq_rel) != 1)
+	{
+		return;
+	}
+
+	if (job->IsCancelled.load(std::memory_order_acquire))
+	{
+		CancelJob(job);
+	}
+	else
+	{
+		EnqueueJob(job);
+	}
+}
+
+void FThreadPool::RunWorker(const int32 workerIndex)
+{
+	GCurrentThreadPool = this;
+	GCurrentWorkerIndex = workerIndex;
+
+	int32 numIdleSpins = 0;
+	while (true)
+	{
+		if (Private::FThreadPoolJob* job = FindJob())
+		{
+			ExecuteJob(job);
+			numIdleSpins = 0;
+			continue;
+		}
+
+		if (numIdleSpins < GNumIdleSpinsBeforeSleeping)
+		{
+			FThread::RelaxProcessor();
+			++numIdleSpins;
+			continue;
+		}
+
+		// Read the epoch before checking for work one last time so that we cannot miss a wake up
+		const uint32 workEpoch = m_WorkEpoch.load();
+		if (HasQueuedJobs())
+		{
+			continue;
+		}
+
+		if (m_IsRunning.load() == false)
+		{
+			break;
+		}
+
+		m_WorkEpoch.wait(workEpoch);
+	}
+
+	GCurrentThreadPool = nullptr;
+	GCurrentWorkerIndex = INDEX_NONE;
+}
\ No newline at end of file
@@ -0,0 +1,181 @@
+#include "HAL/EventLoop.h"
+#include "HAL/File.h"
+#include "Threading/Promise.h"
+#include "Threading/ThreadPool.h"
+#include <gtest/gtest.h>
+
+TEST(AsyncTaskTests, PromiseFulfillsTask)
+{
+	TPromise<int32> promise;
+	TAsyncTask<int32> task = promise.GetTask();
+	EXPECT_TRUE(task.IsValid());
+	EXPECT_FALSE(task.IsReady());
+
+	EXPECT_TRUE(promise.SetValue(42));
+	EXPECT_FALSE(promise.SetValue(7));
+	EXPECT_TRUE(promise.IsFulfilled());
+
+	ASSERT_TRUE(task.IsReady());
+	ASSERT_FALSE(task.GetResult().IsError());
+	EXPECT_EQ(task.GetResult().GetValue(), 42);
+}
+
+TEST(AsyncTaskTests, ThenChainsValuesAndErrors)
+{
+	TPromise<int32> promise;
+	TAsyncTask<FString> stringTask = promise.GetTask()
+		.Then([](const TErrorOr<int32>& result) -> TErrorOr<int32>
+		{
+			if (result.IsError())
+			{
+				return MAKE_ERROR("Unexpected error");
+			}
+			return result.GetValue() * 2;
+		})
+		.Then([](const TErrorOr<int32>& result)
+		{
+			return FString::Format("{}"_sv, result.GetValue());
+		});
+
+	TAsyncTask<int32> failedTask = TAsyncTask<int32>::FromResult(MAKE_ERROR("Failed"))
+		.Then([](const TErrorOr<int32>& result) -> TErrorOr<int32>
+		{
+			if (result.IsError())
+			{
+				return result.GetError();
+			}
+			return 0;
+		});
+
+	EXPECT_FALSE(stringTask.IsReady());
+	promise.SetValue(21);
+
+	ASSERT_TRUE(stringTask.IsReady());
+	EXPECT_EQ(stringTask.GetResult().GetValue(), "42"_sv);
+
+	ASSERT_TRUE(failedTask.IsReady());
+	EXPECT_TRUE(failedTask.GetResult().IsError());
+}
+
+TEST(AsyncTaskTests, ThenFlattensTasks)
+{
+	TPromise<int32> outerPromise;
+	TPromise<int32> innerPromise;
+
+	TAsyncTask<int32> task = outerPromise.GetTask().Then([innerPromise](const TErrorOr<int32>&)
+	{
+		return innerPromise.GetTask();
+	});
+
+	outerPromise.SetValue(1);
+	EXPECT_FALSE(task.IsReady());
+
+	innerPromise.SetValue(2);
+	ASSERT_TRUE(task.IsReady());
+	EXPECT_EQ(task.GetResult().GetValue(), 2);
+}
+
+TEST(AsyncTaskTests, ThenOnThreadPool)
+{
+	FThreadPool threadPool { 2 };
+	FThreadPoolExecutor executor { threadPool };
+
+	TAsyncTask<bool> task = Async(executor, [&threadPool]()
+	{
+		return threadPool.IsInWorkerThread();
+	});
+
+	ASSERT_FALSE(task.GetResult().IsError());
+	EXPECT_TRUE(task.GetResult().GetValue());
+}
+
+TEST(AsyncTaskTests, ThenOnQueuedExecutor)
+{
+	FQueuedExecutor mainThreadExecutor;
+	TPromise<void> promise;
+
+	bool didRun = false;
+	TAsyncTask<void> task = promise.GetTask().Then(mainThreadExecutor, [&didRun](const TErrorOr<void>&)
+	{
+		didRun = true;
+	});
+
+	promise.SetValue();
+	EXPECT_FALSE(didRun);
+	EXPECT_TRUE(mainThreadExecutor.HasPending());
+
+	EXPECT_EQ(mainThreadExecutor.ExecutePending(), 1);
+	EXPECT_TRUE(didRun);
+	EXPECT_TRUE(task.IsReady());
+}
+
+TEST(AsyncTaskTests, WhenAll)
+{
+	FThreadPool threadPool { 4 };
+	FThreadPoolExecutor executor { threadPool };
+
+	TArray<TAsyncTask<int32>> tasks;
+	for (int32 idx = 0; idx < 64; ++idx)
+	{
+		tasks.Add(Async(executor, [idx]()
+		{
+			return idx * idx;
+		}));
+	}
+
+	const TAsyncTask<TArray<int32>> allTask = WhenAll(tasks);
+	const TErrorOr<TArray<int32>>& result = allTask.GetResult();
+	ASSERT_FALSE(result.IsError());
+	ASSERT_EQ(result.GetValue().Num(), tasks.Num());
+	for (int32 idx = 0; idx < tasks.Num(); ++idx)
+	{
+		EXPECT_EQ(result.GetValue()[idx], idx * idx);
+	}
+
+	tasks.Add(TAsyncTask<int32>::FromResult(MAKE_ERROR("Failed")));
+	EXPECT_TRUE(WhenAll(tasks).GetResult().IsError());
+
+	EXPECT_FALSE(WhenAll(TArray<TAsyncTask<void>> {}).GetResult().IsError());
+}
+
+TEST(AsyncTaskTests, WhenAny)
+{
+	TPromise<int32> first;
+	TPromise<int32> second;
+	const TArray<TAsyncTask<int32>> tasks { first.GetTask(), second.GetTask() };
+
+	TAsyncTask<int32> anyTask = WhenAny(tasks);
+	EXPECT_FALSE(anyTask.IsReady());
+
+	second.SetValue(2);
+	first.SetValue(1);
+
+	ASSERT_TRUE(anyTask.IsReady());
+	EXPECT_EQ(anyTask.GetResult().GetValue(), 1);
+}
+
+TEST(AsyncTaskTests, ReadTextFromEventLoop)
+{
+	TSharedPtr<FEventLoop> eventLoop = FEventLoop::Create();
+	FEventLoopExecutor executor { eventLoop };
+
+	const FString filePath { UMBRAL_FILE_AS_VIEW };
+	TAsyncTask<int32> lengthTask = FFile::ReadTextAsync(filePath, eventLoop)
+		.Then(executor, [](const TErrorOr<FString>& result) -> TErrorOr<int32>
+		{
+			if (result.IsError())
+			{
+				return result.GetError();
+			}
+			return result.GetValue().Length();
+		});
+
+	while (eventLoop->IsRunning())
+	{
+		eventLoop->PollTasks();
+	}
+
+	ASSERT_TRUE(lengthTask.IsReady());
+	ASSERT_FALSE(lengthTask.GetResult().IsError());
+	EXPECT_GT(lengthTask.GetResult().GetValue(), 0);
+}
\ No newline at end of file
@@ -1,6 +1,45 @@
 #include "Engine/Logging.h"
+#include "HAL/Timer.h"
+#include "Math/Math.h"
 #include "Misc/Base64.h"
+#include "Misc/StringBuilder.h"
 #include <gtest/gtest.h>
+#include <random>
+
+/**
+ * @brief Encodes bytes one character at a time, the way Base64::Encode used to. Used as the reference for checking and
+ *        timing the vectorized encoder.
+ */
+static FString EncodeOneCharAtATime(const TSpan<const uint8> bytes)
+{
+	constexpr FStringView characters = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"_sv;
+
+	FStringBuilder builder;
+	for (int32 idx = 0; idx < bytes.Num(); idx += 3)
+	{
+		const uint32 first = bytes[idx];
+		const uint32 second = bytes.IsValidIndex(idx + 1) ? bytes[idx + 1] : 0;
+		const uint32 third = bytes.IsValidIndex(idx + 2) ? bytes[idx + 2] : 0;
+
+		builder.Append(characters[static_cast<int32>(first >> 2)]);
+		builder.Append(characters[static_cast<int32>(((first & 0b11) << 4) | (second >> 4))]);
+		builder.Append(bytes.IsValidIndex(idx + 1) ? characters[static_cast<int32>(((second & 0b1111) << 2) | (third >> 6))] : '=');
+		builder.Append(bytes.IsValidIndex(idx + 2) ? characters[static_cast<int32>(third & 0b111111)] : '=');
+	}
+
+	return builder.ReleaseString();
+}
+
+static TArray<uint8> MakeRandomBytes(std::mt19937& random, const int32 numBytes)
+{
+	TArray<uint8> bytes;
+	bytes.Reserve(numBytes);
+	for (int32 idx = 0; idx < numBytes; ++idx)
+	{
+		bytes.Add(static_cast<uint8>(random()));
+	}
+	return bytes;
+}
 
 TEST(Base64Tests, EncodeMinimumViableString)
 {
@@ -43,3 +82,125 @@ TEST(Base64Tests, DecodeNoPadding)
 	ASSERT_TRUE(Base64::Decode(encodedString, originalString));
 	EXPECT_EQ(originalString, "Many hands make light work."_sv);
 }
+
+TEST(Base64Tests, DecodeWithoutPadding)
+{
+	FString originalString;
+	ASSERT_TRUE(Base64::Decode("TWE"_sv, originalString));
+	EXPECT_EQ(originalString, "Ma"_sv);
+
+	ASSERT_TRUE(Base64::Decode("TQ"_sv, originalString));
+	EXPECT_EQ(originalString, "M"_sv);
+}
+
+TEST(Base64Tests, DecodeInvalidStrings)
+{
+	EXPECT_TRUE(Base64::Decode("TWFu!WFu"_sv).IsError());
+	EXPECT_TRUE(Base64::Decode("TWFueSBoYW5kcyBtYWtlIGxpZ2h0IHdvcmsu\xff"_sv).IsError());
+	EXPECT_TRUE(Base64::Decode("TQ==TWFu"_sv).IsError());
+	EXPECT_TRUE(Base64::Decode("TQ=u"_sv).IsError());
+	EXPECT_TRUE(Base64::Decode("T==="_sv).IsError());
+	EXPECT_TRUE(Base64::Decode("TWFuT"_sv).IsError());
+}
+
+TEST(Base64Tests, RoundTripMatchesReference)
+{
+	std::mt19937 random { 42 };
+
+	for (int32 numBytes = 0; numBytes < 300; ++numBytes)
+	{
+		const TArray<uint8> bytes = MakeRandomBytes(random, numBytes);
+		const FString encodedString = Base64::Encode(bytes.AsSpan());
+		ASSERT_EQ(encodedString, EncodeOneCharAtATime(bytes.AsSpan()));
+
+		TErrorOr<TArray<uint8>> decodeResult = Base64::Decode(encodedString);
+		ASSERT_FALSE(decodeResult.IsError());
+
+		const TArray<uint8> decodedBytes = decodeResult.ReleaseValue();
+		ASSERT_EQ(decodedBytes.Num(), bytes.Num());
+		for (int32 idx = 0; idx < bytes.Num(); ++idx)
+		{
+			ASSERT_EQ(decodedBytes[idx], bytes[idx]);
+		}
+	}
+}
+
+TEST(Base64Tests, StreamInChunks)
+{
+	std::mt19937 random { 7 };
+	const TArray<uint8> bytes = MakeRandomBytes(random, 5000);
+	const FString expectedString = Base64::Encode(bytes.AsSpan());
+
+	// Encode in chunks of random sizes
+	TArray<char> encodedChars;
+	Base64::FStreamEncoder encoder;
+	for (int32 idx = 0; idx < bytes.Num(); /* empty */)
+	{
+		const int32 chunkSize = FMath::Min(static_cast<int32>(random() % 100) + 1, bytes.Num() - idx);
+		const int32 outputIndex = encodedChars.AddZeroed(Base64::GetEncodedLength(chunkSize));
+		const int32 numChars = encoder.Encode(TSpan<const uint8> { bytes.GetData() + idx, chunkSize }, TSpan<char> { encodedChars.GetData() + outputIndex, encodedChars.Num() - outputIndex });
+		encodedChars.SetNum(outputIndex + numChars);
+		idx += chunkSize;
+	}
+
+	const int32 finishIndex = encodedChars.AddZeroed(4);
+	encodedChars.SetNum(finishIndex + encoder.Finish(TSpan<char> { encodedChars.GetData() + finishIndex, 4 }));
+	ASSERT_EQ(FStringView { encodedChars.AsSpan() }, expectedString.AsStringView());
+
+	// Decode in chunks of random sizes
+	TArray<uint8> decodedBytes;
+	Base64::FStreamDecoder decoder;
+	const FStringView encodedString { encodedChars.AsSpan() };
+	for (int32 idx = 0; idx < encodedString.Length(); /* empty */)
+	{
+		const int32 chunkSize = FMath::Min(static_cast<int32>(random() % 100) + 1, encodedString.Length() - idx);
+		const int32 outputIndex = decodedBytes.AddZeroed(Base64::GetMaxDecodedLength(chunkSize));
+
+		TErrorOr<int32> decodeResult = decoder.Decode(FStringView { encodedString.GetChars() + idx, chunkSize }, TSpan<uint8> { decodedBytes.GetData() + outputIndex, decodedBytes.Num() - outputIndex });
+		ASSERT_FALSE(decodeResult.IsError());
+
+		decodedBytes.SetNum(outputIndex + decodeResult.ReleaseValue());
+		idx += chunkSize;
+	}
+
+	const int32 finishOutputIndex = decodedBytes.AddZeroed(3);
+	TErrorOr<int32> finishResult = decoder.Finish(TSpan<uint8> { decodedBytes.GetData() + finishOutputIndex, 3 });
+	ASSERT_FALSE(finishResult.IsError());
+	decodedBytes.SetNum(finishOutputIndex + finishResult.ReleaseValue());
+
+	ASSERT_EQ(decodedBytes.Num(), bytes.Num());
+	for (int32 idx = 0; idx < bytes.Num(); ++idx)
+	{
+		ASSERT_EQ(decodedBytes[idx], bytes[idx]);
+	}
+}
+
+// This only measures speed, so it is disabled by default to keep it out of regular test runs. Run it with
+// --gtest_also_run_disabled_tests to see the numbers
+TEST(Base64Tests, DISABLED_Throughput)
+{
+	constexpr int32 numBytes = 4 * 1024 * 1024;
+
+	std::mt19937 random { 1 };
+	const TArray<uint8> bytes = MakeRandomBytes(random, numBytes);
+	const double numMegabytes = static_cast<double>(numBytes) / (1024.0 * 1024.0);
+
+	FTimer timer = FTimer::Start();
+	const FString referenceString = EncodeOneCharAtATime(bytes.AsSpan());
+	const double referenceEncodeSeconds = timer.Stop().GetTotalSeconds();
+
+	timer.Restart();
+	const FString encodedString = Base64::Encode(bytes.AsSpan());
+	const double encodeSeconds = timer.Stop().GetTotalSeconds();
+
+	timer.Restart();
+	TErrorOr<TArray<uint8>> decodeResult = Base64::Decode(encodedString);
+	const double decodeSeconds = timer.Stop().GetTotalSeconds();
+
+	ASSERT_EQ(encodedString, referenceString);
+	ASSERT_FALSE(decodeResult.IsError());
+	EXPECT_EQ(decodeResult.GetValue().Num(), numBytes);
+
+	UM_LOG(Info, "Base-64 encode: {} MB/s (one character at a time: {} MB/s)", numMegabytes / encodeSeconds, numMegabytes / referenceEncodeSeconds);
+	UM_LOG(Info, "Base-64 decode: {} MB/s", numMegabytes / decodeSeconds);
+}
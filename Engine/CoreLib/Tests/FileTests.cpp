@@ -1,8 +1,11 @@
 #include "Engine/Logging.h"
 #include "HAL/EventLoop.h"
+#include "HAL/BufferedFileStream.h"
 #include "HAL/File.h"
+#include "HAL/FileSystem.h"
 #include "HAL/TimePoint.h"
 #include "HAL/Timer.h"
+#include "Math/Math.h"
 #include <gtest/gtest.h>
 
 // TODO Read text from a file that does not exist
@@ -125,4 +128,76 @@ TEST(FileTests, WriteLinesAsync)
 	{
 		EXPECT_EQ(lines[idx], fileLines[idx]);
 	}
+}
+
+TEST(FileTests, BufferedStreamRoundTrips)
+{
+	constexpr FStringView fileName = "BufferedStreamRoundTrips.bin"_sv;
+	constexpr int32 bufferSize = 64;
+
+	TArray<uint8> bytes;
+	for (int32 idx = 0; idx < 1000; ++idx)
+	{
+		bytes.Add(static_cast<uint8>(idx * 13 + 7));
+	}
+
+	{
+		TSharedPtr<IFileStream> fileStream = FFileSystem::OpenWrite(fileName, bufferSize);
+		ASSERT_TRUE(fileStream.IsValid());
+
+		// Mixes writes that fit in the buffer with ones that are larger than it
+		int32 numBytesWritten = 0;
+		for (int32 chunkSize = 1; numBytesWritten < bytes.Num(); chunkSize = (chunkSize * 3) % 97 + 1)
+		{
+			const int32 numBytesToWrite = FMath::Min(chunkSize, bytes.Num() - numBytesWritten);
+			fileStream->Write(bytes.GetData() + numBytesWritten, static_cast<uint64>(numBytesToWrite));
+			numBytesWritten += numBytesToWrite;
+
+			EXPECT_EQ(fileStream->Tell(), numBytesWritten);
+		}
+
+		fileStream->Sync();
+	}
+
+	{
+		TSharedPtr<IFileStream> fileStream = FFileSystem::OpenRead(fileName, bufferSize);
+		ASSERT_TRUE(fileStream.IsValid());
+		EXPECT_EQ(fileStream->GetLength(), bytes.Num());
+
+		TArray<uint8> readBytes;
+		readBytes.SetNum(bytes.Num());
+
+		int32 numBytesRead = 0;
+		for (int32 chunkSize = 1; numBytesRead < bytes.Num(); chunkSize = (chunkSize * 5) % 89 + 1)
+		{
+			const int32 numBytesToRead = FMath::Min(chunkSize, bytes.Num() - numBytesRead);
+			fileStream->Read(readBytes.GetData() + numBytesRead, static_cast<uint64>(numBytesToRead));
+			numBytesRead += numBytesToRead;
+
+			EXPECT_EQ(fileStream->Tell(), numBytesRead);
+		}
+
+		EXPECT_TRUE(fileStream->IsAtEnd());
+		for (int32 idx = 0; idx < bytes.Num(); ++idx)
+		{
+			ASSERT_EQ(readBytes[idx], bytes[idx]);
+		}
+
+		// Seek both within and outside of what has already been read ahead
+		uint8 value = 0;
+		fileStream->Seek(ESeekOrigin::Beginning, 500);
+		fileStream->Read(&value, 1);
+		EXPECT_EQ(value, bytes[500]);
+
+		fileStream->Seek(ESeekOrigin::Current, 10);
+		fileStream->Read(&value, 1);
+		EXPECT_EQ(value, bytes[511]);
+
+		fileStream->Seek(ESeekOrigin::End, -1);
+		fileStream->Read(&value, 1);
+		EXPECT_EQ(value, bytes.Last());
+		EXPECT_TRUE(fileStream->IsAtEnd());
+	}
+
+	EXPECT_FALSE(FFile::Delete(fileName).IsError());
 }
\ No newline at end of file
@@ -6,25 +6,20 @@
 template<typename KeyType, typename ValueType>
 static void DebugPrintBuckets(const THashMap<KeyType, ValueType>& hashMap)
 {
-	using PairType = TKeyValuePair<KeyType, ValueType>;
-	using BucketType = typename THashTable<PairType>::BucketType;
+	const TSpan<const int8> controlBytes = hashMap.DebugGetControlBytes();
 
-	const TArray<BucketType>& buckets = hashMap.DebugGetBuckets();
+	UM_LOG(Info, "Count: {}", controlBytes.Num());
 
-	UM_LOG(Info, "Count: {}", buckets.Num());
-
-	int32 index = -1;
-	for (const BucketType& bucket : buckets)
+	for (int32 index = 0; index < controlBytes.Num(); ++index)
 	{
-		++index;
-
-		if (bucket.HasValue() == false)
+		const TKeyValuePair<KeyType, ValueType>* pair = hashMap.DebugGetSlotElement(index);
+		if (pair == nullptr)
 		{
 			UM_LOG(Info, "~~ [{}] ------------", index);
 			continue;
 		}
 
-		UM_LOG(Info, "~~ [{}] '{}' -> '{}'", index, bucket.GetValue().Key, bucket.GetValue().Value);
+		UM_LOG(Info, "~~ [{}] '{}' -> '{}'", index, pair->Key, pair->Value);
 	}
 }
 
@@ -40,4 +35,19 @@ TEST(HashMapTests, BracketOperator)
 	EXPECT_EQ(hashMap[30], "thirty"_sv);
 	EXPECT_EQ(hashMap[20], "twenty"_sv);
 	EXPECT_EQ(hashMap[10], "ten"_sv);
+}
+
+TEST(HashMapTests, Remove)
+{
+	THashMap<FStringView, int32> hashMap;
+	EXPECT_TRUE(hashMap.Add("one"_sv, 1));
+	EXPECT_TRUE(hashMap.Add("two"_sv, 2));
+	EXPECT_EQ(hashMap.Num(), 2);
+
+	EXPECT_TRUE(hashMap.Remove("one"_sv));
+	EXPECT_FALSE(hashMap.Remove("one"_sv));
+	EXPECT_EQ(hashMap.Num(), 1);
+
+	EXPECT_EQ(hashMap.Find("one"_sv), nullptr);
+	EXPECT_EQ(hashMap.FindRef("two"_sv), 2);
 }
\ No newline at end of file
@@ -7,23 +7,19 @@
 template<typename T>
 [[maybe_unused]] static void PrintHashTableBuckets(const THashTable<T>& hashTable)
 {
-	using BucketType = typename THashTable<T>::FBucket;
-
 	UM_LOG(Info, "BEGIN HASH TABLE(Size={})", hashTable.Num());
 
-	int32 index = 0;
-	for (const BucketType& bucket : hashTable.DebugGetBuckets())
+	const TSpan<const int8> controlBytes = hashTable.DebugGetControlBytes();
+	for (int32 index = 0; index < controlBytes.Num(); ++index)
 	{
-		if (bucket.HasValue())
+		if (const T* value = hashTable.DebugGetSlotElement(index))
 		{
-			UM_LOG(Info, "{} -> Value={}, Hash={}", index, bucket.GetValue(), bucket.CachedHash);
+			UM_LOG(Info, "{} -> Value={}, Control={}", index, *value, controlBytes[index]);
 		}
 		else
 		{
 			UM_LOG(Info, "{} -> ---", index);
 		}
-
-		++index;
 	}
 
 	UM_LOG(Info, "END HASH TABLE");
@@ -249,4 +245,91 @@ TEST(HashTableTests, Remove)
 
 	EXPECT_TRUE(hashTable.Remove(13));
 	EXPECT_FALSE(hashTable.Contains(13));
+	EXPECT_EQ(hashTable.Num(), 0);
+	EXPECT_TRUE(hashTable.IsEmpty());
+}
+
+TEST(HashTableTests, RemoveManyKeepsRemainingValuesReachable)
+{
+	constexpr int32 numValues = 4096;
+
+	THashTable<int32> hashTable;
+	for (int32 value = 0; value < numValues; ++value)
+	{
+		EXPECT_TRUE(hashTable.Add(value));
+	}
+
+	// Removing every third value shifts plenty of elements back into the slots left behind
+	for (int32 value = 0; value < numValues; value += 3)
+	{
+		EXPECT_TRUE(hashTable.Remove(value));
+		EXPECT_FALSE(hashTable.Remove(value));
+	}
+
+	int32 numRemaining = 0;
+	for (int32 value = 0; value < numValues; ++value)
+	{
+		const bool wasRemoved = value % 3 == 0;
+		EXPECT_EQ(hashTable.Contains(value), wasRemoved == false);
+		numRemaining += wasRemoved ? 0 : 1;
+	}
+
+	EXPECT_EQ(hashTable.Num(), numRemaining);
+
+	int32 numIterated = 0;
+	for (const int32 value : hashTable)
+	{
+		EXPECT_NE(value % 3, 0);
+		++numIterated;
+	}
+
+	EXPECT_EQ(numIterated, numRemaining);
+}
+
+TEST(HashTableTests, ReserveAvoidsGrowing)
+{
+	THashTable<int32> hashTable;
+	hashTable.Reserve(1000);
+
+	const int32 reservedCapacity = hashTable.GetCapacity();
+	EXPECT_GE(reservedCapacity, 1000);
+
+	for (int32 value = 0; value < 1000; ++value)
+	{
+		(void)hashTable.Add(value);
+	}
+
+	EXPECT_EQ(hashTable.GetCapacity(), reservedCapacity);
+}
+
+TEST(HashTableTests, ResetKeepsCapacity)
+{
+	THashTable<FString> hashTable;
+	for (int32 value = 0; value < 100; ++value)
+	{
+		(void)hashTable.Add(FString::Format("value{}"_sv, value));
+	}
+
+	const int32 capacity = hashTable.GetCapacity();
+	hashTable.Reset();
+
+	EXPECT_EQ(hashTable.Num(), 0);
+	EXPECT_EQ(hashTable.GetCapacity(), capacity);
+	EXPECT_FALSE(hashTable.Contains("value0"_s));
+	EXPECT_TRUE(hashTable.Add("value0"_s));
+	EXPECT_TRUE(hashTable.Contains("value0"_s));
+}
+
+TEST(HashTableTests, CopyAndMove)
+{
+	THashTable<FString> hashTable { "one"_s, "two"_s, "three"_s };
+
+	const THashTable<FString> copiedHashTable = hashTable;
+	EXPECT_EQ(copiedHashTable.Num(), 3);
+	EXPECT_TRUE(copiedHashTable.Contains("two"_s));
+
+	const THashTable<FString> movedHashTable = MoveTemp(hashTable);
+	EXPECT_EQ(movedHashTable.Num(), 3);
+	EXPECT_TRUE(movedHashTable.Contains("three"_s));
+	EXPECT_TRUE(hashTable.IsEmpty());
 }
\ No newline at end of file
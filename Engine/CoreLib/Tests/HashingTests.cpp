@@ -0,0 +1,75 @@
+#include "Containers/Array.h"
+#include "Containers/HashTable.h"
+#include "Containers/String.h"
+#include "Containers/StringView.h"
+#include "Engine/Hashing.h"
+#include <gtest/gtest.h>
+
+TEST(HashingTests, CompileTimeStringHashMatchesRunTime)
+{
+	constexpr uint64 shortHash = GetHashCode("Lox"_sv);
+	constexpr uint64 mediumHash = GetHashCode("UObject::GetName"_sv);
+	constexpr uint64 longHash = GetHashCode("The quick brown fox jumps over the lazy dog, then does it all over again"_sv);
+
+	const FString shortString = "Lox"_s;
+	const FString mediumString = "UObject::GetName"_s;
+	const FString longString = "The quick brown fox jumps over the lazy dog, then does it all over again"_s;
+
+	EXPECT_EQ(shortHash, GetHashCode(shortString));
+	EXPECT_EQ(mediumHash, GetHashCode(mediumString));
+	EXPECT_EQ(longHash, GetHashCode(longString));
+	EXPECT_EQ(GetHashCode(shortString), GetHashCode(shortString.AsStringView()));
+}
+
+TEST(HashingTests, EveryLengthHashesDifferently)
+{
+	TArray<uint8> bytes;
+	for (int32 idx = 0; idx < 256; ++idx)
+	{
+		bytes.Add(static_cast<uint8>(idx * 7 + 3));
+	}
+
+	// Covers each of the small, medium, and long input paths, along with the boundaries between them
+	THashTable<uint64> hashes;
+	for (int32 length = 0; length <= bytes.Num(); ++length)
+	{
+		EXPECT_TRUE(hashes.Add(Private::HashBytes(TSpan<const uint8> { bytes.GetData(), length })));
+	}
+}
+
+TEST(HashingTests, FlippingAnyBitChangesHash)
+{
+	TArray<uint8> bytes;
+	bytes.SetNum(64);
+
+	const uint64 originalHash = Private::HashBytes(bytes.AsSpan());
+	for (int32 byteIndex = 0; byteIndex < bytes.Num(); ++byteIndex)
+	{
+		for (int32 bitIndex = 0; bitIndex < 8; ++bitIndex)
+		{
+			bytes[byteIndex] ^= static_cast<uint8>(1 << bitIndex);
+			EXPECT_NE(Private::HashBytes(bytes.AsSpan()), originalHash);
+			bytes[byteIndex] ^= static_cast<uint8>(1 << bitIndex);
+		}
+	}
+}
+
+TEST(HashingTests, SeedChangesHash)
+{
+	const FStringView text = "hash flooding"_sv;
+	const TSpan<const uint8> bytes = text.AsByteSpan();
+
+	EXPECT_EQ(Private::HashBytesWithSeed(bytes, 0), Private::HashBytes(bytes));
+	EXPECT_NE(Private::HashBytesWithSeed(bytes, 1), Private::HashBytes(bytes));
+	EXPECT_NE(Private::HashBytesWithSeed(bytes, 1), Private::HashBytesWithSeed(bytes, 2));
+}
+
+TEST(HashingTests, HashCombineIsOrderSensitive)
+{
+	const uint64 firstHash = GetHashCode(1);
+	const uint64 secondHash = GetHashCode(2);
+
+	EXPECT_NE(Private::HashCombine(firstHash, secondHash), Private::HashCombine(secondHash, firstHash));
+	EXPECT_NE(HashItems(1, 2), HashItems(2, 1));
+	EXPECT_NE(HashItems(0, 0), HashItems(0));
+}
\ No newline at end of file
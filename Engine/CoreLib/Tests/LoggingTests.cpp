@@ -0,0 +1,256 @@
+#include "Containers/Array.h"
+#include "Containers/InternalString.h"
+#include "Containers/String.h"
+#include "Containers/StringView.h"
+#include "Engine/Logging.h"
+#include "Engine/Logging/DynamicLoggerInstance.h"
+#include "Engine/Logging/LogListener.h"
+#include "Engine/Logging/LogRecordQueue.h"
+#include "Memory/Memory.h"
+#include "Memory/UniquePtr.h"
+#include "Misc/StringBuilder.h"
+#include "Threading/Thread.h"
+#include <gtest/gtest.h>
+
+/**
+ * @brief Formats a decoded log record's message.
+ *
+ * @param record The decoded log record.
+ * @return The formatted message.
+ */
+static FString FormatLogRecordMessage(FLogRecord& record)
+{
+	FStringBuilder builder;
+	Private::AppendFormattedString(builder, record.Message, record.MessageArgs.AsSpan());
+	return builder.ReleaseString();
+}
+
+/**
+ * @brief Defines a log listener that keeps every string written to it.
+ */
+class FCapturingLogListener final : public ILogListener
+{
+public:
+
+	/**
+	 * @brief Sets default values for this log listener's properties.
+	 *
+	 * @param strings The array to add written strings to.
+	 */
+	explicit FCapturingLogListener(TArray<FString>& strings)
+		: m_Strings { strings }
+	{
+	}
+
+	/** @inheritdoc */
+	virtual void Flush() override
+	{
+	}
+
+	/** @inheritdoc */
+	virtual void Write(ELogLevel, const FStringView string) const override
+	{
+		m_Strings.Add(FString { string });
+	}
+
+private:
+
+	TArray<FString>& m_Strings;
+};
+
+TEST(LoggingTests, EncodedRecordRoundTrips)
+{
+	const FString expectedMessage = FString::Format("{} {} {} {} {} {}"_sv, -42, 42u, true, 2.5, "text"_sv, 'c');
+
+	TArray<Private::FStringFormatArgument> messageArgs = Private::MakeFormatArgumentArray(-42, 42u, true, 2.5, "text"_sv, 'c');
+	const FDateTime time = FDateTime::Now();
+
+	TArray<uint8> bytes;
+	EncodeLogRecord(ELogLevel::Warning, time, "{} {} {} {} {} {}"_sv, messageArgs.AsSpan(), bytes);
+
+	FLogRecord record;
+	DecodeLogRecord(bytes.AsSpan(), record);
+
+	EXPECT_EQ(record.LogLevel, ELogLevel::Warning);
+	EXPECT_EQ(record.Time.GetTicks(), time.GetTicks());
+	EXPECT_EQ(record.MessageArgs.Num(), messageArgs.Num());
+	EXPECT_EQ(FormatLogRecordMessage(record), expectedMessage);
+}
+
+TEST(LoggingTests, CustomFormattedArgumentsAreFormattedWhenEncoded)
+{
+	TArray<uint8> bytes;
+	{
+		const FString name = "Umbral"_s;
+		TArray<Private::FStringFormatArgument> messageArgs = Private::MakeFormatArgumentArray(name, 7);
+		EncodeLogRecord(ELogLevel::Info, FDateTime::Now(), "{} has {} letters"_sv, messageArgs.AsSpan(), bytes);
+	}
+
+	FLogRecord record;
+	DecodeLogRecord(bytes.AsSpan(), record);
+
+	EXPECT_EQ(FormatLogRecordMessage(record), "Umbral has 7 letters"_sv);
+}
+
+TEST(LoggingTests, RingBufferWrapsAround)
+{
+	TUniquePtr<FLogRecordRingBuffer> ringBuffer = MakeUnique<FLogRecordRingBuffer>();
+
+	TArray<uint8> writtenRecord;
+	TArray<uint8> readRecord;
+	for (int32 idx = 0; idx < 1000; ++idx)
+	{
+		writtenRecord.Reset();
+		for (int32 byteIdx = 0; byteIdx < 1 + (idx * 37) % 500; ++byteIdx)
+		{
+			writtenRecord.Add(static_cast<uint8>(idx + byteIdx));
+		}
+
+		ASSERT_TRUE(ringBuffer->TryWrite(writtenRecord.AsSpan()));
+		ASSERT_TRUE(ringBuffer->TryRead(readRecord));
+		ASSERT_EQ(readRecord.Num(), writtenRecord.Num());
+		for (int32 byteIdx = 0; byteIdx < readRecord.Num(); ++byteIdx)
+		{
+			ASSERT_EQ(readRecord[byteIdx], writtenRecord[byteIdx]);
+		}
+	}
+
+	EXPECT_TRUE(ringBuffer->IsEmpty());
+	EXPECT_FALSE(ringBuffer->TryRead(readRecord));
+}
+
+TEST(LoggingTests, RingBufferRejectsRecordsWhenFull)
+{
+	TUniquePtr<FLogRecordRingBuffer> ringBuffer = MakeUnique<FLogRecordRingBuffer>();
+
+	TArray<uint8> record;
+	record.AddZeroed(FLogRecordRingBuffer::MaxRecordSize);
+
+	int32 numRecordsWritten = 0;
+	while (ringBuffer->TryWrite(record.AsSpan()))
+	{
+		++numRecordsWritten;
+	}
+
+	EXPECT_EQ(numRecordsWritten, 3);
+	EXPECT_TRUE(ringBuffer->TryRead(record));
+	EXPECT_TRUE(ringBuffer->TryWrite(record.AsSpan()));
+}
+
+TEST(LoggingTests, QueueKeepsPerThreadOrder)
+{
+	constexpr int32 numThreads = 4;
+	constexpr int32 numRecordsPerThread = 20000;
+
+	FLogRecordQueue queue;
+	std::atomic<int32> numThreadsRunning = numThreads;
+
+	TArray<FThread> threads;
+	for (int32 threadIdx = 0; threadIdx < numThreads; ++threadIdx)
+	{
+		threads.Add(FThread::Create([&queue, &numThreadsRunning, threadIdx]()
+		{
+			for (int32 recordIdx = 0; recordIdx < numRecordsPerThread; ++recordIdx)
+			{
+				const int32 record[2] { threadIdx, recordIdx };
+				const TSpan<const uint8> recordBytes { reinterpret_cast<const uint8*>(record), static_cast<int32>(sizeof(record)) };
+				while (queue.TryWrite(recordBytes) == false)
+				{
+					FThread::RelaxProcessor();
+				}
+			}
+
+			(void)numThreadsRunning.fetch_sub(1);
+		}));
+	}
+
+	int32 nextRecordIndices[numThreads] {};
+	int32 numRecordsRead = 0;
+	bool readInOrder = true;
+
+	const auto readRecord = [&](const TSpan<const uint8> recordBytes)
+	{
+		int32 record[2] {};
+		FMemory::Copy(record, recordBytes.GetData(), sizeof(record));
+
+		readInOrder &= record[1] == nextRecordIndices[record[0]];
+		nextRecordIndices[record[0]] = record[1] + 1;
+		++numRecordsRead;
+	};
+
+	while (numThreadsRunning.load() > 0)
+	{
+		(void)queue.ReadAll(readRecord);
+	}
+
+	for (FThread& thread : threads)
+	{
+		thread.Join();
+	}
+
+	(void)queue.ReadAll(readRecord);
+
+	EXPECT_TRUE(readInOrder);
+	EXPECT_EQ(numRecordsRead, numThreads * numRecordsPerThread);
+	EXPECT_FALSE(queue.HasPendingRecords());
+}
+
+TEST(LoggingTests, AsyncLoggingFromMultipleThreads)
+{
+	constexpr int32 numThreads = 4;
+	constexpr int32 numMessagesPerThread = 64;
+
+	TArray<FString> messages;
+
+	FDynamicLoggerInstance logger;
+	logger.AddListener(MakeUnique<FCapturingLogListener>(messages));
+	logger.SetAsyncWritingEnabled(true);
+	EXPECT_TRUE(logger.IsAsyncWritingEnabled());
+
+	TArray<FThread> threads;
+	for (int32 threadIdx = 0; threadIdx < numThreads; ++threadIdx)
+	{
+		threads.Add(FThread::Create([&logger, threadIdx]()
+		{
+			const FString threadName = FString::Format("Thread {}"_sv, threadIdx);
+			for (int32 messageIdx = 0; messageIdx < numMessagesPerThread; ++messageIdx)
+			{
+				logger.Write(ELogLevel::Info, "{} logged message {} asynchronously ({})"_sv, threadName, messageIdx, messageIdx * 0.5);
+			}
+		}));
+	}
+
+	for (FThread& thread : threads)
+	{
+		thread.Join();
+	}
+
+	logger.Flush();
+	logger.Shutdown();
+
+	// Every message should have been written exactly once, and each thread's messages should be in the order they were logged in
+	ASSERT_EQ(messages.Num(), numThreads * numMessagesPerThread);
+
+	int32 nextMessageIndices[numThreads] {};
+	for (const FString& message : messages)
+	{
+		bool foundMessage = false;
+		for (int32 threadIdx = 0; threadIdx < numThreads && foundMessage == false; ++threadIdx)
+		{
+			const int32 messageIdx = nextMessageIndices[threadIdx];
+			const FString expectedMessage = FString::Format("Thread {} logged message {} asynchronously ({})\n"_sv, threadIdx, messageIdx, messageIdx * 0.5);
+			if (message.EndsWith(expectedMessage))
+			{
+				++nextMessageIndices[threadIdx];
+				foundMessage = true;
+			}
+		}
+
+		EXPECT_TRUE(foundMessage) << "Unexpected log message: " << message.GetChars();
+	}
+
+	for (int32 threadIdx = 0; threadIdx < numThreads; ++threadIdx)
+	{
+		EXPECT_EQ(nextMessageIndices[threadIdx], numMessagesPerThread);
+	}
+}
\ No newline at end of file
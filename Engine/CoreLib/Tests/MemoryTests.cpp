@@ -1,4 +1,5 @@
 #include "Math/Math.h"
+#include "Memory/LinearAllocator.h"
 #include "Memory/Memory.h"
 #include <gtest/gtest.h>
 
@@ -68,4 +69,53 @@ TEST(MemoryTests, AllocateObjectWithParams)
 	EXPECT_FALSE(IsMemoryZeroed(value, sizeof(FMemoryFriendClass)));
 	EXPECT_DOUBLE_EQ(value->GetValue(), FMath::Pi);
 	FMemory::FreeObject(value);
-}
\ No newline at end of file
+}
+
+TEST(MemoryTests, LinearAllocatorAlignment)
+{
+	FLinearAllocator allocator { 256 };
+
+	for (int32 idx = 0; idx < 100; ++idx)
+	{
+		const FMemory::SizeType alignment = FMemory::SizeType { 1 } << (idx % 7);
+		const FMemory::SizeType numBytes = 1 + idx % 13;
+
+		void* memory = allocator.Allocate(numBytes, alignment);
+		ASSERT_NE(memory, nullptr);
+		EXPECT_EQ(reinterpret_cast<uintptr>(memory) % static_cast<uintptr>(alignment), 0u);
+		EXPECT_TRUE(IsMemoryZeroed(memory, numBytes));
+
+		// Fill the memory so that any later allocation that overlaps it won't be zeroed
+		for (FMemory::SizeType byteIndex = 0; byteIndex < numBytes; ++byteIndex)
+		{
+			static_cast<uint8*>(memory)[byteIndex] = 0xCD;
+		}
+	}
+
+	EXPECT_GE(allocator.GetNumBytesReserved(), allocator.GetNumBytesAllocated());
+}
+
+TEST(MemoryTests, LinearAllocatorLargeAllocations)
+{
+	FLinearAllocator allocator { 256 };
+
+	int32* small = allocator.AllocateObject<int32>(42);
+	uint8* large = allocator.AllocateArray<uint8>(4096);
+	int32* nextSmall = allocator.AllocateObject<int32>(7);
+
+	ASSERT_NE(large, nullptr);
+	EXPECT_TRUE(IsMemoryZeroed(large, 4096));
+
+	// Large allocations get a block of their own, so the small allocations around them share a block
+	EXPECT_EQ(*small, 42);
+	EXPECT_EQ(*nextSmall, 7);
+	EXPECT_EQ(nextSmall - small, 1);
+
+	FLinearAllocator movedAllocator = MoveTemp(allocator);
+	EXPECT_EQ(allocator.GetNumBytesReserved(), 0);
+	EXPECT_EQ(*small, 42);
+
+	movedAllocator.Reset();
+	EXPECT_EQ(movedAllocator.GetNumBytesAllocated(), 0);
+	EXPECT_EQ(movedAllocator.GetNumBytesReserved(), 0);
+}
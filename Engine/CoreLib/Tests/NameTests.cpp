@@ -0,0 +1,105 @@
+#include "Containers/HashMap.h"
+#include "Containers/Name.h"
+#include "Containers/String.h"
+#include "Misc/StringBuilder.h"
+#include "Threading/ThreadPool.h"
+#include <gtest/gtest.h>
+
+TEST(NameTests, None)
+{
+	const FName none;
+	EXPECT_TRUE(none.IsNone());
+	EXPECT_TRUE(none.GetPlainName().IsEmpty());
+	EXPECT_EQ(none.GetNumber(), FName::NoNumber);
+	EXPECT_EQ(none, FName { ""_sv });
+	EXPECT_FALSE(FName { "Something"_sv }.IsNone());
+	EXPECT_FALSE((FName { ""_sv, 1 }).IsNone());
+}
+
+TEST(NameTests, Equality)
+{
+	const FName first { "Player"_sv };
+	const FString playerString = "Pla"_s + "yer"_sv;
+	const FName second { playerString.AsStringView() };
+
+	EXPECT_EQ(first, second);
+	EXPECT_EQ(GetHashCode(first), GetHashCode(second));
+	EXPECT_EQ(first.GetPlainName().GetChars(), second.GetPlainName().GetChars());
+
+	EXPECT_NE(first, FName { "player"_sv });
+	EXPECT_NE(first, FName { "Player_1"_sv });
+	EXPECT_NE(first, (FName { "Player"_sv, 1 }));
+	EXPECT_NE((FName { "Player"_sv, 1 }), (FName { "Player"_sv, 2 }));
+	EXPECT_EQ((FName { "Player"_sv, 2 }), (FName { "Player"_sv, 2 }));
+
+	EXPECT_EQ(first.Compare(second), ECompareResult::Equals);
+	EXPECT_EQ(FName { "Apple"_sv }.Compare(first), ECompareResult::LessThan);
+	EXPECT_EQ((FName { "Player"_sv, 3 }).Compare(FName { "Player"_sv, 2 }), ECompareResult::GreaterThan);
+}
+
+TEST(NameTests, Numbers)
+{
+	const FName numbered { "Actor"_sv, 12 };
+	EXPECT_EQ(numbered.GetPlainName(), "Actor"_sv);
+	EXPECT_EQ(numbered.GetNumber(), 12u);
+	EXPECT_EQ(numbered.ToString(), "Actor_12"_sv);
+
+	// Strings are never split into a plain name and a number
+	const FName unnumbered { "Actor_12"_sv };
+	EXPECT_EQ(unnumbered.GetPlainName(), "Actor_12"_sv);
+	EXPECT_EQ(unnumbered.GetNumber(), FName::NoNumber);
+	EXPECT_EQ(unnumbered.ToString(), "Actor_12"_sv);
+}
+
+TEST(NameTests, Formatting)
+{
+	const FName name { "Widget"_sv, 7 };
+	EXPECT_EQ(FString::Format("[{}]"_sv, name), "[Widget_7]"_sv);
+
+	FStringBuilder builder;
+	builder.Append("/"_sv);
+	name.AppendToStringBuilder(builder);
+	EXPECT_EQ(builder.AsStringView(), "/Widget_7"_sv);
+}
+
+TEST(NameTests, HashMapKey)
+{
+	THashMap<FName, int32> values;
+	(void)values.Add(FName { "First"_sv }, 1);
+	(void)values.Add(FName { "First"_sv, 1 }, 2);
+	(void)values.Add(FName { "Second"_sv }, 3);
+
+	EXPECT_EQ(values.Num(), 3);
+	EXPECT_EQ(values.FindRef(FName { "First"_sv }), 1);
+	EXPECT_EQ(values.FindRef(FName { "First"_sv, 1 }), 2);
+	EXPECT_EQ(values.FindRef(FName { "Second"_sv }), 3);
+	EXPECT_EQ(values.Find(FName { "Third"_sv }), nullptr);
+}
+
+TEST(NameTests, CreateFromMultipleThreads)
+{
+	constexpr int32 numNames = 64;
+	constexpr int32 numIterations = 4096;
+
+	TArray<FString> strings;
+	for (int32 idx = 0; idx < numNames; ++idx)
+	{
+		strings.Add(FString::Format("ThreadedName{}"_sv, idx));
+	}
+
+	TArray<FName> names;
+	names.AddDefault(numIterations);
+
+	FThreadPool threadPool;
+	const FJobHandle handle = threadPool.ParallelFor(numIterations, 16, [&](const int32 idx)
+	{
+		names[idx] = FName { strings[idx % numNames].AsStringView() };
+	});
+	threadPool.WaitForCounter(handle);
+
+	for (int32 idx = 0; idx < numIterations; ++idx)
+	{
+		EXPECT_EQ(names[idx], names[idx % numNames]);
+		EXPECT_EQ(names[idx].GetPlainName(), strings[idx % numNames].AsStringView());
+	}
+}
\ No newline at end of file
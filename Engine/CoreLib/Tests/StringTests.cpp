@@ -1,5 +1,6 @@
 #include "Containers/String.h"
 #include "Engine/Logging.h"
+#include "Misc/StringBuilder.h"
 #include <gtest/gtest.h>
 #include <gtest/gtest-printers.h>
 
@@ -360,4 +361,74 @@ TEST(StringTests, SplitByStringIntoViews)
 	EXPECT_EQ(splits[3], "L"_sv);
 	EXPECT_EQ(splits[4], "O"_sv);
 #endif
+}
+
+TEST(StringTests, IndexOfChar_Long)
+{
+	const FString string = "the quick brown fox jumps over the lazy dog and keeps running"_s;
+
+	EXPECT_EQ(string.IndexOf('q'), 4);
+	EXPECT_EQ(string.IndexOf('y'), 38);
+	EXPECT_EQ(string.IndexOf('g', 43), 60);
+	EXPECT_EQ(string.IndexOf('!'), INDEX_NONE);
+}
+
+TEST(StringTests, IndexOfString_Long)
+{
+	const FString string = "the quick brown fox jumps over the lazy dog and keeps running"_s;
+
+	EXPECT_EQ(string.IndexOf("the"_sv), 0);
+	EXPECT_EQ(string.IndexOf("the"_sv, 1), 31);
+	EXPECT_EQ(string.IndexOf("running"_sv), 54);
+	EXPECT_EQ(string.IndexOf("over the lazy dog and"_sv), 26);
+	EXPECT_EQ(string.IndexOf("the lazy cat"_sv), INDEX_NONE);
+	EXPECT_EQ(string.IndexOf("LAZY DOG"_sv), INDEX_NONE);
+	EXPECT_EQ(string.AsStringView().IndexOf("LAZY DOG"_sv, EStringComparison::OrdinalIgnoreCase), 35);
+	EXPECT_TRUE(string.AsStringView().Contains("Keeps Running"_sv, EIgnoreCase::Yes));
+}
+
+TEST(StringTests, CompareOrdinal)
+{
+	constexpr FStringView first = "abcdefghijklmnopqrstuvwxyz_0123456789"_sv;
+	constexpr FStringView second = "abcdefghijklmnopqrstuvwxyz_0123456780"_sv;
+
+	EXPECT_EQ(first.Compare(second), ECompareResult::GreaterThan);
+	EXPECT_EQ(second.Compare(first), ECompareResult::LessThan);
+	EXPECT_EQ(first.Compare(first.Left(20)), ECompareResult::GreaterThan);
+	EXPECT_EQ(first.Left(20).Compare(first), ECompareResult::LessThan);
+	EXPECT_FALSE(first.Equals("ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789"_sv));
+	EXPECT_TRUE(first.Equals("ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789"_sv, EIgnoreCase::Yes));
+	EXPECT_EQ(first.Compare("ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789"_sv), ECompareResult::GreaterThan);
+
+	// Runtime comparisons must agree with constant-evaluated ones
+	constexpr ECompareResult constantResult = "abcdefghijklmnopq_"_sv.Compare("ABCDEFGHIJKLMNOPQa"_sv, EIgnoreCase::Yes);
+	const FString runtimeString = "abcdefghijklmnopq_"_s;
+	EXPECT_EQ(runtimeString.AsStringView().Compare("ABCDEFGHIJKLMNOPQa"_sv, EIgnoreCase::Yes), constantResult);
+}
+
+TEST(StringTests, StartsAndEndsWith)
+{
+	const FString string = "Content/Textures/Characters/Player/Diffuse.png"_s;
+
+	EXPECT_TRUE(string.StartsWith("Content/Textures/"_sv));
+	EXPECT_TRUE(string.StartsWith("content/textures/"_sv, EIgnoreCase::Yes));
+	EXPECT_FALSE(string.StartsWith("content/textures/"_sv));
+	EXPECT_TRUE(string.EndsWith("Player/Diffuse.png"_sv));
+	EXPECT_TRUE(string.EndsWith(".PNG"_sv, EIgnoreCase::Yes));
+	EXPECT_FALSE(string.EndsWith(".PNG"_sv));
+}
+
+TEST(StringTests, AppendRepeatedChar)
+{
+	FStringBuilder builder;
+	builder.Append('[');
+	builder.Append('-', 40);
+	builder.Append(']');
+	builder.Append('x', 0);
+
+	const FString result = builder.ReleaseString();
+	EXPECT_EQ(result.Length(), 42);
+	EXPECT_EQ(result.IndexOf('-'), 1);
+	EXPECT_EQ(result.AsStringView().LastIndexOf('-'), 40);
+	EXPECT_EQ(result.IndexOf(']'), 41);
 }
\ No newline at end of file
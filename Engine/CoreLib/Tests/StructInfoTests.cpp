@@ -0,0 +1,100 @@
+#include "Containers/String.h"
+#include "Meta/StructInfo.h"
+#include <gtest/gtest.h>
+
+TEST(StructInfoTests, IsA)
+{
+	const FStructInfo rootType { "Root"_sv, 4, 4, nullptr };
+	const FStructInfo firstType { "First"_sv, 8, 4, &rootType };
+	const FStructInfo secondType { "Second"_sv, 8, 4, &rootType };
+	const FStructInfo firstDerivedType { "FirstDerived"_sv, 12, 4, &firstType };
+
+	EXPECT_EQ(rootType.GetInheritanceDepth(), 0);
+	EXPECT_EQ(firstDerivedType.GetInheritanceDepth(), 2);
+
+	EXPECT_TRUE(firstDerivedType.IsA(&firstDerivedType));
+	EXPECT_TRUE(firstDerivedType.IsA(&firstType));
+	EXPECT_TRUE(firstDerivedType.IsA(&rootType));
+	EXPECT_FALSE(firstDerivedType.IsA(&secondType));
+	EXPECT_FALSE(firstDerivedType.IsA(nullptr));
+
+	EXPECT_TRUE(secondType.IsA(&rootType));
+	EXPECT_FALSE(secondType.IsA(&firstType));
+	EXPECT_FALSE(rootType.IsA(&firstType));
+	EXPECT_FALSE(firstType.IsA(&firstDerivedType));
+}
+
+TEST(StructInfoTests, KnownAttributes)
+{
+	FStructInfo baseType { "Base"_sv, 4, 4, nullptr };
+	(void)baseType.AddAttribute("Abstract"_sv);
+	(void)baseType.AddAttribute("ChildOf"_sv, "Container"_sv);
+
+	const FStructInfo derivedType { "Derived"_sv, 4, 4, &baseType };
+
+	EXPECT_TRUE(baseType.HasAttribute(EKnownAttributes::IsAbstract));
+	EXPECT_TRUE(baseType.HasAttribute(EKnownAttributes::IsChildOf));
+	EXPECT_FALSE(derivedType.HasAttribute(EKnownAttributes::IsAbstract));
+
+	EXPECT_EQ(baseType.FindTypeWithAttribute(EKnownAttributes::IsChildOf), &baseType);
+	EXPECT_EQ(derivedType.FindTypeWithAttribute(EKnownAttributes::IsChildOf), &baseType);
+
+	FStructInfo otherType { "Other"_sv, 4, 4, nullptr };
+	(void)otherType.AddAttribute("Transient"_sv);
+
+	EXPECT_EQ(otherType.GetKnownAttributes(), EKnownAttributes::None);
+	EXPECT_EQ(otherType.FindTypeWithAttribute(EKnownAttributes::IsChildOf), nullptr);
+	EXPECT_TRUE(otherType.HasAttribute("Transient"_sv));
+}
+
+TEST(StructInfoTests, GetPropertyByName)
+{
+	constexpr int32 numBaseProperties = 40;
+
+	TArray<FString> propertyNames;
+	propertyNames.Reserve(numBaseProperties);
+	for (int32 idx = 0; idx < numBaseProperties; ++idx)
+	{
+		propertyNames.Add(FString::Format("m_Property{}"_sv, idx));
+	}
+
+	FStructInfo baseType { "Base"_sv, numBaseProperties * 4, 4, nullptr };
+	for (int32 idx = 0; idx < numBaseProperties; ++idx)
+	{
+		(void)baseType.AddProperty(propertyNames[idx], GetType<int32>(), idx * 4);
+	}
+	baseType.Finalize();
+
+	FStructInfo derivedType { "Derived"_sv, numBaseProperties * 4 + 4, 4, &baseType };
+	const FPropertyInfo& shadowingProperty = derivedType.AddProperty("m_Property3"_sv, GetType<int32>(), numBaseProperties * 4);
+	const FPropertyInfo& derivedProperty = derivedType.AddProperty("m_Derived"_sv, GetType<int32>(), numBaseProperties * 4);
+
+	// Lookups before finalizing fall back to searching the properties
+	EXPECT_EQ(derivedType.GetPropertyByName("m_Derived"_sv), &derivedProperty);
+	EXPECT_EQ(derivedType.GetPropertyByName("m_Property7"_sv), baseType.GetProperty(7));
+
+	derivedType.Finalize();
+
+	EXPECT_EQ(derivedType.GetNumProperties(), numBaseProperties + 2);
+	for (int32 idx = 0; idx < numBaseProperties; ++idx)
+	{
+		const FPropertyInfo* property = baseType.GetPropertyByName(propertyNames[idx]);
+		ASSERT_NE(property, nullptr);
+		EXPECT_EQ(property, baseType.GetProperty(idx));
+
+		if (idx != 3)
+		{
+			EXPECT_EQ(derivedType.GetPropertyByName(propertyNames[idx]), property);
+		}
+	}
+
+	EXPECT_EQ(derivedType.GetPropertyByName("m_Property3"_sv), &shadowingProperty);
+	EXPECT_EQ(derivedType.GetPropertyByName("m_Derived"_sv), &derivedProperty);
+	EXPECT_EQ(baseType.GetPropertyByName("m_Derived"_sv), nullptr);
+	EXPECT_EQ(derivedType.GetPropertyByName("m_Missing"_sv), nullptr);
+	EXPECT_EQ(derivedType.GetPropertyByName(""_sv), nullptr);
+
+	FStructInfo emptyType { "Empty"_sv, 1, 1, nullptr };
+	emptyType.Finalize();
+	EXPECT_EQ(emptyType.GetPropertyByName("m_Property0"_sv), nullptr);
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+#include "Threading/ThreadPool.h"
+#include <atomic>
+#include <gtest/gtest.h>
+
+TEST(ThreadPoolTests, ScheduleSingleJob)
+{
+	FThreadPool threadPool { 4 };
+	EXPECT_EQ(threadPool.GetNumWorkers(), 4);
+	EXPECT_FALSE(threadPool.IsInWorkerThread());
+
+	std::atomic<bool> didRun = false;
+	std::atomic<bool> ranInWorkerThread = false;
+	FJobHandle handle = threadPool.Schedule([&]()
+	{
+		ranInWorkerThread = threadPool.IsInWorkerThread();
+		didRun = true;
+	});
+
+	// Only waiting without helping guarantees the job ran on a worker
+	handle->Wait();
+	EXPECT_TRUE(handle->IsComplete());
+	EXPECT_TRUE(didRun);
+	EXPECT_TRUE(ranInWorkerThread);
+}
+
+TEST(ThreadPoolTests, SharedCounter)
+{
+	constexpr int32 numJobs = 10000;
+
+	FThreadPool threadPool { 4 };
+	std::atomic<int32> numJobsRun = 0;
+
+	FJobHandle counter = MakeShared<FJobCounter>();
+	for (int32 idx = 0; idx < numJobs; ++idx)
+	{
+		threadPool.ScheduleWithCounter(counter, [&numJobsRun]()
+		{
+			numJobsRun.fetch_add(1);
+		});
+	}
+
+	threadPool.WaitForCounter(counter);
+	EXPECT_EQ(counter->GetNumPendingJobs(), 0);
+	EXPECT_EQ(numJobsRun.load(), numJobs);
+}
+
+TEST(ThreadPoolTests, Dependencies)
+{
+	FThreadPool threadPool { 4 };
+
+	std::atomic<int32> step = 0;
+	std::atomic<bool> firstRanInOrder = false;
+	std::atomic<bool> secondRanInOrder = false;
+	std::atomic<bool> thirdRanInOrder = false;
+
+	FJobHandle first = threadPool.Schedule([&]()
+	{
+		firstRanInOrder = step.fetch_add(1) == 0;
+	});
+	FJobHandle second = threadPool.Schedule([&]()
+	{
+		secondRanInOrder = step.fetch_add(1) == 1;
+	}, first);
+
+	const FJobHandle dependencies[] = { first, second };
+	FJobHandle third = threadPool.Schedule([&]()
+	{
+		thirdRanInOrder = step.fetch_add(1) == 2;
+	}, TSpan<const FJobHandle> { dependencies, 2 });
+
+	threadPool.WaitForCounter(third);
+	EXPECT_TRUE(first->IsComplete());
+	EXPECT_TRUE(second->IsComplete());
+	EXPECT_TRUE(firstRanInOrder);
+	EXPECT_TRUE(secondRanInOrder);
+	EXPECT_TRUE(thirdRanInOrder);
+}
+
+TEST(ThreadPoolTests, NestedJobsWaitWhileHelping)
+{
+	constexpr int32 numOuterJobs = 8;
+	constexpr int32 numInnerJobs = 256;
+
+	// Using a single worker means the outer jobs can only finish if waiting helps execute the inner jobs
+	FThreadPool threadPool { 1 };
+	std::atomic<int32> numInnerJobsRun = 0;
+
+	FJobHandle outerCounter = MakeShared<FJobCounter>();
+	for (int32 outerIdx = 0; outerIdx < numOuterJobs; ++outerIdx)
+	{
+		threadPool.ScheduleWithCounter(outerCounter, [&]()
+		{
+			FJobHandle innerCounter = MakeShared<FJobCounter>();
+			for (int32 innerIdx = 0; innerIdx < numInnerJobs; ++innerIdx)
+			{
+				threadPool.ScheduleWithCounter(innerCounter, [&numInnerJobsRun]()
+				{
+					numInnerJobsRun.fetch_add(1);
+				});
+			}
+
+			threadPool.WaitForCounter(innerCounter);
+		});
+	}
+
+	threadPool.WaitForCounter(outerCounter);
+	EXPECT_EQ(numInnerJobsRun.load(), numOuterJobs * numInnerJobs);
+}
+
+TEST(ThreadPoolTests, ParallelFor)
+{
+	constexpr int32 numItems = 100000;
+
+	FThreadPool threadPool;
+	TArray<int32> values;
+	values.AddZeroed(numItems);
+
+	FJobHandle handle = threadPool.ParallelFor(numItems, 0, [&values](const int32 idx)
+	{
+		values[idx] = idx * 2;
+	});
+
+	threadPool.WaitForCounter(handle);
+	for (int32 idx = 0; idx < numItems; ++idx)
+	{
+		ASSERT_EQ(values[idx], idx * 2);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,126 @@
+#include "Meta/StructInfo.h"
+#include "Meta/TypeRegistry.h"
+#include <gtest/gtest.h>
+
+static const FStructInfo& GetRootTestType()
+{
+	static const FStructInfo GType { "FTypeRegistryTestRoot"_sv, 4, 4, nullptr };
+	return GType;
+}
+
+static const FStructInfo& GetFirstTestType()
+{
+	static const FStructInfo GType { "FTypeRegistryTestRootFirst"_sv, 8, 4, &GetRootTestType() };
+	return GType;
+}
+
+static const FStructInfo& GetFirstDerivedTestType()
+{
+	static const FStructInfo GType { "FTypeRegistryTestRootFirstDerived"_sv, 12, 4, &GetFirstTestType() };
+	return GType;
+}
+
+static const FStructInfo& GetSecondTestType()
+{
+	static const FStructInfo GType { "FTypeRegistryTestRootSecond"_sv, 8, 4, &GetRootTestType() };
+	return GType;
+}
+
+// Registered in an order that differs from the hierarchy on purpose
+static const FTypeRegistration GFirstDerivedTestTypeRegistration { []() -> const FTypeInfo* { return &GetFirstDerivedTestType(); } };
+static const FTypeRegistration GSecondTestTypeRegistration { []() -> const FTypeInfo* { return &GetSecondTestType(); } };
+static const FTypeRegistration GRootTestTypeRegistration { []() -> const FTypeInfo* { return &GetRootTestType(); } };
+static const FTypeRegistration GFirstTestTypeRegistration { []() -> const FTypeInfo* { return &GetFirstTestType(); } };
+
+TEST(TypeRegistryTests, FindTypeByName)
+{
+	EXPECT_EQ(FTypeRegistry::FindTypeByName("FTypeRegistryTestRoot"_sv), &GetRootTestType());
+	EXPECT_EQ(FTypeRegistry::FindTypeByName<FStructInfo>("FTypeRegistryTestRootFirst"_sv), &GetFirstTestType());
+	EXPECT_EQ(FTypeRegistry::FindTypeByName("int32"_sv), GetType<int32>());
+	EXPECT_EQ(FTypeRegistry::FindTypeByName<FStructInfo>("int32"_sv), nullptr);
+	EXPECT_EQ(FTypeRegistry::FindTypeByName("FTypeRegistryTestMissing"_sv), nullptr);
+}
+
+TEST(TypeRegistryTests, FindTypeById)
+{
+	EXPECT_EQ(GetRootTestType().GetId(), GetHashCode("FTypeRegistryTestRoot"_sv));
+	EXPECT_NE(GetRootTestType().GetId(), GetFirstTestType().GetId());
+
+	EXPECT_EQ(FTypeRegistry::FindTypeById(GetRootTestType().GetId()), &GetRootTestType());
+	EXPECT_EQ(FTypeRegistry::FindTypeById(GetType<FStringView>()->GetId()), GetType<FStringView>());
+	EXPECT_EQ(FTypeRegistry::FindTypeById(GetHashCode("FTypeRegistryTestMissing"_sv)), nullptr);
+}
+
+TEST(TypeRegistryTests, GetAllTypes)
+{
+	const TSpan<const FTypeInfo* const> types = FTypeRegistry::GetAllTypes();
+	ASSERT_FALSE(types.IsEmpty());
+
+	for (int32 idx = 1; idx < types.Num(); ++idx)
+	{
+		EXPECT_LT(types[idx - 1]->GetName(), types[idx]->GetName());
+	}
+
+	EXPECT_TRUE(types.Contains(&GetSecondTestType()));
+	EXPECT_TRUE(types.Contains(GetType<bool>()));
+}
+
+TEST(TypeRegistryTests, GetDerivedTypes)
+{
+	const TSpan<const FStructInfo* const> rootDerivedTypes = FTypeRegistry::GetDerivedTypes(&GetRootTestType());
+	ASSERT_EQ(rootDerivedTypes.Num(), 3);
+	EXPECT_EQ(rootDerivedTypes[0], &GetFirstTestType());
+	EXPECT_EQ(rootDerivedTypes[1], &GetFirstDerivedTestType());
+	EXPECT_EQ(rootDerivedTypes[2], &GetSecondTestType());
+
+	const TSpan<const FStructInfo* const> firstDerivedTypes = FTypeRegistry::GetDerivedTypes(&GetFirstTestType());
+	ASSERT_EQ(firstDerivedTypes.Num(), 1);
+	EXPECT_EQ(firstDerivedTypes[0], &GetFirstDerivedTestType());
+
+	EXPECT_TRUE(FTypeRegistry::GetDerivedTypes(&GetSecondTestType()).IsEmpty());
+	EXPECT_TRUE(FTypeRegistry::GetDerivedTypes(nullptr).IsEmpty());
+
+	const FStructInfo unregisteredType { "FTypeRegistryTestUnregistered"_sv, 4, 4, &GetRootTestType() };
+	EXPECT_TRUE(FTypeRegistry::GetDerivedTypes(&unregisteredType).IsEmpty());
+}
+
+TEST(TypeRegistryTests, RegisterAfterQuery)
+{
+	const TSpan<const FTypeInfo* const> typesBefore = FTypeRegistry::GetAllTypes();
+	const int32 numTypesBefore = typesBefore.Num();
+
+	static const FStructInfo GLateType { "FTypeRegistryTestRootLate"_sv, 8, 4, &GetRootTestType() };
+	static const FTypeRegistration GLateTypeRegistration { []() -> const FTypeInfo* { return &GLateType; } };
+
+	EXPECT_EQ(FTypeRegistry::FindTypeByName("FTypeRegistryTestRootLate"_sv), &GLateType);
+	EXPECT_EQ(FTypeRegistry::GetAllTypes().Num(), numTypesBefore + 1);
+	EXPECT_EQ(FTypeRegistry::GetDerivedTypes(&GetRootTestType()).Num(), 4);
+
+	// Spans from before the late registration are still valid
+	EXPECT_EQ(typesBefore.Num(), numTypesBefore);
+	EXPECT_FALSE(typesBefore.Contains(&GLateType));
+}
+TEST(TypeRegistryTests, UnregisterRemovesType)
+{
+	static const FStructInfo GTransientType { "FTypeRegistryTestRootTransient"_sv, 8, 4, &GetRootTestType() };
+	const int32 numTypesBefore = FTypeRegistry::GetAllTypes().Num();
+	const int32 numDerivedTypesBefore = FTypeRegistry::GetDerivedTypes(&GetRootTestType()).Num();
+
+	{
+		const FTypeRegistration transientTypeRegistration { []() -> const FTypeInfo* { return &GTransientType; } };
+
+		EXPECT_EQ(FTypeRegistry::FindTypeByName("FTypeRegistryTestRootTransient"_sv), &GTransientType);
+		EXPECT_EQ(FTypeRegistry::FindTypeById(GTransientType.GetId()), &GTransientType);
+		EXPECT_EQ(FTypeRegistry::GetAllTypes().Num(), numTypesBefore + 1);
+		EXPECT_EQ(FTypeRegistry::GetDerivedTypes(&GetRootTestType()).Num(), numDerivedTypesBefore + 1);
+	}
+
+	EXPECT_EQ(FTypeRegistry::FindTypeByName("FTypeRegistryTestRootTransient"_sv), nullptr);
+	EXPECT_EQ(FTypeRegistry::FindTypeById(GTransientType.GetId()), nullptr);
+	EXPECT_EQ(FTypeRegistry::GetAllTypes().Num(), numTypesBefore);
+	EXPECT_EQ(FTypeRegistry::GetDerivedTypes(&GetRootTestType()).Num(), numDerivedTypesBefore);
+
+	// Types registered before the one that was removed are still found
+	EXPECT_EQ(FTypeRegistry::FindTypeByName("FTypeRegistryTestRoot"_sv), &GetRootTestType());
+	EXPECT_EQ(FTypeRegistry::FindTypeByName("int32"_sv), GetType<int32>());
+}
\ No newline at end of file
@@ -0,0 +1,174 @@
+#include "Misc/InternalUnicode.h"
+#include "Misc/Unicode.h"
+#include <gtest/gtest.h>
+#include <random>
+
+/**
+ * @brief Defines a test string encoded as UTF-8, UTF-16, and UTF-32, one code point at a time.
+ */
+struct FUnicodeTestString
+{
+	TArray<char> Utf8Chars;
+	TArray<char16_t> Utf16Chars;
+	TArray<char32_t> Utf32Chars;
+	int32 NumCodePoints = 0;
+
+	void AddCodePoint(const uint32 codePoint)
+	{
+		Utf8Chars.Append(Utf8::EncodeChar(codePoint).GetCharSpan());
+		Utf16Chars.Append(Utf16::EncodeChar(codePoint).GetCharSpan());
+		Utf32Chars.Add(static_cast<char32_t>(codePoint));
+		++NumCodePoints;
+	}
+};
+
+/**
+ * @brief Makes a test string out of runs of code points from different ranges, so that runs of ASCII characters start
+ *        and stop at every offset within a block.
+ */
+static FUnicodeTestString MakeTestString(std::mt19937& random, const int32 numCodePoints)
+{
+	static constexpr uint32 GMinCodePoints[] { 0x20, 0x80, 0x800, 0xE000, 0x10000 };
+	static constexpr uint32 GMaxCodePoints[] { 0x7F, 0x7FF, 0xD7FF, 0xFFFD, 0x10FFFF };
+
+	FUnicodeTestString result;
+	while (result.NumCodePoints < numCodePoints)
+	{
+		// Favor ASCII, since that is what the fast paths are for
+		const int32 rangeIndex = random() % 3 == 0 ? static_cast<int32>(random() % 5) : 0;
+		const int32 runLength = static_cast<int32>(random() % 40) + 1;
+
+		for (int32 idx = 0; idx < runLength && result.NumCodePoints < numCodePoints; ++idx)
+		{
+			const uint32 range = GMaxCodePoints[rangeIndex] - GMinCodePoints[rangeIndex] + 1;
+			result.AddCodePoint(GMinCodePoints[rangeIndex] + static_cast<uint32>(random()) % range);
+		}
+	}
+
+	return result;
+}
+
+template<typename CharType>
+static TSpan<const CharType> WithoutNullTerminator(const TArray<CharType>& chars)
+{
+	EXPECT_FALSE(chars.IsEmpty());
+	EXPECT_EQ(chars.Last(), static_cast<CharType>(0));
+	return TSpan<const CharType> { chars.GetData(), chars.Num() - 1 };
+}
+
+template<typename CharType>
+static void ExpectCharsEqual(const TSpan<const CharType> actual, const TArray<CharType>& expected)
+{
+	ASSERT_EQ(actual.Num(), expected.Num());
+	for (int32 idx = 0; idx < expected.Num(); ++idx)
+	{
+		ASSERT_EQ(static_cast<uint32>(actual[idx]), static_cast<uint32>(expected[idx])) << "at index " << idx;
+	}
+}
+
+TEST(UnicodeTests, AsciiOnly)
+{
+	constexpr char asciiChars[] = "The quick brown fox jumps over the lazy dog, 0123456789 times!";
+	const TSpan<const char> utf8Chars { asciiChars, static_cast<int32>(sizeof(asciiChars) - 1) };
+
+	const Unicode::FToUtf16Result utf16Result = Unicode::ToUtf16(utf8Chars);
+	ASSERT_TRUE(utf16Result.bValid);
+	ASSERT_EQ(utf16Result.Chars.Num(), utf8Chars.Num() + 1);
+
+	const Unicode::FToUtf32Result utf32Result = Unicode::ToUtf32(utf8Chars);
+	ASSERT_TRUE(utf32Result.bValid);
+	ASSERT_EQ(utf32Result.Chars.Num(), utf8Chars.Num() + 1);
+
+	for (int32 idx = 0; idx < utf8Chars.Num(); ++idx)
+	{
+		EXPECT_EQ(static_cast<uint32>(utf16Result.Chars[idx]), static_cast<uint32>(utf8Chars[idx]));
+		EXPECT_EQ(static_cast<uint32>(utf32Result.Chars[idx]), static_cast<uint32>(utf8Chars[idx]));
+	}
+
+	EXPECT_EQ(Unicode::CountCodePoints(utf8Chars).NumCodePoints, utf8Chars.Num());
+	EXPECT_TRUE(Unicode::IsValidUtf8(utf8Chars));
+}
+
+TEST(UnicodeTests, MatchesPerCodePointEncoding)
+{
+	std::mt19937 random { 1234 };
+
+	for (int32 iteration = 0; iteration < 200; ++iteration)
+	{
+		const FUnicodeTestString testString = MakeTestString(random, iteration + 1);
+		const TSpan<const char> utf8Chars = testString.Utf8Chars.AsSpan();
+		const TSpan<const char16_t> utf16Chars = testString.Utf16Chars.AsSpan();
+		const TSpan<const char32_t> utf32Chars = testString.Utf32Chars.AsSpan();
+
+		EXPECT_TRUE(Unicode::IsValidUtf8(utf8Chars));
+		EXPECT_EQ(Unicode::CountCodePoints(utf8Chars).NumCodePoints, testString.NumCodePoints);
+		EXPECT_EQ(Unicode::CountCodePoints(utf16Chars).NumCodePoints, testString.NumCodePoints);
+		EXPECT_EQ(Unicode::CountCodePoints(utf32Chars).NumCodePoints, testString.NumCodePoints);
+
+		const Unicode::FToUtf8Result utf8FromUtf16 = Unicode::ToUtf8(utf16Chars);
+		ASSERT_TRUE(utf8FromUtf16.bValid);
+		ExpectCharsEqual(WithoutNullTerminator(utf8FromUtf16.Chars), testString.Utf8Chars);
+
+		const Unicode::FToUtf8Result utf8FromUtf32 = Unicode::ToUtf8(utf32Chars);
+		ASSERT_TRUE(utf8FromUtf32.bValid);
+		ExpectCharsEqual(WithoutNullTerminator(utf8FromUtf32.Chars), testString.Utf8Chars);
+
+		const Unicode::FToUtf16Result utf16FromUtf8 = Unicode::ToUtf16(utf8Chars);
+		ASSERT_TRUE(utf16FromUtf8.bValid);
+		ExpectCharsEqual(WithoutNullTerminator(utf16FromUtf8.Chars), testString.Utf16Chars);
+
+		const Unicode::FToUtf16Result utf16FromUtf32 = Unicode::ToUtf16(utf32Chars);
+		ASSERT_TRUE(utf16FromUtf32.bValid);
+		ExpectCharsEqual(WithoutNullTerminator(utf16FromUtf32.Chars), testString.Utf16Chars);
+
+		const Unicode::FToUtf32Result utf32FromUtf8 = Unicode::ToUtf32(utf8Chars);
+		ASSERT_TRUE(utf32FromUtf8.bValid);
+		ExpectCharsEqual(WithoutNullTerminator(utf32FromUtf8.Chars), testString.Utf32Chars);
+
+		const Unicode::FToUtf32Result utf32FromUtf16 = Unicode::ToUtf32(utf16Chars);
+		ASSERT_TRUE(utf32FromUtf16.bValid);
+		ExpectCharsEqual(WithoutNullTerminator(utf32FromUtf16.Chars), testString.Utf32Chars);
+	}
+}
+
+TEST(UnicodeTests, EncodeFourByteSequence)
+{
+	// U+1F600 GRINNING FACE
+	const Utf8::FEncodeResult encodeResult = Utf8::EncodeChar(0x1F600);
+	ASSERT_TRUE(encodeResult.bValid);
+	ASSERT_EQ(encodeResult.CharCount, 4);
+	EXPECT_EQ(encodeResult.Chars[0], 0xF0);
+	EXPECT_EQ(encodeResult.Chars[1], 0x9F);
+	EXPECT_EQ(encodeResult.Chars[2], 0x98);
+	EXPECT_EQ(encodeResult.Chars[3], 0x80);
+
+	EXPECT_TRUE(Unicode::IsValidUtf8(encodeResult.GetCharSpan()));
+}
+
+TEST(UnicodeTests, IsValidUtf8RejectsIllFormedSequences)
+{
+	const auto isValid = [](std::initializer_list<uint8> bytes)
+	{
+		constexpr char prefix[] = "sixteen bytes of ASCII first";
+		TArray<char> chars;
+		chars.Append(prefix, static_cast<int32>(sizeof(prefix) - 1));
+		for (const uint8 byte : bytes)
+		{
+			chars.Add(static_cast<char>(byte));
+		}
+		return Unicode::IsValidUtf8(chars.AsSpan());
+	};
+
+	EXPECT_TRUE(isValid({ 0xC3, 0xA9 }));             // U+00E9
+	EXPECT_TRUE(isValid({ 0xED, 0x9F, 0xBF }));       // U+D7FF
+	EXPECT_TRUE(isValid({ 0xF4, 0x8F, 0xBF, 0xBF })); // U+10FFFF
+
+	EXPECT_FALSE(isValid({ 0x80 }));                   // Lone continuation byte
+	EXPECT_FALSE(isValid({ 0xC3 }));                   // Truncated sequence
+	EXPECT_FALSE(isValid({ 0xC3, 0x41 }));             // Missing continuation byte
+	EXPECT_FALSE(isValid({ 0xC0, 0xAF }));             // Overlong '/'
+	EXPECT_FALSE(isValid({ 0xE0, 0x80, 0xAF }));       // Overlong '/'
+	EXPECT_FALSE(isValid({ 0xED, 0xA0, 0x80 }));       // Encoded surrogate U+D800
+	EXPECT_FALSE(isValid({ 0xF4, 0x90, 0x80, 0x80 })); // U+110000
+	EXPECT_FALSE(isValid({ 0xF8, 0x88, 0x80, 0x80, 0x80 }));
+}
\ No newline at end of file
@@ -135,8 +135,9 @@ void UEngineLoop::Created(const FObjectCreationContext& context)
 void UEngineLoop::EndFrame()
 {
 	// Collect garbage before swapping buffers to allow us to sneak
-	// into the end of a frame before any vertical sync can happen
-	FObjectHeap::CollectGarbage();
+	// into the end of a frame before any vertical sync can happen.
+	// Collection is spread across frames to keep each step short
+	FObjectHeap::CollectGarbageIncrementally();
 
 	// Allow each swap chain to swap its back buffers
 	m_Application->ForEachRenderingContext([](const IApplicationRenderingContext& renderingContext)
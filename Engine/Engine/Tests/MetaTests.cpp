@@ -87,7 +87,7 @@ TEST(MetaTests, Properties)
 	const FPropertyInfo* nameProperty = classInfo->GetPropertyByName("m_Name"_sv);
 	EXPECT_NE(nameProperty, nullptr);
 	EXPECT_EQ(nameProperty->GetName(), "m_Name"_sv);
-	EXPECT_EQ(nameProperty->GetValueType(), GetType<FString>());
+	EXPECT_EQ(nameProperty->GetValueType(), GetType<FName>());
 	EXPECT_EQ(nameProperty->GetOffset(), UObject::GetOffsetOfNameProperty<UObject>());
 	EXPECT_EQ(nameProperty->GetOffset(), UObject::GetOffsetOfNameProperty<UAttributeTestClass>());
 
@@ -98,10 +98,10 @@ TEST(MetaTests, Properties)
 	EXPECT_NE(parentPropertyValue, nullptr);
 	EXPECT_EQ(parentPropertyValue, objectValue->GetPointerToParentProperty());
 
-	const FString* namePropertyValue = nameProperty->GetValue<FString>(*objectValue);
+	const FName* namePropertyValue = nameProperty->GetValue<FName>(*objectValue);
 	EXPECT_NE(namePropertyValue, nullptr);
 	EXPECT_EQ(namePropertyValue, objectValue->GetPointerToNameProperty());
-	EXPECT_TRUE(namePropertyValue->StartsWith("TestName"_sv));
+	EXPECT_EQ(namePropertyValue->GetPlainName(), "TestName"_sv);
 }
 
 TEST(MetaTests, PrimitiveTypes)
@@ -156,6 +156,6 @@ TEST(MetaTests, Parent)
 	EXPECT_TRUE(childClass.IsValid());
 	EXPECT_FALSE(childClass.IsNull());
 
-	const FStringView childContainerName = childClass->GetParentName();
-	EXPECT_TRUE(childContainerName.StartsWith(nameof(UChildClassContainer)));
+	const FName childContainerName = childClass->GetParentName();
+	EXPECT_EQ(childContainerName.GetPlainName(), nameof(UChildClassContainer));
 }
\ No newline at end of file
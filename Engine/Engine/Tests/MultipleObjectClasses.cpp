@@ -1,7 +1,7 @@
 #include "MultipleObjectClasses.h"
 #include "Object/ObjectPtr.h"
 
-FStringView UChildClass::GetParentName() const
+FName UChildClass::GetParentName() const
 {
 	TObjectPtr<UChildClassContainer> parent = GetTypedParent<UChildClassContainer>();
 	return parent->GetName();
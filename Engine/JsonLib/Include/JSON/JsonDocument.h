@@ -0,0 +1,271 @@
+#pragma once
+
+#include "Containers/Span.h"
+#include "Containers/String.h"
+#include "Containers/StringView.h"
+#include "Engine/MiscMacros.h"
+#include "JSON/JsonValueType.h"
+#include "Memory/LinearAllocator.h"
+#include "Memory/UniquePtr.h"
+
+class FJsonDocumentParser;
+class FJsonValue;
+struct FJsonMember;
+
+/**
+ * @brief Defines a read-only JSON value that lives inside of a JSON document.
+ *
+ * Nodes are small and trivially copyable. Strings are views of either the document's source text or the document's
+ * own memory, arrays are contiguous spans of nodes, and objects are spans of members sorted by key. A node is only
+ * valid for as long as the document it came from.
+ */
+class FJsonNode final
+{
+	friend class FJsonDocumentParser;
+
+public:
+
+	/**
+	 * @brief Creates a null JSON node.
+	 */
+	constexpr FJsonNode() = default;
+
+	/**
+	 * @brief Gets this node as an array.
+	 *
+	 * @return This node's elements, or an empty span if this node is not an array.
+	 */
+	[[nodiscard]] TSpan<const FJsonNode> AsArray() const
+	{
+		return IsArray() ? TSpan<const FJsonNode> { m_Elements, m_Num } : TSpan<const FJsonNode> {};
+	}
+
+	/**
+	 * @brief Gets this node as a Boolean.
+	 *
+	 * @return This node's Boolean value, or false if this node is not a Boolean.
+	 */
+	[[nodiscard]] bool AsBool() const
+	{
+		return IsBool() && m_Bool;
+	}
+
+	/**
+	 * @brief Gets this node as a number.
+	 *
+	 * @return This node's number value, or zero if this node is not a number.
+	 */
+	[[nodiscard]] double AsNumber() const
+	{
+		return IsNumber() ? m_Number : 0.0;
+	}
+
+	/**
+	 * @brief Gets this node as an object.
+	 *
+	 * @return This node's members sorted by key, or an empty span if this node is not an object.
+	 */
+	[[nodiscard]] TSpan<const FJsonMember> AsObject() const;
+
+	/**
+	 * @brief Gets this node as a string view.
+	 *
+	 * @return This node's unescaped string value, or an empty string view if this node is not a string.
+	 */
+	[[nodiscard]] FStringView AsStringView() const
+	{
+		return IsString() ? FStringView { m_Chars, m_Num } : FStringView {};
+	}
+
+	/**
+	 * @brief Checks to see if this node is an object with a member with the given key.
+	 *
+	 * @param key The key.
+	 * @return True if this node is an object with a member with the given key, otherwise false.
+	 */
+	[[nodiscard]] bool Contains(const FStringView key) const
+	{
+		return Find(key) != nullptr;
+	}
+
+	/**
+	 * @brief Finds the value of the member with the given key. Objects are sorted, so this is a binary search.
+	 *
+	 * @param key The key.
+	 * @return The value corresponding to \p key, or nullptr if this node is not an object or has no such member.
+	 */
+	[[nodiscard]] const FJsonNode* Find(FStringView key) const;
+
+	/**
+	 * @brief Gets this node's type.
+	 *
+	 * @return This node's type.
+	 */
+	[[nodiscard]] EJsonValueType GetType() const
+	{
+		return m_Type;
+	}
+
+	/**
+	 * @brief Checks to see if this node is an array.
+	 *
+	 * @return True if this node is an array, otherwise false.
+	 */
+	[[nodiscard]] bool IsArray() const
+	{
+		return m_Type == EJsonValueType::Array;
+	}
+
+	/**
+	 * @brief Checks to see if this node is a Boolean.
+	 *
+	 * @return True if this node is a Boolean, otherwise false.
+	 */
+	[[nodiscard]] bool IsBool() const
+	{
+		return m_Type == EJsonValueType::Boolean;
+	}
+
+	/**
+	 * @brief Checks to see if this node is null.
+	 *
+	 * @return True if this node is null, otherwise false.
+	 */
+	[[nodiscard]] bool IsNull() const
+	{
+		return m_Type == EJsonValueType::Null;
+	}
+
+	/**
+	 * @brief Checks to see if this node is a number.
+	 *
+	 * @return True if this node is a number, otherwise false.
+	 */
+	[[nodiscard]] bool IsNumber() const
+	{
+		return m_Type == EJsonValueType::Number;
+	}
+
+	/**
+	 * @brief Checks to see if this node is an object.
+	 *
+	 * @return True if this node is an object, otherwise false.
+	 */
+	[[nodiscard]] bool IsObject() const
+	{
+		return m_Type == EJsonValueType::Object;
+	}
+
+	/**
+	 * @brief Checks to see if this node is a string.
+	 *
+	 * @return True if this node is a string, otherwise false.
+	 */
+	[[nodiscard]] bool IsString() const
+	{
+		return m_Type == EJsonValueType::String;
+	}
+
+	/**
+	 * @brief Gets the number of elements or members in this node.
+	 *
+	 * @return The number of elements if this node is an array, the number of members if this node is an object,
+	 *         otherwise zero.
+	 */
+	[[nodiscard]] int32 Num() const
+	{
+		return IsArray() || IsObject() ? m_Num : 0;
+	}
+
+	/**
+	 * @brief Makes a deep copy of this node as a mutable JSON value that does not depend on the document.
+	 *
+	 * @return The JSON value.
+	 */
+	[[nodiscard]] FJsonValue ToValue() const;
+
+private:
+
+	union
+	{
+		bool m_Bool;
+		double m_Number = 0.0;
+		const char* m_Chars;
+		const FJsonNode* m_Elements;
+		const FJsonMember* m_Members;
+	};
+	int32 m_Num = 0;
+	EJsonValueType m_Type = EJsonValueType::Null;
+};
+
+/**
+ * @brief Defines a member of a JSON object node.
+ */
+struct FJsonMember
+{
+	/** @brief The member's unescaped key. */
+	FStringView Key;
+
+	/** @brief The member's value. */
+	FJsonNode Value;
+};
+
+inline TSpan<const FJsonMember> FJsonNode::AsObject() const
+{
+	return IsObject() ? TSpan<const FJsonMember> { m_Members, m_Num } : TSpan<const FJsonMember> {};
+}
+
+/**
+ * @brief Defines a parsed, read-only JSON document.
+ *
+ * Every node in a document is allocated from a single linear allocator owned by the document, so parsing does not
+ * make a heap allocation per value and destroying a document frees everything at once. Strings without escape
+ * sequences are views of the source text. If the document owns its source text, escaped strings are unescaped in
+ * place as well, otherwise they are unescaped into the document's allocator.
+ */
+class FJsonDocument final
+{
+	UM_DISABLE_COPY(FJsonDocument);
+
+	friend class FJsonDocumentParser;
+
+public:
+
+	UM_DEFAULT_MOVE(FJsonDocument);
+
+	/**
+	 * @brief Creates an empty document whose root is null.
+	 */
+	FJsonDocument() = default;
+
+	/**
+	 * @brief Destroys this document and every node in it.
+	 */
+	~FJsonDocument() = default;
+
+	/**
+	 * @brief Gets the number of bytes this document has reserved for its nodes and unescaped strings.
+	 *
+	 * @return The number of bytes this document has reserved.
+	 */
+	[[nodiscard]] FLinearAllocator::SizeType GetNumBytesReserved() const
+	{
+		return m_Allocator.GetNumBytesReserved();
+	}
+
+	/**
+	 * @brief Gets this document's root node.
+	 *
+	 * @return This document's root node.
+	 */
+	[[nodiscard]] const FJsonNode& GetRoot() const
+	{
+		return m_Root;
+	}
+
+private:
+
+	FLinearAllocator m_Allocator;
+	TUniquePtr<FString> m_OwnedText;
+	FJsonNode m_Root;
+};
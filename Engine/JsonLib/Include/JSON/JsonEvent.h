@@ -0,0 +1,19 @@
+#pragma once
+
+/**
+ * @brief An enumeration of events that a streaming JSON reader can emit.
+ */
+enum class EJsonEvent
+{
+	None,
+	BeginArray,
+	EndArray,
+	BeginObject,
+	EndObject,
+	Key,
+	String,
+	Number,
+	Boolean,
+	Null,
+	EndOfDocument
+};
\ No newline at end of file
@@ -1,7 +1,9 @@
 #pragma once
 
+#include "Containers/Function.h"
 #include "Containers/HashMap.h"
 #include "Containers/String.h"
+#include "Engine/CoreTypes.h"
 #include "JSON/JsonValueType.h"
 
 class FJsonArray;
@@ -67,6 +69,14 @@ public:
 	 */
 	[[nodiscard]] FJsonValue* Find(const FString& key);
 
+	/**
+	 * @brief Iterates this object's key-value pairs, in no particular order, with a callback that takes a key and the
+	 *        value for that key.
+	 *
+	 * @param callback The callback.
+	 */
+	void ForEachPair(TFunction<EIterationDecision(const FString&, const FJsonValue&)> callback) const;
+
 	/**
 	 * @brief Finds the number of values in this JSON array.
 	 *
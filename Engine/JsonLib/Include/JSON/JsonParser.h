@@ -1,10 +1,37 @@
 #pragma once
 
 #include "Engine/Error.h"
+#include "JSON/JsonDocument.h"
 #include "JSON/JsonValue.h"
 
 namespace JSON
 {
+	/**
+	 * @brief Attempts to parse a read-only JSON document from a file. The document owns the file's text.
+	 *
+	 * @param filePath The path to the file.
+	 * @return The parsed JSON document, or the error that was encountered.
+	 */
+	TErrorOr<FJsonDocument> ParseDocumentFile(FStringView filePath);
+
+	/**
+	 * @brief Attempts to parse a read-only JSON document from a string. The document refers to the string, so the
+	 *        string must outlive the document.
+	 *
+	 * @param text The string to parse.
+	 * @return The parsed JSON document, or the error that was encountered.
+	 */
+	TErrorOr<FJsonDocument> ParseDocumentString(FStringView text);
+
+	/**
+	 * @brief Attempts to parse a read-only JSON document from a string. The document takes ownership of the string and
+	 *        unescapes strings in place.
+	 *
+	 * @param text The string to parse.
+	 * @return The parsed JSON document, or the error that was encountered.
+	 */
+	TErrorOr<FJsonDocument> ParseDocumentString(FString&& text);
+
 	/**
 	 * @brief Attempts to parse a JSON value from a file.
 	 *
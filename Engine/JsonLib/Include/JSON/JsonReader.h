@@ -0,0 +1,232 @@
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/StringView.h"
+#include "Engine/Error.h"
+#include "Engine/MiscMacros.h"
+#include "HAL/FileStream.h"
+#include "JSON/JsonEvent.h"
+#include "JSON/JsonValueType.h"
+#include "Memory/SharedPtr.h"
+#include "Parsing/SourceLocation.h"
+
+/**
+ * @brief Defines a streaming JSON reader that emits one event at a time without building a document.
+ *
+ * When reading from a file stream, text is read in fixed-size chunks and only the unread part of the current chunk is
+ * kept around, so memory use does not depend on the size of the file. A chunk only grows when a single string or
+ * number is larger than it. Strings, keys, and numbers are only valid until the next call to ReadNext.
+ */
+class FJsonReader final
+{
+	UM_DISABLE_COPY(FJsonReader);
+
+public:
+
+	/**
+	 * @brief The default number of bytes to read from a file stream at a time.
+	 */
+	static constexpr int32 DefaultChunkSize = 16 * 1024;
+
+	/**
+	 * @brief Sets default values for this reader's properties.
+	 *
+	 * @param stream The file stream to read text from.
+	 * @param chunkSize The number of bytes to read from \p stream at a time.
+	 */
+	explicit FJsonReader(TSharedPtr<IFileStream> stream, int32 chunkSize = DefaultChunkSize);
+
+	/**
+	 * @brief Sets default values for this reader's properties.
+	 *
+	 * @param text The text to read. Must outlive the reader.
+	 */
+	explicit FJsonReader(FStringView text);
+
+	/**
+	 * @brief Destroys this reader.
+	 */
+	~FJsonReader() = default;
+
+	/**
+	 * @brief Gets the value of the current Boolean event.
+	 *
+	 * @return The current Boolean value, or false if the current event is not a Boolean.
+	 */
+	[[nodiscard]] bool GetBool() const
+	{
+		return m_Event == EJsonEvent::Boolean && m_Bool;
+	}
+
+	/**
+	 * @brief Gets the number of arrays and objects that are currently open. This includes the array or object that was
+	 *        just begun, but not the one that was just ended.
+	 *
+	 * @return The current depth.
+	 */
+	[[nodiscard]] int32 GetDepth() const
+	{
+		return m_ContainerStack.Num();
+	}
+
+	/**
+	 * @brief Gets the current event.
+	 *
+	 * @return The current event.
+	 */
+	[[nodiscard]] EJsonEvent GetEvent() const
+	{
+		return m_Event;
+	}
+
+	/**
+	 * @brief Gets the value of the current number event.
+	 *
+	 * @return The current number value, or zero if the current event is not a number.
+	 */
+	[[nodiscard]] double GetNumber() const
+	{
+		return m_Event == EJsonEvent::Number ? m_Number : 0.0;
+	}
+
+	/**
+	 * @brief Gets the unescaped value of the current key or string event.
+	 *
+	 * @return The current key or string value, or an empty string view if the current event is neither.
+	 */
+	[[nodiscard]] FStringView GetString() const
+	{
+		return m_Event == EJsonEvent::Key || m_Event == EJsonEvent::String ? m_String : FStringView {};
+	}
+
+	/**
+	 * @brief Reads the next event. Once the root array or object has ended, every call returns EndOfDocument and
+	 *        anything after the root value is ignored, the same as JSON::ParseString.
+	 *
+	 * @return The next event, or the error that was encountered.
+	 */
+	[[nodiscard]] TErrorOr<EJsonEvent> ReadNext();
+
+	/**
+	 * @brief Skips the rest of the current value. If the current event begins an array or object, this reads up to and
+	 *        including its end event. If the current event is a key, this skips the key's value.
+	 *
+	 * @return Nothing, or the error that was encountered.
+	 */
+	[[nodiscard]] TErrorOr<void> SkipValue();
+
+private:
+
+	/**
+	 * @brief The states the reader can be in between events.
+	 */
+	enum class EState : uint8
+	{
+		/** @brief Expecting a value, or the end of the current array or object. */
+		ValueOrEnd,
+
+		/** @brief Expecting a value after a comma. */
+		Value,
+
+		/** @brief Expecting a comma, or the end of the current array or object. */
+		CommaOrEnd,
+
+		/** @brief Expecting a colon and a value after an object key. */
+		KeyValue
+	};
+
+	/**
+	 * @brief Makes sure at least the given number of unread characters are loaded, unless the text ends first.
+	 *
+	 * @param numChars The number of characters.
+	 * @return True if at least \p numChars characters are loaded, otherwise false.
+	 */
+	[[nodiscard]] bool EnsureChars(const int32 numChars)
+	{
+		while (m_TextLength - m_Position < numChars)
+		{
+			if (ReadChunk() == false)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Records the error that stops the reader at the current position.
+	 *
+	 * @param message The error message.
+	 * @return False, always.
+	 */
+	bool Fail(FStringView message);
+
+	/**
+	 * @brief Reads the next chunk from the file stream, first discarding everything before the start of the current
+	 *        token.
+	 *
+	 * @return True if any characters were read, otherwise false.
+	 */
+	[[nodiscard]] bool ReadChunk();
+
+	/**
+	 * @brief Reads the literal value at the current position.
+	 *
+	 * @param literal The expected literal text.
+	 * @return True if the literal was read, otherwise false.
+	 */
+	[[nodiscard]] bool ReadLiteral(FStringView literal);
+
+	/**
+	 * @brief Reads the next event.
+	 *
+	 * @return The next event, or None if an error was encountered.
+	 */
+	[[nodiscard]] EJsonEvent ReadNextEvent();
+
+	/**
+	 * @brief Reads the number at the current position.
+	 *
+	 * @return True if the number was read, otherwise false.
+	 */
+	[[nodiscard]] bool ReadNumber();
+
+	/**
+	 * @brief Reads the string at the current position, which must be the opening quote.
+	 *
+	 * @return True if the string was read, otherwise false.
+	 */
+	[[nodiscard]] bool ReadString();
+
+	/**
+	 * @brief Reads the value at the current position.
+	 *
+	 * @return The value's event, or None if the value could not be read.
+	 */
+	[[nodiscard]] EJsonEvent ReadValue();
+
+	/**
+	 * @brief Skips whitespace, line comments, and multi-line comments.
+	 *
+	 * @return False if a multi-line comment was not terminated, otherwise true.
+	 */
+	[[nodiscard]] bool SkipWhitespaceAndComments();
+
+	TSharedPtr<IFileStream> m_Stream;
+	TArray<char> m_Chunk;
+	TArray<char> m_UnescapedString;
+	TArray<EJsonValueType> m_ContainerStack;
+	const char* m_Text = nullptr;
+	int32 m_TextLength = 0;
+	int32 m_Position = 0;
+	int32 m_TokenStart = 0;
+	FSourceLocation m_TextLocation { 1, 1 };
+	FSourceLocation m_ErrorLocation;
+	FStringView m_String;
+	FStringView m_ErrorMessage;
+	double m_Number = 0.0;
+	EJsonEvent m_Event = EJsonEvent::None;
+	EState m_State = EState::ValueOrEnd;
+	bool m_Bool = false;
+	bool m_HasReadRoot = false;
+};
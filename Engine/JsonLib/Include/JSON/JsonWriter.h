@@ -0,0 +1,207 @@
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/StringView.h"
+#include "Engine/MiscMacros.h"
+#include "HAL/FileStream.h"
+#include "Memory/SharedPtr.h"
+#include "Misc/StringBuilder.h"
+
+class FJsonNode;
+class FJsonValue;
+
+/**
+ * @brief Defines a streaming JSON writer that writes text as values are added, without building a document first.
+ *
+ * Numbers are written in their shortest form that parses back to exactly the same value. Numbers that cannot be
+ * represented in JSON, such as infinity and NaN, are written as null.
+ */
+class FJsonWriter final
+{
+	UM_DISABLE_COPY(FJsonWriter);
+
+public:
+
+	/**
+	 * @brief The default number of bytes to buffer before writing to a file stream.
+	 */
+	static constexpr int32 DefaultChunkSize = 16 * 1024;
+
+	/**
+	 * @brief Sets default values for this writer's properties.
+	 *
+	 * @param builder The string builder to append text to. Must outlive the writer.
+	 * @param prettyPrint True to put each value on its own line and indent them with tabs, otherwise false.
+	 */
+	explicit FJsonWriter(FStringBuilder& builder, bool prettyPrint = false);
+
+	/**
+	 * @brief Sets default values for this writer's properties.
+	 *
+	 * @param stream The file stream to write text to.
+	 * @param prettyPrint True to put each value on its own line and indent them with tabs, otherwise false.
+	 * @param chunkSize The number of bytes to buffer before writing to \p stream.
+	 */
+	explicit FJsonWriter(TSharedPtr<IFileStream> stream, bool prettyPrint = false, int32 chunkSize = DefaultChunkSize);
+
+	/**
+	 * @brief Destroys this writer, flushing anything that has not been written to its file stream yet.
+	 */
+	~FJsonWriter();
+
+	/**
+	 * @brief Begins an array.
+	 */
+	void BeginArray();
+
+	/**
+	 * @brief Begins an object.
+	 */
+	void BeginObject();
+
+	/**
+	 * @brief Ends the current array.
+	 */
+	void EndArray();
+
+	/**
+	 * @brief Ends the current object.
+	 */
+	void EndObject();
+
+	/**
+	 * @brief Writes anything that has been buffered to the file stream. Does nothing when writing to a string builder.
+	 */
+	void Flush();
+
+	/**
+	 * @brief Checks to see if the root array or object has been ended.
+	 *
+	 * @return True if the root array or object has been ended, otherwise false.
+	 */
+	[[nodiscard]] bool IsComplete() const
+	{
+		return m_HasWrittenRoot && m_ContainerStack.IsEmpty();
+	}
+
+	/**
+	 * @brief Writes a Boolean value.
+	 *
+	 * @param value The value.
+	 */
+	void WriteBool(bool value);
+
+	/**
+	 * @brief Writes the key of the next member of the current object.
+	 *
+	 * @param key The key.
+	 */
+	void WriteKey(FStringView key);
+
+	/**
+	 * @brief Writes a read-only JSON node and everything in it.
+	 *
+	 * @param node The node.
+	 */
+	void WriteNode(const FJsonNode& node);
+
+	/**
+	 * @brief Writes a null value.
+	 */
+	void WriteNull();
+
+	/**
+	 * @brief Writes a number value.
+	 *
+	 * @param value The value.
+	 */
+	void WriteNumber(double value);
+
+	/**
+	 * @brief Writes a string value.
+	 *
+	 * @param value The value.
+	 */
+	void WriteString(FStringView value);
+
+	/**
+	 * @brief Writes a JSON value and everything in it.
+	 *
+	 * @param value The value.
+	 */
+	void WriteValue(const FJsonValue& value);
+
+private:
+
+	/**
+	 * @brief Defines an array or object that is being written.
+	 */
+	struct FContainer
+	{
+		/** @brief True if this container is an object, false if it is an array. */
+		bool IsObject = false;
+
+		/** @brief True if this container has had any values written to it. */
+		bool HasValues = false;
+	};
+
+	/**
+	 * @brief Appends characters to the output, writing the chunk to the file stream once it is full.
+	 *
+	 * @param chars The characters.
+	 * @param numChars The number of characters.
+	 */
+	void Append(const char* chars, int32 numChars);
+
+	/**
+	 * @brief Appends characters to the output.
+	 *
+	 * @param chars The characters.
+	 */
+	void Append(const FStringView chars)
+	{
+		Append(chars.GetChars(), chars.Length());
+	}
+
+	/**
+	 * @brief Begins an array or object.
+	 *
+	 * @param isObject True to begin an object, false to begin an array.
+	 */
+	void BeginContainer(bool isObject);
+
+	/**
+	 * @brief Writes whatever needs to come before a value: a comma and indentation inside of arrays, nothing after keys.
+	 *
+	 * @param isContainer True if the value is an array or object, otherwise false.
+	 */
+	void BeginValue(bool isContainer);
+
+	/**
+	 * @brief Ends the current array or object.
+	 *
+	 * @param isObject True to end an object, false to end an array.
+	 */
+	void EndContainer(bool isObject);
+
+	/**
+	 * @brief Writes a new line and indentation for the current depth when pretty printing.
+	 */
+	void WriteNewLine();
+
+	/**
+	 * @brief Writes a quoted, escaped string.
+	 *
+	 * @param value The unescaped string.
+	 */
+	void WriteQuotedString(FStringView value);
+
+	FStringBuilder* m_Builder = nullptr;
+	TSharedPtr<IFileStream> m_Stream;
+	TArray<char> m_Chunk;
+	TArray<FContainer> m_ContainerStack;
+	int32 m_ChunkSize = 0;
+	bool m_PrettyPrint = false;
+	bool m_HasWrittenKey = false;
+	bool m_HasWrittenRoot = false;
+};
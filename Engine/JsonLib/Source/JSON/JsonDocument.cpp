@@ -0,0 +1,768 @@
+#include "Containers/Array.h"
+#include "Engine/Logging.h"
+#include "Engine/Platform.h"
+#include "HAL/File.h"
+#include "JSON/JsonDocument.h"
+#include "JSON/JsonParser.h"
+#include "JSON/JsonText.h"
+#include "JSON/JsonValue.h"
+#include "Math/Math.h"
+#include "Parsing/ParseError.h"
+#include "Templates/Swap.h"
+
+/** @brief The deepest that arrays and objects may be nested before a document is rejected. */
+static constexpr int32 GMaxJsonDepth = 512;
+
+/** @brief The number of object members that are insertion sorted before being merged. */
+static constexpr int32 GMemberSortRunLength = 16;
+
+/**
+ * @brief Checks to see if one object member's key comes before another's.
+ *
+ * @param left The left member.
+ * @param right The right member.
+ * @return True if \p left's key is ordinally less than \p right's key, otherwise false.
+ */
+[[nodiscard]] static bool IsKeyLess(const FJsonMember& left, const FJsonMember& right)
+{
+	return left.Key.Compare(right.Key) == ECompareResult::LessThan;
+}
+
+/**
+ * @brief Stable sorts object members by their keys, so members with the same key stay in document order.
+ *
+ * @param members The members to sort.
+ * @param scratch Scratch memory with room for as many members as there are to sort.
+ * @param numMembers The number of members to sort.
+ */
+static void SortMembers(FJsonMember* members, FJsonMember* scratch, const int32 numMembers)
+{
+	for (int32 runIndex = 0; runIndex < numMembers; runIndex += GMemberSortRunLength)
+	{
+		const int32 runEnd = FMath::Min(runIndex + GMemberSortRunLength, numMembers);
+		for (int32 idx = runIndex + 1; idx < runEnd; ++idx)
+		{
+			const FJsonMember member = members[idx];
+
+			int32 insertIndex = idx;
+			while (insertIndex > runIndex && IsKeyLess(member, members[insertIndex - 1]))
+			{
+				members[insertIndex] = members[insertIndex - 1];
+				--insertIndex;
+			}
+
+			members[insertIndex] = member;
+		}
+	}
+
+	FJsonMember* source = members;
+	FJsonMember* destination = scratch;
+	for (int32 runLength = GMemberSortRunLength; runLength < numMembers; runLength *= 2)
+	{
+		for (int32 leftIndex = 0; leftIndex < numMembers; leftIndex += runLength * 2)
+		{
+			const int32 leftEnd = FMath::Min(leftIndex + runLength, numMembers);
+			const int32 rightEnd = FMath::Min(leftIndex + runLength * 2, numMembers);
+
+			int32 left = leftIndex;
+			int32 right = leftEnd;
+			int32 output = leftIndex;
+			while (left < leftEnd && right < rightEnd)
+			{
+				// Take from the left run on ties to keep the sort stable
+				destination[output++] = IsKeyLess(source[right], source[left]) ? source[right++] : source[left++];
+			}
+			while (left < leftEnd)
+			{
+				destination[output++] = source[left++];
+			}
+			while (right < rightEnd)
+			{
+				destination[output++] = source[right++];
+			}
+		}
+
+		Swap(source, destination);
+	}
+
+	if (source != members)
+	{
+		FMemory::Copy(members, source, numMembers * static_cast<FMemory::SizeType>(sizeof(FJsonMember)));
+	}
+}
+
+/**
+ * @brief Defines a single-pass parser that builds a JSON document directly from its source text.
+ */
+class FJsonDocumentParser final
+{
+public:
+
+	/**
+	 * @brief Sets default values for this parser's properties.
+	 *
+	 * @param document The document to parse into.
+	 * @param text The text to parse.
+	 * @param mutableText The same text as \p text if it may be overwritten with unescaped strings, otherwise nullptr.
+	 */
+	FJsonDocumentParser(FJsonDocument& document, const FStringView text, char* mutableText)
+		: m_Document { document }
+		, m_Begin { text.GetChars() }
+		, m_Current { text.GetChars() }
+		, m_End { text.GetChars() + text.Length() }
+		, m_MutableBegin { mutableText }
+		, m_LocationPosition { text.GetChars() }
+	{
+	}
+
+	/**
+	 * @brief Gets the error that stopped parsing.
+	 *
+	 * @return The error that stopped parsing.
+	 */
+	[[nodiscard]] FParseError GetError() const
+	{
+		FSourceLocation location = m_Location;
+		if (m_ErrorPosition < m_LocationPosition)
+		{
+			// The error is inside a string that was unescaped in place, and strings never contain raw line breaks
+			location.Column -= static_cast<int32>(m_LocationPosition - m_ErrorPosition);
+			return FParseError { location, m_ErrorMessage };
+		}
+
+		for (const char* position = m_LocationPosition; position < m_ErrorPosition; ++position)
+		{
+			AdvanceLocation(location, *position);
+		}
+
+		return FParseError { location, m_ErrorMessage };
+	}
+
+	/**
+	 * @brief Parses the document's root value.
+	 *
+	 * @return True if the root value was parsed, otherwise false.
+	 */
+	[[nodiscard]] bool Parse()
+	{
+		// Skip the UTF-8 byte order mark that some editors write
+		if (m_End - m_Current >= 3 && FStringView { m_Current, 3 } == "\xEF\xBB\xBF"_sv)
+		{
+			m_Current += 3;
+		}
+
+		if (SkipWhitespaceAndComments() == false)
+		{
+			return false;
+		}
+
+		if (m_Current == m_End || (*m_Current != '[' && *m_Current != '{'))
+		{
+			return Fail("Expected start of JSON array or object"_sv);
+		}
+
+		// We can safely ignore anything after the root value, the same as JSON::ParseString
+		return ParseValue(m_Document.m_Root, 0);
+	}
+
+	/**
+	 * @brief Parses a JSON document from text.
+	 *
+	 * @param text The text to parse. Must outlive the document.
+	 * @param ownedText The text to parse, which the document will take ownership of and may overwrite with unescaped
+	 *                  strings, or nullptr if the document should not own its text.
+	 * @return The parsed document, or the error that was encountered.
+	 */
+	[[nodiscard]] static TErrorOr<FJsonDocument> ParseDocument(FStringView text, TUniquePtr<FString> ownedText)
+	{
+		char* mutableText = nullptr;
+		if (ownedText.IsValid())
+		{
+			text = ownedText->AsStringView();
+			mutableText = ownedText->GetChars();
+		}
+
+		FJsonDocument document;
+		document.m_Allocator = FLinearAllocator { text.Length() };
+		document.m_OwnedText = MoveTemp(ownedText);
+
+		FJsonDocumentParser parser { document, text, mutableText };
+		if (parser.Parse() == false)
+		{
+			UM_LOG(Error, "JSON parse error: {}", parser.GetError());
+			return MAKE_ERROR("Encountered an error while parsing JSON text; see log for more details");
+		}
+
+		return document;
+	}
+
+private:
+
+	/**
+	 * @brief Advances a source location past a character.
+	 *
+	 * @param location The source location.
+	 * @param ch The character.
+	 */
+	static void AdvanceLocation(FSourceLocation& location, const char ch)
+	{
+		if (ch == '\n')
+		{
+			++location.Line;
+			location.Column = 1;
+		}
+		else
+		{
+			++location.Column;
+		}
+	}
+
+	/**
+	 * @brief Records the error that stops parsing at the current position.
+	 *
+	 * @param message The error message.
+	 * @return False, always.
+	 */
+	[[nodiscard]] bool Fail(const FStringView message)
+	{
+		if (m_ErrorMessage.IsEmpty())
+		{
+			m_ErrorPosition = m_Current;
+			m_ErrorMessage = message;
+		}
+		return false;
+	}
+
+	/**
+	 * @brief Finds the first quote, backslash, or control character in a string.
+	 *
+	 * @param position The first character to check.
+	 * @return The first quote, backslash, or control character, or the end of the text if there is none.
+	 */
+	[[nodiscard]] const char* FindStringSpecialChar(const char* position) const
+	{
+		return Private::FindJsonStringSpecialChar(position, m_End);
+	}
+
+	/**
+	 * @brief Parses a JSON array. The current character must be the opening bracket.
+	 *
+	 * @param node The node to parse into.
+	 * @param depth The nesting depth of the array.
+	 * @return True if the array was parsed, otherwise false.
+	 */
+	[[nodiscard]] bool ParseArray(FJsonNode& node, const int32 depth)
+	{
+		++m_Current; // The [
+
+		node.m_Type = EJsonValueType::Array;
+		node.m_Elements = nullptr;
+		node.m_Num = 0;
+
+		if (SkipWhitespaceAndComments() == false)
+		{
+			return false;
+		}
+
+		if (m_Current < m_End && *m_Current == ']')
+		{
+			++m_Current;
+			return true;
+		}
+
+		// Elements are gathered on a stack shared by every array, and only copied into the document once the array's
+		// length is known, so each array is a single allocation no matter how deeply it's nested
+		const int32 firstElementIndex = m_ElementStack.Num();
+		while (true)
+		{
+			FJsonNode element;
+			if (ParseValue(element, depth + 1) == false)
+			{
+				return false;
+			}
+
+			m_ElementStack.Add(element);
+
+			if (SkipWhitespaceAndComments() == false)
+			{
+				return false;
+			}
+
+			if (m_Current < m_End && *m_Current == ',')
+			{
+				++m_Current;
+				if (SkipWhitespaceAndComments() == false)
+				{
+					return false;
+				}
+				continue;
+			}
+
+			if (m_Current < m_End && *m_Current == ']')
+			{
+				++m_Current;
+				break;
+			}
+
+			return Fail("Expected ',' or ']' after JSON array value"_sv);
+		}
+
+		const int32 numElements = m_ElementStack.Num() - firstElementIndex;
+		FJsonNode* elements = m_Document.m_Allocator.AllocateArray<FJsonNode>(numElements);
+		FMemory::Copy(elements, m_ElementStack.GetData() + firstElementIndex, numElements * static_cast<FMemory::SizeType>(sizeof(FJsonNode)));
+		m_ElementStack.SetNum(firstElementIndex);
+
+		node.m_Elements = elements;
+		node.m_Num = numElements;
+
+		return true;
+	}
+
+	/**
+	 * @brief Parses a JSON literal.
+	 *
+	 * @param literal The expected literal text.
+	 * @return True if the literal was parsed, otherwise false.
+	 */
+	[[nodiscard]] bool ParseLiteral(const FStringView literal)
+	{
+		if (m_End - m_Current < literal.Length() || FStringView { m_Current, literal.Length() } != literal)
+		{
+			return Fail("Unexpected character while parsing JSON value"_sv);
+		}
+
+		m_Current += literal.Length();
+		return true;
+	}
+
+	/**
+	 * @brief Parses a JSON number.
+	 *
+	 * @param node The node to parse into.
+	 * @return True if the number was parsed, otherwise false.
+	 */
+	[[nodiscard]] bool ParseNumber(FJsonNode& node)
+	{
+		node.m_Type = EJsonValueType::Number;
+
+		FStringView errorMessage;
+		if (Private::ParseJsonNumber(m_Current, m_End, node.m_Number, errorMessage) == false)
+		{
+			return Fail(errorMessage);
+		}
+
+		return true;
+	}
+
+	/**
+	 * @brief Parses a JSON object. The current character must be the opening brace.
+	 *
+	 * @param node The node to parse into.
+	 * @param depth The nesting depth of the object.
+	 * @return True if the object was parsed, otherwise false.
+	 */
+	[[nodiscard]] bool ParseObject(FJsonNode& node, const int32 depth)
+	{
+		++m_Current; // The {
+
+		node.m_Type = EJsonValueType::Object;
+		node.m_Members = nullptr;
+		node.m_Num = 0;
+
+		if (SkipWhitespaceAndComments() == false)
+		{
+			return false;
+		}
+
+		if (m_Current < m_End && *m_Current == '}')
+		{
+			++m_Current;
+			return true;
+		}
+
+		const int32 firstMemberIndex = m_MemberStack.Num();
+		while (true)
+		{
+			if (m_Current == m_End || *m_Current != '"')
+			{
+				return Fail("Expected string for object key"_sv);
+			}
+
+			FJsonMember member;
+			if (ParseString(member.Key) == false || SkipWhitespaceAndComments() == false)
+			{
+				return false;
+			}
+
+			if (m_Current == m_End || *m_Current != ':')
+			{
+				return Fail("Expected ':' after object key"_sv);
+			}
+
+			++m_Current;
+
+			if (SkipWhitespaceAndComments() == false || ParseValue(member.Value, depth + 1) == false)
+			{
+				return false;
+			}
+
+			m_MemberStack.Add(member);
+
+			if (SkipWhitespaceAndComments() == false)
+			{
+				return false;
+			}
+
+			if (m_Current < m_End && *m_Current == ',')
+			{
+				++m_Current;
+				if (SkipWhitespaceAndComments() == false)
+				{
+					return false;
+				}
+				continue;
+			}
+
+			if (m_Current < m_End && *m_Current == '}')
+			{
+				++m_Current;
+				break;
+			}
+
+			return Fail("Expected ',' or '}' after JSON object value"_sv);
+		}
+
+		int32 numMembers = m_MemberStack.Num() - firstMemberIndex;
+		FJsonMember* members = m_Document.m_Allocator.AllocateArray<FJsonMember>(numMembers);
+		FMemory::Copy(members, m_MemberStack.GetData() + firstMemberIndex, numMembers * static_cast<FMemory::SizeType>(sizeof(FJsonMember)));
+
+		// The members on the stack have been copied, so they can serve as the sort's scratch memory
+		SortMembers(members, m_MemberStack.GetData() + firstMemberIndex, numMembers);
+		m_MemberStack.SetNum(firstMemberIndex);
+
+		// When a key appears more than once, the last value wins, the same as with FJsonObject
+		int32 numUniqueMembers = 0;
+		for (int32 idx = 0; idx < numMembers; ++idx)
+		{
+			if (idx + 1 < numMembers && members[idx].Key == members[idx + 1].Key)
+			{
+				continue;
+			}
+
+			members[numUniqueMembers++] = members[idx];
+		}
+		numMembers = numUniqueMembers;
+
+		node.m_Members = members;
+		node.m_Num = numMembers;
+
+		return true;
+	}
+
+	/**
+	 * @brief Parses a JSON string. The current character must be the opening quote.
+	 *
+	 * @param string The parsed string, without its quotes and with its escape sequences replaced.
+	 * @return True if the string was parsed, otherwise false.
+	 */
+	[[nodiscard]] bool ParseString(FStringView& string)
+	{
+		++m_Current; // The opening "
+
+		const char* stringBegin = m_Current;
+		const char* position = FindStringSpecialChar(m_Current);
+		if (LIKELY(position < m_End && *position == '"'))
+		{
+			string = FStringView { stringBegin, static_cast<int32>(position - stringBegin) };
+			m_Current = position + 1;
+			return true;
+		}
+
+		// Find the end of the string first, so we know how much room the unescaped string could possibly need
+		const char* firstEscape = position;
+		while (position < m_End && *position == '\\')
+		{
+			position = FindStringSpecialChar(position + 2 <= m_End ? position + 2 : m_End);
+		}
+
+		if (position == m_End)
+		{
+			return Fail("Encountered unterminated string"_sv);
+		}
+
+		if (*position != '"')
+		{
+			m_Current = position;
+			return Fail("Unexpected control character in string"_sv);
+		}
+
+		const char* stringEnd = position;
+
+		// Unescaped strings are never longer than their escaped form, so they can be written over the source text
+		// when we're allowed to change it
+		char* output = nullptr;
+		char* outputBegin = nullptr;
+		if (m_MutableBegin != nullptr)
+		{
+			outputBegin = m_MutableBegin + (stringBegin - m_Begin);
+			output = m_MutableBegin + (firstEscape - m_Begin);
+
+			// Unescaping can write line breaks that were never in the source, so error locations must not be counted
+			// through the string afterward. The string has no raw line breaks, so skipping it only moves the column
+			for (; m_LocationPosition < stringBegin; ++m_LocationPosition)
+			{
+				AdvanceLocation(m_Location, *m_LocationPosition);
+			}
+
+			m_Location.Column += static_cast<int32>(stringEnd - stringBegin);
+			m_LocationPosition = stringEnd;
+		}
+		else
+		{
+			const int64 numUnescapedChars = firstEscape - stringBegin;
+			outputBegin = m_Document.m_Allocator.AllocateArray<char>(stringEnd - stringBegin);
+			FMemory::Copy(outputBegin, stringBegin, numUnescapedChars);
+			output = outputBegin + numUnescapedChars;
+		}
+
+		position = firstEscape;
+
+		FStringView errorMessage;
+		if (Private::UnescapeJsonString(position, stringEnd, output, errorMessage) == false)
+		{
+			m_Current = position;
+			return Fail(errorMessage);
+		}
+
+		string = FStringView { outputBegin, static_cast<int32>(output - outputBegin) };
+		m_Current = stringEnd + 1;
+
+		return true;
+	}
+
+	/**
+	 * @brief Parses a JSON value.
+	 *
+	 * @param node The node to parse into.
+	 * @param depth The nesting depth of the value.
+	 * @return True if the value was parsed, otherwise false.
+	 */
+	[[nodiscard]] bool ParseValue(FJsonNode& node, const int32 depth)
+	{
+		if (UNLIKELY(depth > GMaxJsonDepth))
+		{
+			return Fail("JSON arrays and objects are nested too deeply"_sv);
+		}
+
+		if (m_Current == m_End)
+		{
+			return Fail("Unexpected end of JSON text"_sv);
+		}
+
+		switch (*m_Current)
+		{
+		case '[':
+			return ParseArray(node, depth);
+
+		case '{':
+			return ParseObject(node, depth);
+
+		case '"':
+			node.m_Type = EJsonValueType::String;
+			{
+				FStringView string;
+				if (ParseString(string) == false)
+				{
+					return false;
+				}
+				node.m_Chars = string.GetChars();
+				node.m_Num = string.Length();
+			}
+			return true;
+
+		case 't':
+			node.m_Type = EJsonValueType::Boolean;
+			node.m_Bool = true;
+			return ParseLiteral("true"_sv);
+
+		case 'f':
+			node.m_Type = EJsonValueType::Boolean;
+			node.m_Bool = false;
+			return ParseLiteral("false"_sv);
+
+		case 'n':
+			node.m_Type = EJsonValueType::Null;
+			return ParseLiteral("null"_sv);
+
+		case '-':
+		case '+':
+		case '0': case '1': case '2': case '3': case '4':
+		case '5': case '6': case '7': case '8': case '9':
+			return ParseNumber(node);
+
+		default:
+			return Fail("Unexpected character while parsing JSON value"_sv);
+		}
+	}
+
+	/**
+	 * @brief Skips whitespace, line comments, and multi-line comments.
+	 *
+	 * @return False if a multi-line comment was not terminated, otherwise true.
+	 */
+	[[nodiscard]] bool SkipWhitespaceAndComments()
+	{
+		while (m_Current < m_End)
+		{
+			switch (*m_Current)
+			{
+			case ' ':
+			case '\t':
+			case '\n':
+			case '\r':
+				++m_Current;
+				break;
+
+			case '/':
+				if (m_End - m_Current >= 2 && m_Current[1] == '/')
+				{
+					while (m_Current < m_End && *m_Current != '\n' && *m_Current != '\r')
+					{
+						++m_Current;
+					}
+					break;
+				}
+
+				if (m_End - m_Current >= 2 && m_Current[1] == '*')
+				{
+					const char* commentBegin = m_Current;
+					m_Current += 2;
+					while (m_End - m_Current >= 2 && (m_Current[0] != '*' || m_Current[1] != '/'))
+					{
+						++m_Current;
+					}
+
+					if (m_End - m_Current < 2)
+					{
+						m_Current = commentBegin;
+						return Fail("Encountered unterminated comment"_sv);
+					}
+
+					m_Current += 2;
+					break;
+				}
+
+				return true;
+
+			default:
+				return true;
+			}
+		}
+
+		return true;
+	}
+
+	FJsonDocument& m_Document;
+	const char* m_Begin = nullptr;
+	const char* m_Current = nullptr;
+	const char* m_End = nullptr;
+	char* m_MutableBegin = nullptr;
+	const char* m_ErrorPosition = nullptr;
+	FStringView m_ErrorMessage;
+	const char* m_LocationPosition = nullptr;
+	FSourceLocation m_Location { 1, 1 };
+	TArray<FJsonNode> m_ElementStack;
+	TArray<FJsonMember> m_MemberStack;
+};
+
+const FJsonNode* FJsonNode::Find(const FStringView key) const
+{
+	if (IsObject() == false)
+	{
+		return nullptr;
+	}
+
+	int32 lowIndex = 0;
+	int32 highIndex = m_Num;
+	while (lowIndex < highIndex)
+	{
+		const int32 middleIndex = lowIndex + (highIndex - lowIndex) / 2;
+		switch (m_Members[middleIndex].Key.Compare(key))
+		{
+		case ECompareResult::LessThan:
+			lowIndex = middleIndex + 1;
+			break;
+
+		case ECompareResult::GreaterThan:
+			highIndex = middleIndex;
+			break;
+
+		default:
+			return &m_Members[middleIndex].Value;
+		}
+	}
+
+	return nullptr;
+}
+
+FJsonValue FJsonNode::ToValue() const
+{
+	switch (m_Type)
+	{
+	case EJsonValueType::Boolean:
+		return FJsonValue::FromBool(m_Bool);
+
+	case EJsonValueType::Number:
+		return FJsonValue::FromNumber(m_Number);
+
+	case EJsonValueType::String:
+		return FJsonValue::FromString(AsStringView());
+
+	case EJsonValueType::Array:
+	{
+		FJsonArray array;
+		for (const FJsonNode& element : AsArray())
+		{
+			array.Add(element.ToValue());
+		}
+		return FJsonValue::FromArray(MoveTemp(array));
+	}
+
+	case EJsonValueType::Object:
+	{
+		FJsonObject object;
+		for (const FJsonMember& member : AsObject())
+		{
+			object.Set(member.Key, member.Value.ToValue());
+		}
+		return FJsonValue::FromObject(MoveTemp(object));
+	}
+
+	default:
+		return FJsonValue::Null;
+	}
+}
+
+TErrorOr<FJsonDocument> JSON::ParseDocumentFile(const FStringView filePath)
+{
+	TRY_EVAL(FString text, FFile::ReadText(filePath));
+
+	TErrorOr<FJsonDocument> result = ::JSON::ParseDocumentString(MoveTemp(text));
+	if (result.IsError())
+	{
+		return MAKE_ERROR("Failed to parse file \"{}\" as JSON", filePath);
+	}
+
+	return result.ReleaseValue();
+}
+
+TErrorOr<FJsonDocument> JSON::ParseDocumentString(const FStringView text)
+{
+	return FJsonDocumentParser::ParseDocument(text, nullptr);
+}
+
+TErrorOr<FJsonDocument> JSON::ParseDocumentString(FString&& text)
+{
+	TUniquePtr<FString> ownedText = MakeUnique<FString>(MoveTemp(text));
+	return FJsonDocumentParser::ParseDocument(FStringView {}, MoveTemp(ownedText));
+}
@@ -12,6 +12,17 @@ bool FJsonObject::Contains(const FString& key) const
 	return m_Values.ContainsKey(key);
 }
 
+void FJsonObject::ForEachPair(TFunction<EIterationDecision(const FString&, const FJsonValue&)> callback) const
+{
+	for (const FJsonObjectKeyValuePair& pair : m_Values)
+	{
+		if (callback(pair.Key, pair.Value) == EIterationDecision::Break)
+		{
+			break;
+		}
+	}
+}
+
 const FJsonValue* FJsonObject::Find(const FStringView key) const
 {
 	return m_Values.Find(key);
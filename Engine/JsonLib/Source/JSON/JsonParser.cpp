@@ -48,7 +48,7 @@ protected:
 		}
 		else
 		{
-			RecordError(Peek().Location, "Expected start of JSON array or object"_sv);
+			RecordError(GetTokenLocation(Peek()), "Expected start of JSON array or object"_sv);
 		}
 
 		// We can safely ignore anything after the root value
@@ -105,7 +105,7 @@ protected:
 	 */
 	[[nodiscard]] TOptional<FJsonValue> ParseJsonNumber()
 	{
-		const FSourceLocation numberLocation = Peek().Location;
+		const FToken& numberToken = Peek();
 		FStringBuilder numberString;
 
 		// Ignore the plus
@@ -116,17 +116,17 @@ protected:
 		// Keep the negative sign
 		if (Peek().Type == ETokenType::Minus)
 		{
-			numberString.Append(AdvanceToken().Text); // Negation
+			numberString.Append(GetTokenText(AdvanceToken())); // Negation
 		}
 
-		numberString.Append(AdvanceToken().Text); // Number
+		numberString.Append(GetTokenText(AdvanceToken())); // Number
 
 		// Check for a decimal
 		bool decimal = false;
 		if (Peek().Type == ETokenType::Period && PeekNext().Type == ETokenType::Number)
 		{
-			numberString.Append(AdvanceToken().Text); // Period
-			numberString.Append(AdvanceToken().Text); // Number
+			numberString.Append(GetTokenText(AdvanceToken())); // Period
+			numberString.Append(GetTokenText(AdvanceToken())); // Number
 			decimal = true;
 		}
 
@@ -139,7 +139,7 @@ protected:
 			}
 			else
 			{
-				RecordError(numberLocation, "Failed to parse \"{}\" as a decimal"_sv, numberString.AsStringView());
+				RecordError(GetTokenLocation(numberToken), "Failed to parse \"{}\" as a decimal"_sv, numberString.AsStringView());
 				return nullopt;
 			}
 		}
@@ -150,7 +150,7 @@ protected:
 			return FJsonValue::FromNumber(static_cast<double>(number.GetValue()));
 		}
 
-		RecordError(numberLocation, "Failed to parse \"{}\" as an integer"_sv, numberString.AsStringView());
+		RecordError(GetTokenLocation(numberToken), "Failed to parse \"{}\" as an integer"_sv, numberString.AsStringView());
 		return nullopt;
 	}
 
@@ -181,11 +181,11 @@ protected:
 
 			if (Peek().Type != ETokenType::String)
 			{
-				RecordError(Peek().Location, "Expected string for object key"_sv);
+				RecordError(GetTokenLocation(Peek()), "Expected string for object key"_sv);
 				return nullopt;
 			}
 
-			const FStringView key = Peek().Text;
+			const FStringView key = GetTokenText(Peek());
 			AdvanceToken();
 
 			if (Consume(ETokenType::Colon, "Expected ':' after object key"_sv) == false)
@@ -251,20 +251,20 @@ protected:
 			return ParseJsonNumber();
 
 		case ETokenType::String:
-			return FJsonValue::FromString(AdvanceToken().Text);
+			return FJsonValue::FromString(GetTokenText(AdvanceToken()));
 
 		case ETokenType::Identifier:
-			if (Peek().Text == "null"_sv)
+			if (GetTokenText(Peek()) == "null"_sv)
 			{
 				AdvanceToken();
 				return FJsonValue::Null;
 			}
-			if (Peek().Text == "true"_sv)
+			if (GetTokenText(Peek()) == "true"_sv)
 			{
 				AdvanceToken();
 				return FJsonValue::True;
 			}
-			if (Peek().Text == "false"_sv)
+			if (GetTokenText(Peek()) == "false"_sv)
 			{
 				AdvanceToken();
 				return FJsonValue::False;
@@ -275,7 +275,7 @@ protected:
 			break;
 		}
 
-		RecordError(Peek().Location, "Unexpected \"{}\""_sv, Peek().Text);
+		RecordError(GetTokenLocation(Peek()), "Unexpected \"{}\""_sv, GetTokenText(Peek()));
 
 		return nullopt;
 	}
@@ -316,7 +316,7 @@ TErrorOr<FJsonValue> JSON::ParseString(const FStringView text)
 	}
 
 	FJsonParser parser;
-	parser.ParseTokens(scanner.GetTokens());
+	parser.ParseTokens(scanner);
 
 	if (parser.HasErrors())
 	{
@@ -0,0 +1,494 @@
+#include "Engine/Logging.h"
+#include "JSON/JsonReader.h"
+#include "JSON/JsonText.h"
+#include "Math/Math.h"
+#include "Parsing/ParseError.h"
+
+/** @brief The deepest that arrays and objects may be nested before the text is rejected. */
+static constexpr int32 GMaxJsonDepth = 512;
+
+/**
+ * @brief Moves a source location past some characters.
+ *
+ * @param location The location.
+ * @param chars The characters.
+ * @param numChars The number of characters.
+ */
+static void AdvanceLocation(FSourceLocation& location, const char* chars, const int32 numChars)
+{
+	for (int32 idx = 0; idx < numChars; ++idx)
+	{
+		if (chars[idx] == '\n')
+		{
+			++location.Line;
+			location.Column = 1;
+		}
+		else
+		{
+			++location.Column;
+		}
+	}
+}
+
+/**
+ * @brief Checks to see if a character can be part of a JSON number.
+ *
+ * @param ch The character.
+ * @return True if \p ch can be part of a JSON number, otherwise false.
+ */
+[[nodiscard]] static bool IsNumberChar(const char ch)
+{
+	return (ch >= '0' && ch <= '9') || ch == '-' || ch == '+' || ch == '.' || ch == 'e' || ch == 'E';
+}
+
+FJsonReader::FJsonReader(TSharedPtr<IFileStream> stream, const int32 chunkSize)
+	: m_Stream { MoveTemp(stream) }
+{
+	UM_ASSERT(chunkSize > 0, "JSON readers require a chunk size greater than zero");
+
+	m_Chunk.AddUninitialized(chunkSize);
+	m_Text = m_Chunk.GetData();
+}
+
+FJsonReader::FJsonReader(const FStringView text)
+	: m_Text { text.GetChars() }
+	, m_TextLength { text.Length() }
+{
+}
+
+TErrorOr<EJsonEvent> FJsonReader::ReadNext()
+{
+	if (m_ErrorMessage.IsEmpty() == false)
+	{
+		return MAKE_ERROR("Cannot continue reading JSON text after an error");
+	}
+
+	m_Event = ReadNextEvent();
+	if (m_Event == EJsonEvent::None)
+	{
+		UM_LOG(Error, "JSON parse error: {}", FParseError { m_ErrorLocation, m_ErrorMessage });
+		return MAKE_ERROR("Encountered an error while reading JSON text; see log for more details");
+	}
+
+	return m_Event;
+}
+
+TErrorOr<void> FJsonReader::SkipValue()
+{
+	if (m_Event == EJsonEvent::Key)
+	{
+		TRY_EVAL(const EJsonEvent valueEvent, ReadNext());
+		(void)valueEvent;
+	}
+
+	if (m_Event != EJsonEvent::BeginArray && m_Event != EJsonEvent::BeginObject)
+	{
+		return {};
+	}
+
+	const int32 parentDepth = GetDepth() - 1;
+	while (GetDepth() > parentDepth)
+	{
+		TRY_EVAL(const EJsonEvent event, ReadNext());
+		(void)event;
+	}
+
+	return {};
+}
+
+bool FJsonReader::Fail(const FStringView message)
+{
+	if (m_ErrorMessage.IsEmpty())
+	{
+		m_ErrorLocation = m_TextLocation;
+		AdvanceLocation(m_ErrorLocation, m_Text, FMath::Min(m_Position, m_TextLength));
+		m_ErrorMessage = message;
+	}
+	return false;
+}
+
+bool FJsonReader::ReadChunk()
+{
+	if (m_Stream.IsValid() == false || m_Stream->IsOpen() == false)
+	{
+		return false;
+	}
+
+	// Everything before the current token has already been read, so it can be dropped to make room
+	if (m_TokenStart > 0)
+	{
+		AdvanceLocation(m_TextLocation, m_Text, m_TokenStart);
+
+		const int32 numCharsToKeep = m_TextLength - m_TokenStart;
+		FMemory::Move(m_Chunk.GetData(), m_Chunk.GetData() + m_TokenStart, numCharsToKeep);
+
+		m_TextLength = numCharsToKeep;
+		m_Position -= m_TokenStart;
+		m_TokenStart = 0;
+	}
+
+	// The only way the chunk can still be full is if a single token is larger than it
+	if (m_TextLength == m_Chunk.Num())
+	{
+		m_Chunk.AddUninitialized(m_Chunk.Num());
+		m_Text = m_Chunk.GetData();
+	}
+
+	const int64 numBytesLeftInStream = m_Stream->GetLength() - m_Stream->Tell();
+	const int32 numBytesToRead = static_cast<int32>(FMath::Min(static_cast<int64>(m_Chunk.Num() - m_TextLength), numBytesLeftInStream));
+	if (numBytesToRead <= 0)
+	{
+		return false;
+	}
+
+	m_Stream->Read(m_Chunk.GetData() + m_TextLength, static_cast<uint64>(numBytesToRead));
+	m_TextLength += numBytesToRead;
+
+	return true;
+}
+
+bool FJsonReader::ReadLiteral(const FStringView literal)
+{
+	if (EnsureChars(literal.Length()) == false || FStringView { m_Text + m_Position, literal.Length() } != literal)
+	{
+		return Fail("Unexpected character while parsing JSON value"_sv);
+	}
+
+	m_Position += literal.Length();
+	return true;
+}
+
+EJsonEvent FJsonReader::ReadNextEvent()
+{
+	if (m_HasReadRoot)
+	{
+		return EJsonEvent::EndOfDocument;
+	}
+
+	if (m_Event == EJsonEvent::None)
+	{
+		if (m_Chunk.Num() > 0 && (m_Stream.IsValid() == false || m_Stream->IsOpen() == false))
+		{
+			Fail("Cannot read JSON text from a file stream that is not open"_sv);
+			return EJsonEvent::None;
+		}
+
+		// Skip the UTF-8 byte order mark that some editors write
+		if (EnsureChars(3) && FStringView { m_Text + m_Position, 3 } == "\xEF\xBB\xBF"_sv)
+		{
+			m_Position += 3;
+		}
+	}
+
+	if (SkipWhitespaceAndComments() == false)
+	{
+		return EJsonEvent::None;
+	}
+
+	if (m_ContainerStack.IsEmpty())
+	{
+		if (EnsureChars(1) == false || (m_Text[m_Position] != '[' && m_Text[m_Position] != '{'))
+		{
+			Fail("Expected start of JSON array or object"_sv);
+			return EJsonEvent::None;
+		}
+
+		return ReadValue();
+	}
+
+	if (EnsureChars(1) == false)
+	{
+		Fail("Unexpected end of JSON text"_sv);
+		return EJsonEvent::None;
+	}
+
+	const bool isInObject = m_ContainerStack.Last() == EJsonValueType::Object;
+	const char endChar = isInObject ? '}' : ']';
+	const char ch = m_Text[m_Position];
+
+	bool isEnd = false;
+	switch (m_State)
+	{
+	case EState::ValueOrEnd:
+		isEnd = ch == endChar;
+		break;
+
+	case EState::Value:
+		break;
+
+	case EState::CommaOrEnd:
+		if (ch == endChar)
+		{
+			isEnd = true;
+			break;
+		}
+
+		if (ch != ',')
+		{
+			Fail(isInObject ? "Expected ',' or '}' after JSON object value"_sv : "Expected ',' or ']' after JSON array value"_sv);
+			return EJsonEvent::None;
+		}
+
+		++m_Position;
+		if (SkipWhitespaceAndComments() == false)
+		{
+			return EJsonEvent::None;
+		}
+
+		m_State = EState::Value;
+		break;
+
+	case EState::KeyValue:
+		if (ch != ':')
+		{
+			Fail("Expected ':' after object key"_sv);
+			return EJsonEvent::None;
+		}
+
+		++m_Position;
+		if (SkipWhitespaceAndComments() == false)
+		{
+			return EJsonEvent::None;
+		}
+
+		return ReadValue();
+	}
+
+	if (isEnd)
+	{
+		++m_Position;
+		m_ContainerStack.RemoveAt(m_ContainerStack.Num() - 1);
+		m_State = EState::CommaOrEnd;
+		m_HasReadRoot = m_ContainerStack.IsEmpty();
+
+		return isInObject ? EJsonEvent::EndObject : EJsonEvent::EndArray;
+	}
+
+	if (isInObject == false)
+	{
+		return ReadValue();
+	}
+
+	if (EnsureChars(1) == false || m_Text[m_Position] != '"')
+	{
+		Fail("Expected string for object key"_sv);
+		return EJsonEvent::None;
+	}
+
+	if (ReadString() == false)
+	{
+		return EJsonEvent::None;
+	}
+
+	m_State = EState::KeyValue;
+	return EJsonEvent::Key;
+}
+
+bool FJsonReader::ReadNumber()
+{
+	// Numbers are gathered before they're parsed, so the whole number needs to be loaded at once
+	m_TokenStart = m_Position;
+
+	int32 numChars = 0;
+	while ((m_Position + numChars < m_TextLength || ReadChunk()) && IsNumberChar(m_Text[m_Position + numChars]))
+	{
+		++numChars;
+	}
+
+	const char* position = m_Text + m_Position;
+	FStringView errorMessage;
+	const bool parsed = Private::ParseJsonNumber(position, m_Text + m_Position + numChars, m_Number, errorMessage);
+
+	// Anything left over, like the second '.' in "1.2.3", is left to fail as the start of the next token
+	m_Position = static_cast<int32>(position - m_Text);
+
+	return parsed || Fail(errorMessage);
+}
+
+bool FJsonReader::ReadString()
+{
+	// Strings are only unescaped once their end is found, so the whole string needs to be loaded at once
+	m_TokenStart = m_Position;
+	++m_Position; // The opening "
+
+	bool hasEscapes = false;
+	while (true)
+	{
+		const char* specialChar = Private::FindJsonStringSpecialChar(m_Text + m_Position, m_Text + m_TextLength);
+		m_Position = static_cast<int32>(specialChar - m_Text);
+
+		if (m_Position == m_TextLength)
+		{
+			if (ReadChunk() == false)
+			{
+				return Fail("Encountered unterminated string"_sv);
+			}
+			continue;
+		}
+
+		if (*specialChar == '"')
+		{
+			break;
+		}
+
+		if (*specialChar != '\\')
+		{
+			return Fail("Unexpected control character in string"_sv);
+		}
+
+		// Load the escaped character too, so an escaped quote is never mistaken for the end of the string
+		if (EnsureChars(2) == false)
+		{
+			m_Position = m_TextLength;
+			return Fail("Encountered unterminated string"_sv);
+		}
+
+		m_Position += 2;
+		hasEscapes = true;
+	}
+
+	const char* stringBegin = m_Text + m_TokenStart + 1;
+	const char* stringEnd = m_Text + m_Position;
+	const int32 stringLength = static_cast<int32>(stringEnd - stringBegin);
+	++m_Position; // The closing "
+
+	if (LIKELY(hasEscapes == false))
+	{
+		m_String = FStringView { stringBegin, stringLength };
+		return true;
+	}
+
+	m_UnescapedString.Reset();
+	m_UnescapedString.AddUninitialized(stringLength);
+
+	const char* position = stringBegin;
+	char* output = m_UnescapedString.GetData();
+	FStringView errorMessage;
+	if (Private::UnescapeJsonString(position, stringEnd, output, errorMessage) == false)
+	{
+		m_Position = static_cast<int32>(position - m_Text);
+		return Fail(errorMessage);
+	}
+
+	m_String = FStringView { m_UnescapedString.GetData(), static_cast<int32>(output - m_UnescapedString.GetData()) };
+	return true;
+}
+
+EJsonEvent FJsonReader::ReadValue()
+{
+	if (EnsureChars(1) == false)
+	{
+		Fail("Unexpected end of JSON text"_sv);
+		return EJsonEvent::None;
+	}
+
+	m_TokenStart = m_Position;
+	m_State = EState::CommaOrEnd;
+
+	switch (m_Text[m_Position])
+	{
+	case '[':
+	case '{':
+		if (UNLIKELY(m_ContainerStack.Num() >= GMaxJsonDepth))
+		{
+			Fail("JSON arrays and objects are nested too deeply"_sv);
+			return EJsonEvent::None;
+		}
+
+		m_State = EState::ValueOrEnd;
+		if (m_Text[m_Position++] == '[')
+		{
+			m_ContainerStack.Add(EJsonValueType::Array);
+			return EJsonEvent::BeginArray;
+		}
+
+		m_ContainerStack.Add(EJsonValueType::Object);
+		return EJsonEvent::BeginObject;
+
+	case '"':
+		return ReadString() ? EJsonEvent::String : EJsonEvent::None;
+
+	case 't':
+		m_Bool = true;
+		return ReadLiteral("true"_sv) ? EJsonEvent::Boolean : EJsonEvent::None;
+
+	case 'f':
+		m_Bool = false;
+		return ReadLiteral("false"_sv) ? EJsonEvent::Boolean : EJsonEvent::None;
+
+	case 'n':
+		return ReadLiteral("null"_sv) ? EJsonEvent::Null : EJsonEvent::None;
+
+	case '-':
+	case '+':
+	case '0': case '1': case '2': case '3': case '4':
+	case '5': case '6': case '7': case '8': case '9':
+		return ReadNumber() ? EJsonEvent::Number : EJsonEvent::None;
+
+	default:
+		Fail("Unexpected character while parsing JSON value"_sv);
+		return EJsonEvent::None;
+	}
+}
+
+bool FJsonReader::SkipWhitespaceAndComments()
+{
+	while (true)
+	{
+		// Whitespace and comments never need to be kept around when the next chunk is read
+		m_TokenStart = m_Position;
+
+		if (EnsureChars(1) == false)
+		{
+			return true;
+		}
+
+		switch (m_Text[m_Position])
+		{
+		case ' ':
+		case '\t':
+		case '\n':
+		case '\r':
+			++m_Position;
+			break;
+
+		case '/':
+			if (EnsureChars(2) && m_Text[m_Position + 1] == '/')
+			{
+				m_Position += 2;
+				while (EnsureChars(1) && m_Text[m_Position] != '\n' && m_Text[m_Position] != '\r')
+				{
+					m_TokenStart = ++m_Position;
+				}
+				break;
+			}
+
+			if (EnsureChars(2) && m_Text[m_Position + 1] == '*')
+			{
+				m_Position += 2;
+				while (true)
+				{
+					if (EnsureChars(2) == false)
+					{
+						m_Position = m_TextLength;
+						return Fail("Encountered unterminated comment"_sv);
+					}
+
+					if (m_Text[m_Position] == '*' && m_Text[m_Position + 1] == '/')
+					{
+						m_Position += 2;
+						break;
+					}
+
+					m_TokenStart = ++m_Position;
+				}
+				break;
+			}
+
+			return true;
+
+		default:
+			return true;
+		}
+	}
+}
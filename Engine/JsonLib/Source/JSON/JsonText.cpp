@@ -0,0 +1,263 @@
+#include "Containers/Optional.h"
+#include "JSON/JsonText.h"
+#include "Memory/Memory.h"
+#include "Misc/StringParsing.h"
+
+/**
+ * @brief Appends a code point to an unescaped string as UTF-8.
+ *
+ * @param codePoint The code point.
+ * @param output The next character of the unescaped string. Advanced past the appended code point.
+ */
+static void AppendUtf8(const uint32 codePoint, char*& output)
+{
+	if (codePoint < 0x80)
+	{
+		*output++ = static_cast<char>(codePoint);
+	}
+	else if (codePoint < 0x800)
+	{
+		*output++ = static_cast<char>(0xC0 | (codePoint >> 6));
+		*output++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+	}
+	else if (codePoint < 0x10000)
+	{
+		*output++ = static_cast<char>(0xE0 | (codePoint >> 12));
+		*output++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+		*output++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+	}
+	else
+	{
+		*output++ = static_cast<char>(0xF0 | (codePoint >> 18));
+		*output++ = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+		*output++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+		*output++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+	}
+}
+
+/**
+ * @brief Checks to see if a character is a decimal digit.
+ *
+ * @param ch The character.
+ * @return True if \p ch is a decimal digit, otherwise false.
+ */
+[[nodiscard]] static bool IsDigit(const char ch)
+{
+	return ch >= '0' && ch <= '9';
+}
+
+/**
+ * @brief Parses four hexadecimal digits.
+ *
+ * @param position The first digit.
+ * @param end The end of the text.
+ * @param value The parsed value.
+ * @return True if there were four hexadecimal digits to parse, otherwise false.
+ */
+[[nodiscard]] static bool ParseHexQuad(const char* position, const char* end, uint32& value)
+{
+	if (end - position < 4)
+	{
+		return false;
+	}
+
+	value = 0;
+	for (int32 idx = 0; idx < 4; ++idx)
+	{
+		const char ch = position[idx];
+
+		uint32 digit = 0;
+		if (ch >= '0' && ch <= '9')
+		{
+			digit = static_cast<uint32>(ch - '0');
+		}
+		else if (ch >= 'a' && ch <= 'f')
+		{
+			digit = static_cast<uint32>(ch - 'a' + 10);
+		}
+		else if (ch >= 'A' && ch <= 'F')
+		{
+			digit = static_cast<uint32>(ch - 'A' + 10);
+		}
+		else
+		{
+			return false;
+		}
+
+		value = (value << 4) | digit;
+	}
+
+	return true;
+}
+
+bool Private::ParseJsonNumber(const char*& position, const char* end, double& value, FStringView& errorMessage)
+{
+	const char* current = position;
+
+	// Non-standard, but allow numbers like "+42.5" the same as JSON::ParseString
+	if (current < end && *current == '+')
+	{
+		++current;
+	}
+
+	const char* numberBegin = current;
+	const bool negative = current < end && *current == '-';
+	if (negative)
+	{
+		++current;
+	}
+
+	const char* digitsBegin = current;
+	uint64 integerValue = 0;
+	while (current < end && IsDigit(*current))
+	{
+		integerValue = integerValue * 10 + static_cast<uint64>(*current - '0');
+		++current;
+	}
+
+	const int64 numDigits = current - digitsBegin;
+	if (numDigits == 0)
+	{
+		position = current;
+		errorMessage = "Expected digit in JSON number"_sv;
+		return false;
+	}
+
+	bool isIntegral = true;
+	if (current < end && *current == '.')
+	{
+		++current;
+		if (current == end || IsDigit(*current) == false)
+		{
+			position = current;
+			errorMessage = "Expected digit after decimal point in JSON number"_sv;
+			return false;
+		}
+
+		while (current < end && IsDigit(*current))
+		{
+			++current;
+		}
+
+		isIntegral = false;
+	}
+
+	if (current < end && (*current == 'e' || *current == 'E'))
+	{
+		++current;
+		if (current < end && (*current == '+' || *current == '-'))
+		{
+			++current;
+		}
+
+		if (current == end || IsDigit(*current) == false)
+		{
+			position = current;
+			errorMessage = "Expected digit in JSON number exponent"_sv;
+			return false;
+		}
+
+		while (current < end && IsDigit(*current))
+		{
+			++current;
+		}
+
+		isIntegral = false;
+	}
+
+	// Integers with up to 15 digits are exactly representable as doubles, which covers most numbers in practice
+	if (isIntegral && numDigits <= 15)
+	{
+		const double integralValue = static_cast<double>(integerValue);
+		value = negative ? -integralValue : integralValue;
+		position = current;
+		return true;
+	}
+
+	const FStringView numberText { numberBegin, static_cast<int32>(current - numberBegin) };
+	const TOptional<double> number = FStringParser::TryParseDouble(numberText);
+	if (number.IsEmpty())
+	{
+		errorMessage = "Failed to parse JSON number"_sv;
+		return false;
+	}
+
+	value = number.GetValue();
+	position = current;
+	return true;
+}
+
+bool Private::UnescapeJsonString(const char*& position, const char* const end, char*& output, FStringView& errorMessage)
+{
+	while (position < end)
+	{
+		if (*position != '\\')
+		{
+			const char* runEnd = FindJsonStringSpecialChar(position, end);
+			FMemory::Move(output, position, runEnd - position);
+			output += runEnd - position;
+			position = runEnd;
+			continue;
+		}
+
+		const char* escapeBegin = position;
+		const char escaped = position[1];
+		position += 2;
+
+		switch (escaped)
+		{
+		case '"':  *output++ = '"';  break;
+		case '\\': *output++ = '\\'; break;
+		case '/':  *output++ = '/';  break;
+		case 'b':  *output++ = '\b'; break;
+		case 'f':  *output++ = '\f'; break;
+		case 'n':  *output++ = '\n'; break;
+		case 'r':  *output++ = '\r'; break;
+		case 't':  *output++ = '\t'; break;
+
+		case 'u':
+		{
+			uint32 codePoint = 0;
+			if (ParseHexQuad(position, end, codePoint) == false)
+			{
+				position = escapeBegin;
+				errorMessage = "Expected four hexadecimal digits in Unicode escape sequence"_sv;
+				return false;
+			}
+			position += 4;
+
+			if (codePoint >= 0xDC00 && codePoint <= 0xDFFF)
+			{
+				position = escapeBegin;
+				errorMessage = "Unexpected low surrogate in Unicode escape sequence"_sv;
+				return false;
+			}
+
+			if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+			{
+				uint32 lowSurrogate = 0;
+				if (end - position < 6 || position[0] != '\\' || position[1] != 'u' ||
+				    ParseHexQuad(position + 2, end, lowSurrogate) == false || lowSurrogate < 0xDC00 || lowSurrogate > 0xDFFF)
+				{
+					position = escapeBegin;
+					errorMessage = "Expected low surrogate after high surrogate in Unicode escape sequence"_sv;
+					return false;
+				}
+				position += 6;
+
+				codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+			}
+
+			AppendUtf8(codePoint, output);
+			break;
+		}
+
+		default:
+			position = escapeBegin;
+			errorMessage = "Invalid escape sequence in string"_sv;
+			return false;
+		}
+	}
+
+	return true;
+}
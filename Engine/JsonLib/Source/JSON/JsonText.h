@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Containers/StringView.h"
+#include "Engine/IntTypes.h"
+#include "Engine/Platform.h"
+#include <bit>
+
+// Do not include SSE headers on ARM builds
+#if !UMBRAL_ARCH_IS_ARM
+#	include <emmintrin.h> /* For _mm_cmpeq_epi8 and _mm_movemask_epi8 */
+#	define WITH_SSE2 1
+#else
+#	define WITH_SSE2 0
+#endif
+
+/**
+ * Helpers for scanning the pieces of JSON text that are shared by the document parser, the streaming reader, and the
+ * streaming writer.
+ */
+namespace Private
+{
+	/**
+	 * @brief Finds the first quote, backslash, or control character in a run of text.
+	 *
+	 * @param position The first character to check.
+	 * @param end The end of the text.
+	 * @return The first quote, backslash, or control character, or \p end if there is none.
+	 */
+	[[nodiscard]] inline const char* FindJsonStringSpecialChar(const char* position, const char* end)
+	{
+#if WITH_SSE2
+		const __m128i quotes = _mm_set1_epi8('"');
+		const __m128i backslashes = _mm_set1_epi8('\\');
+		const __m128i controlLimit = _mm_set1_epi8(0x20);
+		const __m128i signBits = _mm_set1_epi8(static_cast<char>(0x80));
+
+		while (end - position >= 16)
+		{
+			const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(position));
+
+			// Flip the sign bits so that a signed compare finds the unsigned values below 0x20
+			const __m128i isControl = _mm_cmplt_epi8(_mm_xor_si128(chars, signBits), _mm_xor_si128(controlLimit, signBits));
+			const __m128i isSpecial = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chars, quotes), _mm_cmpeq_epi8(chars, backslashes)), isControl);
+
+			const int32 mask = _mm_movemask_epi8(isSpecial);
+			if (mask != 0)
+			{
+				return position + std::countr_zero(static_cast<uint32>(mask));
+			}
+
+			position += 16;
+		}
+#endif
+
+		while (position < end && *position != '"' && *position != '\\' && static_cast<uint8>(*position) >= 0x20)
+		{
+			++position;
+		}
+
+		return position;
+	}
+
+	/**
+	 * @brief Parses a JSON number. Numbers may have a leading '+', the same as JSON::ParseString allows.
+	 *
+	 * @param position The first character of the number. On failure, this is left on the offending character,
+	 *                 otherwise it is moved past the number.
+	 * @param end The end of the text.
+	 * @param value The parsed value.
+	 * @param errorMessage The reason the number could not be parsed.
+	 * @return True if the number was parsed, otherwise false.
+	 */
+	[[nodiscard]] bool ParseJsonNumber(const char*& position, const char* end, double& value, FStringView& errorMessage);
+
+	/**
+	 * @brief Unescapes the contents of a JSON string. Unescaped strings are never longer than their escaped form, so
+	 *        the output may overlap the input as long as it does not start after it.
+	 *
+	 * @param position The first character to unescape. On failure, this is left on the offending escape sequence.
+	 * @param end The closing quote of the string.
+	 * @param output Where to write the unescaped characters. Moved past the characters that were written.
+	 * @param errorMessage The reason the string could not be unescaped.
+	 * @return True if the string was unescaped, otherwise false.
+	 */
+	[[nodiscard]] bool UnescapeJsonString(const char*& position, const char* end, char*& output, FStringView& errorMessage);
+}
@@ -0,0 +1,327 @@
+#include "Containers/StaticArray.h"
+#include "Engine/Assert.h"
+#include "Engine/CoreTypes.h"
+#include "JSON/JsonDocument.h"
+#include "JSON/JsonText.h"
+#include "JSON/JsonValue.h"
+#include "JSON/JsonWriter.h"
+#include "Math/Math.h"
+#include <charconv> /* For std::to_chars */
+#include <cmath> /* For std::isfinite */
+
+static const FStringView GIndentString = "\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t"_sv;
+static const FStringView GHexDigits = "0123456789abcdef"_sv;
+
+FJsonWriter::FJsonWriter(FStringBuilder& builder, const bool prettyPrint)
+	: m_Builder { &builder }
+	, m_PrettyPrint { prettyPrint }
+{
+}
+
+FJsonWriter::FJsonWriter(TSharedPtr<IFileStream> stream, const bool prettyPrint, const int32 chunkSize)
+	: m_Stream { MoveTemp(stream) }
+	, m_ChunkSize { chunkSize }
+	, m_PrettyPrint { prettyPrint }
+{
+	UM_ASSERT(m_Stream.IsValid() && m_Stream->IsOpen(), "JSON writers require an open file stream to write to");
+	UM_ASSERT(m_ChunkSize > 0, "JSON writers require a chunk size greater than zero");
+
+	m_Chunk.Reserve(m_ChunkSize);
+}
+
+FJsonWriter::~FJsonWriter()
+{
+	Flush();
+}
+
+void FJsonWriter::BeginArray()
+{
+	BeginContainer(false);
+}
+
+void FJsonWriter::BeginObject()
+{
+	BeginContainer(true);
+}
+
+void FJsonWriter::EndArray()
+{
+	EndContainer(false);
+}
+
+void FJsonWriter::EndObject()
+{
+	EndContainer(true);
+}
+
+void FJsonWriter::Flush()
+{
+	if (m_Builder != nullptr || m_Chunk.IsEmpty())
+	{
+		return;
+	}
+
+	m_Stream->Write(m_Chunk.GetData(), static_cast<uint64>(m_Chunk.Num()));
+	m_Chunk.Reset();
+}
+
+void FJsonWriter::WriteBool(const bool value)
+{
+	BeginValue(false);
+	Append(value ? "true"_sv : "false"_sv);
+}
+
+void FJsonWriter::WriteKey(const FStringView key)
+{
+	UM_ASSERT(m_ContainerStack.Num() > 0 && m_ContainerStack.Last().IsObject && m_HasWrittenKey == false, "JSON object keys must be written inside of an object, once per value");
+
+	FContainer& container = m_ContainerStack.Last();
+	if (container.HasValues)
+	{
+		Append(","_sv);
+	}
+	container.HasValues = true;
+
+	WriteNewLine();
+	WriteQuotedString(key);
+	Append(m_PrettyPrint ? ": "_sv : ":"_sv);
+
+	m_HasWrittenKey = true;
+}
+
+void FJsonWriter::WriteNode(const FJsonNode& node)
+{
+	switch (node.GetType())
+	{
+	case EJsonValueType::Boolean:
+		WriteBool(node.AsBool());
+		break;
+
+	case EJsonValueType::Number:
+		WriteNumber(node.AsNumber());
+		break;
+
+	case EJsonValueType::String:
+		WriteString(node.AsStringView());
+		break;
+
+	case EJsonValueType::Array:
+		BeginArray();
+		for (const FJsonNode& element : node.AsArray())
+		{
+			WriteNode(element);
+		}
+		EndArray();
+		break;
+
+	case EJsonValueType::Object:
+		BeginObject();
+		for (const FJsonMember& member : node.AsObject())
+		{
+			WriteKey(member.Key);
+			WriteNode(member.Value);
+		}
+		EndObject();
+		break;
+
+	default:
+		WriteNull();
+		break;
+	}
+}
+
+void FJsonWriter::WriteNull()
+{
+	BeginValue(false);
+	Append("null"_sv);
+}
+
+void FJsonWriter::WriteNumber(const double value)
+{
+	BeginValue(false);
+
+	if (std::isfinite(value) == false)
+	{
+		Append("null"_sv);
+		return;
+	}
+
+	// With no precision given, std::to_chars writes the shortest text that parses back to exactly the same value
+	TStaticArray<char, 32> buffer;
+	const std::to_chars_result result = std::to_chars(buffer.GetData(), buffer.GetData() + buffer.Num(), value);
+	UM_ASSERT(result.ec == std::errc {}, "Failed to convert JSON number to text");
+
+	Append(buffer.GetData(), static_cast<int32>(result.ptr - buffer.GetData()));
+}
+
+void FJsonWriter::WriteString(const FStringView value)
+{
+	BeginValue(false);
+	WriteQuotedString(value);
+}
+
+void FJsonWriter::WriteValue(const FJsonValue& value)
+{
+	switch (value.GetType())
+	{
+	case EJsonValueType::Boolean:
+		WriteBool(value.AsBool());
+		break;
+
+	case EJsonValueType::Number:
+		WriteNumber(value.AsNumber());
+		break;
+
+	case EJsonValueType::String:
+		WriteString(value.AsStringView());
+		break;
+
+	case EJsonValueType::Array:
+		BeginArray();
+		for (const FJsonValue& element : *value.AsArray())
+		{
+			WriteValue(element);
+		}
+		EndArray();
+		break;
+
+	case EJsonValueType::Object:
+		BeginObject();
+		value.AsObject()->ForEachPair([this](const FString& key, const FJsonValue& memberValue)
+		{
+			WriteKey(key);
+			WriteValue(memberValue);
+			return EIterationDecision::Continue;
+		});
+		EndObject();
+		break;
+
+	default:
+		WriteNull();
+		break;
+	}
+}
+
+void FJsonWriter::Append(const char* chars, const int32 numChars)
+{
+	if (m_Builder != nullptr)
+	{
+		m_Builder->Append(chars, numChars);
+		return;
+	}
+
+	m_Chunk.Append(chars, numChars);
+	if (m_Chunk.Num() >= m_ChunkSize)
+	{
+		Flush();
+	}
+}
+
+void FJsonWriter::BeginContainer(const bool isObject)
+{
+	BeginValue(true);
+	Append(isObject ? "{"_sv : "["_sv);
+
+	m_ContainerStack.Add(FContainer { isObject, false });
+}
+
+void FJsonWriter::BeginValue(const bool isContainer)
+{
+	if (m_ContainerStack.IsEmpty())
+	{
+		UM_ASSERT(isContainer && m_HasWrittenRoot == false, "JSON text must have exactly one array or object at its root");
+		m_HasWrittenRoot = true;
+		return;
+	}
+
+	FContainer& container = m_ContainerStack.Last();
+	if (container.IsObject)
+	{
+		UM_ASSERT(m_HasWrittenKey, "Values in JSON objects must be preceded by a key");
+		m_HasWrittenKey = false;
+		return;
+	}
+
+	if (container.HasValues)
+	{
+		Append(","_sv);
+	}
+	container.HasValues = true;
+
+	WriteNewLine();
+}
+
+void FJsonWriter::EndContainer(const bool isObject)
+{
+	UM_ASSERT(m_ContainerStack.Num() > 0 && m_ContainerStack.Last().IsObject == isObject && m_HasWrittenKey == false, "Mismatched end of JSON array or object");
+
+	const bool hadValues = m_ContainerStack.Last().HasValues;
+	m_ContainerStack.RemoveAt(m_ContainerStack.Num() - 1);
+
+	// Empty arrays and objects stay on one line
+	if (hadValues)
+	{
+		WriteNewLine();
+	}
+
+	Append(isObject ? "}"_sv : "]"_sv);
+}
+
+void FJsonWriter::WriteNewLine()
+{
+	if (m_PrettyPrint == false)
+	{
+		return;
+	}
+
+	Append("\n"_sv);
+
+	int32 indent = m_ContainerStack.Num();
+	while (indent > 0)
+	{
+		const int32 numTabs = FMath::Min(indent, GIndentString.Length());
+		Append(GIndentString.GetChars(), numTabs);
+		indent -= numTabs;
+	}
+}
+
+void FJsonWriter::WriteQuotedString(const FStringView value)
+{
+	Append("\""_sv);
+
+	const char* position = value.GetChars();
+	const char* end = position + value.Length();
+	while (position < end)
+	{
+		// Most strings have nothing to escape, so runs of plain characters are appended all at once
+		const char* specialChar = Private::FindJsonStringSpecialChar(position, end);
+		Append(position, static_cast<int32>(specialChar - position));
+		if (specialChar == end)
+		{
+			break;
+		}
+
+		switch (*specialChar)
+		{
+		case '"':  Append("\\\""_sv); break;
+		case '\\': Append("\\\\"_sv); break;
+		case '\b': Append("\\b"_sv);  break;
+		case '\f': Append("\\f"_sv);  break;
+		case '\n': Append("\\n"_sv);  break;
+		case '\r': Append("\\r"_sv);  break;
+		case '\t': Append("\\t"_sv);  break;
+
+		default:
+		{
+			const uint8 ch = static_cast<uint8>(*specialChar);
+			const char escape[] = { '\\', 'u', '0', '0', GHexDigits[ch >> 4], GHexDigits[ch & 0xF] };
+			Append(escape, static_cast<int32>(sizeof(escape)));
+			break;
+		}
+		}
+
+		position = specialChar + 1;
+	}
+
+	Append("\""_sv);
+}
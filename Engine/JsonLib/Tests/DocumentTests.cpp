@@ -0,0 +1,210 @@
+#include "Engine/Logging.h"
+#include "HAL/Timer.h"
+#include "JSON/JsonParser.h"
+#include "Misc/StringBuilder.h"
+#include <gtest/gtest.h>
+
+TEST(DocumentTests, FromStringSimple)
+{
+	TErrorOr<FJsonDocument> parseResult = JSON::ParseDocumentString("[]"_sv);
+	ASSERT_FALSE(parseResult.IsError());
+	EXPECT_TRUE(parseResult.GetValue().GetRoot().IsArray());
+	EXPECT_EQ(parseResult.GetValue().GetRoot().Num(), 0);
+
+	parseResult = JSON::ParseDocumentString("{}"_sv);
+	ASSERT_FALSE(parseResult.IsError());
+	EXPECT_TRUE(parseResult.GetValue().GetRoot().IsObject());
+	EXPECT_EQ(parseResult.GetValue().GetRoot().Num(), 0);
+
+	parseResult = JSON::ParseDocumentString("null"_sv);
+	EXPECT_TRUE(parseResult.IsError());
+}
+
+TEST(DocumentTests, FromStringComplex)
+{
+	constexpr FStringView jsonString = "[\"string\", +42, -3.14, null, {\"key\": \"value\"}, true, 1.5e3]"_sv;
+
+	const TErrorOr<FJsonDocument> parseResult = JSON::ParseDocumentString(jsonString);
+	ASSERT_FALSE(parseResult.IsError());
+
+	const FJsonNode& root = parseResult.GetValue().GetRoot();
+	ASSERT_TRUE(root.IsArray());
+	ASSERT_EQ(root.Num(), 7);
+
+	const TSpan<const FJsonNode> array = root.AsArray();
+	EXPECT_TRUE(array[0].IsString());
+	EXPECT_EQ(array[0].AsStringView(), "string"_sv);
+	EXPECT_DOUBLE_EQ(array[1].AsNumber(), 42.0);
+	EXPECT_DOUBLE_EQ(array[2].AsNumber(), -3.14);
+	EXPECT_TRUE(array[3].IsNull());
+	EXPECT_TRUE(array[5].AsBool());
+	EXPECT_DOUBLE_EQ(array[6].AsNumber(), 1500.0);
+
+	const FJsonNode& object = array[4];
+	ASSERT_TRUE(object.IsObject());
+	EXPECT_EQ(object.Num(), 1);
+	EXPECT_TRUE(object.Contains("key"_sv));
+	EXPECT_FALSE(object.Contains("value"_sv));
+
+	const FJsonNode* keyValue = object.Find("key"_sv);
+	ASSERT_NE(keyValue, nullptr);
+	EXPECT_EQ(keyValue->AsStringView(), "value"_sv);
+
+	// Strings without escape sequences are views of the source text
+	EXPECT_EQ(array[0].AsStringView().GetChars(), jsonString.GetChars() + 2);
+}
+
+TEST(DocumentTests, Escapes)
+{
+	constexpr FStringView jsonString = R"({"tab\tkey": "line\nbreak \"quoted\" \\ \/ \u00e9 \ud83d\ude00 end"})"_sv;
+	constexpr FStringView expectedValue = "line\nbreak \"quoted\" \\ / \xC3\xA9 \xF0\x9F\x98\x80 end"_sv;
+
+	const TErrorOr<FJsonDocument> borrowedResult = JSON::ParseDocumentString(jsonString);
+	ASSERT_FALSE(borrowedResult.IsError());
+
+	const FJsonNode* borrowedValue = borrowedResult.GetValue().GetRoot().Find("tab\tkey"_sv);
+	ASSERT_NE(borrowedValue, nullptr);
+	EXPECT_EQ(borrowedValue->AsStringView(), expectedValue);
+
+	// Owned text is unescaped in place, so the unescaped strings live inside of the original text
+	FString ownedText { jsonString };
+	const TErrorOr<FJsonDocument> ownedResult = JSON::ParseDocumentString(MoveTemp(ownedText));
+	ASSERT_FALSE(ownedResult.IsError());
+
+	const TSpan<const FJsonMember> members = ownedResult.GetValue().GetRoot().AsObject();
+	ASSERT_EQ(members.Num(), 1);
+	EXPECT_EQ(members[0].Key, "tab\tkey"_sv);
+	EXPECT_EQ(members[0].Value.AsStringView(), expectedValue);
+	EXPECT_EQ(members[0].Value.AsStringView().GetChars() - members[0].Key.GetChars(), 12);
+}
+
+TEST(DocumentTests, SortedMembers)
+{
+	FStringBuilder builder;
+	builder.Append("{\"duplicate\": 1"_sv);
+	for (int32 idx = 99; idx >= 0; --idx)
+	{
+		builder.Append(", \"key{}\": {}"_sv, idx, idx);
+	}
+	builder.Append(", \"duplicate\": 2}"_sv);
+
+	const TErrorOr<FJsonDocument> parseResult = JSON::ParseDocumentString(builder.AsStringView());
+	ASSERT_FALSE(parseResult.IsError());
+
+	const FJsonNode& root = parseResult.GetValue().GetRoot();
+	ASSERT_EQ(root.Num(), 101);
+
+	const TSpan<const FJsonMember> members = root.AsObject();
+	for (int32 idx = 1; idx < members.Num(); ++idx)
+	{
+		EXPECT_LT(members[idx - 1].Key, members[idx].Key);
+	}
+
+	for (int32 idx = 0; idx < 100; ++idx)
+	{
+		const FString key = FString::Format("key{}"_sv, idx);
+		const FJsonNode* value = root.Find(key);
+		ASSERT_NE(value, nullptr);
+		EXPECT_DOUBLE_EQ(value->AsNumber(), static_cast<double>(idx));
+	}
+
+	// The last value for a duplicated key wins, the same as with FJsonObject
+	const FJsonNode* duplicate = root.Find("duplicate"_sv);
+	ASSERT_NE(duplicate, nullptr);
+	EXPECT_DOUBLE_EQ(duplicate->AsNumber(), 2.0);
+}
+
+TEST(DocumentTests, CommentsAndWhitespace)
+{
+	constexpr FStringView jsonString = "\xEF\xBB\xBF // Leading comment\r\n{ /* inline */ \"a\" : [ 1 , 2 ] // trailing\n}"_sv;
+
+	const TErrorOr<FJsonDocument> parseResult = JSON::ParseDocumentString(jsonString);
+	ASSERT_FALSE(parseResult.IsError());
+
+	const FJsonNode* value = parseResult.GetValue().GetRoot().Find("a"_sv);
+	ASSERT_NE(value, nullptr);
+	EXPECT_EQ(value->Num(), 2);
+}
+
+TEST(DocumentTests, InvalidText)
+{
+	EXPECT_TRUE(JSON::ParseDocumentString("[1, 2,]"_sv).IsError());
+	EXPECT_TRUE(JSON::ParseDocumentString("[1 2]"_sv).IsError());
+	EXPECT_TRUE(JSON::ParseDocumentString("{\"a\" 1}"_sv).IsError());
+	EXPECT_TRUE(JSON::ParseDocumentString("{a: 1}"_sv).IsError());
+	EXPECT_TRUE(JSON::ParseDocumentString("[\"unterminated]"_sv).IsError());
+	EXPECT_TRUE(JSON::ParseDocumentString("[\"new\nline\"]"_sv).IsError());
+	EXPECT_TRUE(JSON::ParseDocumentString("[\"\\q\"]"_sv).IsError());
+	EXPECT_TRUE(JSON::ParseDocumentString("[\"\\ud800\"]"_sv).IsError());
+	EXPECT_TRUE(JSON::ParseDocumentString("[1.]"_sv).IsError());
+	EXPECT_TRUE(JSON::ParseDocumentString("[nul]"_sv).IsError());
+	EXPECT_TRUE(JSON::ParseDocumentString("[/* unterminated"_sv).IsError());
+
+	FStringBuilder builder;
+	for (int32 idx = 0; idx < 1000; ++idx)
+	{
+		builder.Append("["_sv);
+	}
+	EXPECT_TRUE(JSON::ParseDocumentString(builder.AsStringView()).IsError());
+}
+
+TEST(DocumentTests, MatchesValueParser)
+{
+	constexpr FStringView jsonString = R"({"name": "manifest", "version": 3, "entries": [{"path": "a.png", "size": 1024}, {"path": "b.png", "size": 2048.5}], "enabled": false})"_sv;
+
+	const TErrorOr<FJsonValue> valueResult = JSON::ParseString(jsonString);
+	const TErrorOr<FJsonDocument> documentResult = JSON::ParseDocumentString(jsonString);
+	ASSERT_FALSE(valueResult.IsError());
+	ASSERT_FALSE(documentResult.IsError());
+
+	const FJsonValue converted = documentResult.GetValue().GetRoot().ToValue();
+	ASSERT_TRUE(converted.IsObject());
+
+	const FJsonObject* expectedObject = valueResult.GetValue().AsObject();
+	const FJsonObject* convertedObject = converted.AsObject();
+	EXPECT_EQ(convertedObject->Num(), expectedObject->Num());
+	EXPECT_EQ(convertedObject->Find("name"_sv)->AsStringView(), expectedObject->Find("name"_sv)->AsStringView());
+	EXPECT_DOUBLE_EQ(convertedObject->Find("version"_sv)->AsNumber(), expectedObject->Find("version"_sv)->AsNumber());
+	EXPECT_EQ(convertedObject->Find("enabled"_sv)->AsBool(), expectedObject->Find("enabled"_sv)->AsBool());
+
+	const FJsonArray* entries = convertedObject->Find("entries"_sv)->AsArray();
+	ASSERT_EQ(entries->Num(), 2);
+	EXPECT_DOUBLE_EQ(entries->At(1).AsObject()->Find("size"_sv)->AsNumber(), 2048.5);
+}
+
+// Only logs parse speeds, so it is left out of regular test runs
+TEST(DocumentTests, DISABLED_Throughput)
+{
+	FStringBuilder builder;
+	builder.Append("{\"assets\": ["_sv);
+	for (int32 idx = 0; idx < 20000; ++idx)
+	{
+		if (idx > 0)
+		{
+			builder.Append(", "_sv);
+		}
+		builder.Append("{"_sv);
+		builder.Append("\"path\": \"Content/Textures/Texture_{}.png\", \"size\": {}, \"scale\": {}.25, \"tags\": [\"texture\", \"level_{}\"], \"streamed\": {}"_sv,
+			idx, idx * 37, idx % 8, idx % 16, idx % 2 == 0 ? "true"_sv : "false"_sv);
+		builder.Append("}"_sv);
+	}
+	builder.Append("]}"_sv);
+
+	const FStringView jsonString = builder.AsStringView();
+	const double numMegabytes = static_cast<double>(jsonString.Length()) / (1024.0 * 1024.0);
+
+	FTimer timer = FTimer::Start();
+	const TErrorOr<FJsonValue> valueResult = JSON::ParseString(jsonString);
+	const double valueSeconds = timer.Stop().GetTotalSeconds();
+
+	timer.Restart();
+	const TErrorOr<FJsonDocument> documentResult = JSON::ParseDocumentString(jsonString);
+	const double documentSeconds = timer.Stop().GetTotalSeconds();
+
+	ASSERT_FALSE(valueResult.IsError());
+	ASSERT_FALSE(documentResult.IsError());
+	EXPECT_EQ(documentResult.GetValue().GetRoot().Find("assets"_sv)->Num(), 20000);
+
+	UM_LOG(Info, "JSON document parse: {} MB/s (FJsonValue: {} MB/s)", numMegabytes / documentSeconds, numMegabytes / valueSeconds);
+	UM_LOG(Info, "JSON document reserved {} KB for {} KB of text", documentResult.GetValue().GetNumBytesReserved() / 1024, jsonString.Length() / 1024);
+}
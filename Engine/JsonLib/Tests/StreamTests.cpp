@@ -0,0 +1,367 @@
+#include "HAL/File.h"
+#include "HAL/FileSystem.h"
+#include "JSON/JsonParser.h"
+#include "JSON/JsonReader.h"
+#include "JSON/JsonWriter.h"
+#include "Misc/StringBuilder.h"
+#include "Misc/StringParsing.h"
+#include <gtest/gtest.h>
+#include <limits>
+
+/**
+ * @brief Reads every event from a JSON reader into a string, so two readers can be compared.
+ *
+ * @param reader The reader.
+ * @param events The events that were read.
+ * @return True if the whole document was read, otherwise false.
+ */
+static bool ReadAllEvents(FJsonReader& reader, FStringBuilder& events)
+{
+	while (true)
+	{
+		const TErrorOr<EJsonEvent> event = reader.ReadNext();
+		if (event.IsError())
+		{
+			return false;
+		}
+
+		switch (event.GetValue())
+		{
+		case EJsonEvent::BeginArray:    events.Append("["_sv); break;
+		case EJsonEvent::EndArray:      events.Append("]"_sv); break;
+		case EJsonEvent::BeginObject:   events.Append("{"_sv); break;
+		case EJsonEvent::EndObject:     events.Append("}"_sv); break;
+		case EJsonEvent::Key:           events.Append("K<{}>"_sv, reader.GetString()); break;
+		case EJsonEvent::String:        events.Append("S<{}>"_sv, reader.GetString()); break;
+		case EJsonEvent::Number:        events.Append("N<{}>"_sv, reader.GetNumber()); break;
+		case EJsonEvent::Boolean:       events.Append(reader.GetBool() ? "T"_sv : "F"_sv); break;
+		case EJsonEvent::Null:          events.Append("Z"_sv); break;
+		case EJsonEvent::EndOfDocument: return true;
+		default:                        return false;
+		}
+	}
+}
+
+/**
+ * @brief Checks to see if a reader can read all of the given text.
+ *
+ * @param text The text.
+ * @return True if all of \p text could be read, otherwise false.
+ */
+static bool CanReadAll(const FStringView text)
+{
+	FJsonReader reader { text };
+	FStringBuilder events;
+	return ReadAllEvents(reader, events);
+}
+
+TEST(StreamTests, ReaderEvents)
+{
+	FJsonReader reader { R"({"name": "level", "count": 3, "scale": -1.5e2, "tags": ["a", "b\n"], "visible": true, "parent": null} trailing)"_sv };
+
+	const auto expectEvent = [&reader](const EJsonEvent expectedEvent)
+	{
+		const TErrorOr<EJsonEvent> event = reader.ReadNext();
+		ASSERT_FALSE(event.IsError());
+		EXPECT_EQ(event.GetValue(), expectedEvent);
+	};
+
+	expectEvent(EJsonEvent::BeginObject);
+	EXPECT_EQ(reader.GetDepth(), 1);
+
+	expectEvent(EJsonEvent::Key);
+	EXPECT_EQ(reader.GetString(), "name"_sv);
+	expectEvent(EJsonEvent::String);
+	EXPECT_EQ(reader.GetString(), "level"_sv);
+
+	expectEvent(EJsonEvent::Key);
+	expectEvent(EJsonEvent::Number);
+	EXPECT_DOUBLE_EQ(reader.GetNumber(), 3.0);
+
+	expectEvent(EJsonEvent::Key);
+	expectEvent(EJsonEvent::Number);
+	EXPECT_DOUBLE_EQ(reader.GetNumber(), -150.0);
+
+	expectEvent(EJsonEvent::Key);
+	EXPECT_EQ(reader.GetString(), "tags"_sv);
+	expectEvent(EJsonEvent::BeginArray);
+	EXPECT_EQ(reader.GetDepth(), 2);
+	expectEvent(EJsonEvent::String);
+	EXPECT_EQ(reader.GetString(), "a"_sv);
+	expectEvent(EJsonEvent::String);
+	EXPECT_EQ(reader.GetString(), "b\n"_sv);
+	expectEvent(EJsonEvent::EndArray);
+	EXPECT_EQ(reader.GetDepth(), 1);
+
+	expectEvent(EJsonEvent::Key);
+	expectEvent(EJsonEvent::Boolean);
+	EXPECT_TRUE(reader.GetBool());
+
+	expectEvent(EJsonEvent::Key);
+	EXPECT_EQ(reader.GetString(), "parent"_sv);
+	expectEvent(EJsonEvent::Null);
+
+	expectEvent(EJsonEvent::EndObject);
+	EXPECT_EQ(reader.GetDepth(), 0);
+
+	// Anything after the root value is ignored
+	expectEvent(EJsonEvent::EndOfDocument);
+	expectEvent(EJsonEvent::EndOfDocument);
+}
+
+TEST(StreamTests, ReaderSmallChunks)
+{
+	constexpr FStringView fileName = "ReaderSmallChunks.json"_sv;
+
+	FStringBuilder builder;
+	builder.Append("\xEF\xBB\xBF// Leading comment\n[\n"_sv);
+	for (int32 idx = 0; idx < 200; ++idx)
+	{
+		builder.Append("\t{"_sv);
+		builder.Append(" /* entry */ \"id\": {}, \"value\": -{}.{}e-3, \"escaped\": \"tab\\t\\u00e9 \\\"{}\\\"\", \"flag\": {}, \"none\": null "_sv,
+			idx, idx * 7919, idx, idx, idx % 3 == 0 ? "true"_sv : "false"_sv);
+		builder.Append("},\n"_sv);
+	}
+
+	// Strings and numbers that are longer than a chunk have to grow the chunk
+	builder.Append("\t\""_sv);
+	for (int32 idx = 0; idx < 100; ++idx)
+	{
+		builder.Append("long string \\n "_sv);
+	}
+	builder.Append("\",\n\t12345678901234567890.5\n]"_sv);
+
+	const FStringView jsonString = builder.AsStringView();
+	ASSERT_FALSE(FFile::WriteText(fileName, jsonString).IsError());
+
+	FJsonReader textReader { jsonString };
+	FStringBuilder textEvents;
+	ASSERT_TRUE(ReadAllEvents(textReader, textEvents));
+
+	for (const int32 chunkSize : { 1, 7, 64, 4096 })
+	{
+		FJsonReader streamReader { FFileSystem::OpenRead(fileName), chunkSize };
+		FStringBuilder streamEvents;
+		ASSERT_TRUE(ReadAllEvents(streamReader, streamEvents));
+		EXPECT_EQ(streamEvents.AsStringView(), textEvents.AsStringView());
+	}
+
+	EXPECT_FALSE(FFile::Delete(fileName).IsError());
+
+	// Readers whose file stream could not be opened fail instead of reading nothing
+	FJsonReader missingFileReader { FFileSystem::OpenRead("ReaderSmallChunks.missing.json"_sv) };
+	EXPECT_TRUE(missingFileReader.ReadNext().IsError());
+}
+
+TEST(StreamTests, ReaderInvalidText)
+{
+	EXPECT_TRUE(CanReadAll("[1, {\"a\": [true, false, null]}, \"\\ud83d\\ude00\"]"_sv));
+
+	EXPECT_FALSE(CanReadAll("null"_sv));
+	EXPECT_FALSE(CanReadAll("[1, 2,]"_sv));
+	EXPECT_FALSE(CanReadAll("[1 2]"_sv));
+	EXPECT_FALSE(CanReadAll("{\"a\" 1}"_sv));
+	EXPECT_FALSE(CanReadAll("{\"a\": 1,}"_sv));
+	EXPECT_FALSE(CanReadAll("{a: 1}"_sv));
+	EXPECT_FALSE(CanReadAll("[1}"_sv));
+	EXPECT_FALSE(CanReadAll("[\"unterminated]"_sv));
+	EXPECT_FALSE(CanReadAll("[\"new\nline\"]"_sv));
+	EXPECT_FALSE(CanReadAll("[\"\\q\"]"_sv));
+	EXPECT_FALSE(CanReadAll("[\"\\ud800\"]"_sv));
+	EXPECT_FALSE(CanReadAll("[1.]"_sv));
+	EXPECT_FALSE(CanReadAll("[1.2.3]"_sv));
+	EXPECT_FALSE(CanReadAll("[nul]"_sv));
+	EXPECT_FALSE(CanReadAll("[/* unterminated"_sv));
+	EXPECT_FALSE(CanReadAll("[1, 2"_sv));
+
+	FStringBuilder builder;
+	for (int32 idx = 0; idx < 1000; ++idx)
+	{
+		builder.Append("["_sv);
+	}
+	EXPECT_FALSE(CanReadAll(builder.AsStringView()));
+
+	// Readers stop for good after an error
+	FJsonReader reader { "[1 2]"_sv };
+	FStringBuilder events;
+	EXPECT_FALSE(ReadAllEvents(reader, events));
+	EXPECT_TRUE(reader.ReadNext().IsError());
+}
+
+TEST(StreamTests, ReaderSkipValue)
+{
+	FJsonReader reader { R"({"skipped": {"a": [1, 2, {"b": []}], "c": "d"}, "array": [[1], [2, 3]], "kept": 42})"_sv };
+
+	ASSERT_EQ(reader.ReadNext().GetValue(), EJsonEvent::BeginObject);
+
+	// Skipping a key skips its value
+	ASSERT_EQ(reader.ReadNext().GetValue(), EJsonEvent::Key);
+	EXPECT_EQ(reader.GetString(), "skipped"_sv);
+	ASSERT_FALSE(reader.SkipValue().IsError());
+	EXPECT_EQ(reader.GetEvent(), EJsonEvent::EndObject);
+	EXPECT_EQ(reader.GetDepth(), 1);
+
+	// Skipping the start of an array skips to its end
+	ASSERT_EQ(reader.ReadNext().GetValue(), EJsonEvent::Key);
+	ASSERT_EQ(reader.ReadNext().GetValue(), EJsonEvent::BeginArray);
+	ASSERT_FALSE(reader.SkipValue().IsError());
+	EXPECT_EQ(reader.GetEvent(), EJsonEvent::EndArray);
+	EXPECT_EQ(reader.GetDepth(), 1);
+
+	ASSERT_EQ(reader.ReadNext().GetValue(), EJsonEvent::Key);
+	EXPECT_EQ(reader.GetString(), "kept"_sv);
+	ASSERT_EQ(reader.ReadNext().GetValue(), EJsonEvent::Number);
+	EXPECT_DOUBLE_EQ(reader.GetNumber(), 42.0);
+	ASSERT_EQ(reader.ReadNext().GetValue(), EJsonEvent::EndObject);
+	ASSERT_EQ(reader.ReadNext().GetValue(), EJsonEvent::EndOfDocument);
+}
+
+TEST(StreamTests, WriterCompact)
+{
+	FStringBuilder builder;
+	{
+		FJsonWriter writer { builder };
+		writer.BeginObject();
+		writer.WriteKey("name"_sv);
+		writer.WriteString("quote \" backslash \\ newline \n bell \x07 \xC3\xA9"_sv);
+		writer.WriteKey("values"_sv);
+		writer.BeginArray();
+		writer.WriteNumber(1.0);
+		writer.WriteNumber(-2.5);
+		writer.WriteBool(true);
+		writer.WriteNull();
+		writer.BeginArray();
+		writer.EndArray();
+		writer.EndArray();
+		writer.WriteKey("empty"_sv);
+		writer.BeginObject();
+		writer.EndObject();
+		writer.EndObject();
+		EXPECT_TRUE(writer.IsComplete());
+	}
+
+	EXPECT_EQ(builder.AsStringView(), R"({"name":"quote \" backslash \\ newline \n bell \u0007 )" "\xC3\xA9" R"(","values":[1,-2.5,true,null,[]],"empty":{}})"_sv);
+
+	const TErrorOr<FJsonDocument> parseResult = JSON::ParseDocumentString(builder.AsStringView());
+	ASSERT_FALSE(parseResult.IsError());
+	EXPECT_EQ(parseResult.GetValue().GetRoot().Find("name"_sv)->AsStringView(), "quote \" backslash \\ newline \n bell \x07 \xC3\xA9"_sv);
+}
+
+TEST(StreamTests, WriterPrettyPrint)
+{
+	FStringBuilder builder;
+	FJsonWriter writer { builder, true };
+	writer.BeginObject();
+	writer.WriteKey("a"_sv);
+	writer.WriteNumber(1.0);
+	writer.WriteKey("b"_sv);
+	writer.BeginArray();
+	writer.WriteString("c"_sv);
+	writer.BeginObject();
+	writer.EndObject();
+	writer.EndArray();
+	writer.EndObject();
+
+	EXPECT_EQ(builder.AsStringView(), "{\n\t\"a\": 1,\n\t\"b\": [\n\t\t\"c\",\n\t\t{}\n\t]\n}"_sv);
+}
+
+TEST(StreamTests, WriterNumbers)
+{
+	const auto writeNumber = [](const double value)
+	{
+		FStringBuilder builder;
+		FJsonWriter writer { builder };
+		writer.BeginArray();
+		writer.WriteNumber(value);
+		writer.EndArray();
+
+		const FStringView text = builder.AsStringView();
+		return FString { FStringView { text.GetChars() + 1, text.Length() - 2 } };
+	};
+
+	// Numbers are written in the shortest form that parses back to the same value
+	EXPECT_EQ(writeNumber(0.1), "0.1"_sv);
+	EXPECT_EQ(writeNumber(42.0), "42"_sv);
+	EXPECT_EQ(writeNumber(-1.5), "-1.5"_sv);
+	EXPECT_EQ(writeNumber(1e300), "1e+300"_sv);
+	EXPECT_EQ(writeNumber(std::numeric_limits<double>::infinity()), "null"_sv);
+	EXPECT_EQ(writeNumber(std::numeric_limits<double>::quiet_NaN()), "null"_sv);
+
+	const double values[] = { 1.0 / 3.0, 2.0 / 3.0, 123456789.123456789, 9007199254740993.0, 5e-324, 1.7976931348623157e308, -0.0, 3.14159265358979 };
+	for (const double value : values)
+	{
+		const FString text = writeNumber(value);
+		const TOptional<double> parsedValue = FStringParser::TryParseDouble(text.AsStringView());
+		ASSERT_TRUE(parsedValue.HasValue()) << text.GetChars();
+		EXPECT_EQ(parsedValue.GetValue(), value) << text.GetChars();
+	}
+}
+
+TEST(StreamTests, WriterFileRoundTrip)
+{
+	constexpr FStringView fileName = "WriterFileRoundTrip.json"_sv;
+	constexpr int32 numEntries = 5000;
+
+	{
+		TSharedPtr<IFileStream> fileStream = FFileSystem::OpenWrite(fileName);
+		ASSERT_TRUE(fileStream.IsValid());
+
+		FJsonWriter writer { fileStream, true, 256 };
+		writer.BeginObject();
+		writer.WriteKey("entries"_sv);
+		writer.BeginArray();
+		for (int32 idx = 0; idx < numEntries; ++idx)
+		{
+			writer.BeginObject();
+			writer.WriteKey("id"_sv);
+			writer.WriteNumber(static_cast<double>(idx));
+			writer.WriteKey("ratio"_sv);
+			writer.WriteNumber(static_cast<double>(idx) / 7.0);
+			writer.WriteKey("path"_sv);
+			const FString path = FString::Format("Content/Levels/Level_{}.json"_sv, idx);
+			writer.WriteString(path);
+			writer.EndObject();
+		}
+		writer.EndArray();
+		writer.EndObject();
+	}
+
+	const TErrorOr<FJsonDocument> parseResult = JSON::ParseDocumentFile(fileName);
+	ASSERT_FALSE(parseResult.IsError());
+
+	const FJsonNode* entries = parseResult.GetValue().GetRoot().Find("entries"_sv);
+	ASSERT_NE(entries, nullptr);
+	ASSERT_EQ(entries->Num(), numEntries);
+	for (int32 idx = 0; idx < numEntries; ++idx)
+	{
+		const FJsonNode& entry = entries->AsArray()[idx];
+		ASSERT_EQ(entry.Find("ratio"_sv)->AsNumber(), static_cast<double>(idx) / 7.0);
+		ASSERT_EQ(FString::Format("Content/Levels/Level_{}.json"_sv, idx), entry.Find("path"_sv)->AsStringView());
+	}
+
+	// Values and documents write back out to the same text
+	FStringBuilder documentText;
+	{
+		FJsonWriter writer { documentText };
+		writer.WriteNode(parseResult.GetValue().GetRoot());
+	}
+
+	const TErrorOr<FJsonValue> valueResult = JSON::ParseString(documentText.AsStringView());
+	ASSERT_FALSE(valueResult.IsError());
+
+	FStringBuilder valueText;
+	{
+		FJsonWriter writer { valueText };
+		writer.WriteValue(valueResult.GetValue());
+	}
+
+	const TErrorOr<FJsonDocument> valueDocumentResult = JSON::ParseDocumentString(valueText.AsStringView());
+	ASSERT_FALSE(valueDocumentResult.IsError());
+	EXPECT_EQ(valueDocumentResult.GetValue().GetRoot().Find("entries"_sv)->Num(), numEntries);
+
+	FJsonReader reader { FFileSystem::OpenRead(fileName) };
+	FStringBuilder events;
+	EXPECT_TRUE(ReadAllEvents(reader, events));
+
+	EXPECT_FALSE(FFile::Delete(fileName).IsError());
+}
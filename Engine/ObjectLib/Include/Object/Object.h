@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Containers/Name.h"
 #include "Containers/String.h"
 #include "Containers/StringView.h"
 #include "Memory/MemoryMacros.h"
@@ -13,6 +14,7 @@
 #include "Object/WeakObjectPtr.h"
 #include "Templates/IsBaseOf.h"
 #include "Templates/IsConstructible.h"
+#include <atomic>
 #include "Object.Generated.h"
 
 class FStringBuilder;
@@ -33,6 +35,11 @@ protected:
 
 public:
 
+	/**
+	 * @brief The oldest garbage collector age an object can reach before it has to be promoted to the old generation.
+	 */
+	static constexpr int32 MaxGarbageCollectorAge = 15;
+
 	/**
 	 * @brief Destroys this object.
 	 */
@@ -70,7 +77,7 @@ public:
 	 *
 	 * @return This object's name.
 	 */
-	[[nodiscard]] FStringView GetName() const;
+	[[nodiscard]] FName GetName() const;
 
 	/**
 	 * @brief Gets this object's fully qualified path.
@@ -100,13 +107,23 @@ public:
 	}
 
 	/**
-	 * @brief Checks to see if this object has been visited by the garbage collector.
+	 * @brief Gets the number of minor garbage collections this object has survived while in the young generation.
+	 *
+	 * @return The number of minor garbage collections this object has survived.
+	 */
+	[[nodiscard]] int32 GetGarbageCollectorAge() const
+	{
+		return static_cast<int32>(m_GarbageCollectorAge);
+	}
+
+	/**
+	 * @brief Gets this object's garbage collector mark bit. Which value means "marked" alternates between collections.
 	 *
-	 * @return True if this object has been visited by the garbage collector, otherwise false.
+	 * @return This object's garbage collector mark bit.
 	 */
-	[[nodiscard]] bool HasBeenVisitedByGarbageCollector() const
+	[[nodiscard]] bool GetGarbageCollectorMark() const
 	{
-		return m_VisitedByGarbageCollector;
+		return m_GarbageCollectorMark.load(std::memory_order_relaxed);
 	}
 
 	/**
@@ -129,6 +146,28 @@ public:
 		return IsA(ObjectType::StaticType());
 	}
 
+	/**
+	 * @brief Checks to see if this object has been promoted to the old generation, meaning only major garbage
+	 *        collections will consider it.
+	 *
+	 * @return True if this object is in the old generation, otherwise false.
+	 */
+	[[nodiscard]] bool IsInOldGeneration() const
+	{
+		return m_InOldGeneration;
+	}
+
+	/**
+	 * @brief Checks to see if this object is in the garbage collector's remembered set, meaning minor garbage
+	 *        collections treat it as a root.
+	 *
+	 * @return True if this object is in the remembered set, otherwise false.
+	 */
+	[[nodiscard]] bool IsInRememberedSet() const
+	{
+		return m_InRememberedSet;
+	}
+
 	/**
 	 * @brief Checks to see if this object is marked for garbage collection.
 	 *
@@ -151,6 +190,34 @@ public:
 	 */
 	void NotifyDestroyed(TBadge<FObjectHeap>);
 
+	/**
+	 * @brief Sets the number of minor garbage collections this object has survived while in the young generation.
+	 *
+	 * @param age The new age.
+	 */
+	void SetGarbageCollectorAge(TBadge<FObjectHeap>, int32 age);
+
+	/**
+	 * @brief Sets this object's garbage collector mark bit.
+	 *
+	 * @param mark The new mark bit.
+	 */
+	void SetGarbageCollectorMark(TBadge<FObjectHeap>, bool mark);
+
+	/**
+	 * @brief Sets whether or not this object is in the old generation.
+	 *
+	 * @param inOldGeneration True to promote this object to the old generation, false to return it to the young one.
+	 */
+	void SetInOldGeneration(TBadge<FObjectHeap>, bool inOldGeneration);
+
+	/**
+	 * @brief Sets whether or not this object is in the garbage collector's remembered set.
+	 *
+	 * @param inRememberedSet True if this object has been added to the remembered set, false if it has been removed.
+	 */
+	void SetInRememberedSet(TBadge<FObjectHeap>, bool inRememberedSet);
+
 	/**
 	 * @brief Sets whether or not this object has been marked for garbage collection.
 	 *
@@ -163,7 +230,7 @@ public:
 	 *
 	 * @param name The new name.
 	 */
-	void SetName(TBadge<FObjectHeap>, FString name);
+	void SetName(TBadge<FObjectHeap>, FName name);
 
 	/**
 	 * @brief Sets this object's parent.
@@ -172,13 +239,6 @@ public:
 	 */
 	void SetParent(TBadge<FObjectHeap>, FObjectPtr parent);
 
-	/**
-	 * @brief Sets whether or not this object has been marked by the garbage collector.
-	 *
-	 * @param marked True to mark this object as visited by the garbage collector, false to unmark it.
-	 */
-	void SetVisitedByGarbageCollector(TBadge<FObjectHeap>, bool visited);
-
 	/**
 	 * @brief Sets whether or not this object should be kept alive during garbage collection.
 	 *
@@ -193,6 +253,14 @@ public:
 	 */
 	[[nodiscard]] bool ShouldKeepAlive() const;
 
+	/**
+	 * @brief Attempts to set this object's garbage collector mark bit. Safe to call from multiple threads at once.
+	 *
+	 * @param mark The new mark bit.
+	 * @return True if this call changed the mark bit, false if it was already set to \p mark.
+	 */
+	[[nodiscard]] bool TrySetGarbageCollectorMark(TBadge<FObjectHeap>, bool mark);
+
 #if WITH_TESTING
 	/**
 	 * @brief Gets the offset to the name property for the given object type.
@@ -255,7 +323,9 @@ protected:
 
 	/**
 	 * @brief "Manually" visits referenced objects. This is a workaround until the header tool supports
-	 *        struct types that themselves have object references.
+	 *        struct types that themselves have object references. References visited here that live outside of this
+	 *        object must be held by an array or hash map property, otherwise minor garbage collections won't know to
+	 *        look for them.
 	 *
 	 * @param visitor The visitor.
 	 */
@@ -274,12 +344,17 @@ private:
 	FObjectPtr m_Parent;
 
 	UM_PROPERTY()
-	FString m_Name;
+	FName m_Name;
 
 	uint64 m_ObjectHash = INVALID_HASH;
 	uint64 m_KeepAlive : 1 = false;
 	uint64 m_MarkedForGarbageCollection : 1 = false;
-	uint64 m_VisitedByGarbageCollector : 1 = false;
+	uint64 m_InOldGeneration : 1 = false;
+	uint64 m_InRememberedSet : 1 = false;
+	uint64 m_GarbageCollectorAge : 4 = 0;
+
+	// Kept out of the bit field above because it can be set by multiple threads at once during a parallel mark
+	std::atomic<bool> m_GarbageCollectorMark = false;
 
 	// TODO Eventually may need a way to keep an object alive even though it has no references
 };
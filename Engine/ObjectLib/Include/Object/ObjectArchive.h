@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/Span.h"
+#include "Containers/StringView.h"
+#include "Engine/Error.h"
+#include "Object/ObjectPtr.h"
+
+/**
+ * @brief Defines a way to save graphs of objects to, and load them from, a compact binary archive.
+ *
+ * An archive holds the objects it was given along with every object they reference, directly or indirectly, through
+ * object pointer properties or their parent. Weak object pointers are only kept if the object they point to is in the
+ * archive too. Properties are read and written using each class's reflection data, with neighbouring properties that
+ * are plain data copied as a single block of bytes.
+ */
+class FObjectArchive final
+{
+public:
+
+	/**
+	 * @brief The version of the archive format. Archives saved with any other version cannot be loaded.
+	 */
+	static constexpr uint32 Version = 1;
+
+	/**
+	 * @brief Loads objects from an archive.
+	 *
+	 * Objects are created through the object heap, so their Created function is called before their properties are
+	 * loaded. Classes are looked up by name in the type registry, and loading fails if any class in the archive is not
+	 * registered or has had its properties changed since the archive was saved.
+	 *
+	 * @param bytes The archive's bytes.
+	 * @return The loaded objects that were given when the archive was saved, in the same order they were given in.
+	 */
+	[[nodiscard]] static TErrorOr<TArray<FObjectPtr>> Load(TSpan<const uint8> bytes);
+
+	/**
+	 * @brief Loads objects from an archive file.
+	 *
+	 * @param filePath The path to the archive file.
+	 * @return The loaded objects that were given when the archive was saved, in the same order they were given in.
+	 */
+	[[nodiscard]] static TErrorOr<TArray<FObjectPtr>> LoadFromFile(FStringView filePath);
+
+	/**
+	 * @brief Saves objects, and every object they reference, to an archive.
+	 *
+	 * @param objects The objects to save.
+	 * @param bytes The array to write the archive to. Any existing contents are discarded.
+	 * @return The error, if one occurred.
+	 */
+	[[nodiscard]] static TErrorOr<void> Save(TSpan<const FObjectPtr> objects, TArray<uint8>& bytes);
+
+	/**
+	 * @brief Saves objects, and every object they reference, to an archive file.
+	 *
+	 * @param filePath The path to the archive file.
+	 * @param objects The objects to save.
+	 * @return The error, if one occurred.
+	 */
+	[[nodiscard]] static TErrorOr<void> SaveToFile(FStringView filePath, TSpan<const FObjectPtr> objects);
+};
\ No newline at end of file
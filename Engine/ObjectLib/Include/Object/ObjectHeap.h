@@ -3,6 +3,7 @@
 #include "Containers/String.h"
 #include "Containers/StringView.h"
 #include "Engine/Error.h"
+#include "HAL/TimeSpan.h"
 #include "Meta/ClassInfo.h"
 #include "Misc/Badge.h"
 #include "Object/ObjectHeapVisitor.h"
@@ -12,6 +13,42 @@
 
 class UObject;
 
+/**
+ * @brief Defines the settings used by the incremental garbage collector.
+ */
+struct FGarbageCollectorSettings
+{
+	/**
+	 * @brief The maximum amount of time a single incremental garbage collection step may take.
+	 */
+	FTimeSpan StepTimeBudget = FTimeSpan::FromMilliseconds(1.0);
+
+	/**
+	 * @brief The number of bytes that must be allocated for objects since the last collection before a new collection
+	 *        is started by an incremental step. Bytes reclaimed by minor collections are paid back off of this debt.
+	 */
+	int64 AllocationDebtThreshold = 1024 * 1024;
+
+	/**
+	 * @brief The number of bytes that must be allocated for young objects since the last minor collection before a new
+	 *        minor collection is run by an incremental step.
+	 */
+	int64 NurserySize = 256 * 1024;
+
+	/**
+	 * @brief The number of minor collections a young object must survive before it is promoted to the old generation.
+	 *        Cannot be larger than UObject::MaxGarbageCollectorAge.
+	 */
+	int32 NumMinorCollectionsBeforePromotion = 2;
+
+	/**
+	 * @brief The number of threads that trace objects while marking, including the thread running the collection.
+	 *        Values greater than one mark in parallel using a thread pool owned by the object heap, and zero uses one
+	 *        thread per logical processor.
+	 */
+	int32 NumMarkThreads = 1;
+};
+
 /**
  * @brief Defines a way to access the object heap.
  */
@@ -47,10 +84,24 @@ public:
 	static FObjectPtr AllocateObject(const FClassInfo* objectClass, FObjectPtr parent, FStringView name, const FObjectCreationContext& context);
 
 	/**
-	 * @brief Attempts to collect all garbage from the object heap.
+	 * @brief Collects all garbage from the object heap, finishing any in-progress incremental collection first. Every
+	 *        object that survives a major collection like this one is promoted to the old generation.
 	 */
 	static void CollectGarbage();
 
+	/**
+	 * @brief Performs one time-budgeted step of garbage collection. A new collection is only started once enough memory
+	 *        has been allocated for objects since the last collection finished. While no collection is in progress, a
+	 *        minor collection is run first if the nursery has filled up.
+	 */
+	static void CollectGarbageIncrementally();
+
+	/**
+	 * @brief Collects garbage from the young generation only. Objects in the old generation are assumed to be alive, and
+	 *        the only ones traced are those in the remembered set. Does nothing while a collection is in progress.
+	 */
+	static void CollectYoungGarbage();
+
 	/**
 	 * @brief Destructs an object.
 	 *
@@ -66,16 +117,56 @@ public:
 		object->~ObjectTypeToDestruct();
 	}
 
+	/**
+	 * @brief Gets the settings used by the incremental garbage collector.
+	 *
+	 * @return The settings used by the incremental garbage collector.
+	 */
+	[[nodiscard]] static const FGarbageCollectorSettings& GetGarbageCollectorSettings();
+
 	/**
 	 * @brief Initializes the object heap.
 	 */
 	[[nodiscard]] static TErrorOr<void> Initialize(TBadge<class FEngineInitializer>);
 
+	/**
+	 * @brief Checks to see if a garbage collection is currently in progress.
+	 *
+	 * @return True if a garbage collection is currently in progress, otherwise false.
+	 */
+	[[nodiscard]] static bool IsCollectingGarbage();
+
+	/**
+	 * @brief Sets the settings used by the incremental garbage collector.
+	 *
+	 * @param settings The new settings.
+	 */
+	static void SetGarbageCollectorSettings(const FGarbageCollectorSettings& settings);
+
 	/**
 	 * @brief Shuts down the object heap, destroying all objects that have been created.
 	 */
 	static void Shutdown(TBadge<class FEngineInitializer>);
 
+	/**
+	 * @brief Notifies the garbage collector that a reference to an object has been written somewhere. While a
+	 *        collection is marking, this ensures the object is kept alive even if it was stored into an object that
+	 *        has already been traced. Once marking has finished this does nothing, so objects that have already been
+	 *        found unreachable can never be brought back to life.
+	 *
+	 * @param object The object being referenced.
+	 */
+	static void WriteBarrier(UObject* object);
+
+	/**
+	 * @brief Notifies the garbage collector that a reference to an object has been written somewhere. While no
+	 *        collection is in progress, this records where young objects are referenced from so that minor collections
+	 *        do not need to trace the old generation.
+	 *
+	 * @param objectPtr The pointer to the object being referenced. Its address is the location that was written to.
+	 */
+	static void WriteBarrier(const FObjectPtr& objectPtr);
+
 private:
 
 	/**
@@ -115,6 +206,7 @@ private:
 	 *
 	 * @param object The object.
 	 * @param name The desired name.
+	 * @param nameCounter The number to give the name to keep it unique.
 	 */
-	static void SetObjectName(UObject* object, FStringView name, uint64 nameCounter);
+	static void SetObjectName(UObject* object, FStringView name, uint32 nameCounter);
 };
\ No newline at end of file
@@ -21,14 +21,25 @@ class FObjectPtr
 {
 public:
 
-	UM_DEFAULT_COPY(FObjectPtr);
-	UM_DEFAULT_MOVE(FObjectPtr);
-
 	/**
 	 * @brief Sets default values for this object pointer's properties.
 	 */
 	FObjectPtr() = default;
 
+	/**
+	 * @brief Copies another object pointer.
+	 *
+	 * @param other The other object pointer.
+	 */
+	FObjectPtr(const FObjectPtr& other);
+
+	/**
+	 * @brief Copies another object pointer.
+	 *
+	 * @param other The other object pointer.
+	 */
+	FObjectPtr(FObjectPtr&& other) noexcept;
+
 	/**
 	 * @brief Sets default values for this object pointer's properties.
 	 */
@@ -106,6 +117,22 @@ public:
 	 */
 	[[nodiscard]] UObject* operator->() const;
 
+	/**
+	 * @brief Copies another object pointer.
+	 *
+	 * @param other The other object pointer.
+	 * @return This object pointer.
+	 */
+	FObjectPtr& operator=(const FObjectPtr& other);
+
+	/**
+	 * @brief Copies another object pointer.
+	 *
+	 * @param other The other object pointer.
+	 * @return This object pointer.
+	 */
+	FObjectPtr& operator=(FObjectPtr&& other) noexcept;
+
 	/**
 	 * @brief Checks to see if this object pointer is the same as another.
 	 *
@@ -130,6 +157,11 @@ public:
 
 private:
 
+	/**
+	 * @brief Notifies the garbage collector that this object pointer has been written to.
+	 */
+	void ApplyWriteBarrier() const;
+
 	class FObjectHeader* m_ObjectHeader = nullptr;
 	uint64 m_ObjectHash = INVALID_HASH;
 };
@@ -46,7 +46,7 @@ uint64 UObject::GetHash() const
 	return m_ObjectHash;
 }
 
-FStringView UObject::GetName() const
+FName UObject::GetName() const
 {
 	return m_Name;
 }
@@ -78,16 +78,38 @@ void UObject::NotifyDestroyed(TBadge<FObjectHeap>)
 	Destroyed();
 }
 
+void UObject::SetGarbageCollectorAge(TBadge<FObjectHeap>, const int32 age)
+{
+	UM_ASSERT(age >= 0 && age <= MaxGarbageCollectorAge, "Garbage collector age is out of range");
+
+	m_GarbageCollectorAge = static_cast<uint64>(age);
+}
+
+void UObject::SetGarbageCollectorMark(TBadge<FObjectHeap>, const bool mark)
+{
+	m_GarbageCollectorMark.store(mark, std::memory_order_relaxed);
+}
+
+void UObject::SetInOldGeneration(TBadge<FObjectHeap>, const bool inOldGeneration)
+{
+	m_InOldGeneration = inOldGeneration;
+}
+
+void UObject::SetInRememberedSet(TBadge<FObjectHeap>, const bool inRememberedSet)
+{
+	m_InRememberedSet = inRememberedSet;
+}
+
 void UObject::SetMarkedForGarbageCollection(TBadge<FObjectHeap>, const bool marked)
 {
 	m_MarkedForGarbageCollection = marked;
 }
 
-void UObject::SetName(TBadge<FObjectHeap>, FString newName)
+void UObject::SetName(TBadge<FObjectHeap>, const FName newName)
 {
-	UM_ASSERT(m_Name.IsEmpty(), "Attempting to set object name when it is already set!");
+	UM_ASSERT(m_Name.IsNone(), "Attempting to set object name when it is already set!");
 
-	m_Name = MoveTemp(newName);
+	m_Name = newName;
 	m_ObjectHash = GetHashCode(m_Name);
 }
 
@@ -97,14 +119,15 @@ void UObject::SetParent(TBadge<FObjectHeap>, FObjectPtr newParent)
 	m_Parent = MoveTemp(newParent);
 }
 
-void UObject::SetVisitedByGarbageCollector(TBadge<FObjectHeap>, const bool visited)
-{
-	m_VisitedByGarbageCollector = visited;
-}
-
 void UObject::SetShouldKeepAlive(const bool keepAlive)
 {
 	m_KeepAlive = keepAlive;
+
+	// Objects that become roots in the middle of a collection still need to have their references traced
+	if (keepAlive)
+	{
+		FObjectHeap::WriteBarrier(this);
+	}
 }
 
 bool UObject::ShouldKeepAlive() const
@@ -112,6 +135,17 @@ bool UObject::ShouldKeepAlive() const
 	return m_KeepAlive;
 }
 
+bool UObject::TrySetGarbageCollectorMark(TBadge<FObjectHeap>, const bool mark)
+{
+	// Check before exchanging so that objects that are already marked don't bounce their cache line between threads
+	if (m_GarbageCollectorMark.load(std::memory_order_relaxed) == mark)
+	{
+		return false;
+	}
+
+	return m_GarbageCollectorMark.exchange(mark, std::memory_order_acq_rel) != mark;
+}
+
 void UObject::Created(const FObjectCreationContext& context)
 {
 	(void)context;
@@ -134,5 +168,5 @@ void UObject::AppendPathToStringBuilder(FStringBuilder& builder) const
 	}
 
 	builder.Append("/"_sv);
-	builder.Append(m_Name);
+	m_Name.AppendToStringBuilder(builder);
 }
\ No newline at end of file
@@ -0,0 +1,904 @@
+#include "Containers/HashMap.h"
+#include "HAL/File.h"
+#include "Memory/Memory.h"
+#include "Meta/ArrayTypeInfo.h"
+#include "Meta/EnumInfo.h"
+#include "Meta/HashMapTypeInfo.h"
+#include "Meta/PropertyInfo.h"
+#include "Meta/TypeRegistry.h"
+#include "Object/Object.h"
+#include "Object/ObjectArchive.h"
+#include "Object/ObjectHeap.h"
+#include "Object/WeakObjectPtr.h"
+
+/**
+ * @brief Defines the kinds of operations used to save and load a value.
+ */
+enum class EArchiveOpType : uint8
+{
+	CopyBytes,
+	String,
+	ObjectPtr,
+	WeakObjectPtr,
+	Array,
+	HashMap
+};
+
+/**
+ * @brief Defines a single operation used to save and load part of a value.
+ */
+struct FArchiveOp
+{
+	const FTypeInfo* ContainerType = nullptr;
+	int32 Offset = 0;
+	int32 NumBytes = 0;
+	int32 ElementLayoutIndex = INDEX_NONE;
+	int32 ValueLayoutIndex = INDEX_NONE;
+	EArchiveOpType Type = EArchiveOpType::CopyBytes;
+};
+
+/**
+ * @brief Defines the operations used to save and load every property of a type.
+ */
+struct FArchiveLayout
+{
+	TArray<FArchiveOp> Ops;
+	uint64 Hash = 0;
+	bool IsComplete = false;
+	bool IsPlainData = true;
+};
+
+// Identifies the start of an object archive ("UMOA")
+static constexpr uint32 GObjectArchiveMagic = 0x414F4D55;
+
+/**
+ * @brief Checks to see if a type is a primitive that can be saved by copying its bytes.
+ *
+ * @param type The type.
+ * @return True if \p type can be saved by copying its bytes, otherwise false.
+ */
+static bool IsPrimitiveType(const FTypeInfo* type)
+{
+	static const TStaticArray<const FTypeInfo*, 15> GPrimitiveTypes
+	{{
+		GetType<bool>(),
+		GetType<int8>(),
+		GetType<int16>(),
+		GetType<int32>(),
+		GetType<int64>(),
+		GetType<uint8>(),
+		GetType<uint16>(),
+		GetType<uint32>(),
+		GetType<uint64>(),
+		GetType<float>(),
+		GetType<double>(),
+		GetType<char>(),
+		GetType<char8_t>(),
+		GetType<char16_t>(),
+		GetType<char32_t>()
+	}};
+
+	for (const FTypeInfo* primitiveType : GPrimitiveTypes)
+	{
+		if (primitiveType == type)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @brief Defines a cache of the layouts used to save and load types.
+ */
+class FArchiveLayoutCache
+{
+public:
+
+	/**
+	 * @brief Gets a layout.
+	 *
+	 * @param index The layout's index.
+	 * @return The layout at \p index.
+	 */
+	[[nodiscard]] const FArchiveLayout& GetLayout(const int32 index) const
+	{
+		return m_Layouts[index];
+	}
+
+	/**
+	 * @brief Gets the index of an object class's layout, creating the layout if necessary.
+	 *
+	 * Properties declared by UObject itself are left out, as they are set when the object is allocated.
+	 *
+	 * @param objectClass The object class.
+	 * @return The index of the layout for \p objectClass.
+	 */
+	[[nodiscard]] TErrorOr<int32> GetClassLayoutIndex(const FClassInfo* objectClass)
+	{
+		return GetLayoutIndex(objectClass, UObject::StaticType());
+	}
+
+	/**
+	 * @brief Gets the index of a value type's layout, creating the layout if necessary.
+	 *
+	 * @param type The value type.
+	 * @return The index of the layout for \p type.
+	 */
+	[[nodiscard]] TErrorOr<int32> GetValueLayoutIndex(const FTypeInfo* type)
+	{
+		return GetLayoutIndex(type, nullptr);
+	}
+
+private:
+
+	/**
+	 * @brief Appends a copy of some bytes to a layout, merging it with the previous copy when the two are adjacent.
+	 *
+	 * @param layout The layout.
+	 * @param offset The offset of the bytes.
+	 * @param numBytes The number of bytes.
+	 */
+	static void AppendCopyBytes(FArchiveLayout& layout, const int32 offset, const int32 numBytes)
+	{
+		if (layout.Ops.Num() > 0)
+		{
+			FArchiveOp& lastOp = layout.Ops.Last();
+			if (lastOp.Type == EArchiveOpType::CopyBytes && lastOp.Offset + lastOp.NumBytes == offset)
+			{
+				lastOp.NumBytes += numBytes;
+				return;
+			}
+		}
+
+		FArchiveOp& op = layout.Ops.AddDefaultGetRef();
+		op.Type = EArchiveOpType::CopyBytes;
+		op.Offset = offset;
+		op.NumBytes = numBytes;
+	}
+
+	/**
+	 * @brief Appends the operations for every property of a struct to a layout.
+	 *
+	 * @param layout The layout.
+	 * @param structType The struct type.
+	 * @param offset The offset of the struct.
+	 * @param stopType The base type whose properties, and whose base types' properties, are left out.
+	 * @return The error, if one occurred.
+	 */
+	TErrorOr<void> AppendStructOps(FArchiveLayout& layout, const FStructInfo* structType, const int32 offset, const FStructInfo* stopType)
+	{
+		// Base types are visited first so that properties are appended in the order they're laid out in memory
+		TArray<const FStructInfo*> types;
+		for (const FStructInfo* type = structType; type != nullptr && type != stopType; type = type->GetBaseType())
+		{
+			types.Add(type);
+		}
+
+		for (int32 typeIndex = types.Num() - 1; typeIndex >= 0; --typeIndex)
+		{
+			for (const FPropertyInfo& property : types[typeIndex]->GetProperties())
+			{
+				layout.Hash = Private::HashCombine(layout.Hash, GetHashCode(property.GetName()));
+				TRY_DO(AppendValueOps(layout, property.GetValueType(), offset + property.GetOffset()));
+			}
+		}
+
+		return {};
+	}
+
+	/**
+	 * @brief Appends the operations for a value to a layout.
+	 *
+	 * @param layout The layout.
+	 * @param type The value's type.
+	 * @param offset The offset of the value.
+	 * @return The error, if one occurred.
+	 */
+	TErrorOr<void> AppendValueOps(FArchiveLayout& layout, const FTypeInfo* type, const int32 offset)
+	{
+		layout.Hash = Private::HashCombine(layout.Hash, GetHashCode(type->GetName()));
+		layout.Hash = Private::HashCombine(layout.Hash, GetHashCode(offset));
+
+		if (IsPrimitiveType(type) || Cast<FEnumInfo>(type) != nullptr)
+		{
+			AppendCopyBytes(layout, offset, type->GetSize());
+			return {};
+		}
+
+		if (const FStaticArrayTypeInfo* staticArrayType = Cast<FStaticArrayTypeInfo>(type))
+		{
+			const FTypeInfo* elementType = staticArrayType->GetElementType();
+			for (int32 idx = 0; idx < staticArrayType->GetNumElements(); ++idx)
+			{
+				TRY_DO(AppendValueOps(layout, elementType, offset + idx * elementType->GetSize()));
+			}
+			return {};
+		}
+
+		if (Cast<FClassInfo>(type) != nullptr)
+		{
+			return MAKE_ERROR("Objects of type \"{}\" can only be saved through object pointers", type->GetName());
+		}
+
+		if (const FStructInfo* structType = Cast<FStructInfo>(type))
+		{
+			return AppendStructOps(layout, structType, offset, nullptr);
+		}
+
+		FArchiveOp op;
+		op.Offset = offset;
+		op.ContainerType = type;
+
+		if (type == GetType<FString>())
+		{
+			op.Type = EArchiveOpType::String;
+		}
+		else if (type == GetType<FObjectPtr>())
+		{
+			op.Type = EArchiveOpType::ObjectPtr;
+		}
+		else if (type == GetType<FWeakObjectPtr>())
+		{
+			op.Type = EArchiveOpType::WeakObjectPtr;
+		}
+		else if (const FArrayTypeInfo* arrayType = Cast<FArrayTypeInfo>(type))
+		{
+			op.Type = EArchiveOpType::Array;
+			TRY_EVAL(op.ElementLayoutIndex, GetValueLayoutIndex(arrayType->GetElementType()));
+		}
+		else if (const FHashMapTypeInfo* hashMapType = Cast<FHashMapTypeInfo>(type))
+		{
+			op.Type = EArchiveOpType::HashMap;
+			TRY_EVAL(op.ElementLayoutIndex, GetValueLayoutIndex(hashMapType->GetKeyType()));
+			TRY_EVAL(op.ValueLayoutIndex, GetValueLayoutIndex(hashMapType->GetValueType()));
+		}
+		else
+		{
+			return MAKE_ERROR("Values of type \"{}\" cannot be saved to an object archive", type->GetName());
+		}
+
+		// Layouts of recursive types are still being built when they're referenced, so they only contribute their name
+		for (const int32 layoutIndex : { op.ElementLayoutIndex, op.ValueLayoutIndex })
+		{
+			if (layoutIndex != INDEX_NONE && m_Layouts[layoutIndex].IsComplete)
+			{
+				layout.Hash = Private::HashCombine(layout.Hash, m_Layouts[layoutIndex].Hash);
+			}
+		}
+
+		layout.IsPlainData = false;
+		layout.Ops.Add(MoveTemp(op));
+
+		return {};
+	}
+
+	/**
+	 * @brief Gets the index of a type's layout, creating the layout if necessary.
+	 *
+	 * @param type The type.
+	 * @param stopType The base type whose properties, and whose base types' properties, are left out.
+	 * @return The index of the layout for \p type.
+	 */
+	TErrorOr<int32> GetLayoutIndex(const FTypeInfo* type, const FStructInfo* stopType)
+	{
+		if (const int32* existingLayoutIndex = m_LayoutIndices.Find(type))
+		{
+			return *existingLayoutIndex;
+		}
+
+		// Adding the layout before building it lets recursive types refer back to it
+		const int32 layoutIndex = m_Layouts.AddDefault();
+		(void)m_LayoutIndices.Add(type, layoutIndex);
+
+		FArchiveLayout layout;
+		if (stopType != nullptr)
+		{
+			TRY_DO(AppendStructOps(layout, Cast<FStructInfo>(type), 0, stopType));
+		}
+		else
+		{
+			TRY_DO(AppendValueOps(layout, type, 0));
+		}
+
+		layout.IsComplete = true;
+		m_Layouts[layoutIndex] = MoveTemp(layout);
+
+		return layoutIndex;
+	}
+
+	TArray<FArchiveLayout> m_Layouts;
+	THashMap<const FTypeInfo*, int32> m_LayoutIndices;
+};
+
+/**
+ * @brief Defines a way to read values from an archive's bytes without reading past the end of them.
+ */
+class FArchiveReader
+{
+public:
+
+	/**
+	 * @brief Sets default values for this archive reader's properties.
+	 *
+	 * @param bytes The bytes to read from.
+	 */
+	explicit FArchiveReader(const TSpan<const uint8> bytes)
+		: m_Bytes { bytes }
+	{
+	}
+
+	/**
+	 * @brief Checks to see if this reader has encountered an error.
+	 *
+	 * @return True if this reader has encountered an error, otherwise false.
+	 */
+	[[nodiscard]] bool HasError() const
+	{
+		return m_HasError;
+	}
+
+	/**
+	 * @brief Reads bytes. If there are not enough bytes left, the destination is zeroed and this reader enters an error state.
+	 *
+	 * @param destination The destination for the bytes.
+	 * @param numBytes The number of bytes to read.
+	 */
+	void ReadBytes(void* destination, const int32 numBytes)
+	{
+		if (numBytes == 0)
+		{
+			return;
+		}
+
+		if (m_HasError || numBytes > m_Bytes.Num() - m_Offset)
+		{
+			SetError();
+			FMemory::ZeroOut(destination, numBytes);
+			return;
+		}
+
+		FMemory::Copy(destination, m_Bytes.GetData() + m_Offset, numBytes);
+		m_Offset += numBytes;
+	}
+
+	/**
+	 * @brief Reads a number of elements. Enters an error state if the number could not fit in the remaining bytes.
+	 *
+	 * @param minElementSize The smallest number of bytes each element could take up.
+	 * @return The number of elements.
+	 */
+	[[nodiscard]] int32 ReadNum(const int32 minElementSize)
+	{
+		const int32 num = ReadValue<int32>();
+		if (num < 0 || static_cast<int64>(num) * minElementSize > m_Bytes.Num() - m_Offset)
+		{
+			SetError();
+			return 0;
+		}
+
+		return num;
+	}
+
+	/**
+	 * @brief Reads an index of an object in the archive. Enters an error state if the index is out of range.
+	 *
+	 * @param numObjects The number of objects the index can refer to.
+	 * @return The object index, or INDEX_NONE for no object.
+	 */
+	[[nodiscard]] int32 ReadObjectIndex(const int32 numObjects)
+	{
+		const int32 objectIndex = ReadValue<int32>();
+		if (objectIndex < INDEX_NONE || objectIndex >= numObjects)
+		{
+			SetError();
+			return INDEX_NONE;
+		}
+
+		return objectIndex;
+	}
+
+	/**
+	 * @brief Reads a string.
+	 *
+	 * @return The string.
+	 */
+	[[nodiscard]] FString ReadString()
+	{
+		const int32 length = ReadNum(sizeof(char));
+		if (length == 0)
+		{
+			return {};
+		}
+
+		FString value { reinterpret_cast<const char*>(m_Bytes.GetData() + m_Offset), length };
+		m_Offset += length;
+		return value;
+	}
+
+	/**
+	 * @brief Reads a value by copying its bytes.
+	 *
+	 * @tparam T The value's type.
+	 * @return The value.
+	 */
+	template<typename T>
+	[[nodiscard]] T ReadValue()
+	{
+		T value {};
+		ReadBytes(&value, sizeof(T));
+		return value;
+	}
+
+	/**
+	 * @brief Puts this reader into an error state. All further reads will fail.
+	 */
+	void SetError()
+	{
+		m_HasError = true;
+	}
+
+private:
+
+	TSpan<const uint8> m_Bytes;
+	int32 m_Offset = 0;
+	bool m_HasError = false;
+};
+
+/**
+ * @brief Writes a value by copying its bytes.
+ *
+ * @tparam T The value's type.
+ * @param bytes The bytes to write to.
+ * @param value The value.
+ */
+template<typename T>
+static void WriteValue(TArray<uint8>& bytes, const T& value)
+{
+	bytes.Append(reinterpret_cast<const uint8*>(&value), sizeof(T));
+}
+
+/**
+ * @brief Writes a string.
+ *
+ * @param bytes The bytes to write to.
+ * @param value The string.
+ */
+static void WriteString(TArray<uint8>& bytes, const FStringView value)
+{
+	WriteValue<int32>(bytes, value.Length());
+	bytes.Append(reinterpret_cast<const uint8*>(value.GetChars()), value.Length());
+}
+
+/**
+ * @brief Adds every object strongly referenced by a value to a list of objects.
+ *
+ * @param layouts The layout cache.
+ * @param layoutIndex The index of the value's layout.
+ * @param value The value.
+ * @param objects The list of objects to add to.
+ */
+static void CollectReferencedObjects(const FArchiveLayoutCache& layouts, const int32 layoutIndex, const uint8* value, TArray<const UObject*>& objects)
+{
+	const FArchiveLayout& layout = layouts.GetLayout(layoutIndex);
+	if (layout.IsPlainData)
+	{
+		return;
+	}
+
+	for (const FArchiveOp& op : layout.Ops)
+	{
+		const uint8* opValue = value + op.Offset;
+		switch (op.Type)
+		{
+		case EArchiveOpType::ObjectPtr:
+			if (UObject* object = reinterpret_cast<const FObjectPtr*>(opValue)->GetObject())
+			{
+				objects.Add(object);
+			}
+			break;
+
+		case EArchiveOpType::Array:
+		{
+			const FArrayTypeInfo* arrayType = static_cast<const FArrayTypeInfo*>(op.ContainerType);
+			const uint8* elements = static_cast<const uint8*>(arrayType->GetData(const_cast<uint8*>(opValue)));
+			const int32 elementSize = arrayType->GetElementType()->GetSize();
+			for (int32 idx = 0; idx < arrayType->GetNum(opValue); ++idx)
+			{
+				CollectReferencedObjects(layouts, op.ElementLayoutIndex, elements + idx * elementSize, objects);
+			}
+			break;
+		}
+
+		case EArchiveOpType::HashMap:
+			static_cast<const FHashMapTypeInfo*>(op.ContainerType)->ForEachPair(opValue, [&](const void* key, const void* pairValue)
+			{
+				CollectReferencedObjects(layouts, op.ElementLayoutIndex, static_cast<const uint8*>(key), objects);
+				CollectReferencedObjects(layouts, op.ValueLayoutIndex, static_cast<const uint8*>(pairValue), objects);
+			});
+			break;
+
+		default:
+			break;
+		}
+	}
+}
+
+/**
+ * @brief Writes a value using its layout.
+ *
+ * @param layouts The layout cache.
+ * @param layoutIndex The index of the value's layout.
+ * @param value The value.
+ * @param objectIndices The index of every object in the archive.
+ * @param bytes The bytes to write to.
+ */
+static void WriteLayoutValue(const FArchiveLayoutCache& layouts, const int32 layoutIndex, const uint8* value, const THashMap<const UObject*, int32>& objectIndices, TArray<uint8>& bytes)
+{
+	const auto GetObjectIndex = [&objectIndices](const UObject* object)
+	{
+		const int32* objectIndex = object ? objectIndices.Find(object) : nullptr;
+		return objectIndex ? *objectIndex : INDEX_NONE;
+	};
+
+	for (const FArchiveOp& op : layouts.GetLayout(layoutIndex).Ops)
+	{
+		const uint8* opValue = value + op.Offset;
+		switch (op.Type)
+		{
+		case EArchiveOpType::CopyBytes:
+			bytes.Append(opValue, op.NumBytes);
+			break;
+
+		case EArchiveOpType::String:
+			WriteString(bytes, reinterpret_cast<const FString*>(opValue)->AsStringView());
+			break;
+
+		case EArchiveOpType::ObjectPtr:
+			WriteValue<int32>(bytes, GetObjectIndex(reinterpret_cast<const FObjectPtr*>(opValue)->GetObject()));
+			break;
+
+		case EArchiveOpType::WeakObjectPtr:
+			WriteValue<int32>(bytes, GetObjectIndex(reinterpret_cast<const FWeakObjectPtr*>(opValue)->GetObject()));
+			break;
+
+		case EArchiveOpType::Array:
+		{
+			const FArrayTypeInfo* arrayType = static_cast<const FArrayTypeInfo*>(op.ContainerType);
+			const uint8* elements = static_cast<const uint8*>(arrayType->GetData(const_cast<uint8*>(opValue)));
+			const int32 elementSize = arrayType->GetElementType()->GetSize();
+			const int32 numElements = arrayType->GetNum(opValue);
+			WriteValue<int32>(bytes, numElements);
+
+			if (layouts.GetLayout(op.ElementLayoutIndex).IsPlainData)
+			{
+				bytes.Append(elements, numElements * elementSize);
+				break;
+			}
+
+			for (int32 idx = 0; idx < numElements; ++idx)
+			{
+				WriteLayoutValue(layouts, op.ElementLayoutIndex, elements + idx * elementSize, objectIndices, bytes);
+			}
+			break;
+		}
+
+		case EArchiveOpType::HashMap:
+		{
+			const FHashMapTypeInfo* hashMapType = static_cast<const FHashMapTypeInfo*>(op.ContainerType);
+			WriteValue<int32>(bytes, hashMapType->GetNum(opValue));
+			hashMapType->ForEachPair(opValue, [&](const void* key, const void* pairValue)
+			{
+				WriteLayoutValue(layouts, op.ElementLayoutIndex, static_cast<const uint8*>(key), objectIndices, bytes);
+				WriteLayoutValue(layouts, op.ValueLayoutIndex, static_cast<const uint8*>(pairValue), objectIndices, bytes);
+			});
+			break;
+		}
+
+		default:
+			UM_ASSERT_NOT_REACHED_MSG("Unhandled archive operation type");
+		}
+	}
+}
+
+/**
+ * @brief Reads a value using its layout.
+ *
+ * @param layouts The layout cache.
+ * @param layoutIndex The index of the value's layout.
+ * @param value The value.
+ * @param objects Every object in the archive.
+ * @param reader The reader to read from.
+ */
+static void ReadLayoutValue(const FArchiveLayoutCache& layouts, const int32 layoutIndex, uint8* value, TSpan<const FObjectPtr> objects, FArchiveReader& reader)
+{
+	for (const FArchiveOp& op : layouts.GetLayout(layoutIndex).Ops)
+	{
+		if (reader.HasError())
+		{
+			return;
+		}
+
+		uint8* opValue = value + op.Offset;
+		switch (op.Type)
+		{
+		case EArchiveOpType::CopyBytes:
+			reader.ReadBytes(opValue, op.NumBytes);
+			break;
+
+		case EArchiveOpType::String:
+			*reinterpret_cast<FString*>(opValue) = reader.ReadString();
+			break;
+
+		case EArchiveOpType::ObjectPtr:
+		{
+			const int32 objectIndex = reader.ReadObjectIndex(objects.Num());
+			*reinterpret_cast<FObjectPtr*>(opValue) = objectIndex == INDEX_NONE ? FObjectPtr {} : objects[objectIndex];
+			break;
+		}
+
+		case EArchiveOpType::WeakObjectPtr:
+		{
+			const int32 objectIndex = reader.ReadObjectIndex(objects.Num());
+			*reinterpret_cast<FWeakObjectPtr*>(opValue) = objectIndex == INDEX_NONE ? FWeakObjectPtr {} : FWeakObjectPtr { objects[objectIndex] };
+			break;
+		}
+
+		case EArchiveOpType::Array:
+		{
+			const FArrayTypeInfo* arrayType = static_cast<const FArrayTypeInfo*>(op.ContainerType);
+			const int32 elementSize = arrayType->GetElementType()->GetSize();
+			const bool isPlainData = layouts.GetLayout(op.ElementLayoutIndex).IsPlainData;
+
+			// Every element takes up at least one byte in the archive, so the number read is bounded by what remains
+			const int32 numElements = reader.ReadNum(isPlainData ? elementSize : 1);
+			arrayType->ResetToNum(opValue, numElements);
+
+			uint8* elements = static_cast<uint8*>(arrayType->GetData(opValue));
+			if (isPlainData)
+			{
+				reader.ReadBytes(elements, numElements * elementSize);
+				break;
+			}
+
+			for (int32 idx = 0; idx < numElements && reader.HasError() == false; ++idx)
+			{
+				ReadLayoutValue(layouts, op.ElementLayoutIndex, elements + idx * elementSize, objects, reader);
+			}
+			break;
+		}
+
+		case EArchiveOpType::HashMap:
+		{
+			const int32 numPairs = reader.ReadNum(1);
+			static_cast<const FHashMapTypeInfo*>(op.ContainerType)->ResetToPairs(opValue, numPairs, [&](void* key, void* pairValue)
+			{
+				ReadLayoutValue(layouts, op.ElementLayoutIndex, static_cast<uint8*>(key), objects, reader);
+				ReadLayoutValue(layouts, op.ValueLayoutIndex, static_cast<uint8*>(pairValue), objects, reader);
+			});
+			break;
+		}
+
+		default:
+			UM_ASSERT_NOT_REACHED_MSG("Unhandled archive operation type");
+		}
+	}
+}
+
+TErrorOr<TArray<FObjectPtr>> FObjectArchive::Load(const TSpan<const uint8> bytes)
+{
+	FArchiveReader reader { bytes };
+	if (reader.ReadValue<uint32>() != GObjectArchiveMagic)
+	{
+		return MAKE_ERROR("Data is not an object archive");
+	}
+
+	const uint32 version = reader.ReadValue<uint32>();
+	if (version != Version)
+	{
+		return MAKE_ERROR("Object archive has version {} but only version {} is supported", version, Version);
+	}
+
+	// Each class takes up at least a name length and a hash, and each object at least a class, parent, and name length
+	const int32 numClasses = reader.ReadNum(sizeof(int32) + sizeof(uint64));
+	const int32 numObjects = reader.ReadNum(3 * sizeof(int32));
+	const int32 numRootObjects = reader.ReadNum(sizeof(int32));
+
+	FArchiveLayoutCache layouts;
+	TArray<const FClassInfo*> archiveClasses;
+	TArray<int32> archiveClassLayoutIndices;
+	archiveClasses.Reserve(numClasses);
+	archiveClassLayoutIndices.Reserve(numClasses);
+
+	for (int32 classIndex = 0; classIndex < numClasses && reader.HasError() == false; ++classIndex)
+	{
+		const FString className = reader.ReadString();
+		const uint64 layoutHash = reader.ReadValue<uint64>();
+
+		const FClassInfo* objectClass = FTypeRegistry::FindTypeByName<FClassInfo>(className.AsStringView());
+		if (objectClass == nullptr)
+		{
+			return MAKE_ERROR("Object archive contains objects of unknown class \"{}\"", className);
+		}
+
+		TRY_EVAL(const int32 layoutIndex, layouts.GetClassLayoutIndex(objectClass));
+		if (layouts.GetLayout(layoutIndex).Hash != layoutHash)
+		{
+			return MAKE_ERROR("The properties of class \"{}\" have changed since the object archive was saved", className);
+		}
+
+		archiveClasses.Add(objectClass);
+		archiveClassLayoutIndices.Add(layoutIndex);
+	}
+
+	TArray<FObjectPtr> objects;
+	TArray<int32> objectLayoutIndices;
+	objects.Reserve(numObjects);
+	objectLayoutIndices.Reserve(numObjects);
+
+	for (int32 objectIndex = 0; objectIndex < numObjects && reader.HasError() == false; ++objectIndex)
+	{
+		const int32 classIndex = reader.ReadValue<int32>();
+		const int32 parentIndex = reader.ReadObjectIndex(objectIndex);
+		const FString objectName = reader.ReadString();
+
+		if (archiveClasses.IsValidIndex(classIndex) == false)
+		{
+			return MAKE_ERROR("Object archive has an invalid class index for object {}", objectIndex);
+		}
+
+		FObjectPtr parent = parentIndex == INDEX_NONE ? FObjectPtr {} : objects[parentIndex];
+		FObjectPtr object = FObjectHeap::AllocateObject(archiveClasses[classIndex], MoveTemp(parent), objectName, {});
+		if (object.IsNull())
+		{
+			return MAKE_ERROR("Failed to create object \"{}\" of class \"{}\"", objectName, archiveClasses[classIndex]->GetName());
+		}
+
+		objects.Add(MoveTemp(object));
+		objectLayoutIndices.Add(archiveClassLayoutIndices[classIndex]);
+	}
+
+	TArray<FObjectPtr> rootObjects;
+	rootObjects.Reserve(numRootObjects);
+	for (int32 idx = 0; idx < numRootObjects && reader.HasError() == false; ++idx)
+	{
+		const int32 objectIndex = reader.ReadObjectIndex(objects.Num());
+		rootObjects.Add(objectIndex == INDEX_NONE ? FObjectPtr {} : objects[objectIndex]);
+	}
+
+	for (int32 objectIndex = 0; objectIndex < objects.Num() && reader.HasError() == false; ++objectIndex)
+	{
+		uint8* objectData = reinterpret_cast<uint8*>(objects[objectIndex].GetObject());
+		ReadLayoutValue(layouts, objectLayoutIndices[objectIndex], objectData, objects.AsSpan(), reader);
+	}
+
+	if (reader.HasError())
+	{
+		return MAKE_ERROR("Object archive is truncated or corrupt");
+	}
+
+	return rootObjects;
+}
+
+TErrorOr<TArray<FObjectPtr>> FObjectArchive::LoadFromFile(const FStringView filePath)
+{
+	TRY_EVAL(const TArray<uint8> bytes, FFile::ReadBytes(filePath));
+	return Load(bytes.AsSpan());
+}
+
+TErrorOr<void> FObjectArchive::Save(const TSpan<const FObjectPtr> objects, TArray<uint8>& bytes)
+{
+	bytes.Reset();
+
+	// Find every object that needs to be saved, along with the layout of its class
+	FArchiveLayoutCache layouts;
+	THashMap<const UObject*, int32> objectLayoutIndices;
+	TArray<const UObject*> objectsToVisit;
+	TArray<const UObject*> discoveredObjects;
+
+	for (const FObjectPtr& object : objects)
+	{
+		if (const UObject* rootObject = object.GetObject())
+		{
+			objectsToVisit.Add(rootObject);
+		}
+	}
+
+	for (int32 visitIndex = 0; visitIndex < objectsToVisit.Num(); ++visitIndex)
+	{
+		const UObject* object = objectsToVisit[visitIndex];
+		if (objectLayoutIndices.ContainsKey(object))
+		{
+			continue;
+		}
+
+		TRY_EVAL(const int32 layoutIndex, layouts.GetClassLayoutIndex(object->GetType()));
+		(void)objectLayoutIndices.Add(object, layoutIndex);
+		discoveredObjects.Add(object);
+
+		if (const UObject* parent = object->GetParent().GetObject())
+		{
+			objectsToVisit.Add(parent);
+		}
+
+		CollectReferencedObjects(layouts, layoutIndex, reinterpret_cast<const uint8*>(object), objectsToVisit);
+	}
+
+	// Order the objects so that every object comes after its parent, as parents must exist when objects are loaded
+	TArray<const UObject*> sortedObjects;
+	THashMap<const UObject*, int32> objectIndices;
+	TArray<const UObject*> ancestors;
+	sortedObjects.Reserve(discoveredObjects.Num());
+	objectIndices.Reserve(discoveredObjects.Num());
+
+	for (const UObject* object : discoveredObjects)
+	{
+		ancestors.Reset();
+		for (const UObject* ancestor = object; ancestor != nullptr && objectIndices.ContainsKey(ancestor) == false; ancestor = ancestor->GetParent().GetObject())
+		{
+			ancestors.Add(ancestor);
+		}
+
+		for (int32 idx = ancestors.Num() - 1; idx >= 0; --idx)
+		{
+			(void)objectIndices.Add(ancestors[idx], sortedObjects.Num());
+			sortedObjects.Add(ancestors[idx]);
+		}
+	}
+
+	// Gather the classes of the objects
+	TArray<const FClassInfo*> archiveClasses;
+	THashMap<const FClassInfo*, int32> archiveClassIndices;
+	for (const UObject* object : sortedObjects)
+	{
+		if (archiveClassIndices.ContainsKey(object->GetType()) == false)
+		{
+			(void)archiveClassIndices.Add(object->GetType(), archiveClasses.Num());
+			archiveClasses.Add(object->GetType());
+		}
+	}
+
+	WriteValue<uint32>(bytes, GObjectArchiveMagic);
+	WriteValue<uint32>(bytes, Version);
+	WriteValue<int32>(bytes, archiveClasses.Num());
+	WriteValue<int32>(bytes, sortedObjects.Num());
+	WriteValue<int32>(bytes, objects.Num());
+
+	for (const FClassInfo* objectClass : archiveClasses)
+	{
+		TRY_EVAL(const int32 layoutIndex, layouts.GetClassLayoutIndex(objectClass));
+		WriteString(bytes, objectClass->GetName());
+		WriteValue<uint64>(bytes, layouts.GetLayout(layoutIndex).Hash);
+	}
+
+	for (const UObject* object : sortedObjects)
+	{
+		const UObject* parent = object->GetParent().GetObject();
+		WriteValue<int32>(bytes, archiveClassIndices.FindRef(object->GetType()));
+		WriteValue<int32>(bytes, parent ? objectIndices.FindRef(parent) : INDEX_NONE);
+		// The object heap gives every object a number, so only the plain name is saved and loaded objects get new numbers
+		WriteString(bytes, object->GetName().GetPlainName());
+	}
+
+	for (const FObjectPtr& object : objects)
+	{
+		const UObject* rootObject = object.GetObject();
+		WriteValue<int32>(bytes, rootObject ? objectIndices.FindRef(rootObject) : INDEX_NONE);
+	}
+
+	for (const UObject* object : sortedObjects)
+	{
+		WriteLayoutValue(layouts, objectLayoutIndices.FindRef(object), reinterpret_cast<const uint8*>(object), objectIndices, bytes);
+	}
+
+	return {};
+}
+
+TErrorOr<void> FObjectArchive::SaveToFile(const FStringView filePath, const TSpan<const FObjectPtr> objects)
+{
+	TArray<uint8> bytes;
+	TRY_DO(Save(objects, bytes));
+
+	return FFile::WriteBytes(filePath, bytes.AsSpan());
+}
\ No newline at end of file
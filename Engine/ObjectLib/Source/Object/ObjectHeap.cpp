@@ -1,37 +1,131 @@
+#include "Containers/HashMap.h"
 #include "Containers/HashTable.h"
 #include "Engine/Logging.h"
+#include "Math/Math.h"
+#include "Meta/ArrayTypeInfo.h"
+#include "Meta/HashMapTypeInfo.h"
+#include "Meta/TypeRegistry.h"
 #include "HAL/Timer.h"
 #include "Object/Object.h"
 #include "Object/ObjectHeap.h"
 #include "Object/ObjectHeapBlock.h"
 #include "Memory/Memory.h"
-#include "Misc/StringBuilder.h"
+#include "Threading/Thread.h"
+#include "Threading/ThreadPool.h"
+#include "Threading/WorkStealingQueue.h"
+#include <atomic>
+
+/**
+ * @brief Defines the phases of an incremental garbage collection.
+ */
+enum class EGarbageCollectorPhase : uint8
+{
+	Idle,
+	MarkRoots,
+	Mark,
+	Sweep,
+	Destroy
+};
+
+using FGreyObjectQueue = Private::TWorkStealingQueue<UObject>;
+
+// The number of units of work a garbage collection step performs between checks of its time budget
+static constexpr int32 GNumWorkUnitsPerTimeCheck = 32;
+
+// The number of times an idle thread looks for objects to trace during a parallel mark before it starts sleeping
+static constexpr int32 GNumIdleSpinsBeforeSleeping = 64;
 
 static TArray<TUniquePtr<FObjectHeapBlock>> GObjectHeapBlocks;
-static int64 GNumObjectsMarkedForDeletion = 0;
+static THashMap<int32, TArray<FObjectHeapBlock*>> GHeapBlocksWithFreeCells;
+static TArray<FObjectHeapBlock*> GHeapBlocksSortedByAddress;
+static TArray<FObjectHeader*> GYoungObjects;
+static TArray<FObjectHeader*> GRememberedObjects;
+static TArray<FObjectHeader*> GOldObjectsWithContainers;
+static THashMap<const FStructInfo*, bool> GTypesWithContainers;
+static bool GHasYoungReferencesInContainers = false;
+static int64 GNurseryAllocationDebt = 0;
+static bool GIsCollectingYoungGarbage = false;
+static FGarbageCollectorSettings GGarbageCollectorSettings;
+static EGarbageCollectorPhase GGarbageCollectorPhase = EGarbageCollectorPhase::Idle;
+static bool GGarbageCollectorMarkValue = false;
+static TArray<UObject*> GGreyObjects;
+static TArray<FObjectHeader*> GObjectsPendingDestruction;
+static int32 GNextObjectPendingDestruction = 0;
+static int64 GNumObjectsCollected = 0;
+static int32 GHeapCursorBlockIndex = 0;
+static int32 GHeapCursorCellIndex = 0;
+static int64 GAllocationDebt = 0;
+static FTimeSpan GGarbageCollectionDuration;
+static TUniquePtr<FThreadPool> GMarkThreadPool;
+static thread_local bool GIsMarkingInParallel = false;
+
+/**
+ * @brief Finds the index of the first heap block, in address order, that starts after the given location.
+ *
+ * @param location The location.
+ * @return The index of the first heap block that starts after \p location.
+ */
+static int32 FindHeapBlockIndexAfterLocation(const void* location)
+{
+	int32 lowIndex = 0;
+	int32 highIndex = GHeapBlocksSortedByAddress.Num();
+	while (lowIndex < highIndex)
+	{
+		const int32 middleIndex = lowIndex + (highIndex - lowIndex) / 2;
+		if (static_cast<const void*>(GHeapBlocksSortedByAddress[middleIndex]) <= location)
+		{
+			lowIndex = middleIndex + 1;
+		}
+		else
+		{
+			highIndex = middleIndex;
+		}
+	}
+
+	return lowIndex;
+}
 
 /**
- * @brief Gets the heap block that an object header belongs to.
+ * @brief Finds the heap block that contains the given location.
  *
- * @param objectHeader The object header.
- * @return The owning heap block.
+ * @param location The location.
+ * @return The heap block that contains \p location, or nullptr if no heap block contains it.
  */
-static FObjectHeapBlock* GetHeapBlockForObjectHeader(FObjectHeader* objectHeader)
+static FObjectHeapBlock* FindHeapBlockContainingLocation(const void* location)
 {
-	if (objectHeader == nullptr)
+	// Blocks for large objects span several block sizes, so the location can't simply be masked like a cell can
+	const int32 blockIndex = FindHeapBlockIndexAfterLocation(location) - 1;
+	if (blockIndex < 0)
 	{
 		return nullptr;
 	}
 
-	for (TUniquePtr<FObjectHeapBlock>& heapBlock : GObjectHeapBlocks)
+	FObjectHeapBlock* heapBlock = GHeapBlocksSortedByAddress[blockIndex];
+	const uint8* heapBlockEnd = reinterpret_cast<const uint8*>(heapBlock) + heapBlock->GetAllocationSize();
+
+	return static_cast<const uint8*>(location) < heapBlockEnd ? heapBlock : nullptr;
+}
+
+/**
+ * @brief Creates a new heap block and makes it available for allocations.
+ *
+ * @param cellSize The heap block's cell size.
+ */
+static void CreateHeapBlock(const int32 cellSize)
+{
+	TUniquePtr<FObjectHeapBlock>& heapBlock = GObjectHeapBlocks.Emplace(FObjectHeapBlock::Create(cellSize));
+
+	const int32 sortedIndex = FindHeapBlockIndexAfterLocation(heapBlock.Get());
+	if (sortedIndex == GHeapBlocksSortedByAddress.Num())
 	{
-		if (heapBlock->OwnsCell(objectHeader))
-		{
-			return heapBlock.Get();
-		}
+		GHeapBlocksSortedByAddress.Add(heapBlock.Get());
+	}
+	else
+	{
+		GHeapBlocksSortedByAddress.Insert(sortedIndex, heapBlock.Get());
 	}
 
-	UM_ASSERT_NOT_REACHED();
+	GHeapBlocksWithFreeCells[cellSize].Add(heapBlock.Get());
 }
 
 /**
@@ -43,16 +137,11 @@ static FObjectHeapBlock* GetHeapBlockForObjectHeader(FObjectHeader* objectHeader
  */
 static bool ParentObjectRespectsDesiredClassParent(const FClassInfo* objectClass, const FObjectPtr& parent)
 {
-	const FStructInfo* parentClassWithChildOfAttribute = objectClass;
-	while (parentClassWithChildOfAttribute->HasAttribute("ChildOf"_sv) == false)
+	// Most classes don't have a desired parent class anywhere in their class chain, which we can know without walking it
+	const FStructInfo* parentClassWithChildOfAttribute = objectClass->FindTypeWithAttribute(EKnownAttributes::IsChildOf);
+	if (parentClassWithChildOfAttribute == nullptr)
 	{
-		parentClassWithChildOfAttribute = parentClassWithChildOfAttribute->GetBaseType();
-
-		// If we've exhausted the parent class chain and still haven't found the attribute, we can exit
-		if (parentClassWithChildOfAttribute == nullptr)
-		{
-			return true;
-		}
+		return true;
 	}
 
 	const FStringView parentClassName = parentClassWithChildOfAttribute->GetAttributeByName("ChildOf"_sv)->GetValue();
@@ -67,47 +156,25 @@ static bool ParentObjectRespectsDesiredClassParent(const FClassInfo* objectClass
 		return false;
 	}
 
+	const FStructInfo* desiredParentType = FTypeRegistry::FindTypeByName<FStructInfo>(parentClassName);
+	if (desiredParentType == nullptr)
+	{
+		UM_LOG(Error, "Type {} requires a parent of type {}, but that type is not registered", objectClass->GetName(), parentClassName);
+		return false;
+	}
+
 	const FStructInfo* parentType = parent->GetType();
 	UM_ENSURE(parentType != nullptr);
 
-	// TODO This would be better if we could get a type by name, but walking like this should be okay for now
-	while (parentType != nullptr)
+	if (parentType->IsA(desiredParentType))
 	{
-		if (parentType->GetName() == parentClassName)
-		{
-			return true;
-		}
-
-		parentType = parentType->GetBaseType();
+		return true;
 	}
 
 	UM_LOG(Error, "Type {} requires a parent of type {}, but given parent is of type {}", objectClass->GetName(), parentClassName, parent->GetType()->GetName());
 	return false;
 }
 
-/**
- * @brief Visits all objects in the object heap blocks.
- *
- * @tparam VisitorType The visitor's type.
- * @param visitor The visitor.
- */
-template<typename VisitorType>
-static void VisitObjectsInHeapBlocks(VisitorType& visitor)
-{
-	for (TUniquePtr<FObjectHeapBlock>& heapBlock : GObjectHeapBlocks)
-	{
-		const int32 numCells = heapBlock->GetNumCells();
-		for (int32 idx = 0; idx < numCells; ++idx)
-		{
-			FObjectHeader* cell = heapBlock->GetCell(idx);
-			if (UObject* object = cell->GetObject())
-			{
-				visitor.Visit(object);
-			}
-		}
-	}
-}
-
 FObjectPtr FObjectHeap::AllocateObject(const FClassInfo* objectClass, FObjectPtr parent, FStringView name, const FObjectCreationContext& context)
 {
 	if (objectClass == nullptr)
@@ -122,7 +189,7 @@ FObjectPtr FObjectHeap::AllocateObject(const FClassInfo* objectClass, FObjectPtr
 		return nullptr;
 	}
 
-	if (objectClass->HasAttribute("Abstract"_sv))
+	if (objectClass->HasAttribute(EKnownAttributes::IsAbstract))
 	{
 		UM_LOG(Error, "Cannot allocate abstract class {}", objectClass->GetName());
 		return nullptr;
@@ -144,47 +211,754 @@ FObjectPtr FObjectHeap::AllocateObject(const FClassInfo* objectClass, FObjectPtr
 
 	objectClass->ConstructAtLocation(objectMemory);
 
+	// New objects start out marked so that a collection in progress will not reclaim them
+	constexpr TBadge<FObjectHeap> badge;
 	UObject* object = reinterpret_cast<UObject*>(objectMemory);
+	object->SetGarbageCollectorMark(badge, GGarbageCollectorMarkValue);
+	GYoungObjects.Add(FObjectHeader::FromObject(object));
+
 	SetObjectParent(object, MoveTemp(parent));
-	SetObjectName(object, MoveTemp(name), (reinterpret_cast<uint64>(objectMemory) % 0xFFFE) + 1);
+	SetObjectName(object, name, static_cast<uint32>(reinterpret_cast<uint64>(objectMemory) % 0xFFFE) + 1);
 	NotifyObjectCreated(object, context);
 
 	return FObjectPtr { object };
 }
 
-void* FObjectHeap::AllocateObjectMemoryFromHeap(const FClassInfo* objectClass)
-{
-	UM_ASSERT(objectClass != nullptr, "Given null class when allocating object memory");
+void* FObjectHeap::AllocateObjectMemoryFromHeap(const FClassInfo* objectClass)
+{
+	UM_ASSERT(objectClass != nullptr, "Given null class when allocating object memory");
+
+	// Only heap blocks with free cells are kept in these lists, so any block in the list for our cell size will do
+	const int32 cellSize = FObjectHeapBlock::GetAlignedCellSize(objectClass->GetSize());
+	TArray<FObjectHeapBlock*>& heapBlocksWithFreeCells = GHeapBlocksWithFreeCells[cellSize];
+
+	// If there are no free cells, we need to create a new heap block suitable for the object
+	if (heapBlocksWithFreeCells.IsEmpty())
+	{
+		CreateHeapBlock(cellSize);
+	}
+
+	FObjectHeapBlock* heapBlock = heapBlocksWithFreeCells.Last();
+	void* objectMemory = heapBlock->Allocate(objectClass);
+
+	UM_ASSERT(objectMemory != nullptr, "Failed to allocate memory for object from heap");
+
+	if (heapBlock->HasFreeCells() == false)
+	{
+		(void)heapBlocksWithFreeCells.TakeLast();
+	}
+
+	GAllocationDebt += objectClass->GetSize();
+	GNurseryAllocationDebt += objectClass->GetSize();
+
+	return objectMemory;
+}
+
+// Used by SortObjectHeadersForDestruction
+inline  const FObjectHeader* GetObjectHeader(const FObjectHeader* header)
+{
+	return header;
+}
+
+/**
+ * @brief Sorts a list of object headers so that "newer" objects are first.
+ *
+ * @param headers The list of headers to sort.
+ */
+template<typename ElementType>
+static void SortObjectHeadersForDestruction(TArray<ElementType>& headers)
+{
+	headers.Sort([](const ElementType& firstElement, const ElementType& secondElement)
+	{
+		const FObjectHeader* firstHeader = GetObjectHeader(firstElement);
+		const FObjectHeader* secondHeader = GetObjectHeader(secondElement);
+
+		const FTimePoint firstTime = firstHeader->GetObjectAllocationTime();
+		const FTimePoint secondTime = secondHeader->GetObjectAllocationTime();
+
+		if (firstTime < secondTime)
+		{
+			return ECompareResult::GreaterThan;
+		}
+		if (firstTime > secondTime)
+		{
+			return ECompareResult::LessThan;
+		}
+		return ECompareResult::Equals;
+	});
+}
+
+/**
+ * @brief Defines the time budget for a single garbage collection step.
+ */
+class FGarbageCollectorStepBudget
+{
+public:
+
+	/**
+	 * @brief Sets default values for this step budget's properties.
+	 *
+	 * @param timeBudget The amount of time the step may take.
+	 */
+	explicit FGarbageCollectorStepBudget(const FTimeSpan timeBudget)
+		: m_Timer { FTimer::Start() }
+		, m_TimeBudget { timeBudget }
+	{
+	}
+
+	/**
+	 * @brief Records that a unit of work was performed and checks to see if the step has run out of time.
+	 *
+	 * @return True if the step has run out of time, otherwise false.
+	 */
+	[[nodiscard]] bool ConsumeWorkUnit()
+	{
+		// Reading the clock is comparatively expensive, so only do it every so often
+		++m_NumWorkUnits;
+		if (m_NumWorkUnits % GNumWorkUnitsPerTimeCheck != 0)
+		{
+			return false;
+		}
+
+		return m_Timer.GetElapsedTime() >= m_TimeBudget;
+	}
+
+	/**
+	 * @brief Checks to see if the step has run out of time. Safe to call from multiple threads at once.
+	 *
+	 * @return True if the step has run out of time, otherwise false.
+	 */
+	[[nodiscard]] bool IsExhausted() const
+	{
+		return m_Timer.GetElapsedTime() >= m_TimeBudget;
+	}
+
+	/**
+	 * @brief Gets the amount of time this step has taken so far.
+	 *
+	 * @return The amount of time this step has taken so far.
+	 */
+	[[nodiscard]] FTimeSpan GetElapsedTime() const
+	{
+		return m_Timer.GetElapsedTime();
+	}
+
+private:
+
+	FTimer m_Timer;
+	FTimeSpan m_TimeBudget;
+	int32 m_NumWorkUnits = 0;
+};
+
+/**
+ * @brief Deletes a cell marked for deletion, making its heap block available for allocations again if necessary.
+ *
+ * @param badge The object heap badge to use.
+ * @param cell The cell.
+ */
+static void DeleteMarkedCell(const TBadge<FObjectHeap> badge, FObjectHeader* cell)
+{
+	FObjectHeapBlock* heapBlock = FObjectHeapBlock::FromCell(cell);
+
+	const bool hadFreeCells = heapBlock->HasFreeCells();
+	heapBlock->DeleteMarkedCell(badge, cell);
+
+	if (hadFreeCells == false)
+	{
+		GHeapBlocksWithFreeCells[heapBlock->GetCellSize()].Add(heapBlock);
+	}
+}
+
+/**
+ * @brief Checks to see if the current garbage collection is still marking live objects.
+ *
+ * @return True if the current garbage collection is still marking live objects, otherwise false.
+ */
+static bool IsMarking()
+{
+	return GGarbageCollectorPhase == EGarbageCollectorPhase::MarkRoots || GGarbageCollectorPhase == EGarbageCollectorPhase::Mark;
+}
+
+/**
+ * @brief Checks to see if an object has been marked as live by the current garbage collection.
+ *
+ * @param object The object.
+ * @return True if the object has been marked as live, otherwise false.
+ */
+static bool IsObjectMarked(const UObject* object)
+{
+	return object->GetGarbageCollectorMark() == GGarbageCollectorMarkValue;
+}
+
+/**
+ * @brief Shades an object grey, marking it as live and queueing its references to be traced.
+ *
+ * @param badge The object heap badge to use.
+ * @param object The object.
+ */
+static void ShadeObject(const TBadge<FObjectHeap> badge, UObject* object)
+{
+	if (IsObjectMarked(object))
+	{
+		return;
+	}
+
+	object->SetGarbageCollectorMark(badge, GGarbageCollectorMarkValue);
+	GGreyObjects.Add(object);
+}
+
+/**
+ * @brief Defines an object heap visitor that shades every object it visits.
+ */
+class FShadeObjectHeapVisitor : public FObjectHeapVisitor
+{
+public:
+
+	/**
+	 * @brief Sets default values for this heap visitor's properties.
+	 *
+	 * @param badge The object heap badge to use.
+	 */
+	explicit FShadeObjectHeapVisitor(TBadge<FObjectHeap> badge)
+		: m_Badge { badge }
+	{
+	}
+
+	/** @copydoc FObjectHeapVisitor::Visit */
+	virtual void Visit(UObject* object) override
+	{
+		ShadeObject(m_Badge, object);
+	}
+
+private:
+
+	TBadge<FObjectHeap> m_Badge;
+};
+
+/**
+ * @brief Traces grey objects until either there are none left or the step budget has run out.
+ *
+ * @param badge The object heap badge to use.
+ * @param budget The step budget.
+ * @return True if there are no grey objects left, otherwise false.
+ */
+static bool TraceGreyObjects(const TBadge<FObjectHeap> badge, FGarbageCollectorStepBudget& budget)
+{
+	FShadeObjectHeapVisitor shadeVisitor { badge };
+	while (GGreyObjects.Num() > 0)
+	{
+		UObject* object = GGreyObjects.TakeLast();
+		object->VisitReferencedObjects(shadeVisitor);
+
+		if (budget.ConsumeWorkUnit())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief Visits heap cells starting from the heap cursor until either all cells have been visited or the step budget
+ *        has run out. The heap cursor is left where visiting stopped.
+ *
+ * @tparam FunctionType The type of the function to call for each cell.
+ * @param budget The step budget.
+ * @param function The function to call for each cell that holds an object.
+ * @return True if all cells have been visited, otherwise false.
+ */
+template<typename FunctionType>
+static bool VisitHeapCellsFromCursor(FGarbageCollectorStepBudget& budget, FunctionType function)
+{
+	while (GHeapCursorBlockIndex < GObjectHeapBlocks.Num())
+	{
+		FObjectHeapBlock* heapBlock = GObjectHeapBlocks[GHeapCursorBlockIndex].Get();
+
+		const int32 numCells = heapBlock->GetNumCells();
+		while (GHeapCursorCellIndex < numCells)
+		{
+			FObjectHeader* cell = heapBlock->GetCell(GHeapCursorCellIndex);
+			++GHeapCursorCellIndex;
+
+			if (UObject* object = cell->GetObject())
+			{
+				function(heapBlock, cell, object);
+			}
+
+			if (budget.ConsumeWorkUnit())
+			{
+				return false;
+			}
+		}
+
+		++GHeapCursorBlockIndex;
+		GHeapCursorCellIndex = 0;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Resets the heap cursor to the first cell of the first heap block.
+ */
+static void ResetHeapCursor()
+{
+	GHeapCursorBlockIndex = 0;
+	GHeapCursorCellIndex = 0;
+}
+
+/**
+ * @brief Gets the number of threads that should trace objects while marking.
+ *
+ * @return The number of threads that should trace objects while marking.
+ */
+static int32 GetNumMarkThreads()
+{
+	if (GGarbageCollectorSettings.NumMarkThreads <= 0)
+	{
+		return FThread::GetNumLogicalProcessors();
+	}
+
+	return GGarbageCollectorSettings.NumMarkThreads;
+}
+
+/**
+ * @brief Gets the thread pool used to mark objects in parallel, creating it if necessary.
+ *
+ * @return The thread pool used to mark objects in parallel.
+ */
+static FThreadPool& GetMarkThreadPool()
+{
+	// The thread running the collection also marks objects, so it doesn't need a worker of its own
+	const int32 numWorkers = GetNumMarkThreads() - 1;
+	if (GMarkThreadPool.IsValid() == false || GMarkThreadPool->GetNumWorkers() != numWorkers)
+	{
+		GMarkThreadPool = MakeUnique<FThreadPool>(numWorkers);
+	}
+
+	return *GMarkThreadPool;
+}
+
+/**
+ * @brief Shades an object grey while marking in parallel.
+ *
+ * @param badge The object heap badge to use.
+ * @param object The object.
+ * @param greyObjects The calling thread's grey object queue.
+ */
+static void ShadeObjectInParallel(const TBadge<FObjectHeap> badge, UObject* object, FGreyObjectQueue& greyObjects)
+{
+	// Only the thread that actually flips the mark gets to queue the object, so each object is traced exactly once
+	if (object->TrySetGarbageCollectorMark(badge, GGarbageCollectorMarkValue))
+	{
+		greyObjects.Push(object);
+	}
+}
+
+/**
+ * @brief Shades every root object in part of a heap block while marking in parallel.
+ *
+ * @param badge The object heap badge to use.
+ * @param heapBlock The heap block.
+ * @param firstCellIndex The index of the first cell to check.
+ * @param greyObjects The calling thread's grey object queue.
+ */
+static void ShadeRootObjectsInParallel(const TBadge<FObjectHeap> badge, const FObjectHeapBlock& heapBlock, const int32 firstCellIndex, FGreyObjectQueue& greyObjects)
+{
+	const int32 numCells = heapBlock.GetNumCells();
+	for (int32 idx = firstCellIndex; idx < numCells; ++idx)
+	{
+		UObject* object = heapBlock.GetCell(idx)->GetObject();
+		if (object != nullptr && object->ShouldKeepAlive())
+		{
+			ShadeObjectInParallel(badge, object, greyObjects);
+		}
+	}
+}
+
+/**
+ * @brief Defines an object heap visitor that shades every object it visits into a thread's grey object queue.
+ */
+class FParallelShadeObjectHeapVisitor : public FObjectHeapVisitor
+{
+public:
+
+	/**
+	 * @brief Sets default values for this heap visitor's properties.
+	 *
+	 * @param badge The object heap badge to use.
+	 * @param greyObjects The grey object queue of the thread using this visitor.
+	 */
+	FParallelShadeObjectHeapVisitor(TBadge<FObjectHeap> badge, FGreyObjectQueue& greyObjects)
+		: m_Badge { badge }
+		, m_GreyObjects { greyObjects }
+	{
+	}
+
+	/** @copydoc FObjectHeapVisitor::Visit */
+	virtual void Visit(UObject* object) override
+	{
+		ShadeObjectInParallel(m_Badge, object, m_GreyObjects);
+	}
+
+private:
+
+	TBadge<FObjectHeap> m_Badge;
+	FGreyObjectQueue& m_GreyObjects;
+};
+
+/**
+ * @brief Defines the state shared by every thread taking part in a parallel mark.
+ */
+class FParallelMarkContext
+{
+	UM_DISABLE_COPY(FParallelMarkContext);
+	UM_DISABLE_MOVE(FParallelMarkContext);
+
+public:
+
+	/**
+	 * @brief Sets default values for this parallel mark context's properties.
+	 *
+	 * @param badge The object heap badge to use.
+	 * @param budget The step budget.
+	 * @param numMarkers The number of threads taking part in the mark.
+	 */
+	FParallelMarkContext(const TBadge<FObjectHeap> badge, const FGarbageCollectorStepBudget& budget, const int32 numMarkers)
+		: Badge { badge }
+		, Budget { budget }
+	{
+		GreyObjectQueues.Reserve(numMarkers);
+		for (int32 idx = 0; idx < numMarkers; ++idx)
+		{
+			GreyObjectQueues.Add(MakeUnique<FGreyObjectQueue>());
+		}
+	}
+
+	/** @brief The object heap badge to use. */
+	TBadge<FObjectHeap> Badge;
+
+	/** @brief The step budget. */
+	const FGarbageCollectorStepBudget& Budget;
+
+	/** @brief The grey object queue of each thread taking part in the mark. */
+	TArray<TUniquePtr<FGreyObjectQueue>> GreyObjectQueues;
+
+	/** @brief The index of the next heap block whose roots have not been claimed by a thread. */
+	std::atomic<int32> NextRootBlockIndex = 0;
+
+	/** @brief The number of threads that are currently tracing objects. */
+	std::atomic<int32> NumBusyMarkers = 0;
+
+	/** @brief Whether or not the step budget has run out. */
+	std::atomic<bool> IsOutOfTime = false;
+};
+
+/**
+ * @brief Attempts to steal a grey object from another thread taking part in a parallel mark.
+ *
+ * @param context The parallel mark context.
+ * @param markerIndex The index of the calling thread.
+ * @return The stolen object, or nullptr if nothing could be stolen.
+ */
+static UObject* StealGreyObject(FParallelMarkContext& context, const int32 markerIndex)
+{
+	const int32 numMarkers = context.GreyObjectQueues.Num();
+	for (int32 offset = 1; offset < numMarkers; ++offset)
+	{
+		FGreyObjectQueue& victimQueue = *context.GreyObjectQueues[(markerIndex + offset) % numMarkers];
+		if (UObject* object = victimQueue.Steal())
+		{
+			return object;
+		}
+	}
+
+	return nullptr;
+}
+
+/**
+ * @brief Marks objects on the calling thread as part of a parallel mark until either there is no work left anywhere or
+ *        the step budget has run out.
+ *
+ * @param context The parallel mark context.
+ * @param markerIndex The index of the calling thread.
+ */
+static void RunParallelMarker(FParallelMarkContext& context, const int32 markerIndex)
+{
+	GIsMarkingInParallel = true;
+
+	FGreyObjectQueue& greyObjects = *context.GreyObjectQueues[markerIndex];
+	FParallelShadeObjectHeapVisitor shadeVisitor { context.Badge, greyObjects };
+
+	const int32 numHeapBlocks = GObjectHeapBlocks.Num();
+	int32 numWorkUnits = 0;
+	int32 numIdleSpins = 0;
+	bool isBusy = false;
+
+	const auto setBusy = [&context, &isBusy](const bool busy)
+	{
+		if (isBusy != busy)
+		{
+			isBusy = busy;
+			(void)context.NumBusyMarkers.fetch_add(busy ? 1 : -1, std::memory_order_acq_rel);
+		}
+	};
+
+	const auto traceObject = [&](UObject* object)
+	{
+		object->VisitReferencedObjects(shadeVisitor);
+
+		++numWorkUnits;
+		if (numWorkUnits % GNumWorkUnitsPerTimeCheck == 0 && context.Budget.IsExhausted())
+		{
+			context.IsOutOfTime.store(true, std::memory_order_relaxed);
+		}
+	};
+
+	setBusy(true);
+	while (context.IsOutOfTime.load(std::memory_order_relaxed) == false)
+	{
+		// Work through our own queue first, newest first, since those objects are the most likely to still be in cache
+		if (UObject* object = greyObjects.Pop())
+		{
+			numIdleSpins = 0;
+			traceObject(object);
+			continue;
+		}
+
+		// Then take a share of the roots while there are any left
+		if (context.NextRootBlockIndex.load(std::memory_order_relaxed) < numHeapBlocks)
+		{
+			const int32 blockIndex = context.NextRootBlockIndex.fetch_add(1, std::memory_order_relaxed);
+			if (blockIndex < numHeapBlocks)
+			{
+				numIdleSpins = 0;
+				setBusy(true);
+				ShadeRootObjectsInParallel(context.Badge, *GObjectHeapBlocks[blockIndex], 0, greyObjects);
+				continue;
+			}
+		}
+
+		// Then help out the other threads
+		if (UObject* object = StealGreyObject(context, markerIndex))
+		{
+			numIdleSpins = 0;
+			setBusy(true);
+			traceObject(object);
+			continue;
+		}
+
+		// Only a busy thread can create more work, so once none are busy there is nothing left to do anywhere
+		setBusy(false);
+		if (context.NumBusyMarkers.load(std::memory_order_acquire) == 0)
+		{
+			break;
+		}
+
+		// Back off if the other threads are taking a while, since we may be competing with them for a processor
+		++numIdleSpins;
+		if (numIdleSpins < GNumIdleSpinsBeforeSleeping)
+		{
+			FThread::RelaxProcessor();
+		}
+		else
+		{
+			FThread::Sleep(FTimeSpan::FromMilliseconds(0.05));
+		}
+	}
+
+	setBusy(false);
+	GIsMarkingInParallel = false;
+}
+
+/**
+ * @brief Marks objects using multiple threads until either marking has finished or the step budget has run out.
+ *
+ * @param badge The object heap badge to use.
+ * @param budget The step budget.
+ * @return True if marking has finished, otherwise false.
+ */
+static bool MarkInParallel(const TBadge<FObjectHeap> badge, FGarbageCollectorStepBudget& budget)
+{
+	FThreadPool& threadPool = GetMarkThreadPool();
+	FParallelMarkContext context { badge, budget, threadPool.GetNumWorkers() + 1 };
+
+	// Anything already shaded, along with any roots left in a partially scanned heap block, starts out on our own queue
+	FGreyObjectQueue& greyObjects = *context.GreyObjectQueues[0];
+	for (UObject* object : GGreyObjects)
+	{
+		greyObjects.Push(object);
+	}
+	GGreyObjects.Reset();
+
+	if (GGarbageCollectorPhase == EGarbageCollectorPhase::MarkRoots && GHeapCursorBlockIndex < GObjectHeapBlocks.Num())
+	{
+		ShadeRootObjectsInParallel(badge, *GObjectHeapBlocks[GHeapCursorBlockIndex], GHeapCursorCellIndex, greyObjects);
+		context.NextRootBlockIndex.store(GHeapCursorBlockIndex + 1, std::memory_order_relaxed);
+	}
+	else
+	{
+		context.NextRootBlockIndex.store(GObjectHeapBlocks.Num(), std::memory_order_relaxed);
+	}
+
+	const FJobHandle markersCounter = MakeShared<FJobCounter>();
+	for (int32 markerIndex = 1; markerIndex < context.GreyObjectQueues.Num(); ++markerIndex)
+	{
+		threadPool.ScheduleWithCounter(markersCounter, [&context, markerIndex]()
+		{
+			RunParallelMarker(context, markerIndex);
+		});
+	}
+
+	RunParallelMarker(context, 0);
+	threadPool.WaitForCounter(markersCounter);
+
+	// If we ran out of time, hand whatever is left back to the incremental collector for the next step
+	for (TUniquePtr<FGreyObjectQueue>& queue : context.GreyObjectQueues)
+	{
+		while (UObject* object = queue->Steal())
+		{
+			GGreyObjects.Add(object);
+		}
+	}
+
+	const int32 nextRootBlockIndex = context.NextRootBlockIndex.load(std::memory_order_relaxed);
+	if (nextRootBlockIndex < GObjectHeapBlocks.Num())
+	{
+		GGarbageCollectorPhase = EGarbageCollectorPhase::MarkRoots;
+		GHeapCursorBlockIndex = nextRootBlockIndex;
+		GHeapCursorCellIndex = 0;
+		return false;
+	}
+
+	GGarbageCollectorPhase = EGarbageCollectorPhase::Mark;
+	return GGreyObjects.IsEmpty();
+}
+
+/**
+ * @brief Starts a new garbage collection.
+ */
+static void BeginGarbageCollection()
+{
+	UM_ASSERT(GGarbageCollectorPhase == EGarbageCollectorPhase::Idle, "Attempting to begin a garbage collection while one is in progress");
+
+	// Flipping which mark value means "live" makes every object white again without having to visit any of them
+	GGarbageCollectorMarkValue = GGarbageCollectorMarkValue == false;
+	GGarbageCollectorPhase = EGarbageCollectorPhase::MarkRoots;
+	GGarbageCollectionDuration = FTimeSpan::Zero;
+	GAllocationDebt = 0;
+	ResetHeapCursor();
+}
+
+/**
+ * @brief Performs garbage collection work until either the current collection has finished or the step budget has run out.
+ *
+ * @param badge The object heap badge to use.
+ * @param budget The step budget.
+ * @return True if the current collection has finished, otherwise false.
+ */
+static bool AdvanceGarbageCollection(const TBadge<FObjectHeap> badge, FGarbageCollectorStepBudget& budget)
+{
+	// When marking in parallel, roots are shaded and traced at the same time
+	if (IsMarking() && GetNumMarkThreads() > 1)
+	{
+		if (MarkInParallel(badge, budget) == false)
+		{
+			return false;
+		}
+
+		GGarbageCollectorPhase = EGarbageCollectorPhase::Sweep;
+		ResetHeapCursor();
+	}
+
+	// 1. Shade all root objects
+	if (GGarbageCollectorPhase == EGarbageCollectorPhase::MarkRoots)
+	{
+		const bool visitedAllCells = VisitHeapCellsFromCursor(budget, [badge](FObjectHeapBlock*, FObjectHeader*, UObject* object)
+		{
+			if (object->ShouldKeepAlive())
+			{
+				ShadeObject(badge, object);
+			}
+		});
+
+		if (visitedAllCells == false)
+		{
+			return false;
+		}
+
+		GGarbageCollectorPhase = EGarbageCollectorPhase::Mark;
+	}
+
+	// 2. Trace grey objects until there are none left. Any object that gains a reference during this phase is shaded by the
+	//    write barrier, so an object can never be hidden behind one that has already been traced
+	if (GGarbageCollectorPhase == EGarbageCollectorPhase::Mark)
+	{
+		if (TraceGreyObjects(badge, budget) == false)
+		{
+			return false;
+		}
+
+		GGarbageCollectorPhase = EGarbageCollectorPhase::Sweep;
+		ResetHeapCursor();
+	}
 
-	void* objectMemory = nullptr;
-	for (TUniquePtr<FObjectHeapBlock>& heapBlock : GObjectHeapBlocks)
+	// 3. Gather every object that is still white
+	if (GGarbageCollectorPhase == EGarbageCollectorPhase::Sweep)
 	{
-		objectMemory = heapBlock->Allocate(objectClass);
+		const bool visitedAllCells = VisitHeapCellsFromCursor(budget, [badge](FObjectHeapBlock*, FObjectHeader* cell, UObject* object)
+		{
+			if (IsObjectMarked(object) || object->IsMarkedForGarbageCollection())
+			{
+				return;
+			}
+
+			object->SetMarkedForGarbageCollection(badge, true);
+			GObjectsPendingDestruction.Add(cell);
+		});
 
-		if (objectMemory != nullptr)
+		if (visitedAllCells == false)
 		{
-			break;
+			return false;
 		}
+
+		SortObjectHeadersForDestruction(GObjectsPendingDestruction);
+
+		GGarbageCollectorPhase = EGarbageCollectorPhase::Destroy;
+		GNextObjectPendingDestruction = 0;
 	}
 
-	// If we couldn't allocate the memory, we need to create a new heap block suitable for the object
-	if (objectMemory == nullptr)
+	// 4. Delete the gathered objects in reverse allocation order
+	if (GGarbageCollectorPhase == EGarbageCollectorPhase::Destroy)
 	{
-		const int32 suitableCellSize = FObjectHeapBlock::GetAlignedCellSize(objectClass->GetSize());
+		while (GNextObjectPendingDestruction < GObjectsPendingDestruction.Num())
+		{
+			FObjectHeader* cell = GObjectsPendingDestruction[GNextObjectPendingDestruction];
+			++GNextObjectPendingDestruction;
 
-		TUniquePtr<FObjectHeapBlock>& heapBlock = GObjectHeapBlocks.Emplace(FObjectHeapBlock::Create(suitableCellSize));
-		objectMemory = heapBlock->Allocate(objectClass);
-	}
+			// Gathered objects are never rescued once marking has finished, so this only skips cells that are already gone
+			const UObject* object = cell->GetObject();
+			if (object != nullptr && object->IsMarkedForGarbageCollection())
+			{
+				DeleteMarkedCell(badge, cell);
+				++GNumObjectsCollected;
+			}
 
-	UM_ASSERT(objectMemory != nullptr, "Failed to allocate memory for object from heap");
+			if (budget.ConsumeWorkUnit())
+			{
+				return false;
+			}
+		}
+	}
 
-	return objectMemory;
+	return true;
 }
 
 /**
- * @brief Defines an object heap visitor that marks every non-"rooted" object it visits for garbage collection.
+ * @brief Defines an object heap visitor that shades every young object it visits.
  */
-class FMarkObjectForGarbageCollectionHeapVisitor : public FObjectHeapVisitor
+class FShadeYoungObjectHeapVisitor : public FObjectHeapVisitor
 {
 public:
 
@@ -193,7 +967,7 @@ public:
 	 *
 	 * @param badge The object heap badge to use.
 	 */
-	explicit FMarkObjectForGarbageCollectionHeapVisitor(TBadge<FObjectHeap> badge)
+	explicit FShadeYoungObjectHeapVisitor(TBadge<FObjectHeap> badge)
 		: m_Badge { badge }
 	{
 	}
@@ -201,15 +975,11 @@ public:
 	/** @copydoc FObjectHeapVisitor::Visit */
 	virtual void Visit(UObject* object) override
 	{
-		object->SetVisitedByGarbageCollector(m_Badge, false);
-
-		if (object->ShouldKeepAlive())
+		// Minor collections assume every old object is alive, so there's no need to trace through them
+		if (object->IsInOldGeneration() == false)
 		{
-			return;
+			ShadeObject(m_Badge, object);
 		}
-
-		++GNumObjectsMarkedForDeletion;
-		object->SetMarkedForGarbageCollection(m_Badge, true);
 	}
 
 private:
@@ -218,206 +988,437 @@ private:
 };
 
 /**
- * @brief Defines an object heap visitor that un-marks from garbage collection every object referenced by a "rooted" object.
+ * @brief Defines an object heap visitor that checks to see if any of the objects it visits are young.
  */
-class FUnmarkObjectForGarbageCollectionHeapVisitor : public FObjectHeapVisitor
+class FFindYoungObjectHeapVisitor : public FObjectHeapVisitor
 {
 public:
 
 	/**
-	 * @brief Sets default values for this heap visitor's properties.
-	 *
-	 * @param badge The object heap badge to use.
-	 */
-	explicit FUnmarkObjectForGarbageCollectionHeapVisitor(TBadge<FObjectHeap> badge)
-		: m_Badge { badge }
-	{
-	}
-
-	/**
-	 * @brief Checks to see if this object heap visitor is currently tracing a root object.
+	 * @brief Checks to see if any of the visited objects were young.
 	 *
-	 * @return True if this object heap visitor is currently tracing a root object, otherwise false.
+	 * @return True if any of the visited objects were young, otherwise false.
 	 */
-	[[nodiscard]] bool IsTracingRootObject() const
+	[[nodiscard]] bool FoundYoungObject() const
 	{
-		return m_RootObjectCount > 0;
+		return m_FoundYoungObject;
 	}
 
 	/** @copydoc FObjectHeapVisitor::Visit */
 	virtual void Visit(UObject* object) override
 	{
-		if (object->HasBeenVisitedByGarbageCollector())
-		{
-			return;
-		}
-
-		if (object->ShouldKeepAlive())
-		{
-			++m_RootObjectCount;
-			object->SetVisitedByGarbageCollector(m_Badge, true);
-			object->VisitReferencedObjects(*this);
-			--m_RootObjectCount;
-		}
-		else if (IsTracingRootObject())
+		if (object->IsInOldGeneration() == false)
 		{
-			--GNumObjectsMarkedForDeletion;
-
-			object->SetVisitedByGarbageCollector(m_Badge, true);
-			object->SetMarkedForGarbageCollection(m_Badge, false);
-			object->VisitReferencedObjects(*this);
+			m_FoundYoungObject = true;
 		}
 	}
 
 private:
 
-	int64 m_RootObjectCount = 0;
-	TBadge<FObjectHeap> m_Badge;
+	bool m_FoundYoungObject = false;
 };
 
 /**
- * @brief Defines a combination of an object header as well as its owning heap block.
+ * @brief Checks to see if an object is young or references any young objects.
+ *
+ * @param object The object.
+ * @return True if \p object is young or references any young objects, otherwise false.
  */
-class FObjectHeaderAndBlock
+static bool ReferencesYoungObjects(UObject* object)
 {
-public:
+	// Objects visit themselves along with their references, so young objects always count as referencing one
+	FFindYoungObjectHeapVisitor visitor;
+	object->VisitReferencedObjects(visitor);
+
+	return visitor.FoundYoungObject();
+}
 
-	/** @brief The heap block. */
-	FObjectHeapBlock* Block = nullptr;
+/**
+ * @brief Adds an object to the remembered set, which minor collections trace as if it were a root.
+ *
+ * @param badge The object heap badge to use.
+ * @param object The object.
+ */
+static void AddToRememberedSet(const TBadge<FObjectHeap> badge, UObject* object)
+{
+	if (object->IsInRememberedSet())
+	{
+		return;
+	}
 
-	/** @brief The object header. */
-	FObjectHeader* Header = nullptr;
+	object->SetInRememberedSet(badge, true);
+	GRememberedObjects.Add(FObjectHeader::FromObject(object));
+}
 
-	/**
-	 * @brief Created a new object header and heap block pair.
-	 *
-	 * @param block The heap block.
-	 * @param header The object header.
-	 */
-	explicit FObjectHeaderAndBlock(FObjectHeapBlock* block, FObjectHeader* header)
-	    : Block { block }
-	    , Header { header }
+/**
+ * @brief Checks to see if a value of the given type is plain data that can't reference any objects.
+ *
+ * @param type The type.
+ * @return True if \p type is plain data, otherwise false.
+ */
+static bool IsPlainDataType(const FTypeInfo* type)
+{
+	return type != GetType<FObjectPtr>() &&
+	       Cast<FStructInfo>(type) == nullptr &&
+	       Cast<FArrayTypeInfo>(type) == nullptr &&
+	       Cast<FHashMapTypeInfo>(type) == nullptr;
+}
+
+/**
+ * @brief Checks to see if a type has any container properties that could hold references to objects. References held
+ *        by containers live outside of the object that owns them, so the write barrier can't trace them back to it.
+ *
+ * @param type The type.
+ * @return True if \p type has any container properties that could hold references to objects, otherwise false.
+ */
+static bool HasContainersOfObjects(const FStructInfo* type)
+{
+	if (const bool* cachedResult = GTypesWithContainers.Find(type))
 	{
+		return *cachedResult;
 	}
-};
 
-// Used by SortObjectHeadersForDestruction
-inline  const FObjectHeader* GetObjectHeader(const FObjectHeader* header)
+	bool result = false;
+	for (const FStructInfo* currentType = type; currentType != nullptr && result == false; currentType = currentType->GetBaseType())
+	{
+		for (const FPropertyInfo& property : currentType->GetProperties())
+		{
+			const FTypeInfo* valueType = property.GetValueType();
+			if (const FArrayTypeInfo* arrayType = Cast<FArrayTypeInfo>(valueType))
+			{
+				result = IsPlainDataType(arrayType->GetElementType()) == false;
+			}
+			else if (const FHashMapTypeInfo* hashMapType = Cast<FHashMapTypeInfo>(valueType))
+			{
+				result = IsPlainDataType(hashMapType->GetKeyType()) == false || IsPlainDataType(hashMapType->GetValueType()) == false;
+			}
+			else if (const FStructInfo* structType = Cast<FStructInfo>(valueType))
+			{
+				result = structType != type && HasContainersOfObjects(structType);
+			}
+
+			if (result)
+			{
+				break;
+			}
+		}
+	}
+
+	(void)GTypesWithContainers.Add(type, result);
+	return result;
+}
+
+/**
+ * @brief Promotes an object to the old generation.
+ *
+ * @param badge The object heap badge to use.
+ * @param object The object.
+ */
+static void PromoteObject(const TBadge<FObjectHeap> badge, UObject* object)
 {
-	return header;
+	object->SetInOldGeneration(badge, true);
+	object->SetGarbageCollectorAge(badge, 0);
+
+	if (HasContainersOfObjects(object->GetType()))
+	{
+		GOldObjectsWithContainers.Add(FObjectHeader::FromObject(object));
+	}
 }
 
-// Used by SortObjectHeadersForDestruction
-inline const FObjectHeader* GetObjectHeader(const FObjectHeaderAndBlock& headerAndBlock)
+/**
+ * @brief Adds every old object whose containers reference young objects to the remembered set. This only needs to
+ *        happen when references to young objects have been written into containers since the last minor collection.
+ *
+ * @param badge The object heap badge to use.
+ */
+static void RememberOldObjectsWithYoungObjectsInContainers(const TBadge<FObjectHeap> badge)
 {
-	return headerAndBlock.Header;
+	if (GHasYoungReferencesInContainers == false)
+	{
+		return;
+	}
+
+	for (FObjectHeader* cell : GOldObjectsWithContainers)
+	{
+		UObject* object = cell->GetObject();
+		if (object->IsInRememberedSet() == false && ReferencesYoungObjects(object))
+		{
+			AddToRememberedSet(badge, object);
+		}
+	}
+
+	GHasYoungReferencesInContainers = false;
 }
 
 /**
- * @brief Sorts a list of object headers so that "newer" objects are first.
+ * @brief Promotes every young object to the old generation and empties the remembered set. Every object that survives a
+ *        major collection is promoted, since the collection was just as likely to find it alive as a minor one would have.
  *
- * @param headers The list of headers to sort.
+ * @param badge The object heap badge to use.
  */
-template<typename ElementType>
-static void SortObjectHeadersForDestruction(TArray<ElementType>& headers)
+static void PromoteAllYoungObjects(const TBadge<FObjectHeap> badge)
 {
-	headers.Sort([](const ElementType& firstElement, const ElementType& secondElement)
+	// Cells freed by the major collection may still be in these lists, and may even have been reused since. A reused cell
+	// only holds a young object, which is added back below when it's promoted
+	TArray<FObjectHeader*> oldObjectsWithContainers = MoveTemp(GOldObjectsWithContainers);
+	GOldObjectsWithContainers.Reset();
+	for (FObjectHeader* cell : oldObjectsWithContainers)
 	{
-		const FObjectHeader* firstHeader = GetObjectHeader(firstElement);
-		const FObjectHeader* secondHeader = GetObjectHeader(secondElement);
+		const UObject* object = cell->GetObject();
+		if (object != nullptr && object->IsInOldGeneration())
+		{
+			GOldObjectsWithContainers.Add(cell);
+		}
+	}
 
-		const FTimePoint firstTime = firstHeader->GetObjectAllocationTime();
-		const FTimePoint secondTime = secondHeader->GetObjectAllocationTime();
+	for (FObjectHeader* cell : GYoungObjects)
+	{
+		if (UObject* object = cell->GetObject())
+		{
+			PromoteObject(badge, object);
+		}
+	}
 
-		if (firstTime < secondTime)
+	for (FObjectHeader* cell : GRememberedObjects)
+	{
+		if (UObject* object = cell->GetObject())
 		{
-			return ECompareResult::GreaterThan;
+			object->SetInRememberedSet(badge, false);
 		}
-		if (firstTime > secondTime)
+	}
+
+	GYoungObjects.Reset();
+	GRememberedObjects.Reset();
+	GHasYoungReferencesInContainers = false;
+	GNurseryAllocationDebt = 0;
+}
+
+/**
+ * @brief Records that a reference to a young object was written somewhere, so that minor collections can find the
+ *        object without tracing the old generation.
+ *
+ * @param badge The object heap badge to use.
+ * @param location The location the reference was written to.
+ */
+static void RememberYoungObjectReference(const TBadge<FObjectHeap> badge, const void* location)
+{
+	// References on a stack or in static storage are never roots, and are by far the most common, so check for them first
+	if (FMemory::IsAllocatedMemory(location) == false)
+	{
+		return;
+	}
+
+	if (const FObjectHeapBlock* heapBlock = FindHeapBlockContainingLocation(location))
+	{
+		// The reference was written into an object, which only needs to be remembered if it's old
+		const FObjectHeader* ownerCell = heapBlock->FindCellContaining(location);
+		UObject* owner = ownerCell ? ownerCell->GetObject() : nullptr;
+		if (owner != nullptr && owner->IsInOldGeneration())
 		{
-			return ECompareResult::LessThan;
+			AddToRememberedSet(badge, owner);
 		}
-		return ECompareResult::Equals;
-	});
+
+		return;
+	}
+
+	// References anywhere else, such as the elements of an array property, can't be traced back to the object that owns
+	// them. The next minor collection looks for their owners among the old objects that have containers instead
+	GHasYoungReferencesInContainers = true;
 }
 
 /**
- * @brief Defines a heap visitor to gather objects marked for deletion.
+ * @brief Performs one step of the current garbage collection, finishing it if the step budget allows.
+ *
+ * @param badge The object heap badge to use.
+ * @param budget The step budget.
  */
-class FGatherObjectsForDeletionHeapVisitor : public FObjectHeapVisitor
+static void StepGarbageCollection(const TBadge<FObjectHeap> badge, FGarbageCollectorStepBudget& budget)
 {
-public:
+	const bool finishedCollection = AdvanceGarbageCollection(badge, budget);
+	GGarbageCollectionDuration += budget.GetElapsedTime();
 
-	/**
-	 * @brief Sets default values for this heap visitor's properties.
-	 *
-	 * @param badge The object heap badge to use.
-	 */
-	explicit FGatherObjectsForDeletionHeapVisitor(TBadge<FObjectHeap> badge)
-		: m_Badge { badge }
+	if (finishedCollection == false)
+	{
+		return;
+	}
+
+	if (GNumObjectsCollected > 0)
 	{
-		m_ObjectsMarkedForDeletion.Reserve(8);
+		UM_LOG(Info, "Garbage collected {} objects in {}ms ({} ticks)", GNumObjectsCollected, GGarbageCollectionDuration.GetTotalMilliseconds(), GGarbageCollectionDuration.GetTicks());
 	}
 
-	/**
-	 * @brief Sorts object marked for deletion to be deleted in reverse allocation order and then deletes them.
-	 */
-	void SortAndDeleteMarkedObjects()
+	GObjectsPendingDestruction.Reset();
+	GNextObjectPendingDestruction = 0;
+	GNumObjectsCollected = 0;
+	GGarbageCollectorPhase = EGarbageCollectorPhase::Idle;
+
+	PromoteAllYoungObjects(badge);
+}
+
+void FObjectHeap::CollectGarbage()
+{
+	constexpr TBadge<FObjectHeap> badge;
+
+	// Objects allocated during an in-progress collection were assumed to be live, so finish it before starting over
+	if (IsCollectingGarbage())
+	{
+		FGarbageCollectorStepBudget budget { FTimeSpan::MaxValue };
+		StepGarbageCollection(badge, budget);
+	}
+
+	BeginGarbageCollection();
+
+	FGarbageCollectorStepBudget budget { FTimeSpan::MaxValue };
+	StepGarbageCollection(badge, budget);
+}
+
+void FObjectHeap::CollectGarbageIncrementally()
+{
+	if (IsCollectingGarbage() == false)
 	{
-		SortObjectHeadersForDestruction(m_ObjectsMarkedForDeletion);
+		// Minor collections are cheap and pay back some of the allocation debt, so they get the first chance at running
+		if (GNurseryAllocationDebt >= GGarbageCollectorSettings.NurserySize)
+		{
+			CollectYoungGarbage();
+		}
 
-		for (FObjectHeaderAndBlock& headerAndBlock : m_ObjectsMarkedForDeletion)
+		if (GAllocationDebt < GGarbageCollectorSettings.AllocationDebtThreshold)
 		{
-			headerAndBlock.Block->DeleteMarkedCell(m_Badge, headerAndBlock.Header);
+			return;
 		}
+
+		BeginGarbageCollection();
 	}
 
-	/** @copydoc FObjectHeapVisitor::Visit */
-	virtual void Visit(UObject* object) override
+	constexpr TBadge<FObjectHeap> badge;
+	FGarbageCollectorStepBudget budget { GGarbageCollectorSettings.StepTimeBudget };
+	StepGarbageCollection(badge, budget);
+}
+
+void FObjectHeap::CollectYoungGarbage()
+{
+	if (IsCollectingGarbage() || GIsCollectingYoungGarbage)
+	{
+		return;
+	}
+
+	constexpr TBadge<FObjectHeap> badge;
+	const FTimer collectionTimer = FTimer::Start();
+	GIsCollectingYoungGarbage = true;
+
+	// Flipping the mark value makes every young object white. Old objects turn white as well, but minor collections never
+	// look at their marks, and the mark value is flipped back before the collection finishes
+	const bool liveMarkValue = GGarbageCollectorMarkValue;
+	GGarbageCollectorMarkValue = liveMarkValue == false;
+
+	// 1. Shade all young roots, as well as every young object referenced by the remembered set
+	RememberOldObjectsWithYoungObjectsInContainers(badge);
+
+	FShadeYoungObjectHeapVisitor shadeVisitor { badge };
+	for (FObjectHeader* cell : GYoungObjects)
 	{
-		if (object->IsMarkedForGarbageCollection())
+		UObject* object = cell->GetObject();
+		if (object->ShouldKeepAlive())
 		{
-			FObjectHeader* objectHeader = FObjectHeader::FromObject(object);
-			FObjectHeapBlock* heapBlock = GetHeapBlockForObjectHeader(objectHeader);
-			(void)m_ObjectsMarkedForDeletion.Emplace(heapBlock, objectHeader);
+			ShadeObject(badge, object);
 		}
 	}
 
-private:
+	for (FObjectHeader* cell : GRememberedObjects)
+	{
+		cell->GetObject()->VisitReferencedObjects(shadeVisitor);
+	}
 
-	TArray<FObjectHeaderAndBlock> m_ObjectsMarkedForDeletion;
-	TBadge<FObjectHeap> m_Badge;
-};
+	// 2. Trace grey objects until there are none left
+	while (GGreyObjects.Num() > 0)
+	{
+		UObject* object = GGreyObjects.TakeLast();
+		object->VisitReferencedObjects(shadeVisitor);
+	}
 
-void FObjectHeap::CollectGarbage()
-{
-	constexpr TBadge<FObjectHeap> badge;
+	// 3. Gather every young object that is still white, and age the rest
+	const int32 promotionAge = FMath::Clamp(GGarbageCollectorSettings.NumMinorCollectionsBeforePromotion, 1, UObject::MaxGarbageCollectorAge);
 
-	FTimer collectionStartTime = FTimer::Start();
+	TArray<FObjectHeader*> survivingYoungObjects;
+	TArray<UObject*> promotedObjects;
+	for (FObjectHeader* cell : GYoungObjects)
+	{
+		UObject* object = cell->GetObject();
+		if (IsObjectMarked(object) == false)
+		{
+			object->SetMarkedForGarbageCollection(badge, true);
+			GObjectsPendingDestruction.Add(cell);
+			continue;
+		}
+
+		// Major collections expect every object to have the same mark when they begin, so put survivors back to the live mark
+		object->SetGarbageCollectorMark(badge, liveMarkValue);
+
+		const int32 age = object->GetGarbageCollectorAge() + 1;
+		if (age >= promotionAge)
+		{
+			PromoteObject(badge, object);
+			promotedObjects.Add(object);
+		}
+		else
+		{
+			object->SetGarbageCollectorAge(badge, age);
+			survivingYoungObjects.Add(cell);
+		}
+	}
+
+	GYoungObjects = MoveTemp(survivingYoungObjects);
+	GGarbageCollectorMarkValue = liveMarkValue;
+
+	// 4. Rebuild the remembered set, keeping only objects that still reference the young generation. Newly promoted objects
+	//    may reference objects that are still young, so they need to be considered as well
+	TArray<FObjectHeader*> previousRememberedObjects = MoveTemp(GRememberedObjects);
+	GRememberedObjects.Reset();
 
-	// 1. Mark all objects
-	GNumObjectsMarkedForDeletion = 0;
-	FMarkObjectForGarbageCollectionHeapVisitor markVisitor { badge };
-	VisitObjectsInHeapBlocks(markVisitor);
+	for (FObjectHeader* cell : previousRememberedObjects)
+	{
+		UObject* object = cell->GetObject();
+		object->SetInRememberedSet(badge, false);
 
-	// 2. Un-mark all live objects
-	FUnmarkObjectForGarbageCollectionHeapVisitor unmarkVisitor { badge };
-	VisitObjectsInHeapBlocks(unmarkVisitor);
+		if (ReferencesYoungObjects(object))
+		{
+			AddToRememberedSet(badge, object);
+		}
+	}
 
-	// 3. Delete all marked objects
-	if (GNumObjectsMarkedForDeletion > 0)
+	for (UObject* object : promotedObjects)
 	{
-		FGatherObjectsForDeletionHeapVisitor gatherAndDeleteVisitor { badge };
-		VisitObjectsInHeapBlocks(gatherAndDeleteVisitor);
-		gatherAndDeleteVisitor.SortAndDeleteMarkedObjects();
+		if (ReferencesYoungObjects(object))
+		{
+			AddToRememberedSet(badge, object);
+		}
 	}
 
-	const FTimeSpan collectionDuration = collectionStartTime.Stop();
-	if (GNumObjectsMarkedForDeletion > 0)
+	// 5. Delete the gathered objects in reverse allocation order
+	SortObjectHeadersForDestruction(GObjectsPendingDestruction);
+
+	int64 numBytesCollected = 0;
+	for (FObjectHeader* cell : GObjectsPendingDestruction)
 	{
-		UM_LOG(Info, "Garbage collected {} objects in {}ms ({} ticks)", GNumObjectsMarkedForDeletion, collectionDuration.GetTotalMilliseconds(), collectionDuration.GetTicks());
-		GNumObjectsMarkedForDeletion = 0;
+		numBytesCollected += cell->GetObjectType()->GetSize();
+		DeleteMarkedCell(badge, cell);
 	}
+
+	const int32 numObjectsCollected = GObjectsPendingDestruction.Num();
+	GObjectsPendingDestruction.Reset();
+
+	// Whatever a minor collection frees no longer counts towards starting a major collection
+	GAllocationDebt = FMath::Max(GAllocationDebt - numBytesCollected, static_cast<int64>(0));
+	GNurseryAllocationDebt = 0;
+	GIsCollectingYoungGarbage = false;
+
+	const FTimeSpan collectionDuration = collectionTimer.GetElapsedTime();
+	UM_LOG(Verbose, "Minor garbage collection collected {} objects and promoted {} in {}ms ({} ticks)", numObjectsCollected, promotedObjects.Num(), collectionDuration.GetTotalMilliseconds(), collectionDuration.GetTicks());
+}
+
+const FGarbageCollectorSettings& FObjectHeap::GetGarbageCollectorSettings()
+{
+	return GGarbageCollectorSettings;
 }
 
 TErrorOr<void> FObjectHeap::Initialize(TBadge<class FEngineInitializer>)
@@ -429,7 +1430,7 @@ TErrorOr<void> FObjectHeap::Initialize(TBadge<class FEngineInitializer>)
 
 	for (const int32 cellSize : FObjectHeapBlock::GetAlignedCellSizes())
 	{
-		(void)GObjectHeapBlocks.Emplace(FObjectHeapBlock::Create(cellSize));
+		CreateHeapBlock(cellSize);
 	}
 
 	if (GObjectHeapBlocks.IsEmpty())
@@ -440,6 +1441,16 @@ TErrorOr<void> FObjectHeap::Initialize(TBadge<class FEngineInitializer>)
 	return {};
 }
 
+bool FObjectHeap::IsCollectingGarbage()
+{
+	return GGarbageCollectorPhase != EGarbageCollectorPhase::Idle;
+}
+
+void FObjectHeap::SetGarbageCollectorSettings(const FGarbageCollectorSettings& settings)
+{
+	GGarbageCollectorSettings = settings;
+}
+
 void FObjectHeap::Shutdown(TBadge<class FEngineInitializer>)
 {
 	if (GObjectHeapBlocks.IsEmpty())
@@ -478,6 +1489,24 @@ void FObjectHeap::Shutdown(TBadge<class FEngineInitializer>)
 		heapBlock.Reset();
 	}
 	GObjectHeapBlocks.Reset();
+	GHeapBlocksWithFreeCells.Clear();
+	GHeapBlocksSortedByAddress.Reset();
+
+	GGarbageCollectorPhase = EGarbageCollectorPhase::Idle;
+	GGreyObjects.Reset();
+	GObjectsPendingDestruction.Reset();
+	GNextObjectPendingDestruction = 0;
+	GNumObjectsCollected = 0;
+	GAllocationDebt = 0;
+	GYoungObjects.Reset();
+	GRememberedObjects.Reset();
+	GOldObjectsWithContainers.Reset();
+	GTypesWithContainers.Clear();
+	GHasYoungReferencesInContainers = false;
+	GNurseryAllocationDebt = 0;
+	ResetHeapCursor();
+
+	GMarkThreadPool.Reset();
 }
 
 void FObjectHeap::NotifyObjectCreated(UObject* object, const FObjectCreationContext& context)
@@ -500,22 +1529,45 @@ void FObjectHeap::SetObjectParent(UObject* object, FObjectPtr parent)
 	object->SetParent(badge, MoveTemp(parent));
 }
 
-void FObjectHeap::SetObjectName(UObject* object, FStringView name, uint64 nameCounter)
+void FObjectHeap::SetObjectName(UObject* object, const FStringView name, const uint32 nameCounter)
 {
 	constexpr TBadge<FObjectHeap> badge;
 
-	FStringBuilder nameBuilder;
-	if (name.IsEmpty())
+	// The counter is kept as the name's number so that objects with the same name all share one name table entry
+	const FStringView plainName = name.IsEmpty() ? object->GetType()->GetName() : name;
+	object->SetName(badge, FName { plainName, nameCounter });
+}
+
+void FObjectHeap::WriteBarrier(UObject* object)
+{
+	// Threads marking in parallel are only ever copying references they are already tracing
+	if (object == nullptr || GIsMarkingInParallel || IsMarking() == false)
 	{
-		nameBuilder.Append(object->GetType()->GetName());
+		return;
 	}
-	else
+
+	constexpr TBadge<FObjectHeap> badge;
+	ShadeObject(badge, object);
+}
+
+void FObjectHeap::WriteBarrier(const FObjectPtr& objectPtr)
+{
+	if (GIsMarkingInParallel)
 	{
-		nameBuilder.Append(name);
+		return;
 	}
 
-	nameBuilder.Append("_"_sv);
-	nameBuilder.Append(nameCounter);
+	if (IsCollectingGarbage())
+	{
+		WriteBarrier(objectPtr.GetObject());
+		return;
+	}
 
-	object->SetName(badge, nameBuilder.ReleaseString());
+	// Every object is promoted once a major collection finishes, so only references written outside of one need to be remembered
+	UObject* object = objectPtr.GetObject();
+	if (object != nullptr && object->IsInOldGeneration() == false)
+	{
+		constexpr TBadge<FObjectHeap> badge;
+		RememberYoungObjectReference(badge, &objectPtr);
+	}
 }
\ No newline at end of file
@@ -35,10 +35,32 @@ static const TStaticArray<int32, 11> GObjectHeapBlockSizes
 	1024
 }};
 
-FObjectHeapBlock::FObjectHeapBlock(const int32 cellSize)
+// Objects that do not fit in a cell of this size are given a heap block of their own
+static const int32 GLargestAlignedCellSize = GObjectHeapBlockSizes[GObjectHeapBlockSizes.Num() - 1];
+
+/**
+ * @brief Gets the number of bytes to allocate for a heap block with the given cell size.
+ *
+ * @param cellSize The heap block's cell size.
+ * @return The number of bytes to allocate for the heap block.
+ */
+static int32 GetHeapBlockAllocationSize(const int32 cellSize)
+{
+	if (cellSize <= GLargestAlignedCellSize)
+	{
+		return FObjectHeapBlock::BlockSize;
+	}
+
+	const int32 minAllocationSize = static_cast<int32>(sizeof(FObjectHeapBlock)) + cellSize;
+	return (minAllocationSize + FObjectHeapBlock::BlockSize - 1) & ~(FObjectHeapBlock::BlockSize - 1);
+}
+
+FObjectHeapBlock::FObjectHeapBlock(const int32 cellSize, const int32 allocationSize)
 	: m_CellSize { cellSize }
+	, m_AllocationSize { allocationSize }
 {
-	UM_ASSERT(GObjectHeapBlockSizes.Contains(cellSize), "Given cell size is not supported");
+	UM_ASSERT(GObjectHeapBlockSizes.Contains(cellSize) || cellSize > GLargestAlignedCellSize, "Given cell size is not supported");
+	UM_ASSERT(allocationSize == GetHeapBlockAllocationSize(cellSize), "Given allocation size does not match cell size");
 
 	m_FreeList = GetCell(0);
 
@@ -102,8 +124,10 @@ bool FObjectHeapBlock::CanAllocate(const int32 size)
 
 TUniquePtr<FObjectHeapBlock> FObjectHeapBlock::Create(const int32 cellSize)
 {
-	void* heapBlockLocation = FMemory::Allocate(FObjectHeapBlock::BlockSize);
-	FMemory::ConstructObjectAt<FObjectHeapBlock>(heapBlockLocation, cellSize);
+	// Aligning each block to the block size means the block that owns a cell can be found by just masking the cell's address
+	const int32 allocationSize = GetHeapBlockAllocationSize(cellSize);
+	void* heapBlockLocation = FMemory::AllocateAligned(allocationSize, FObjectHeapBlock::BlockSize);
+	FMemory::ConstructObjectAt<FObjectHeapBlock>(heapBlockLocation, cellSize, allocationSize);
 
 	return TUniquePtr<FObjectHeapBlock> { reinterpret_cast<FObjectHeapBlock*>(heapBlockLocation) };
 }
@@ -135,6 +159,26 @@ void FObjectHeapBlock::DeleteMarkedObjects()
 	}
 }
 
+FObjectHeader* FObjectHeapBlock::FindCellContaining(const void* location) const
+{
+	const uint8* firstCellLocation = reinterpret_cast<const uint8*>(this) + sizeof(FObjectHeapBlock);
+	const uint8* byteLocation = static_cast<const uint8*>(location);
+	if (byteLocation < firstCellLocation)
+	{
+		return nullptr;
+	}
+
+	const int32 cellIndex = static_cast<int32>((byteLocation - firstCellLocation) / m_CellSize);
+	return GetCell(cellIndex);
+}
+
+FObjectHeapBlock* FObjectHeapBlock::FromCell(const FObjectHeader* cell)
+{
+	// Every cell's header lies within the first BlockSize bytes of its block, even in blocks for large objects
+	const uintptr cellAddress = reinterpret_cast<uintptr>(cell);
+	return reinterpret_cast<FObjectHeapBlock*>(cellAddress & ~static_cast<uintptr>(BlockSize - 1));
+}
+
 int32 FObjectHeapBlock::GetAlignedCellSize(const int32 objectSize)
 {
 	const int32 index = GObjectHeapBlockSizes.IndexOfByPredicate([objectSize](const int32 cellSize)
@@ -142,9 +186,14 @@ int32 FObjectHeapBlock::GetAlignedCellSize(const int32 objectSize)
 		return cellSize - static_cast<int32>(sizeof(FObjectHeader)) >= objectSize;
 	});
 
-	UM_ASSERT(index != INDEX_NONE, "Given object size is too large for any cell size");
+	if (index != INDEX_NONE)
+	{
+		return GObjectHeapBlockSizes[index];
+	}
 
-	return GObjectHeapBlockSizes[index];
+	// Large objects get a block with a single cell that takes up all of the block's memory
+	const int32 minCellSize = static_cast<int32>(sizeof(FObjectHeader)) + objectSize;
+	return GetHeapBlockAllocationSize(minCellSize) - static_cast<int32>(sizeof(FObjectHeapBlock));
 }
 
 TSpan<const int32> FObjectHeapBlock::GetAlignedCellSizes()
@@ -152,6 +201,11 @@ TSpan<const int32> FObjectHeapBlock::GetAlignedCellSizes()
 	return GObjectHeapBlockSizes;
 }
 
+int32 FObjectHeapBlock::GetAllocationSize() const
+{
+	return m_AllocationSize;
+}
+
 FObjectHeader* FObjectHeapBlock::GetCell(const int32 index) const
 {
 	if (index < 0 || index >= GetNumCells())
@@ -165,17 +219,27 @@ FObjectHeader* FObjectHeapBlock::GetCell(const int32 index) const
 	return reinterpret_cast<FObjectHeader*>(firstCellLocation + index * m_CellSize);
 }
 
+int32 FObjectHeapBlock::GetCellSize() const
+{
+	return m_CellSize;
+}
+
 int32 FObjectHeapBlock::GetNumCells() const
 {
-	constexpr int32 memorySizeForCells = FObjectHeapBlock::BlockSize - sizeof(FObjectHeapBlock);
+	const int32 memorySizeForCells = m_AllocationSize - static_cast<int32>(sizeof(FObjectHeapBlock));
 	return memorySizeForCells / m_CellSize;
 }
 
+bool FObjectHeapBlock::HasFreeCells() const
+{
+	return m_FreeList != nullptr;
+}
+
 bool FObjectHeapBlock::OwnsCell(const FObjectHeader* cell) const
 {
 	const uint8* startLocation = reinterpret_cast<const uint8*>(this) + sizeof(FObjectHeapBlock);
-	const uint8* endLocation = startLocation + FObjectHeapBlock::BlockSize;
-	const void* cellLocation = static_cast<const void*>(cell);
+	const uint8* endLocation = reinterpret_cast<const uint8*>(this) + m_AllocationSize;
+	const uint8* cellLocation = reinterpret_cast<const uint8*>(cell);
 
-	return cellLocation >= startLocation && cellLocation <= endLocation;
+	return cellLocation >= startLocation && cellLocation < endLocation;
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Containers/Array.h"
+#include "Math/Math.h"
 #include "Object/ObjectHeader.h"
 #include "Memory/UniquePtr.h"
 
@@ -17,10 +18,13 @@ class FObjectHeapBlock final
 public:
 
 	/**
-	 * @brief Gets the allocated size of each heap block.
+	 * @brief Gets the allocated size, as well as the alignment, of each heap block. Blocks for objects that are too large
+	 *        for any aligned cell size span a multiple of this size instead.
 	 */
 	static constexpr int32 BlockSize = 16 * 1024;
 
+	static_assert(FMath::IsPowerOfTwo(BlockSize), "Heap block size must be a power of two");
+
 	/**
 	 * @brief Destroys this object heap block.
 	 */
@@ -70,7 +74,24 @@ public:
 	void DeleteMarkedObjects();
 
 	/**
-	 * @brief Gets the next cell size for a given object size.
+	 * @brief Finds the cell in this heap block that contains the given location.
+	 *
+	 * @param location The location.
+	 * @return The cell that contains \p location, or nullptr if no cell in this heap block contains it.
+	 */
+	[[nodiscard]] FObjectHeader* FindCellContaining(const void* location) const;
+
+	/**
+	 * @brief Gets the heap block that owns the given cell.
+	 *
+	 * @param cell The cell.
+	 * @return The heap block that owns \p cell.
+	 */
+	[[nodiscard]] static FObjectHeapBlock* FromCell(const FObjectHeader* cell);
+
+	/**
+	 * @brief Gets the next cell size for a given object size. Objects too large for any of the aligned cell sizes are
+	 *        given a cell size that fills a heap block of their own.
 	 *
 	 * @param objectSize The size of the object.
 	 * @return The cell size for the object size.
@@ -84,6 +105,13 @@ public:
 	 */
 	[[nodiscard]] static TSpan<const int32> GetAlignedCellSizes();
 
+	/**
+	 * @brief Gets the number of bytes allocated for this heap block, including the block itself.
+	 *
+	 * @return The number of bytes allocated for this heap block.
+	 */
+	[[nodiscard]] int32 GetAllocationSize() const;
+
 	/**
 	 * @brief Gets the cell at the given index.
 	 *
@@ -92,6 +120,13 @@ public:
 	 */
 	[[nodiscard]] FObjectHeader* GetCell(int32 index) const;
 
+	/**
+	 * @brief Gets the size of each cell in this block.
+	 *
+	 * @return The size of each cell in this block.
+	 */
+	[[nodiscard]] int32 GetCellSize() const;
+
 	/**
 	 * @brief Gets the number of cells in this block.
 	 *
@@ -99,6 +134,13 @@ public:
 	 */
 	[[nodiscard]] int32 GetNumCells() const;
 
+	/**
+	 * @brief Checks to see if this heap block has at least one free cell.
+	 *
+	 * @return True if this heap block has at least one free cell, otherwise false.
+	 */
+	[[nodiscard]] bool HasFreeCells() const;
+
 	/**
 	 * @brief Checks to see if this heap block owns the given cell.
 	 *
@@ -112,10 +154,12 @@ private:
 	/**
 	 * @brief Creates a new object heap block.
 	 *
-	 * @param cellSize
+	 * @param cellSize The heap block's cell size.
+	 * @param allocationSize The number of bytes allocated for the heap block, including the block itself.
 	 */
-	explicit FObjectHeapBlock(int32 cellSize);
+	FObjectHeapBlock(int32 cellSize, int32 allocationSize);
 
 	FObjectHeader* m_FreeList = nullptr;
 	int32 m_CellSize = 0;
+	int32 m_AllocationSize = 0;
 };
\ No newline at end of file
@@ -5,14 +5,15 @@
 DEFINE_PRIMITIVE_TYPE_DEFINITION(FObjectPtr)
 
 FObjectPtr::FObjectPtr(UObject* object)
-	: m_ObjectHeader { FObjectHeader::FromObject(object) }
 {
 	if (object == nullptr)
 	{
 		return;
 	}
 
+	m_ObjectHeader = FObjectHeader::FromObject(object);
 	m_ObjectHash = object->GetHash();
+	ApplyWriteBarrier();
 }
 
 FObjectPtr::FObjectPtr(const UObject* object)
@@ -20,6 +21,20 @@ FObjectPtr::FObjectPtr(const UObject* object)
 {
 }
 
+FObjectPtr::FObjectPtr(const FObjectPtr& other)
+	: m_ObjectHeader { other.m_ObjectHeader }
+	, m_ObjectHash { other.m_ObjectHash }
+{
+	ApplyWriteBarrier();
+}
+
+FObjectPtr::FObjectPtr(FObjectPtr&& other) noexcept
+	: m_ObjectHeader { other.m_ObjectHeader }
+	, m_ObjectHash { other.m_ObjectHash }
+{
+	ApplyWriteBarrier();
+}
+
 UObject* FObjectPtr::GetObject() const
 {
 	if (m_ObjectHeader != nullptr &&
@@ -61,4 +76,30 @@ void FObjectPtr::Reset()
 UObject* FObjectPtr::operator->() const
 {
 	return GetObject();
+}
+
+FObjectPtr& FObjectPtr::operator=(const FObjectPtr& other)
+{
+	m_ObjectHeader = other.m_ObjectHeader;
+	m_ObjectHash = other.m_ObjectHash;
+	ApplyWriteBarrier();
+
+	return *this;
+}
+
+FObjectPtr& FObjectPtr::operator=(FObjectPtr&& other) noexcept
+{
+	m_ObjectHeader = other.m_ObjectHeader;
+	m_ObjectHash = other.m_ObjectHash;
+	ApplyWriteBarrier();
+
+	return *this;
+}
+
+void FObjectPtr::ApplyWriteBarrier() const
+{
+	if (m_ObjectHeader != nullptr)
+	{
+		FObjectHeap::WriteBarrier(*this);
+	}
 }
\ No newline at end of file
@@ -0,0 +1,21 @@
+#include "GarbageCollectionTestClasses.h"
+
+TArray<int32>& UGarbageCollectionTestNode::GetDestroyedNodeIds()
+{
+	static TArray<int32> GDestroyedNodeIds;
+	return GDestroyedNodeIds;
+}
+
+void UGarbageCollectionTestNode::Destroyed()
+{
+	GetDestroyedNodeIds().Add(Id);
+
+	if (CopyFirstWhenDestroyed)
+	{
+		// Copying a pointer runs the write barrier, which must not bring an unreachable object back to life
+		const TObjectPtr<UGarbageCollectionTestNode> first = First;
+		(void)first;
+	}
+
+	Super::Destroyed();
+}
\ No newline at end of file
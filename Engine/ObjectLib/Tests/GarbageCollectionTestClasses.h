@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/StaticArray.h"
+#include "Object/Object.h"
+#include "GarbageCollectionTestClasses.Generated.h"
+
+UM_CLASS()
+class UGarbageCollectionTestNode : public UObject
+{
+	UM_GENERATED_BODY();
+
+public:
+
+	/**
+	 * @brief Gets the IDs of all test nodes that have been destroyed, in the order they were destroyed in.
+	 *
+	 * @return The IDs of all test nodes that have been destroyed.
+	 */
+	[[nodiscard]] static TArray<int32>& GetDestroyedNodeIds();
+
+	UM_PROPERTY()
+	TObjectPtr<UGarbageCollectionTestNode> First;
+
+	UM_PROPERTY()
+	TObjectPtr<UGarbageCollectionTestNode> Second;
+
+	UM_PROPERTY()
+	TArray<TObjectPtr<UGarbageCollectionTestNode>> Children;
+
+	UM_PROPERTY()
+	int32 Id = 0;
+
+	/** @brief Whether or not this node copies its first child pointer when it is destroyed. */
+	bool CopyFirstWhenDestroyed = false;
+
+protected:
+
+	/** @copydoc UObject::Destroyed */
+	virtual void Destroyed() override;
+};
+
+UM_CLASS()
+class UGarbageCollectionTestLargeNode : public UGarbageCollectionTestNode
+{
+	UM_GENERATED_BODY();
+
+public:
+
+	/** @brief Extra data that makes this node too large for any of the object heap's aligned cell sizes. */
+	TStaticArray<uint8, 4096> Payload;
+};
\ No newline at end of file
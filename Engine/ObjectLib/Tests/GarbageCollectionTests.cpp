@@ -0,0 +1,513 @@
+#include "Object/Object.h"
+#include "Object/ObjectHeap.h"
+#include "Templates/NumericLimits.h"
+#include "GarbageCollectionTestClasses.h"
+#include <gtest/gtest.h>
+
+/**
+ * @brief Creates a garbage collection test node.
+ *
+ * @param id The node's ID.
+ * @return The node.
+ */
+static TObjectPtr<UGarbageCollectionTestNode> MakeTestNode(const int32 id)
+{
+	TObjectPtr<UGarbageCollectionTestNode> node = MakeObject<UGarbageCollectionTestNode>();
+	node->Id = id;
+	return node;
+}
+
+/**
+ * @brief Sets the garbage collector settings for the duration of a test.
+ */
+class FScopedGarbageCollectorSettings
+{
+public:
+
+	explicit FScopedGarbageCollectorSettings(const FGarbageCollectorSettings& settings)
+		: m_PreviousSettings { FObjectHeap::GetGarbageCollectorSettings() }
+	{
+		FObjectHeap::SetGarbageCollectorSettings(settings);
+	}
+
+	~FScopedGarbageCollectorSettings()
+	{
+		FObjectHeap::SetGarbageCollectorSettings(m_PreviousSettings);
+	}
+
+private:
+
+	FGarbageCollectorSettings m_PreviousSettings;
+};
+
+TEST(GarbageCollectionTests, CollectsUnreachableObjects)
+{
+	FObjectHeap::CollectGarbage();
+
+	TObjectPtr<UGarbageCollectionTestNode> root = MakeTestNode(1);
+	root->SetShouldKeepAlive(true);
+	root->First = MakeTestNode(2);
+	root->First->Second = MakeTestNode(3);
+
+	const TObjectPtr<UGarbageCollectionTestNode> child = root->First;
+	const TObjectPtr<UGarbageCollectionTestNode> grandchild = child->Second;
+	const TObjectPtr<UGarbageCollectionTestNode> orphan = MakeTestNode(4);
+
+	FObjectHeap::CollectGarbage();
+	EXPECT_FALSE(FObjectHeap::IsCollectingGarbage());
+	EXPECT_TRUE(root.IsValid());
+	EXPECT_TRUE(child.IsValid());
+	EXPECT_TRUE(grandchild.IsValid());
+	EXPECT_TRUE(orphan.IsNull());
+
+	root->First = nullptr;
+	FObjectHeap::CollectGarbage();
+	EXPECT_TRUE(root.IsValid());
+	EXPECT_TRUE(child.IsNull());
+	EXPECT_TRUE(grandchild.IsNull());
+
+	root->SetShouldKeepAlive(false);
+	FObjectHeap::CollectGarbage();
+	EXPECT_TRUE(root.IsNull());
+}
+
+TEST(GarbageCollectionTests, DestroysNewestObjectsFirst)
+{
+	FObjectHeap::CollectGarbage();
+	UGarbageCollectionTestNode::GetDestroyedNodeIds().Reset();
+
+	for (int32 id = 1; id <= 4; ++id)
+	{
+		(void)MakeTestNode(id);
+	}
+
+	FObjectHeap::CollectGarbage();
+
+	const TArray<int32>& destroyedIds = UGarbageCollectionTestNode::GetDestroyedNodeIds();
+	ASSERT_EQ(destroyedIds.Num(), 4);
+	EXPECT_EQ(destroyedIds[0], 4);
+	EXPECT_EQ(destroyedIds[1], 3);
+	EXPECT_EQ(destroyedIds[2], 2);
+	EXPECT_EQ(destroyedIds[3], 1);
+}
+
+TEST(GarbageCollectionTests, IncrementalCollectionWaitsForAllocationDebt)
+{
+	FObjectHeap::CollectGarbage();
+
+	FGarbageCollectorSettings settings;
+	settings.AllocationDebtThreshold = 16 * static_cast<int64>(sizeof(UGarbageCollectionTestNode));
+	FScopedGarbageCollectorSettings scopedSettings { settings };
+
+	const TObjectPtr<UGarbageCollectionTestNode> firstOrphan = MakeTestNode(1);
+	FObjectHeap::CollectGarbageIncrementally();
+	EXPECT_FALSE(FObjectHeap::IsCollectingGarbage());
+	EXPECT_TRUE(firstOrphan.IsValid());
+
+	for (int32 id = 2; id <= 16; ++id)
+	{
+		(void)MakeTestNode(id);
+	}
+
+	FObjectHeap::CollectGarbageIncrementally();
+	while (FObjectHeap::IsCollectingGarbage())
+	{
+		FObjectHeap::CollectGarbageIncrementally();
+	}
+
+	EXPECT_TRUE(firstOrphan.IsNull());
+}
+
+TEST(GarbageCollectionTests, IncrementalCollectionIsSplitIntoSteps)
+{
+	FObjectHeap::CollectGarbage();
+
+	FGarbageCollectorSettings settings;
+	settings.StepTimeBudget = FTimeSpan::Zero;
+	settings.AllocationDebtThreshold = 0;
+	FScopedGarbageCollectorSettings scopedSettings { settings };
+
+	TArray<TObjectPtr<UGarbageCollectionTestNode>> orphans;
+	for (int32 id = 0; id < 256; ++id)
+	{
+		orphans.Add(MakeTestNode(id));
+	}
+
+	int32 numSteps = 0;
+	do
+	{
+		FObjectHeap::CollectGarbageIncrementally();
+		++numSteps;
+	}
+	while (FObjectHeap::IsCollectingGarbage());
+
+	EXPECT_GT(numSteps, 1);
+	for (const TObjectPtr<UGarbageCollectionTestNode>& orphan : orphans)
+	{
+		EXPECT_TRUE(orphan.IsNull());
+	}
+}
+
+TEST(GarbageCollectionTests, WriteBarrierKeepsStoredObjectAlive)
+{
+	FObjectHeap::CollectGarbage();
+
+	FGarbageCollectorSettings settings;
+	settings.StepTimeBudget = FTimeSpan::Zero;
+	settings.AllocationDebtThreshold = 0;
+	settings.NurserySize = TNumericLimits<int64>::MaxValue;
+	FScopedGarbageCollectorSettings scopedSettings { settings };
+
+	TObjectPtr<UGarbageCollectionTestNode> root = MakeTestNode(1);
+	root->SetShouldKeepAlive(true);
+
+	// A long chain of reachable nodes keeps marking going for many steps after the root has been traced
+	root->Second = MakeTestNode(2);
+	TObjectPtr<UGarbageCollectionTestNode> tail = root->Second;
+	for (int32 id = 3; id < 1024; ++id)
+	{
+		tail->Second = MakeTestNode(id);
+		tail = tail->Second;
+	}
+
+	// Only referenced from the stack, so the collector has no way to find it on its own
+	const TObjectPtr<UGarbageCollectionTestNode> hidden = MakeTestNode(1024);
+	const TObjectPtr<UGarbageCollectionTestNode> canary = MakeTestNode(1025);
+
+	// Step until the root has been traced but the tail of the chain has not, which means marking is still in progress
+	const auto isRootTracedWhileMarking = [&root, &tail]()
+	{
+		const bool liveMarkValue = root->GetGarbageCollectorMark();
+		return root->Second->GetGarbageCollectorMark() == liveMarkValue && tail->GetGarbageCollectorMark() != liveMarkValue;
+	};
+
+	FObjectHeap::CollectGarbageIncrementally();
+	while (FObjectHeap::IsCollectingGarbage() && isRootTracedWhileMarking() == false)
+	{
+		FObjectHeap::CollectGarbageIncrementally();
+	}
+
+	ASSERT_TRUE(FObjectHeap::IsCollectingGarbage());
+	root->First = hidden;
+
+	while (FObjectHeap::IsCollectingGarbage())
+	{
+		FObjectHeap::CollectGarbageIncrementally();
+	}
+
+	EXPECT_TRUE(canary.IsNull());
+	EXPECT_TRUE(hidden.IsValid());
+	EXPECT_TRUE(tail.IsValid());
+	EXPECT_EQ(root->First, hidden);
+
+	root->SetShouldKeepAlive(false);
+	FObjectHeap::CollectGarbage();
+	EXPECT_TRUE(root.IsNull());
+	EXPECT_TRUE(hidden.IsNull());
+	EXPECT_TRUE(tail.IsNull());
+}
+
+TEST(GarbageCollectionTests, WriteBarrierDoesNotResurrectObjectsAfterMarking)
+{
+	FObjectHeap::CollectGarbage();
+	UGarbageCollectionTestNode::GetDestroyedNodeIds().Reset();
+
+	// Newer objects are destroyed first, so the second node is still around when the first one's Destroyed() runs
+	const TObjectPtr<UGarbageCollectionTestNode> second = MakeTestNode(2);
+	const TObjectPtr<UGarbageCollectionTestNode> first = MakeTestNode(1);
+	first->First = second;
+	first->CopyFirstWhenDestroyed = true;
+
+	FObjectHeap::CollectGarbage();
+	EXPECT_FALSE(FObjectHeap::IsCollectingGarbage());
+	EXPECT_TRUE(first.IsNull());
+	EXPECT_TRUE(second.IsNull());
+
+	const TArray<int32>& destroyedIds = UGarbageCollectionTestNode::GetDestroyedNodeIds();
+	ASSERT_EQ(destroyedIds.Num(), 2);
+	EXPECT_EQ(destroyedIds[0], 1);
+	EXPECT_EQ(destroyedIds[1], 2);
+}
+
+TEST(GarbageCollectionTests, ParallelMark)
+{
+	FObjectHeap::CollectGarbage();
+
+	FGarbageCollectorSettings settings;
+	settings.NumMarkThreads = 4;
+	FScopedGarbageCollectorSettings scopedSettings { settings };
+
+	// A long chain would overflow the stack if it were traced recursively, and a wide tree gives the threads work to steal
+	constexpr int32 numChainNodes = 20000;
+	constexpr int32 numTreeNodes = 4096;
+
+	TObjectPtr<UGarbageCollectionTestNode> root = MakeTestNode(0);
+	root->SetShouldKeepAlive(true);
+
+	TObjectPtr<UGarbageCollectionTestNode> chainTail = root;
+	for (int32 id = 1; id <= numChainNodes; ++id)
+	{
+		chainTail->First = MakeTestNode(id);
+		chainTail = chainTail->First;
+	}
+
+	TArray<TObjectPtr<UGarbageCollectionTestNode>> treeNodes;
+	treeNodes.Add(MakeTestNode(-1));
+	root->Second = treeNodes[0];
+	for (int32 idx = 1; idx < numTreeNodes; ++idx)
+	{
+		TObjectPtr<UGarbageCollectionTestNode> node = MakeTestNode(-1 - idx);
+		const TObjectPtr<UGarbageCollectionTestNode>& parent = treeNodes[(idx - 1) / 2];
+		if (idx % 2 == 1)
+		{
+			parent->First = node;
+		}
+		else
+		{
+			parent->Second = node;
+		}
+		treeNodes.Add(MoveTemp(node));
+	}
+
+	TArray<TObjectPtr<UGarbageCollectionTestNode>> orphans;
+	for (int32 idx = 0; idx < 1024; ++idx)
+	{
+		orphans.Add(MakeTestNode(idx));
+	}
+
+	FObjectHeap::CollectGarbage();
+
+	EXPECT_TRUE(chainTail.IsValid());
+	for (const TObjectPtr<UGarbageCollectionTestNode>& node : treeNodes)
+	{
+		EXPECT_TRUE(node.IsValid());
+	}
+	for (const TObjectPtr<UGarbageCollectionTestNode>& orphan : orphans)
+	{
+		EXPECT_TRUE(orphan.IsNull());
+	}
+
+	// Marking in parallel should also pick up where it left off when spread across time-budgeted steps
+	FGarbageCollectorSettings incrementalSettings = settings;
+	incrementalSettings.StepTimeBudget = FTimeSpan::Zero;
+	incrementalSettings.AllocationDebtThreshold = 0;
+	FObjectHeap::SetGarbageCollectorSettings(incrementalSettings);
+
+	root->Second = nullptr;
+	do
+	{
+		FObjectHeap::CollectGarbageIncrementally();
+	}
+	while (FObjectHeap::IsCollectingGarbage());
+
+	EXPECT_TRUE(chainTail.IsValid());
+	for (const TObjectPtr<UGarbageCollectionTestNode>& node : treeNodes)
+	{
+		EXPECT_TRUE(node.IsNull());
+	}
+
+	root->SetShouldKeepAlive(false);
+	FObjectHeap::CollectGarbage();
+	EXPECT_TRUE(root.IsNull());
+	EXPECT_TRUE(chainTail.IsNull());
+}
+
+TEST(GarbageCollectionTests, LargeObjects)
+{
+	FObjectHeap::CollectGarbage();
+
+	TObjectPtr<UGarbageCollectionTestLargeNode> root = MakeObject<UGarbageCollectionTestLargeNode>();
+	root->SetShouldKeepAlive(true);
+	root->First = MakeTestNode(1);
+	root->Payload[0] = 0xAB;
+	root->Payload[root->Payload.Num() - 1] = 0xCD;
+
+	const TObjectPtr<UGarbageCollectionTestLargeNode> orphan = MakeObject<UGarbageCollectionTestLargeNode>();
+	const UGarbageCollectionTestLargeNode* orphanAddress = orphan.GetObject();
+	ASSERT_NE(orphanAddress, nullptr);
+
+	FObjectHeap::CollectGarbage();
+	ASSERT_TRUE(root.IsValid());
+	EXPECT_TRUE(root->First.IsValid());
+	EXPECT_EQ(root->Payload[0], 0xAB);
+	EXPECT_EQ(root->Payload[root->Payload.Num() - 1], 0xCD);
+	EXPECT_TRUE(orphan.IsNull());
+
+	// The heap block freed up by the orphan should be reused instead of allocating a new one
+	const TObjectPtr<UGarbageCollectionTestLargeNode> replacement = MakeObject<UGarbageCollectionTestLargeNode>();
+	EXPECT_EQ(replacement.GetObject(), orphanAddress);
+
+	root->SetShouldKeepAlive(false);
+	FObjectHeap::CollectGarbage();
+	EXPECT_TRUE(root.IsNull());
+	EXPECT_TRUE(replacement.IsNull());
+}
+TEST(GarbageCollectionTests, MinorCollectionOnlyCollectsYoungObjects)
+{
+	FObjectHeap::CollectGarbage();
+
+	TObjectPtr<UGarbageCollectionTestNode> root = MakeTestNode(1);
+	root->SetShouldKeepAlive(true);
+	root->First = MakeTestNode(2);
+	const TObjectPtr<UGarbageCollectionTestNode> oldOrphan = root->First;
+
+	FObjectHeap::CollectGarbage();
+	ASSERT_TRUE(oldOrphan.IsValid());
+	EXPECT_TRUE(root->IsInOldGeneration());
+	EXPECT_TRUE(oldOrphan->IsInOldGeneration());
+
+	root->First = nullptr;
+	const TObjectPtr<UGarbageCollectionTestNode> youngOrphan = MakeTestNode(3);
+	EXPECT_FALSE(youngOrphan->IsInOldGeneration());
+
+	FObjectHeap::CollectYoungGarbage();
+	EXPECT_TRUE(root.IsValid());
+	EXPECT_TRUE(oldOrphan.IsValid());
+	EXPECT_TRUE(youngOrphan.IsNull());
+
+	FObjectHeap::CollectGarbage();
+	EXPECT_TRUE(oldOrphan.IsNull());
+
+	root->SetShouldKeepAlive(false);
+	FObjectHeap::CollectGarbage();
+	EXPECT_TRUE(root.IsNull());
+}
+
+TEST(GarbageCollectionTests, RememberedSetKeepsYoungObjectsAlive)
+{
+	FObjectHeap::CollectGarbage();
+
+	TObjectPtr<UGarbageCollectionTestNode> root = MakeTestNode(1);
+	root->SetShouldKeepAlive(true);
+	FObjectHeap::CollectGarbage();
+	ASSERT_TRUE(root->IsInOldGeneration());
+
+	// Only reachable through an old object, which a minor collection does not trace unless the write barrier remembered it
+	root->First = MakeTestNode(2);
+	root->First->Second = MakeTestNode(3);
+	const TObjectPtr<UGarbageCollectionTestNode> child = root->First;
+	const TObjectPtr<UGarbageCollectionTestNode> grandchild = child->Second;
+	EXPECT_TRUE(root->IsInRememberedSet());
+
+	// Array elements live outside of the object heap, so the old object that owns the array is found when collecting
+	root->Children.Add(MakeTestNode(4));
+	const TObjectPtr<UGarbageCollectionTestNode> childInArray = root->Children[0];
+
+	// References held on the stack or in arrays that no object owns never keep objects alive
+	const TObjectPtr<UGarbageCollectionTestNode> orphan = MakeTestNode(5);
+	TArray<TObjectPtr<UGarbageCollectionTestNode>> unownedArray;
+	unownedArray.Add(MakeTestNode(6));
+
+	FObjectHeap::CollectYoungGarbage();
+	EXPECT_TRUE(child.IsValid());
+	EXPECT_TRUE(grandchild.IsValid());
+	EXPECT_TRUE(childInArray.IsValid());
+	EXPECT_TRUE(orphan.IsNull());
+	EXPECT_TRUE(unownedArray[0].IsNull());
+
+	root->SetShouldKeepAlive(false);
+	FObjectHeap::CollectGarbage();
+	EXPECT_TRUE(root.IsNull());
+	EXPECT_TRUE(child.IsNull());
+	EXPECT_TRUE(childInArray.IsNull());
+}
+
+TEST(GarbageCollectionTests, MinorCollectionFreesObjectsRemovedFromArrays)
+{
+	FObjectHeap::CollectGarbage();
+
+	FGarbageCollectorSettings settings;
+	settings.NumMinorCollectionsBeforePromotion = TNumericLimits<int32>::MaxValue;
+	FScopedGarbageCollectorSettings scopedSettings { settings };
+
+	TObjectPtr<UGarbageCollectionTestNode> root = MakeTestNode(1);
+	root->SetShouldKeepAlive(true);
+	FObjectHeap::CollectGarbage();
+	ASSERT_TRUE(root->IsInOldGeneration());
+
+	root->Children.Add(MakeTestNode(2));
+	root->Children.Add(MakeTestNode(3));
+	const TObjectPtr<UGarbageCollectionTestNode> kept = root->Children[0];
+	const TObjectPtr<UGarbageCollectionTestNode> removed = root->Children[1];
+
+	FObjectHeap::CollectYoungGarbage();
+	ASSERT_TRUE(kept.IsValid());
+	ASSERT_TRUE(removed.IsValid());
+	EXPECT_FALSE(removed->IsInOldGeneration());
+
+	root->Children.RemoveAt(1);
+
+	FObjectHeap::CollectYoungGarbage();
+	EXPECT_TRUE(kept.IsValid());
+	EXPECT_TRUE(removed.IsNull());
+
+	root->Children.Reset();
+
+	FObjectHeap::CollectYoungGarbage();
+	EXPECT_TRUE(kept.IsNull());
+
+	root->SetShouldKeepAlive(false);
+	FObjectHeap::CollectGarbage();
+	EXPECT_TRUE(root.IsNull());
+}
+
+TEST(GarbageCollectionTests, PromotesObjectsAfterSurvivingMinorCollections)
+{
+	FObjectHeap::CollectGarbage();
+
+	FGarbageCollectorSettings settings;
+	settings.NumMinorCollectionsBeforePromotion = 2;
+	FScopedGarbageCollectorSettings scopedSettings { settings };
+
+	TObjectPtr<UGarbageCollectionTestNode> root = MakeTestNode(1);
+	root->SetShouldKeepAlive(true);
+
+	FObjectHeap::CollectYoungGarbage();
+	ASSERT_TRUE(root.IsValid());
+	EXPECT_FALSE(root->IsInOldGeneration());
+	EXPECT_EQ(root->GetGarbageCollectorAge(), 1);
+
+	// Allocated after the first collection, so this will still be young once the root has been promoted
+	root->First = MakeTestNode(2);
+	const TObjectPtr<UGarbageCollectionTestNode> child = root->First;
+
+	FObjectHeap::CollectYoungGarbage();
+	EXPECT_TRUE(root->IsInOldGeneration());
+	EXPECT_TRUE(root->IsInRememberedSet());
+	ASSERT_TRUE(child.IsValid());
+	EXPECT_FALSE(child->IsInOldGeneration());
+
+	// Once nothing it references is young any more, the root can leave the remembered set
+	FObjectHeap::CollectYoungGarbage();
+	ASSERT_TRUE(child.IsValid());
+	EXPECT_TRUE(child->IsInOldGeneration());
+	EXPECT_FALSE(root->IsInRememberedSet());
+
+	root->SetShouldKeepAlive(false);
+	FObjectHeap::CollectGarbage();
+	EXPECT_TRUE(root.IsNull());
+	EXPECT_TRUE(child.IsNull());
+}
+
+TEST(GarbageCollectionTests, IncrementalCollectionRunsMinorCollectionWhenNurseryIsFull)
+{
+	FObjectHeap::CollectGarbage();
+
+	FGarbageCollectorSettings settings;
+	settings.NurserySize = 16 * static_cast<int64>(sizeof(UGarbageCollectionTestNode));
+	settings.AllocationDebtThreshold = TNumericLimits<int64>::MaxValue;
+	FScopedGarbageCollectorSettings scopedSettings { settings };
+
+	const TObjectPtr<UGarbageCollectionTestNode> firstOrphan = MakeTestNode(1);
+	FObjectHeap::CollectGarbageIncrementally();
+	EXPECT_TRUE(firstOrphan.IsValid());
+
+	for (int32 id = 2; id <= 16; ++id)
+	{
+		(void)MakeTestNode(id);
+	}
+
+	FObjectHeap::CollectGarbageIncrementally();
+	EXPECT_FALSE(FObjectHeap::IsCollectingGarbage());
+	EXPECT_TRUE(firstOrphan.IsNull());
+}
\ No newline at end of file
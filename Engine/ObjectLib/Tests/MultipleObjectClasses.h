@@ -40,5 +40,5 @@ class UChildClass : public UObject
 
 public:
 
-	FStringView GetParentName() const;
+	FName GetParentName() const;
 };
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/HashMap.h"
+#include "Containers/StaticArray.h"
+#include "Containers/String.h"
+#include "Object/Object.h"
+#include "Object/WeakObjectPtr.h"
+#include "ObjectArchiveTestClasses.Generated.h"
+
+UM_CLASS()
+class UObjectArchiveTestNode : public UObject
+{
+	UM_GENERATED_BODY();
+
+public:
+
+	UM_PROPERTY()
+	int32 Id = 0;
+
+	UM_PROPERTY()
+	float Weight = 0.0f;
+
+	UM_PROPERTY()
+	FString Label;
+
+	UM_PROPERTY()
+	TStaticArray<int32, 4> Corners;
+
+	UM_PROPERTY()
+	TArray<int32> Values;
+
+	UM_PROPERTY()
+	TArray<FString> Tags;
+
+	UM_PROPERTY()
+	TObjectPtr<UObjectArchiveTestNode> Next;
+
+	UM_PROPERTY()
+	TWeakObjectPtr<UObjectArchiveTestNode> Observed;
+
+	UM_PROPERTY()
+	TArray<TObjectPtr<UObjectArchiveTestNode>> Children;
+
+	UM_PROPERTY()
+	THashMap<FString, int32> Counts;
+};
+
+UM_CLASS()
+class UObjectArchiveTestLeaf : public UObjectArchiveTestNode
+{
+	UM_GENERATED_BODY();
+
+public:
+
+	UM_PROPERTY()
+	uint64 Extra = 0;
+};
\ No newline at end of file
@@ -0,0 +1,131 @@
+#include "Object/Object.h"
+#include "Object/ObjectArchive.h"
+#include "Object/ObjectHeap.h"
+#include "ObjectArchiveTestClasses.h"
+#include <gtest/gtest.h>
+
+/**
+ * @brief Saves a small object graph to an archive.
+ *
+ * @return The archive's bytes.
+ */
+static TArray<uint8> SaveTestArchive()
+{
+	FObjectHeap::CollectGarbage();
+
+	TObjectPtr<UObjectArchiveTestNode> root = MakeObject<UObjectArchiveTestNode>(nullptr, "Root"_sv);
+	root->Id = 1;
+	root->Label = "root"_s;
+
+	TObjectPtr<UObjectArchiveTestLeaf> leaf = MakeObject<UObjectArchiveTestLeaf>(root, "Leaf"_sv);
+	leaf->Id = 2;
+	root->Children.Add(leaf);
+
+	TArray<uint8> bytes;
+	const TArray<FObjectPtr> rootObjects = { root };
+	EXPECT_FALSE(FObjectArchive::Save(rootObjects.AsSpan(), bytes).IsError());
+	return bytes;
+}
+
+TEST(ObjectArchiveTests, SaveAndLoad)
+{
+	FObjectHeap::CollectGarbage();
+
+	TObjectPtr<UObjectArchiveTestNode> root = MakeObject<UObjectArchiveTestNode>(nullptr, "Root"_sv);
+	root->Id = 1;
+	root->Weight = 0.5f;
+	root->Label = "Hello, archive"_s;
+	root->Corners = {{ 1, 2, 3, 4 }};
+	root->Values = { 10, 20, 30 };
+	root->Tags = { "first"_s, "second"_s };
+	(void)root->Counts.Add("apples"_s, 3);
+	(void)root->Counts.Add("pears"_s, 5);
+
+	TObjectPtr<UObjectArchiveTestLeaf> leaf = MakeObject<UObjectArchiveTestLeaf>(root, "Leaf"_sv);
+	leaf->Id = 2;
+	leaf->Extra = 0x0123456789ABCDEF;
+	leaf->Observed = root;
+	root->Children.Add(leaf);
+
+	// Only reachable through another object's pointer, and points back to the root to form a cycle
+	TObjectPtr<UObjectArchiveTestNode> next = MakeObject<UObjectArchiveTestNode>();
+	next->Id = 3;
+	next->Next = root;
+	root->Next = next;
+
+	// Only weakly referenced, so it should not be saved
+	TObjectPtr<UObjectArchiveTestNode> outsider = MakeObject<UObjectArchiveTestNode>();
+	next->Observed = outsider;
+
+	TArray<uint8> bytes;
+	const TArray<FObjectPtr> rootObjects = { root };
+	ASSERT_FALSE(FObjectArchive::Save(rootObjects.AsSpan(), bytes).IsError());
+
+	TErrorOr<TArray<FObjectPtr>> loadResult = FObjectArchive::Load(bytes.AsSpan());
+	ASSERT_FALSE(loadResult.IsError());
+
+	const TArray<FObjectPtr> loadedObjects = loadResult.ReleaseValue();
+	ASSERT_EQ(loadedObjects.Num(), 1);
+
+	const TObjectPtr<UObjectArchiveTestNode> loadedRoot = Cast<UObjectArchiveTestNode>(loadedObjects[0]);
+	ASSERT_TRUE(loadedRoot.IsValid());
+	EXPECT_NE(loadedRoot, root);
+	EXPECT_TRUE(loadedRoot->GetParent().IsNull());
+	EXPECT_EQ(loadedRoot->GetName().GetPlainName(), "Root"_sv);
+	EXPECT_EQ(loadedRoot->Id, 1);
+	EXPECT_EQ(loadedRoot->Weight, 0.5f);
+	EXPECT_EQ(loadedRoot->Label, "Hello, archive"_sv);
+	EXPECT_EQ(loadedRoot->Corners[2], 3);
+	ASSERT_EQ(loadedRoot->Values.Num(), 3);
+	EXPECT_EQ(loadedRoot->Values[1], 20);
+	ASSERT_EQ(loadedRoot->Tags.Num(), 2);
+	EXPECT_EQ(loadedRoot->Tags[1], "second"_sv);
+	ASSERT_EQ(loadedRoot->Counts.Num(), 2);
+	EXPECT_EQ(loadedRoot->Counts.FindRef("apples"_s), 3);
+	EXPECT_EQ(loadedRoot->Counts.FindRef("pears"_s), 5);
+
+	ASSERT_EQ(loadedRoot->Children.Num(), 1);
+	const TObjectPtr<UObjectArchiveTestLeaf> loadedLeaf = Cast<UObjectArchiveTestLeaf>(loadedRoot->Children[0]);
+	ASSERT_TRUE(loadedLeaf.IsValid());
+	EXPECT_EQ(loadedLeaf->GetParent(), loadedRoot);
+	EXPECT_EQ(loadedLeaf->GetName().GetPlainName(), "Leaf"_sv);
+	EXPECT_EQ(loadedLeaf->Id, 2);
+	EXPECT_EQ(loadedLeaf->Extra, 0x0123456789ABCDEFull);
+	EXPECT_EQ(loadedLeaf->Observed.GetObject(), loadedRoot.GetObject());
+
+	const TObjectPtr<UObjectArchiveTestNode> loadedNext = loadedRoot->Next;
+	ASSERT_TRUE(loadedNext.IsValid());
+	EXPECT_NE(loadedNext, next);
+	EXPECT_EQ(loadedNext->Id, 3);
+	EXPECT_EQ(loadedNext->Next, loadedRoot);
+	EXPECT_TRUE(loadedNext->Observed.IsNull());
+}
+
+TEST(ObjectArchiveTests, LoadFailsForUnknownClass)
+{
+	TArray<uint8> bytes = SaveTestArchive();
+
+	// Rename the leaf class in place to one that is not in the type registry
+	const FStringView className = UObjectArchiveTestLeaf::StaticType()->GetName();
+	const FStringView bytesAsChars { reinterpret_cast<const char*>(bytes.GetData()), bytes.Num() };
+	const int32 classNameIndex = bytesAsChars.IndexOf(className);
+	ASSERT_NE(classNameIndex, INDEX_NONE);
+
+	bytes[classNameIndex + className.Length() - 1] = '_';
+	EXPECT_TRUE(FObjectArchive::Load(bytes.AsSpan()).IsError());
+}
+
+TEST(ObjectArchiveTests, LoadFailsForBadData)
+{
+	const TArray<uint8> bytes = SaveTestArchive();
+	ASSERT_FALSE(FObjectArchive::Load(bytes.AsSpan()).IsError());
+
+	for (int32 numBytes = 0; numBytes < bytes.Num(); ++numBytes)
+	{
+		EXPECT_TRUE(FObjectArchive::Load(bytes.AsSpan().Slice(0, numBytes)).IsError());
+	}
+
+	TArray<uint8> badVersionBytes = bytes;
+	badVersionBytes[sizeof(uint32)] += 1;
+	EXPECT_TRUE(FObjectArchive::Load(badVersionBytes.AsSpan()).IsError());
+}
\ No newline at end of file
@@ -54,6 +54,12 @@ TEST(ObjectTests, Is)
 	EXPECT_TRUE(secondDerived->IsA<UObject>());
 }
 
+TEST(ObjectTests, CannotMakeAbstractObject)
+{
+	TObjectPtr<UBaseTestClass> baseObject = MakeObject<UBaseTestClass>();
+	EXPECT_TRUE(baseObject.IsNull());
+}
+
 TEST(ObjectTests, ObjectCreationContext)
 {
 	FObjectCreationContext params;
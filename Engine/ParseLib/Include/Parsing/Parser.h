@@ -3,6 +3,7 @@
 #include "Containers/Array.h"
 #include "Memory/UniquePtr.h"
 #include "Parsing/ParseError.h"
+#include "Parsing/Scanner.h"
 #include "Parsing/Token.h"
 #include "Templates/VariadicTraits.h"
 
@@ -39,11 +40,11 @@ public:
 	}
 
 	/**
-	 * @brief Parses the given token collection.
+	 * @brief Parses the tokens from a scanner's last scan. The scanner must outlive parsing.
 	 *
-	 * @param tokens The token collection.
+	 * @param scanner The scanner.
 	 */
-	void ParseTokens(TSpan<const FToken> tokens);
+	void ParseTokens(const FScanner& scanner);
 
 protected:
 
@@ -73,6 +74,22 @@ protected:
 	 */
 	[[nodiscard]] bool Consume(ETokenType tokenType, FStringView message);
 
+	/**
+	 * @brief Gets the line and column of a token.
+	 *
+	 * @param token The token.
+	 * @return The token's source location.
+	 */
+	[[nodiscard]] FSourceLocation GetTokenLocation(const FToken& token) const;
+
+	/**
+	 * @brief Gets the source text of a token.
+	 *
+	 * @param token The token.
+	 * @return The token's source text.
+	 */
+	[[nodiscard]] FStringView GetTokenText(const FToken& token) const;
+
 	/**
 	 * @brief Checks to see if this parser is at the end of the token collection.
 	 *
@@ -178,5 +195,6 @@ private:
 
 	TArray<FParseError> m_Errors;
 	TSpan<const FToken> m_Tokens;
+	const FScanner* m_Scanner = nullptr;
 	int32 m_TokenIndex = 0;
 };
@@ -2,7 +2,7 @@
 
 #include "Containers/Array.h"
 #include "Parsing/ParseError.h"
-#include "Parsing/SourceLocation.h"
+#include "Parsing/SourceLineTable.h"
 #include "Parsing/Token.h"
 
 // TODO Make this virtual OR provide a plethora of configuration options
@@ -59,6 +59,38 @@ public:
 		return m_MultiLineCommentEnd;
 	}
 
+	/**
+	 * @brief Gets the source text from the last scan.
+	 *
+	 * @return The source text from the last scan.
+	 */
+	[[nodiscard]] FStringView GetText() const
+	{
+		return m_Text;
+	}
+
+	/**
+	 * @brief Gets the line and column of a token from the last scan.
+	 *
+	 * @param token The token.
+	 * @return The token's source location.
+	 */
+	[[nodiscard]] FSourceLocation GetTokenLocation(const FToken& token) const
+	{
+		return m_LineTable.GetSourceLocation(token.SourceIndex);
+	}
+
+	/**
+	 * @brief Gets the source text for a token from the last scan.
+	 *
+	 * @param token The token.
+	 * @return The token's source text.
+	 */
+	[[nodiscard]] FStringView GetTokenText(const FToken& token) const
+	{
+		return token.GetText(m_Text);
+	}
+
 	/**
 	 * @brief Gets the tokens from the last scan.
 	 *
@@ -152,12 +184,11 @@ protected:
 	[[nodiscard]] FStringView GetCurrentTokenText() const;
 
 	/**
-	 * @brief Gets the source text for a token based off of its source index and length.
+	 * @brief Gets the line and column of the character cursor.
 	 *
-	 * @param token The token.
-	 * @return The token's source text.
+	 * @return The line and column of the character cursor.
 	 */
-	[[nodiscard]] FStringView GetTokenText(const FToken& token) const;
+	[[nodiscard]] FSourceLocation GetCurrentLocation() const;
 
 	/**
 	 * @brief Checks to see if this scanner is at the end of the source text.
@@ -252,10 +283,9 @@ private:
 	FStringView m_LineCommentBegin;
 	FStringView m_MultiLineCommentBegin;
 	FStringView m_MultiLineCommentEnd;
+	FSourceLineTable m_LineTable;
 	FStringView m_Text;
 	FStringView::SizeType m_CurrentIndex = 0; // Current index of the character cursor in m_Text
 	FStringView::SizeType m_StartIndex = 0;   // Starting index of the current token being parsed
-	FSourceLocation m_CurrentLocation;
-	FSourceLocation m_StartLocation;
 	bool m_ShouldRecordComments = false;
 };
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/StringView.h"
+#include "Parsing/SourceLocation.h"
+
+/**
+ * @brief Defines a table of the offsets where each line in source text begins.
+ *
+ * The table is only built the first time a source location is requested, so scanning and parsing text that has no
+ * errors never pays for it. Lines may end with "\n", "\r\n", or a lone "\r".
+ */
+class FSourceLineTable
+{
+public:
+
+	/**
+	 * @brief Gets the line and column of a character in the source text.
+	 *
+	 * @param sourceIndex The zero-based index of the character.
+	 * @return The one-based line and column of the character, or (0:0) if the index is invalid.
+	 */
+	[[nodiscard]] FSourceLocation GetSourceLocation(int32 sourceIndex) const;
+
+	/**
+	 * @brief Gets the source text this table is for.
+	 *
+	 * @return The source text.
+	 */
+	[[nodiscard]] FStringView GetText() const
+	{
+		return m_Text;
+	}
+
+	/**
+	 * @brief Resets this table to describe new source text.
+	 *
+	 * @param text The source text.
+	 */
+	void Reset(FStringView text);
+
+private:
+
+	/**
+	 * @brief Builds the line start offsets if they have not been built yet.
+	 */
+	void BuildLineStarts() const;
+
+	FStringView m_Text;
+	mutable TArray<int32> m_LineStarts;
+};
\ No newline at end of file
@@ -1,11 +1,13 @@
 #pragma once
 
 #include "Containers/StringView.h"
-#include "Parsing/SourceLocation.h"
 #include "Parsing/TokenType.h"
 
 /**
  * @brief Defines a token.
+ *
+ * Tokens only store where they are in the source text, so they are kept small. Use FScanner::GetTokenText or
+ * FScanner::GetTokenLocation to get a token's text or line and column.
  */
 class FToken
 {
@@ -13,18 +15,30 @@ public:
 
 	static const FToken EndOfSource;
 
-	/** The token's text. This will only be valid as long as the source string is kept in memory. */
-	FStringView Text;
-
-	/** The source location of the token. */
-	FSourceLocation Location;
-
-	/** The token's type. */
-	ETokenType Type = ETokenType::EndOfSource;
-
 	/** The zero-based index of the token within the source. */
 	int32 SourceIndex = INDEX_NONE;
 
 	/** The length, or number of characters, of the token within the source. */
 	int32 SourceLength = 0;
-};
\ No newline at end of file
+
+	/** The token's type. */
+	ETokenType Type = ETokenType::EndOfSource;
+
+	/**
+	 * @brief Gets this token's text from the source it was scanned from.
+	 *
+	 * @param source The source text.
+	 * @return The token's text. This will only be valid as long as the source string is kept in memory.
+	 */
+	[[nodiscard]] FStringView GetText(const FStringView source) const
+	{
+		if (SourceIndex == INDEX_NONE)
+		{
+			return {};
+		}
+
+		return source.Substring(SourceIndex, SourceLength);
+	}
+};
+
+static_assert(sizeof(FToken) == 12);
\ No newline at end of file
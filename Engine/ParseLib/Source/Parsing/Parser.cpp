@@ -1,9 +1,10 @@
 #include "Parsing/Parser.h"
 
-void FParser::ParseTokens(const TSpan<const FToken> tokens)
+void FParser::ParseTokens(const FScanner& scanner)
 {
 	m_Errors.Reset();
-	m_Tokens = tokens;
+	m_Tokens = scanner.GetTokens();
+	m_Scanner = &scanner;
 	m_TokenIndex = 0;
 
 	if (m_Tokens.IsEmpty())
@@ -50,16 +51,28 @@ bool FParser::Consume(const ETokenType tokenType, const FStringView message)
 
 	if (Peek().Type == ETokenType::EndOfSource)
 	{
-		RecordError(PeekPrevious().Location, message);
+		RecordError(GetTokenLocation(PeekPrevious()), message);
 	}
 	else
 	{
-		RecordError(Peek().Location, message);
+		RecordError(GetTokenLocation(Peek()), message);
 	}
 
 	return false;
 }
 
+FSourceLocation FParser::GetTokenLocation(const FToken& token) const
+{
+	UM_ASSERT(m_Scanner != nullptr, "Attempting to get a token location without parsing tokens");
+	return m_Scanner->GetTokenLocation(token);
+}
+
+FStringView FParser::GetTokenText(const FToken& token) const
+{
+	UM_ASSERT(m_Scanner != nullptr, "Attempting to get token text without parsing tokens");
+	return m_Scanner->GetTokenText(token);
+}
+
 bool FParser::IsAtEnd() const
 {
 	return m_TokenIndex >= m_Tokens.Num();
@@ -1,49 +1,284 @@
-#include "Containers/HashMap.h"
-#include "Misc/StringParsing.h"
+#include "Containers/StaticArray.h"
+#include "Engine/Platform.h"
+#include "Misc/EnumMacros.h"
 #include "Parsing/Scanner.h"
+#include <bit>
+
+// Do not include SSE headers on ARM builds
+#if !UMBRAL_ARCH_IS_ARM
+#	include <emmintrin.h> /* For _mm_cmpeq_epi8 and _mm_movemask_epi8 */
+#	define WITH_SSE2 1
+#else
+#	define WITH_SSE2 0
+#endif
+
+/**
+ * @brief Flags for the classes a character can belong to.
+ */
+enum class ECharClass : uint8
+{
+	None = 0,
+	Whitespace = (1 << 0),
+	Alpha = (1 << 1),
+	Digit = (1 << 2),
+	AlphaNumeric = Alpha | Digit
+};
+
+ENUM_FLAG_OPERATORS(ECharClass)
+
+/**
+ * @brief The classes of every character.
+ */
+static constexpr TStaticArray<ECharClass, 256> GCharClasses = []()
+{
+	TStaticArray<ECharClass, 256> result {};
+	for (int32 idx = 0; idx < 256; ++idx)
+	{
+		// Characters used to be compared as signed, so bytes outside of ASCII are skipped as whitespace
+		if (idx <= ' ' || idx >= 0x80)
+		{
+			result[idx] = ECharClass::Whitespace;
+		}
+		else if ((idx >= 'A' && idx <= 'Z') || (idx >= 'a' && idx <= 'z') || idx == '_')
+		{
+			result[idx] = ECharClass::Alpha;
+		}
+		else if (idx >= '0' && idx <= '9')
+		{
+			result[idx] = ECharClass::Digit;
+		}
+	}
+	return result;
+}();
 
 /**
- * @brief Checks to see if the given character is an alphabetic character.
+ * @brief The type of token that every character makes on its own, or EndOfSource if it does not make one.
+ */
+static constexpr TStaticArray<ETokenType, 256> GSingleCharTokenTypes = []()
+{
+	TStaticArray<ETokenType, 256> result {};
+	for (int32 idx = 0; idx < 256; ++idx)
+	{
+		result[idx] = ETokenType::EndOfSource;
+	}
+
+	// TODO Configurable :)
+	result['\''] = ETokenType::SingleQuote;
+	result['(']  = ETokenType::LeftParen;
+	result[')']  = ETokenType::RightParent;
+	result['[']  = ETokenType::LeftBracket;
+	result[']']  = ETokenType::RightBracket;
+	result['{']  = ETokenType::LeftBrace;
+	result['}']  = ETokenType::RightBrace;
+	result['<']  = ETokenType::LessThan;
+	result['>']  = ETokenType::GreaterThan;
+	result['_']  = ETokenType::Underscore;
+	result['.']  = ETokenType::Period;
+	result[',']  = ETokenType::Comma;
+	result[':']  = ETokenType::Colon;
+	result[';']  = ETokenType::Semicolon;
+	result['+']  = ETokenType::Plus;
+	result['-']  = ETokenType::Minus;
+	result['*']  = ETokenType::Asterisk;
+	result['/']  = ETokenType::Slash;
+	result['=']  = ETokenType::Equal;
+	result['^']  = ETokenType::Caret;
+	result['!']  = ETokenType::Exclamation;
+	result['?']  = ETokenType::Question;
+	result['&']  = ETokenType::Ampersand;
+	result['%']  = ETokenType::Percent;
+	result['#']  = ETokenType::Octothorpe;
+	result['~']  = ETokenType::Tilde;
+	result['`']  = ETokenType::Backtick;
+	return result;
+}();
+
+/**
+ * @brief Checks to see if a character belongs to any of the given classes.
  *
  * @param ch The character.
- * @return True if \p ch is alphabetic, otherwise false.
+ * @param charClass The classes.
+ * @return True if \p ch belongs to any of \p charClass, otherwise false.
  */
-static constexpr bool IsAlpha(const FStringView::CharType ch)
+[[nodiscard]] static bool HasCharClass(const FStringView::CharType ch, const ECharClass charClass)
 {
-	return (ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z') || ch == '_';
+	return (GCharClasses[static_cast<uint8>(ch)] & charClass) != ECharClass::None;
 }
 
+#if WITH_SSE2
 /**
- * @brief Checks to see if the given character is a numeric digit.
+ * @brief Gets the index of the first character in a block that does not match.
  *
- * @param ch The character.
- * @return True if \p ch is a numeric digit, otherwise false.
+ * @param isMatch The comparison result for each character in the block.
+ * @return The index of the first character that does not match, or 16 if every character matches.
  */
-static constexpr bool IsDigit(const FStringView::CharType ch)
+[[nodiscard]] static int32 FindFirstMismatch(const __m128i isMatch)
 {
-	return ch >= '0' && ch <= '9';
+	const uint32 mask = static_cast<uint32>(_mm_movemask_epi8(isMatch)) ^ 0xFFFFu;
+	return mask == 0 ? 16 : std::countr_zero(mask);
 }
 
 /**
- * @brief Checks to see if the given character is alphabetic or numeric.
+ * @brief Checks each character in a block to see if it is in an inclusive range.
  *
- * @param ch The character.
- * @return True if the character is a number or letter, otherwise false.
+ * @param chars The block of characters. Characters are compared as signed, so bytes outside of ASCII never match.
+ * @param first The first character in the range.
+ * @param last The last character in the range.
+ * @return The comparison result for each character.
+ */
+[[nodiscard]] static __m128i IsInRange(const __m128i chars, const char first, const char last)
+{
+	return _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8(static_cast<char>(first - 1))),
+	                     _mm_cmplt_epi8(chars, _mm_set1_epi8(static_cast<char>(last + 1))));
+}
+#endif
+
+/**
+ * @brief Skips a run of whitespace characters.
+ *
+ * @param position The first character to check.
+ * @param end The end of the text.
+ * @return The first character that is not whitespace, or \p end if there is none.
+ */
+[[nodiscard]] static const FStringView::CharType* SkipWhitespaceChars(const FStringView::CharType* position, const FStringView::CharType* end)
+{
+#if WITH_SSE2
+	const __m128i spaceLimit = _mm_set1_epi8(' ' + 1);
+	while (end - position >= 16)
+	{
+		const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(position));
+		const int32 offset = FindFirstMismatch(_mm_cmplt_epi8(chars, spaceLimit));
+		position += offset;
+		if (offset < 16)
+		{
+			return position;
+		}
+	}
+#endif
+
+	while (position < end && HasCharClass(*position, ECharClass::Whitespace))
+	{
+		++position;
+	}
+
+	return position;
+}
+
+/**
+ * @brief Skips a run of letters, digits, and underscores.
+ *
+ * @param position The first character to check.
+ * @param end The end of the text.
+ * @return The first character that cannot be part of an identifier, or \p end if there is none.
+ */
+[[nodiscard]] static const FStringView::CharType* SkipAlphaNumericChars(const FStringView::CharType* position, const FStringView::CharType* end)
+{
+#if WITH_SSE2
+	const __m128i caseBit = _mm_set1_epi8('a' - 'A');
+	const __m128i underscores = _mm_set1_epi8('_');
+	while (end - position >= 16)
+	{
+		const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(position));
+
+		// Setting the case bit folds uppercase letters into lowercase without moving any other character into range
+		const __m128i isAlpha = IsInRange(_mm_or_si128(chars, caseBit), 'a', 'z');
+		const __m128i isAlphaNumeric = _mm_or_si128(_mm_or_si128(isAlpha, IsInRange(chars, '0', '9')), _mm_cmpeq_epi8(chars, underscores));
+
+		const int32 offset = FindFirstMismatch(isAlphaNumeric);
+		position += offset;
+		if (offset < 16)
+		{
+			return position;
+		}
+	}
+#endif
+
+	while (position < end && HasCharClass(*position, ECharClass::AlphaNumeric))
+	{
+		++position;
+	}
+
+	return position;
+}
+
+/**
+ * @brief Skips a run of digits.
+ *
+ * @param position The first character to check.
+ * @param end The end of the text.
+ * @return The first character that is not a digit, or \p end if there is none.
+ */
+[[nodiscard]] static const FStringView::CharType* SkipDigitChars(const FStringView::CharType* position, const FStringView::CharType* end)
+{
+#if WITH_SSE2
+	while (end - position >= 16)
+	{
+		const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(position));
+		const int32 offset = FindFirstMismatch(IsInRange(chars, '0', '9'));
+		position += offset;
+		if (offset < 16)
+		{
+			return position;
+		}
+	}
+#endif
+
+	while (position < end && HasCharClass(*position, ECharClass::Digit))
+	{
+		++position;
+	}
+
+	return position;
+}
+
+/**
+ * @brief Skips the characters of a string literal.
+ *
+ * @param position The first character to check.
+ * @param end The end of the text.
+ * @return The first quote or new line character, or \p end if there is none.
  */
-static constexpr bool IsAlphaNumeric(const FStringView::CharType ch)
+[[nodiscard]] static const FStringView::CharType* SkipStringLiteralChars(const FStringView::CharType* position, const FStringView::CharType* end)
 {
-	return IsAlpha(ch) || IsDigit(ch);
+#if WITH_SSE2
+	const __m128i quotes = _mm_set1_epi8('"');
+	const __m128i lineFeeds = _mm_set1_epi8('\n');
+	const __m128i carriageReturns = _mm_set1_epi8('\r');
+	while (end - position >= 16)
+	{
+		const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(position));
+		const __m128i isStringEnd = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chars, quotes), _mm_cmpeq_epi8(chars, lineFeeds)),
+		                                         _mm_cmpeq_epi8(chars, carriageReturns));
+
+		const int32 mask = _mm_movemask_epi8(isStringEnd);
+		if (mask != 0)
+		{
+			return position + std::countr_zero(static_cast<uint32>(mask));
+		}
+
+		position += 16;
+	}
+#endif
+
+	while (position < end && *position != '"' && *position != '\n' && *position != '\r')
+	{
+		++position;
+	}
+
+	return position;
 }
 
 void FScanner::ScanTextForTokens(const FStringView text)
 {
 	m_Errors.Reset();
 	m_Tokens.Reset();
+	m_LineTable.Reset(text);
 	m_Text = text;
 	m_CurrentIndex = 0;
 	m_StartIndex = 0;
-	m_StartLocation = { 1, 1 };
-	m_CurrentLocation = { 1, 1 };
+
+	// Most source text has a token every few characters, so reserving up front avoids repeatedly growing the array
+	m_Tokens.Reserve(text.Length() / 8);
 
 	while (IsAtEnd() == false)
 	{
@@ -55,7 +290,6 @@ void FScanner::ScanTextForTokens(const FStringView text)
 		}
 
 		m_StartIndex = m_CurrentIndex;
-		m_StartLocation = m_CurrentLocation;
 		ScanToken();
 	}
 }
@@ -63,11 +297,9 @@ void FScanner::ScanTextForTokens(const FStringView text)
 FToken& FScanner::AddToken(const ETokenType tokenType)
 {
 	FToken& token = m_Tokens.AddDefaultGetRef();
-	token.Text = GetCurrentTokenText();
-	token.Location = m_StartLocation;
-	token.Type = tokenType;
 	token.SourceIndex = m_StartIndex;
 	token.SourceLength = m_CurrentIndex - m_StartIndex;
+	token.Type = tokenType;
 
 	return token;
 }
@@ -81,34 +313,6 @@ FStringView::CharType FScanner::AdvanceChar()
 
 	const FStringView::CharType result = m_Text[m_CurrentIndex];
 	++m_CurrentIndex;
-	++m_CurrentLocation.Column;
-
-	if ((Peek() == '\n') || (Peek() == '\r' && PeekNext() != '\n'))
-	{
-		++m_CurrentLocation.Line;
-		m_CurrentLocation.Column = 0;
-	}
-
-#if 0
-	if (Peek() == '\r')
-	{
-		// New line is \r\n
-		if (PeekNext() == '\n')
-		{
-			// Do nothing because then the \n will be handled by the next AdvanceChar
-		}
-		// New line is \r
-		else
-		{
-			// Record new line position
-		}
-	}
-	// New line is \n
-	else if (Peek() == '\n')
-	{
-		// Record new line position
-	}
-#endif
 
 	return result;
 }
@@ -119,9 +323,9 @@ FStringView FScanner::GetCurrentTokenText() const
 	return m_Text.Substring(m_StartIndex, tokenLength);
 }
 
-FStringView FScanner::GetTokenText(const FToken& token) const
+FSourceLocation FScanner::GetCurrentLocation() const
 {
-	return m_Text.Substring(token.SourceIndex, token.SourceLength);
+	return m_LineTable.GetSourceLocation(m_CurrentIndex);
 }
 
 bool FScanner::IsAtEnd() const
@@ -200,10 +404,8 @@ FStringView::CharType FScanner::PeekPrevious() const
 
 void FScanner::ScanIdentifier()
 {
-	while (IsAlphaNumeric(Peek()))
-	{
-		AdvanceChar();
-	}
+	const FStringView::CharType* chars = m_Text.GetChars();
+	m_CurrentIndex = static_cast<FStringView::SizeType>(SkipAlphaNumericChars(chars + m_CurrentIndex, chars + m_Text.Length()) - chars);
 
 	AddToken(ETokenType::Identifier);
 }
@@ -218,7 +420,6 @@ void FScanner::ScanLineComment()
 	FToken& token = AddToken(ETokenType::Comment);
 	token.SourceIndex += m_LineCommentBegin.Length();
 	token.SourceLength -= m_LineCommentBegin.Length();
-	token.Text = GetTokenText(token);
 }
 
 void FScanner::ScanMultiLineComment()
@@ -231,35 +432,30 @@ void FScanner::ScanMultiLineComment()
 	FToken& token = AddToken(ETokenType::Comment);
 	token.SourceIndex += m_MultiLineCommentBegin.Length();
 	token.SourceLength -= m_MultiLineCommentBegin.Length() + m_MultiLineCommentEnd.Length();
-	token.Text = GetTokenText(token);
 }
 
 void FScanner::ScanNumberLiteral()
 {
-	while (IsDigit(Peek()))
-	{
-		AdvanceChar();
-	}
+	const FStringView::CharType* chars = m_Text.GetChars();
+	m_CurrentIndex = static_cast<FStringView::SizeType>(SkipDigitChars(chars + m_CurrentIndex, chars + m_Text.Length()) - chars);
 
 	AddToken(ETokenType::Number);
 }
 
 void FScanner::ScanStringLiteral()
 {
-	while (Peek() != '"' && IsAtEnd() == false)
-	{
-		if (Peek() == '\n' || Peek() == '\r')
-		{
-			(void)m_Errors.Emplace(m_CurrentLocation, "Unexpected new line in string"_sv);
-			return;
-		}
+	const FStringView::CharType* chars = m_Text.GetChars();
+	m_CurrentIndex = static_cast<FStringView::SizeType>(SkipStringLiteralChars(chars + m_CurrentIndex, chars + m_Text.Length()) - chars);
 
-		AdvanceChar();
+	if (IsAtEnd())
+	{
+		(void)m_Errors.Emplace(GetCurrentLocation(), "Encountered unterminated string"_sv);
+		return;
 	}
 
-	if (IsAtEnd())
+	if (Peek() == '\n' || Peek() == '\r')
 	{
-		(void)m_Errors.Emplace(m_CurrentLocation, "Encountered unterminated string"_sv);
+		(void)m_Errors.Emplace(GetCurrentLocation(), "Unexpected new line in string"_sv);
 		return;
 	}
 
@@ -269,7 +465,6 @@ void FScanner::ScanStringLiteral()
 	FToken& token = AddToken(ETokenType::String);
 	token.SourceIndex = m_StartIndex + 1;
 	token.SourceLength = (m_CurrentIndex - 1) - (m_StartIndex + 1);
-	token.Text = GetTokenText(token);
 }
 
 void FScanner::ScanToken()
@@ -279,77 +474,44 @@ void FScanner::ScanToken()
 		return;
 	}
 
-	if (Match(m_LineCommentBegin))
+	// Only compare the comment markers when the first character could start one
+	const FStringView::CharType ch = Peek();
+	if (m_LineCommentBegin.IsEmpty() == false && ch == m_LineCommentBegin[0] && Match(m_LineCommentBegin))
 	{
 		return ScanLineComment();
 	}
-	if (Match(m_MultiLineCommentBegin))
+	if (m_MultiLineCommentBegin.IsEmpty() == false && ch == m_MultiLineCommentBegin[0] && Match(m_MultiLineCommentBegin))
 	{
 		return ScanMultiLineComment();
 	}
 
-	const char ch = AdvanceChar();
-	switch (ch)
+	AdvanceChar();
+
+	const ETokenType singleCharTokenType = GSingleCharTokenTypes[static_cast<uint8>(ch)];
+	if (singleCharTokenType != ETokenType::EndOfSource)
+	{
+		AddToken(singleCharTokenType);
+	}
+	else if (ch == '"')
 	{
-	// TODO Configurable :)
-	case '"':
 		ScanStringLiteral();
-		break;
-
-	case '\'': AddToken(ETokenType::SingleQuote);   break;
-	case '(':  AddToken(ETokenType::LeftParen);     break;
-	case ')':  AddToken(ETokenType::RightParent);   break;
-	case '[':  AddToken(ETokenType::LeftBracket);   break;
-	case ']':  AddToken(ETokenType::RightBracket);  break;
-	case '{':  AddToken(ETokenType::LeftBrace);     break;
-	case '}':  AddToken(ETokenType::RightBrace);    break;
-	case '<':  AddToken(ETokenType::LessThan);      break;
-	case '>':  AddToken(ETokenType::GreaterThan);   break;
-	case '_':  AddToken(ETokenType::Underscore);    break;
-	case '.':  AddToken(ETokenType::Period);        break;
-	case ',':  AddToken(ETokenType::Comma);         break;
-	case ':':  AddToken(ETokenType::Colon);         break;
-	case ';':  AddToken(ETokenType::Semicolon);     break;
-	case '+':  AddToken(ETokenType::Plus);          break;
-	case '-':  AddToken(ETokenType::Minus);         break;
-	case '*':  AddToken(ETokenType::Asterisk);      break;
-	case '/':  AddToken(ETokenType::Slash);         break;
-	case '=':  AddToken(ETokenType::Equal);         break;
-	case '^':  AddToken(ETokenType::Caret);         break;
-	case '!':  AddToken(ETokenType::Exclamation);   break;
-	case '?':  AddToken(ETokenType::Question);      break;
-	case '&':  AddToken(ETokenType::Ampersand);     break;
-	case '%':  AddToken(ETokenType::Percent);       break;
-	case '#':  AddToken(ETokenType::Octothorpe);    break;
-	case '~':  AddToken(ETokenType::Tilde);         break;
-	case '`':  AddToken(ETokenType::Backtick);      break;
-
-	default:
-		if (IsDigit(ch))
-		{
-			ScanNumberLiteral();
-		}
-		else if (IsAlpha(ch))
-		{
-			ScanIdentifier();
-		}
-		else
-		{
-			m_Errors.Add(FParseError::Format(m_CurrentLocation, "Unexpected character \"{}\""_sv, ch));
-		}
-		break;
+	}
+	else if (HasCharClass(ch, ECharClass::Digit))
+	{
+		ScanNumberLiteral();
+	}
+	else if (HasCharClass(ch, ECharClass::Alpha))
+	{
+		ScanIdentifier();
+	}
+	else
+	{
+		m_Errors.Add(FParseError::Format(GetCurrentLocation(), "Unexpected character \"{}\""_sv, ch));
 	}
 }
 
 void FScanner::SkipWhitespace()
 {
-	const auto IsWhitespace = [](const FStringView::CharType ch)
-	{
-		return ch <= ' ';
-	};
-
-	while (IsAtEnd() == false && IsWhitespace(Peek()))
-	{
-		AdvanceChar();
-	}
+	const FStringView::CharType* chars = m_Text.GetChars();
+	m_CurrentIndex = static_cast<FStringView::SizeType>(SkipWhitespaceChars(chars + m_CurrentIndex, chars + m_Text.Length()) - chars);
 }
@@ -0,0 +1,55 @@
+#include "Parsing/SourceLineTable.h"
+
+FSourceLocation FSourceLineTable::GetSourceLocation(const int32 sourceIndex) const
+{
+	if (sourceIndex < 0 || sourceIndex > m_Text.Length())
+	{
+		return {};
+	}
+
+	BuildLineStarts();
+
+	// Find the last line that starts at or before the index
+	int32 low = 0;
+	int32 high = m_LineStarts.Num() - 1;
+	while (low < high)
+	{
+		const int32 middle = low + (high - low + 1) / 2;
+		if (m_LineStarts[middle] <= sourceIndex)
+		{
+			low = middle;
+		}
+		else
+		{
+			high = middle - 1;
+		}
+	}
+
+	return FSourceLocation { low + 1, sourceIndex - m_LineStarts[low] + 1 };
+}
+
+void FSourceLineTable::Reset(const FStringView text)
+{
+	m_Text = text;
+	m_LineStarts.Reset();
+}
+
+void FSourceLineTable::BuildLineStarts() const
+{
+	if (m_LineStarts.Num() > 0)
+	{
+		return;
+	}
+
+	m_LineStarts.Add(0);
+
+	const FStringView::CharType* chars = m_Text.GetChars();
+	const int32 length = m_Text.Length();
+	for (int32 idx = 0; idx < length; ++idx)
+	{
+		if (chars[idx] == '\n' || (chars[idx] == '\r' && (idx + 1 >= length || chars[idx + 1] != '\n')))
+		{
+			m_LineStarts.Add(idx + 1);
+		}
+	}
+}
\ No newline at end of file
@@ -11,10 +11,10 @@ TEST(ScannerTests, SingleLineComment)
 
 	EXPECT_FALSE(scanner.HasErrors());
 	ASSERT_EQ(scanner.GetTokens().Num(), 4);
-	EXPECT_EQ(scanner.GetTokens()[0].Text, "this"_sv);
-	EXPECT_EQ(scanner.GetTokens()[1].Text, "is"_sv);
-	EXPECT_EQ(scanner.GetTokens()[2].Text, "a"_sv);
-	EXPECT_EQ(scanner.GetTokens()[3].Text, "single line comment"_sv);
+	EXPECT_EQ(scanner.GetTokenText(scanner.GetTokens()[0]), "this"_sv);
+	EXPECT_EQ(scanner.GetTokenText(scanner.GetTokens()[1]), "is"_sv);
+	EXPECT_EQ(scanner.GetTokenText(scanner.GetTokens()[2]), "a"_sv);
+	EXPECT_EQ(scanner.GetTokenText(scanner.GetTokens()[3]), "single line comment"_sv);
 }
 
 TEST(ScannerTests, MultiLineComment)
@@ -27,10 +27,51 @@ TEST(ScannerTests, MultiLineComment)
 
 	EXPECT_FALSE(scanner.HasErrors());
 	ASSERT_EQ(scanner.GetTokens().Num(), 6);
-	EXPECT_EQ(scanner.GetTokens()[0].Text, "this"_sv);
-	EXPECT_EQ(scanner.GetTokens()[1].Text, "is"_sv);
-	EXPECT_EQ(scanner.GetTokens()[2].Text, "a"_sv);
-	EXPECT_EQ(scanner.GetTokens()[3].Text, "multi\nline\rcomment\r\n:)"_sv);
-	EXPECT_EQ(scanner.GetTokens()[4].Text, "hello"_sv);
-	EXPECT_EQ(scanner.GetTokens()[5].Text, "world"_sv);
+	EXPECT_EQ(scanner.GetTokenText(scanner.GetTokens()[0]), "this"_sv);
+	EXPECT_EQ(scanner.GetTokenText(scanner.GetTokens()[1]), "is"_sv);
+	EXPECT_EQ(scanner.GetTokenText(scanner.GetTokens()[2]), "a"_sv);
+	EXPECT_EQ(scanner.GetTokenText(scanner.GetTokens()[3]), "multi\nline\rcomment\r\n:)"_sv);
+	EXPECT_EQ(scanner.GetTokenText(scanner.GetTokens()[4]), "hello"_sv);
+	EXPECT_EQ(scanner.GetTokenText(scanner.GetTokens()[5]), "world"_sv);
+}
+
+TEST(ScannerTests, TokenLocations)
+{
+	const FStringView text = "first\n  second\r\nthird\rfourth"_sv;
+
+	FScanner scanner;
+	scanner.ScanTextForTokens(text);
+
+	EXPECT_FALSE(scanner.HasErrors());
+	ASSERT_EQ(scanner.GetTokens().Num(), 4);
+	EXPECT_EQ(scanner.GetTokenLocation(scanner.GetTokens()[0]).Line, 1);
+	EXPECT_EQ(scanner.GetTokenLocation(scanner.GetTokens()[0]).Column, 1);
+	EXPECT_EQ(scanner.GetTokenLocation(scanner.GetTokens()[1]).Line, 2);
+	EXPECT_EQ(scanner.GetTokenLocation(scanner.GetTokens()[1]).Column, 3);
+	EXPECT_EQ(scanner.GetTokenLocation(scanner.GetTokens()[2]).Line, 3);
+	EXPECT_EQ(scanner.GetTokenLocation(scanner.GetTokens()[2]).Column, 1);
+	EXPECT_EQ(scanner.GetTokenLocation(scanner.GetTokens()[3]).Line, 4);
+	EXPECT_EQ(scanner.GetTokenLocation(scanner.GetTokens()[3]).Column, 1);
+	EXPECT_EQ(scanner.GetTokenText(scanner.GetTokens()[3]), "fourth"_sv);
+}
+
+TEST(ScannerTests, LongRuns)
+{
+	const FStringView text = "a_very_long_identifier_name_0123456789 \t\n\r\n                   12345678901234567890 \"a string that is longer than sixteen characters\" + _x"_sv;
+
+	FScanner scanner;
+	scanner.ScanTextForTokens(text);
+
+	EXPECT_FALSE(scanner.HasErrors());
+	ASSERT_EQ(scanner.GetTokens().Num(), 6);
+	EXPECT_EQ(scanner.GetTokens()[0].Type, ETokenType::Identifier);
+	EXPECT_EQ(scanner.GetTokenText(scanner.GetTokens()[0]), "a_very_long_identifier_name_0123456789"_sv);
+	EXPECT_EQ(scanner.GetTokens()[1].Type, ETokenType::Number);
+	EXPECT_EQ(scanner.GetTokenText(scanner.GetTokens()[1]), "12345678901234567890"_sv);
+	EXPECT_EQ(scanner.GetTokens()[2].Type, ETokenType::String);
+	EXPECT_EQ(scanner.GetTokenText(scanner.GetTokens()[2]), "a string that is longer than sixteen characters"_sv);
+	EXPECT_EQ(scanner.GetTokens()[3].Type, ETokenType::Plus);
+	EXPECT_EQ(scanner.GetTokens()[4].Type, ETokenType::Underscore);
+	EXPECT_EQ(scanner.GetTokens()[5].Type, ETokenType::Identifier);
+	EXPECT_EQ(scanner.GetTokenLocation(scanner.GetTokens()[1]).Line, 3);
 }
@@ -8,9 +8,13 @@
 #include "HAL/Path.h"
 #include "HAL/TextStreamWriter.h"
 #include "Main/Main.h"
+#include "MetaTool/GeneratedFileStream.h"
+#include "MetaTool/HeaderFileCache.h"
 #include "MetaTool/HeaderFileGenerator.h"
 #include "MetaTool/HeaderFileParser.h"
+#include "MetaTool/ScanDiagnostics.h"
 #include "MetaTool/SourceFileGenerator.h"
+#include "Threading/ThreadPool.h"
 
 static FStringView GTargetName;
 static FStringView GTargetSourceDirectory;
@@ -116,8 +120,31 @@ public:
 	 */
 	[[nodiscard]] bool ReadHeadersFile(FStringView headersFilePath);
 
+	/**
+	 * @brief Loads the cache of previously scanned header files.
+	 *
+	 * @param cacheFilePath The path to the cache file.
+	 */
+	void LoadCache(const FStringView cacheFilePath)
+	{
+		m_PreviousCache.Load(cacheFilePath);
+	}
+
+	/**
+	 * @brief Saves the cache of scanned header files.
+	 *
+	 * @param cacheFilePath The path to the cache file.
+	 */
+	void SaveCache(const FStringView cacheFilePath) const
+	{
+		m_Cache.Save(cacheFilePath);
+	}
+
 	/**
 	 * @brief Scans all files.
+	 *
+	 * Files are scanned in parallel, but the results are gathered in the order the header files were given so that
+	 * the amalgamated source file is the same from run to run.
 	 */
 	bool ScanFiles()
 	{
@@ -126,15 +153,47 @@ public:
 			return true;
 		}
 
+		TArray<FHeaderScanResult> scanResults;
+		scanResults.AddDefault(m_HeaderFiles.Num());
+
+		FThreadPool threadPool;
+		const FJobHandle scanJob = threadPool.ParallelFor(m_HeaderFiles.Num(), 1, [this, &scanResults](const int32 index)
+		{
+			FScopedScanDiagnostics diagnosticsScope { scanResults[index].Diagnostics };
+			scanResults[index].Succeeded = ScanFile(m_HeaderFiles[index], scanResults[index]);
+		});
+		threadPool.WaitForCounter(scanJob);
+
 		bool foundErrors = false;
-		for (FStringView filePath : m_HeaderFiles)
+		for (int32 index = 0; index < scanResults.Num(); ++index)
 		{
+			FHeaderScanResult& scanResult = scanResults[index];
+			FScopedScanDiagnostics::LogAll(scanResult.Diagnostics.AsSpan());
+
+			if (scanResult.Succeeded == false)
+			{
+				foundErrors = true;
+				continue;
+			}
+
+			const FStringView filePath = m_HeaderFiles[index];
 			if (filePath.IsEmpty())
 			{
 				continue;
 			}
 
-			foundErrors |= ScanFile(filePath) == false;
+			if (scanResult.EmittedTypeNames.IsEmpty() == false)
+			{
+				(void)m_GeneratedHeaderFiles.Emplace(FHeaderFileGenerator::GetTargetFilePath(filePath, GOutputDirectory));
+				(void)m_GeneratedSourceFiles.Emplace(FSourceFileGenerator::GetTargetFilePath(filePath, GOutputDirectory));
+				m_EmittedTypeNames.Append(scanResult.EmittedTypeNames.GetData(), scanResult.EmittedTypeNames.Num());
+			}
+
+			FHeaderFileCacheEntry cacheEntry;
+			cacheEntry.FilePath = FString { filePath };
+			cacheEntry.SourceHash = scanResult.SourceHash;
+			cacheEntry.EmittedTypeNames = MoveTemp(scanResult.EmittedTypeNames);
+			m_Cache.Add(MoveTemp(cacheEntry));
 		}
 		return foundErrors == false;
 	}
@@ -142,17 +201,40 @@ public:
 private:
 
 	/**
-	 * @brief Scans a file.
+	 * @brief Defines the result of scanning a single header file.
+	 */
+	struct FHeaderScanResult
+	{
+		/** @brief The names of the types that were emitted for the header file. */
+		TArray<FString> EmittedTypeNames;
+
+		/** @brief The hash of the header file's source. */
+		uint64 SourceHash = 0;
+
+		/** @brief The messages that were logged while scanning the header file. */
+		TArray<FScanDiagnostic> Diagnostics;
+
+		/** @brief Whether or not the header file was scanned successfully. */
+		bool Succeeded = false;
+	};
+
+	/**
+	 * @brief Scans a file. This is called from worker threads, so it must only read shared state and must log with
+	 *        META_LOG.
 	 *
 	 * @param filePath The path of the file to scan.
+	 * @param scanResult The result of scanning the file.
+	 * @return True if the file was scanned successfully, otherwise false.
 	 */
-	bool ScanFile(FStringView filePath);
+	bool ScanFile(FStringView filePath, FHeaderScanResult& scanResult) const;
 
 	FString m_HeadersFileContent;
 	TArray<FStringView> m_HeaderFiles;
 	TArray<FString> m_GeneratedHeaderFiles;
 	TArray<FString> m_GeneratedSourceFiles;
 	TArray<FString> m_EmittedTypeNames;
+	FHeaderFileCache m_PreviousCache;
+	FHeaderFileCache m_Cache;
 };
 
 bool FMetaGenerationContext::ReadHeadersFile(const FStringView headersFilePath)
@@ -172,17 +254,38 @@ bool FMetaGenerationContext::ReadHeadersFile(const FStringView headersFilePath)
 	return true;
 }
 
-bool FMetaGenerationContext::ScanFile(const FStringView filePath)
+bool FMetaGenerationContext::ScanFile(const FStringView filePath, FHeaderScanResult& scanResult) const
 {
-	FHeaderFileParser parser;
-	const EHeaderFileParseResult parseResult = parser.ParseFile(filePath, GOutputDirectory);
-	if (parseResult == EHeaderFileParseResult::GeneratedFileUpToDate)
+	if (filePath.IsEmpty())
 	{
-		m_GeneratedHeaderFiles.Add(FHeaderFileGenerator::GetTargetFilePath(filePath, GOutputDirectory));
-		m_GeneratedSourceFiles.Add(FSourceFileGenerator::GetTargetFilePath(filePath, GOutputDirectory));
 		return true;
 	}
-	else if (parseResult != EHeaderFileParseResult::Success)
+
+	TErrorOr<FString> readResult = FFile::ReadText(filePath);
+	if (readResult.IsError())
+	{
+		META_LOG(Error, "{}", readResult.ReleaseError());
+		return false;
+	}
+
+	FString fileSource = readResult.ReleaseValue();
+	scanResult.SourceHash = FHeaderFileCache::HashSource(fileSource.AsStringView());
+
+	// Reuse the previous run's results if the header has not changed, the cache was written by the same generator version,
+	// and the header's generated files are still around
+	if (const FHeaderFileCacheEntry* cacheEntry = m_PreviousCache.Find(filePath, scanResult.SourceHash))
+	{
+		if (cacheEntry->EmittedTypeNames.IsEmpty() ||
+		    (FFile::Exists(FHeaderFileGenerator::GetTargetFilePath(filePath, GOutputDirectory)) &&
+		     FFile::Exists(FSourceFileGenerator::GetTargetFilePath(filePath, GOutputDirectory))))
+		{
+			scanResult.EmittedTypeNames = cacheEntry->EmittedTypeNames;
+			return true;
+		}
+	}
+
+	FHeaderFileParser parser;
+	if (parser.ParseSource(filePath, MoveTemp(fileSource)) != EHeaderFileParseResult::Success)
 	{
 		return false;
 	}
@@ -197,42 +300,39 @@ bool FMetaGenerationContext::ScanFile(const FStringView filePath)
 	FHeaderFileGenerator headerGenerator;
 	if (headerGenerator.Begin(filePath, GOutputDirectory) == false)
 	{
-		UM_LOG(Error, "{}: Failed to begin writing header file for \"{}\"", GOutputDirectory, filePath);
+		META_LOG(Error, "{}: Failed to begin writing header file for \"{}\"", GOutputDirectory, filePath);
 		return false;
 	}
 
 	FSourceFileGenerator sourceGenerator;
 	if (sourceGenerator.Begin(filePath, GOutputDirectory) == false)
 	{
-		UM_LOG(Error, "{}: Failed to begin writing source file for \"{}\"", GOutputDirectory, filePath);
+		META_LOG(Error, "{}: Failed to begin writing source file for \"{}\"", GOutputDirectory, filePath);
 		return false;
 	}
 
 	for (const FParsedClassInfo& classInfo : parser.GetFoundClasses())
 	{
-		(void)m_EmittedTypeNames.Emplace(classInfo.TypeName);
+		(void)scanResult.EmittedTypeNames.Emplace(classInfo.TypeName);
 
 		headerGenerator.EmitClass(classInfo);
 		sourceGenerator.EmitClass(classInfo);
 	}
 	for (const FParsedEnumInfo& enumInfo : parser.GetFoundEnums())
 	{
-		(void)m_EmittedTypeNames.Emplace(enumInfo.EnumName);
+		(void)scanResult.EmittedTypeNames.Emplace(enumInfo.EnumName);
 
 		headerGenerator.EmitEnum(enumInfo);
 		sourceGenerator.EmitEnum(enumInfo);
 	}
 	for (const FParsedStructInfo& structInfo : parser.GetFoundStructs())
 	{
-		(void)m_EmittedTypeNames.Emplace(structInfo.TypeName);
+		(void)scanResult.EmittedTypeNames.Emplace(structInfo.TypeName);
 
 		headerGenerator.EmitStruct(structInfo);
 		sourceGenerator.EmitStruct(structInfo);
 	}
 
-	(void)m_GeneratedHeaderFiles.Emplace(headerGenerator.GetTargetFilePath());
-	(void)m_GeneratedSourceFiles.Emplace(sourceGenerator.GetTargetFilePath());
-
 	return true;
 }
 
@@ -281,6 +381,9 @@ extern "C" int32 UmbralMain()
 	const FString headersFileName = FString::Format("{}Headers.txt"_sv, GTargetName);
 	const FString headersFilePath = FPath::Join(GOutputDirectory, headersFileName);
 
+	const FString cacheFileName = FString::Format("{}MetaCache.txt"_sv, GTargetName);
+	const FString cacheFilePath = FPath::Join(GOutputDirectory, cacheFileName);
+
 	FMetaGenerationContext context;
 	if (context.ReadHeadersFile(headersFilePath) == false)
 	{
@@ -288,7 +391,13 @@ extern "C" int32 UmbralMain()
 		return EXIT_FAILURE;
 	}
 
-	if (context.ScanFiles() == false)
+	context.LoadCache(cacheFilePath);
+
+	// Headers that failed to scan are left out of the cache, so they will be scanned again next time
+	const bool scannedFiles = context.ScanFiles();
+	context.SaveCache(cacheFilePath);
+
+	if (scannedFiles == false)
 	{
 		return EXIT_FAILURE;
 	}
@@ -325,12 +434,8 @@ extern "C" int32 UmbralMain()
 	const FString targetFileName = FString { GTargetName } + ".Generated.cpp"_sv;
 	const FString targetFilePath = FPath::Join(GOutputDirectory, targetFileName);
 
-	TSharedPtr<IFileStream> fileStream = FFileSystem::OpenWrite(targetFilePath);
-	if (fileStream.IsNull())
-	{
-		UM_LOG(Error, "Failed to open \"{}\" for write", targetFilePath);
-		return EXIT_FAILURE;
-	}
+	// Only touch the amalgamated source file if it changed so that the target is not needlessly rebuilt
+	TSharedPtr<IFileStream> fileStream = MakeShared<FGeneratedFileStream>(targetFilePath);
 
 	FTextStreamWriter writer;
 	writer.SetFileStream(fileStream);
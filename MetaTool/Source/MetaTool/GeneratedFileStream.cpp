@@ -0,0 +1,83 @@
+#include "HAL/File.h"
+#include "MetaTool/GeneratedFileStream.h"
+#include "MetaTool/ScanDiagnostics.h"
+
+FGeneratedFileStream::FGeneratedFileStream(FString path)
+	: IFileStream(MoveTemp(path), EFileAccess::Write, EFileMode::Create)
+{
+}
+
+FGeneratedFileStream::~FGeneratedFileStream()
+{
+	Close();
+}
+
+void FGeneratedFileStream::Close()
+{
+	if (m_IsOpen == false)
+	{
+		return;
+	}
+
+	m_IsOpen = false;
+
+	if (FFile::Exists(GetPath()))
+	{
+		const TErrorOr<FString> existingContents = FFile::ReadText(GetPath());
+		if (existingContents.IsError() == false && existingContents.GetValue() == m_Contents.AsStringView())
+		{
+			return;
+		}
+	}
+
+	const TErrorOr<void> writeResult = FFile::WriteText(GetPath(), m_Contents.AsStringView());
+	if (writeResult.IsError())
+	{
+		META_LOG(Error, "Failed to write generated file \"{}\". Reason: {}", GetPath(), writeResult.GetError().GetMessage());
+	}
+}
+
+void FGeneratedFileStream::Flush()
+{
+}
+
+int64 FGeneratedFileStream::GetLength() const
+{
+	return m_Contents.Length();
+}
+
+bool FGeneratedFileStream::IsAtEnd() const
+{
+	return true;
+}
+
+bool FGeneratedFileStream::IsOpen() const
+{
+	return m_IsOpen;
+}
+
+void FGeneratedFileStream::Read(void*, uint64)
+{
+	UM_ASSERT_NOT_REACHED_MSG("Generated file streams cannot be read from");
+}
+
+void FGeneratedFileStream::Seek(ESeekOrigin, int64)
+{
+	UM_ASSERT_NOT_REACHED_MSG("Generated file streams cannot seek");
+}
+
+void FGeneratedFileStream::Sync()
+{
+}
+
+int64 FGeneratedFileStream::Tell() const
+{
+	return m_Contents.Length();
+}
+
+void FGeneratedFileStream::Write(const void* data, const uint64 dataSize)
+{
+	UM_ENSURE(m_IsOpen);
+
+	m_Contents.Append(static_cast<const char*>(data), static_cast<int32>(dataSize));
+}
\ No newline at end of file
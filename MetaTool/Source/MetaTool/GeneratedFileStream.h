@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Containers/String.h"
+#include "HAL/FileStream.h"
+
+/**
+ * @brief Defines a write-only file stream for generated files. Everything written is kept in memory, and the file is
+ *        only written when the stream is closed if its contents actually changed. This keeps the file's modified time
+ *        untouched on no-op runs, so translation units that include it are not rebuilt.
+ */
+class FGeneratedFileStream final : public IFileStream
+{
+	friend class FMemory;
+
+public:
+
+	/**
+	 * @brief Sets default values for this generated file stream's properties.
+	 *
+	 * @param path The path to the generated file.
+	 */
+	explicit FGeneratedFileStream(FString path);
+
+	/**
+	 * @brief Destroys this generated file stream.
+	 */
+	virtual ~FGeneratedFileStream() override;
+
+	/** @copydoc IFileStream::Close */
+	virtual void Close() override;
+
+	/** @copydoc IFileStream::Flush */
+	virtual void Flush() override;
+
+	/** @copydoc IFileStream::GetLength */
+	virtual int64 GetLength() const override;
+
+	/** @copydoc IFileStream::IsAtEnd */
+	virtual bool IsAtEnd() const override;
+
+	/** @copydoc IFileStream::IsOpen */
+	virtual bool IsOpen() const override;
+
+	/** @copydoc IFileStream::Read */
+	virtual void Read(void* data, uint64 dataSize) override;
+
+	/** @copydoc IFileStream::Seek */
+	virtual void Seek(ESeekOrigin origin, int64 offset) override;
+
+	/** @copydoc IFileStream::Sync */
+	virtual void Sync() override;
+
+	/** @copydoc IFileStream::Tell */
+	virtual int64 Tell() const override;
+
+	/** @copydoc IFileStream::Write */
+	virtual void Write(const void* data, uint64 dataSize) override;
+
+	using IFileStream::Write;
+
+private:
+
+	FString m_Contents;
+	bool m_IsOpen = true;
+};
\ No newline at end of file
@@ -0,0 +1,136 @@
+#include "Engine/Hashing.h"
+#include "Engine/Logging.h"
+#include "HAL/File.h"
+#include "MetaTool/GeneratedFileStream.h"
+#include "MetaTool/HeaderFileCache.h"
+
+/**
+ * @brief Attempts to parse an unsigned decimal integer.
+ *
+ * @param text The text to parse.
+ * @param value The parsed value.
+ * @return True if \p text was entirely a decimal integer, otherwise false.
+ */
+[[nodiscard]] static bool TryParseUint64(const FStringView text, uint64& value)
+{
+	if (text.IsEmpty())
+	{
+		return false;
+	}
+
+	value = 0;
+	for (const char ch : text)
+	{
+		if (ch < '0' || ch > '9')
+		{
+			return false;
+		}
+
+		value = value * 10 + static_cast<uint64>(ch - '0');
+	}
+
+	return true;
+}
+
+void FHeaderFileCache::Add(FHeaderFileCacheEntry entry)
+{
+	if (const int32* existingIndex = m_EntryIndices.Find(entry.FilePath))
+	{
+		m_Entries[*existingIndex] = MoveTemp(entry);
+		return;
+	}
+
+	(void)m_EntryIndices.Add(entry.FilePath, m_Entries.Num());
+	(void)m_Entries.Add(MoveTemp(entry));
+}
+
+const FHeaderFileCacheEntry* FHeaderFileCache::Find(const FStringView filePath, const uint64 sourceHash) const
+{
+	const int32* entryIndex = m_EntryIndices.Find(filePath);
+	if (entryIndex == nullptr)
+	{
+		return nullptr;
+	}
+
+	const FHeaderFileCacheEntry& entry = m_Entries[*entryIndex];
+	if (entry.SourceHash != sourceHash)
+	{
+		return nullptr;
+	}
+
+	return &entry;
+}
+
+uint64 FHeaderFileCache::HashSource(const FStringView fileSource)
+{
+	return Private::HashCombine(GetHashCode(fileSource), static_cast<uint64>(fileSource.Length()));
+}
+
+void FHeaderFileCache::Load(const FStringView cacheFilePath)
+{
+	m_Entries.Reset();
+	m_EntryIndices.Reset();
+
+	if (FFile::Exists(cacheFilePath) == false)
+	{
+		return;
+	}
+
+	TErrorOr<FString> readResult = FFile::ReadText(cacheFilePath);
+	if (readResult.IsError())
+	{
+		UM_LOG(Warning, "Failed to read meta cache \"{}\"; all headers will be parsed. Reason: {}", cacheFilePath, readResult.GetError().GetMessage());
+		return;
+	}
+
+	const FString cacheText = readResult.ReleaseValue();
+	const TArray<FStringView> lines = cacheText.SplitByCharsIntoViews("\r\n"_sv, EStringSplitOptions::IgnoreEmptyEntries);
+	const FString versionLine = FString::Format("Version\t{}\t{}"_sv, Version, GeneratorVersion);
+	if (lines.IsEmpty() || lines[0] != versionLine.AsStringView())
+	{
+		return;
+	}
+
+	for (int32 lineIndex = 1; lineIndex < lines.Num(); ++lineIndex)
+	{
+		// Each line is "<path>\t<hash>[\t<type name>...]"
+		const TArray<FString> fields = FString { lines[lineIndex] }.SplitByChars("\t"_sv, EStringSplitOptions::None);
+
+		FHeaderFileCacheEntry entry;
+		if (fields.Num() < 2 || TryParseUint64(fields[1].AsStringView(), entry.SourceHash) == false)
+		{
+			UM_LOG(Warning, "Meta cache \"{}\" is malformed; all headers will be parsed", cacheFilePath);
+			m_Entries.Reset();
+			m_EntryIndices.Reset();
+			return;
+		}
+
+		entry.FilePath = fields[0];
+		for (int32 fieldIndex = 2; fieldIndex < fields.Num(); ++fieldIndex)
+		{
+			(void)entry.EmittedTypeNames.Add(fields[fieldIndex]);
+		}
+
+		Add(MoveTemp(entry));
+	}
+}
+
+void FHeaderFileCache::Save(const FStringView cacheFilePath) const
+{
+	FString cacheText = FString::Format("Version\t{}\t{}\n"_sv, Version, GeneratorVersion);
+	for (const FHeaderFileCacheEntry& entry : m_Entries)
+	{
+		const FString entryLine = FString::Format("{}\t{}"_sv, entry.FilePath, entry.SourceHash);
+		cacheText.Append(entryLine);
+		for (const FString& typeName : entry.EmittedTypeNames)
+		{
+			cacheText.Append("\t"_sv);
+			cacheText.Append(typeName);
+		}
+		cacheText.Append("\n"_sv);
+	}
+
+	FGeneratedFileStream fileStream { FString { cacheFilePath } };
+	fileStream.Write(cacheText.GetChars(), static_cast<uint64>(cacheText.Length()));
+	fileStream.Close();
+}
\ No newline at end of file
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/HashMap.h"
+#include "Containers/String.h"
+
+/**
+ * @brief Defines what the meta tool remembers about a header file between runs.
+ */
+struct FHeaderFileCacheEntry
+{
+	/** @brief The path to the header file. */
+	FString FilePath;
+
+	/** @brief The hash of the header file's source. */
+	uint64 SourceHash = 0;
+
+	/** @brief The names of the types that were emitted for the header file. */
+	TArray<FString> EmittedTypeNames;
+};
+
+/**
+ * @brief Defines a cache of header files that have already had meta info generated, keyed by their content hashes.
+ */
+class FHeaderFileCache final
+{
+public:
+
+	/**
+	 * @brief The version of the cache file's layout. This must be bumped whenever the way entries are written changes.
+	 */
+	static constexpr int32 Version = 3;
+
+	/**
+	 * @brief The version of the code generators. This must be bumped whenever FHeaderFileGenerator or
+	 *        FSourceFileGenerator change what they emit for the same input. Caches written with any other generator
+	 *        version are discarded, so every header is regenerated instead of keeping stale generated code around.
+	 */
+	static constexpr int32 GeneratorVersion = 2;
+
+	/**
+	 * @brief Adds an entry to this cache, replacing any existing entry for the same header file.
+	 *
+	 * @param entry The entry to add.
+	 */
+	void Add(FHeaderFileCacheEntry entry);
+
+	/**
+	 * @brief Attempts to find the entry for a header file whose source has not changed.
+	 *
+	 * @param filePath The path to the header file.
+	 * @param sourceHash The hash of the header file's current source.
+	 * @return The entry for \p filePath, or nullptr if there is no entry or the header file has changed.
+	 */
+	[[nodiscard]] const FHeaderFileCacheEntry* Find(FStringView filePath, uint64 sourceHash) const;
+
+	/**
+	 * @brief Hashes the source of a header file.
+	 *
+	 * @param fileSource The header file's source.
+	 * @return The hash of \p fileSource.
+	 */
+	[[nodiscard]] static uint64 HashSource(FStringView fileSource);
+
+	/**
+	 * @brief Loads this cache from a file. A missing, malformed, or outdated cache file, or one written by a different
+	 *        generator version, results in an empty cache.
+	 *
+	 * @param cacheFilePath The path to the cache file.
+	 */
+	void Load(FStringView cacheFilePath);
+
+	/**
+	 * @brief Saves this cache to a file. The file is only written if its contents changed.
+	 *
+	 * @param cacheFilePath The path to the cache file.
+	 */
+	void Save(FStringView cacheFilePath) const;
+
+private:
+
+	TArray<FHeaderFileCacheEntry> m_Entries;
+	THashMap<FString, int32> m_EntryIndices;
+};
\ No newline at end of file
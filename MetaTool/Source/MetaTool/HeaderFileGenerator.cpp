@@ -1,8 +1,8 @@
-#include "HAL/FileSystem.h"
 #include "HAL/Path.h"
 #include "HAL/TextStreamWriter.h"
 #include "Misc/CString.h"
 #include "Misc/StringBuilder.h"
+#include "MetaTool/GeneratedFileStream.h"
 #include "MetaTool/HeaderFileGenerator.h"
 #include <cstring>
 
@@ -48,7 +48,7 @@ bool FHeaderFileGenerator::Begin(const FStringView sourceFilePath, const FString
 	m_UniqueFileId = GenerateUniqueFileId(sourceFilePath);
 	m_TargetFilePath = GetTargetFilePath(m_SourceFilePath, targetFileDirectory);
 
-	m_FileStream = FFileSystem::OpenWrite(m_TargetFilePath);
+	m_FileStream = MakeShared<FGeneratedFileStream>(m_TargetFilePath);
 	if (m_FileStream.IsNull() || m_FileStream->IsOpen() == false)
 	{
 		return false;
@@ -7,7 +7,8 @@
 #include "MetaTool/EnumInfo.h"
 
 /**
- * @brief Defines a helper for generating header files.
+ * @brief Defines a helper for generating header files. Bump FHeaderFileCache::GeneratorVersion whenever what this emits
+ *        changes, otherwise headers that were already generated keep their stale generated code.
  */
 class FHeaderFileGenerator final
 {
@@ -1,10 +1,8 @@
 #include "Containers/Optional.h"
 #include "HAL/File.h"
 #include "HAL/Path.h"
-#include "MetaTool/HeaderFileGenerator.h"
 #include "MetaTool/HeaderFileParser.h"
 #include "MetaTool/MetaMacroNames.h"
-#include "MetaTool/SourceFileGenerator.h"
 
 namespace TreeSitter
 {
@@ -142,40 +140,28 @@ public:
 		LogMessage(n, "Dumping {} node children:"_sv, ts_node_type(n)); \
 		for (uint32 i = 0; i < cc; ++i) { \
 			TSNode cn = ts_node_named_child(n, i); \
-			UM_LOG(Info, "\t{"); \
-			UM_LOG(Info, "\t\t\"index\": \"{} / {}\",", i + 1, cc); \
-			UM_LOG(Info, "\t\t\"type\": \"{}\",", ts_node_type(cn)); \
-			UM_LOG(Info, "\t\t\"text\": \"{}\"", GetNodeSourceText(cn)); \
-			UM_LOG(Info, "\t}"); \
+			META_LOG(Info, "\t{"); \
+			META_LOG(Info, "\t\t\"index\": \"{} / {}\",", i + 1, cc); \
+			META_LOG(Info, "\t\t\"type\": \"{}\",", ts_node_type(cn)); \
+			META_LOG(Info, "\t\t\"text\": \"{}\"", GetNodeSourceText(cn)); \
+			META_LOG(Info, "\t}"); \
 		} \
 	}
 
 extern "C" const TSLanguage* tree_sitter_cpp(void);
 
-[[nodiscard]] static bool AreGeneratedFilesNewerThanSourceFile(const FStringView sourceFile, const FStringView targetFileDirectory)
+/**
+ * @brief Makes tree-sitter allocate through the engine's allocator. Safe to call from multiple threads.
+ */
+static void SetTreeSitterAllocator()
 {
-	using FGetTargetFilePathFunction = FString(*)(FStringView, FStringView);
-
-	const auto IsGeneratedFileNewerThanSourceFile = [sourceFile, targetFileDirectory](FGetTargetFilePathFunction getTargetFilePathFunction)
+	static const bool GHasSetAllocator = []()
 	{
-		const FFileStats sourceFileStats = FFile::Stat(sourceFile);
-		if (sourceFileStats.Exists == false)
-		{
-			return false;
-		}
-
-		const FString targetFilePath = getTargetFilePathFunction(sourceFile, targetFileDirectory);
-		const FFileStats targetFileStats = FFile::Stat(targetFilePath);
-		if (targetFileStats.Exists == false)
-		{
-			return false;
-		}
-
-		return targetFileStats.ModifiedTime >= sourceFileStats.ModifiedTime;
-	};
+		ts_set_allocator(TreeSitter::Malloc, TreeSitter::Calloc, TreeSitter::Realloc, TreeSitter::Free);
+		return true;
+	}();
 
-	return IsGeneratedFileNewerThanSourceFile(FHeaderFileGenerator::GetTargetFilePath)
-	       && IsGeneratedFileNewerThanSourceFile(FSourceFileGenerator::GetTargetFilePath);
+	(void)GHasSetAllocator;
 }
 
 [[nodiscard]] static TSNode GetChildNodeOfType(TSNode node, const FStringView type)
@@ -283,35 +269,32 @@ bool FHeaderFileParser::IncludesFile(const FStringView filePath) const
 	});
 }
 
-EHeaderFileParseResult FHeaderFileParser::ParseFile(const FStringView filePath, const FStringView targetFileDirectory)
+EHeaderFileParseResult FHeaderFileParser::ParseFile(const FStringView filePath)
 {
-#if WITH_MODULE_EMITTED_TYPES == 0
-	if (AreGeneratedFilesNewerThanSourceFile(filePath, targetFileDirectory))
-	{
-		// TODO Re-enable with module emitted types when we have some kind of caching system for the types we emitted
-		return EHeaderFileParseResult::GeneratedFileUpToDate;
-	}
-#endif
-
-	ts_set_allocator(TreeSitter::Malloc, TreeSitter::Calloc, TreeSitter::Realloc, TreeSitter::Free);
-
-	m_FilePath = filePath;
-	m_FileSource.Reset();
-	m_FoundClasses.Reset();
-
 	TErrorOr<FString> readResult = FFile::ReadText(filePath);
 	if (readResult.IsError())
 	{
-		UM_LOG(Error, "{}", readResult.ReleaseError());
+		META_LOG(Error, "{}", readResult.ReleaseError());
 		return EHeaderFileParseResult::CouldNotReadFile;
 	}
 
-	m_FileSource = readResult.ReleaseValue();
+	return ParseSource(filePath, readResult.ReleaseValue());
+}
+
+EHeaderFileParseResult FHeaderFileParser::ParseSource(const FStringView filePath, FString fileSource)
+{
+	SetTreeSitterAllocator();
+
+	m_FilePath = filePath;
+	m_FileSource = MoveTemp(fileSource);
+	m_FoundClasses.Reset();
+	m_FoundEnums.Reset();
+	m_FoundStructs.Reset();
 
 	TUniquePtr<TSParser, FTreeSitterParserDeleter> parser { ts_parser_new() };
 	if (parser.IsNull())
 	{
-		UM_LOG(Error, "Failed to create parser");
+		META_LOG(Error, "Failed to create parser");
 		return EHeaderFileParseResult::ParseError;
 	}
 
@@ -323,7 +306,7 @@ EHeaderFileParseResult FHeaderFileParser::ParseFile(const FStringView filePath,
 	};
 	if (parseTree.IsNull())
 	{
-		UM_LOG(Error, "Failed to parse file \"{}\"", m_FilePath);
+		META_LOG(Error, "Failed to parse file \"{}\"", m_FilePath);
 		return EHeaderFileParseResult::ParseError;
 	}
 
@@ -331,7 +314,7 @@ EHeaderFileParseResult FHeaderFileParser::ParseFile(const FStringView filePath,
 	const FStringView rootNodeType { ts_node_type(translationUnit) };
 	if (rootNodeType != "translation_unit"_sv)
 	{
-		UM_LOG(Error, "Root node is not a translation unit for C++ file \"{}\"", filePath);
+		META_LOG(Error, "Root node is not a translation unit for C++ file \"{}\"", filePath);
 		return EHeaderFileParseResult::ParseError;
 	}
 
@@ -2,9 +2,9 @@
 
 #include "Containers/Stack.h"
 #include "Containers/String.h"
-#include "Engine/Logging.h"
 #include "MetaTool/ClassInfo.h"
 #include "MetaTool/EnumInfo.h"
+#include "MetaTool/ScanDiagnostics.h"
 #include <tree_sitter/api.h>
 
 class FReflectionHeaderInfo; // TODO Rename to FParsedHeaderInfo ?
@@ -16,8 +16,6 @@ enum class EHeaderFileParseResult
 {
 	/** @brief Successfully parsed a header file. */
 	Success,
-	/** @brief The generated file is already up-to-date. */
-	GeneratedFileUpToDate,
 	/** @brief Failed to read the header file. */
 	CouldNotReadFile,
 	/** @brief Encountered an error while parsing the header file. */
@@ -86,10 +84,18 @@ public:
 	 * @brief Attempts to parse a header file for types to generate meta info for.
 	 *
 	 * @param filePath The path to the file being parsed.
-	 * @param targetFileDirectory The directory that the generated files will live in.
-	 * @return True if parsing was successful, otherwise false.
+	 * @return The result of parsing the file.
 	 */
-	[[nodiscard]] EHeaderFileParseResult ParseFile(FStringView filePath, FStringView targetFileDirectory);
+	[[nodiscard]] EHeaderFileParseResult ParseFile(FStringView filePath);
+
+	/**
+	 * @brief Attempts to parse the already-read source of a header file for types to generate meta info for.
+	 *
+	 * @param filePath The path to the file being parsed.
+	 * @param fileSource The file's source.
+	 * @return The result of parsing the file.
+	 */
+	[[nodiscard]] EHeaderFileParseResult ParseSource(FStringView filePath, FString fileSource);
 
 private:
 
@@ -115,12 +121,12 @@ private:
 
 		if constexpr (sizeof...(args) == 0)
 		{
-			UM_LOG(Error, "{}({}:{}) {}", m_FilePath, location.row + 1, location.column + 1, message);
+			META_LOG(Error, "{}({}:{}) {}", m_FilePath, location.row + 1, location.column + 1, message);
 		}
 		else
 		{
 			const FString formattedMessage = FString::Format(message, Forward<ArgTypes>(args)...);
-			UM_LOG(Error, "{}({}:{}) {}", m_FilePath, location.row + 1, location.column + 1, formattedMessage);
+			META_LOG(Error, "{}({}:{}) {}", m_FilePath, location.row + 1, location.column + 1, formattedMessage);
 		}
 	}
 
@@ -138,12 +144,12 @@ private:
 
 		if constexpr (sizeof...(args) == 0)
 		{
-			UM_LOG(Info, "{}({}:{}) {}", m_FilePath, location.row + 1, location.column + 1, message);
+			META_LOG(Info, "{}({}:{}) {}", m_FilePath, location.row + 1, location.column + 1, message);
 		}
 		else
 		{
 			const FString formattedMessage = FString::Format(message, Forward<ArgTypes>(args)...);
-			UM_LOG(Info, "{}({}:{}) {}", m_FilePath, location.row + 1, location.column + 1, formattedMessage);
+			META_LOG(Info, "{}({}:{}) {}", m_FilePath, location.row + 1, location.column + 1, formattedMessage);
 		}
 	}
 
@@ -0,0 +1,38 @@
+#include "MetaTool/ScanDiagnostics.h"
+
+/** @brief The messages collected for the header file being scanned on the calling thread, if any. */
+static thread_local TArray<FScanDiagnostic>* GCurrentScanDiagnostics = nullptr;
+
+FScopedScanDiagnostics::FScopedScanDiagnostics(TArray<FScanDiagnostic>& diagnostics)
+	: m_PreviousDiagnostics { GCurrentScanDiagnostics }
+{
+	GCurrentScanDiagnostics = &diagnostics;
+}
+
+FScopedScanDiagnostics::~FScopedScanDiagnostics()
+{
+	GCurrentScanDiagnostics = m_PreviousDiagnostics;
+}
+
+void FScopedScanDiagnostics::LogAll(const TSpan<const FScanDiagnostic> diagnostics)
+{
+	for (const FScanDiagnostic& diagnostic : diagnostics)
+	{
+		if (diagnostic.LogLevel >= Private::FLogger::GetLogLevel())
+		{
+			Private::FLogger::GetInstance().Write(diagnostic.LogLevel, "{}"_sv, diagnostic.Message);
+		}
+	}
+}
+
+void FScopedScanDiagnostics::Write(const ELogLevel logLevel, FString message)
+{
+	if (GCurrentScanDiagnostics != nullptr)
+	{
+		GCurrentScanDiagnostics->Add(FScanDiagnostic { logLevel, MoveTemp(message) });
+		return;
+	}
+
+	const FScanDiagnostic diagnostic { logLevel, MoveTemp(message) };
+	LogAll(TSpan<const FScanDiagnostic> { &diagnostic, 1 });
+}
\ No newline at end of file
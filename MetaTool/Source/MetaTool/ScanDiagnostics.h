@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/Span.h"
+#include "Containers/String.h"
+#include "Engine/Logging.h"
+
+/**
+ * @brief Logs a message from code that may be scanning a header file. While a header file is being scanned, the message
+ *        is kept with the header file's results instead of being written to the log straight away.
+ */
+#define META_LOG(LogLevel, Message, ...) \
+	FScopedScanDiagnostics::Write(ELogLevel:: LogLevel, FString::Format(UM_JOIN(Message, _sv), ##__VA_ARGS__))
+
+/**
+ * @brief Defines a message that was logged while scanning a header file.
+ */
+struct FScanDiagnostic
+{
+	/** @brief The message's log level. */
+	ELogLevel LogLevel = ELogLevel::Info;
+
+	/** @brief The formatted message. */
+	FString Message;
+};
+
+/**
+ * @brief Defines a scope in which messages logged with META_LOG on the calling thread are collected instead of logged.
+ *
+ * Header files are scanned on worker threads, but the logger is not safe to write to from more than one thread at a
+ * time, so each header file's messages are collected and logged by the main thread once scanning has finished.
+ */
+class FScopedScanDiagnostics final
+{
+	UM_DISABLE_COPY(FScopedScanDiagnostics);
+	UM_DISABLE_MOVE(FScopedScanDiagnostics);
+
+public:
+
+	/**
+	 * @brief Starts collecting messages logged on the calling thread.
+	 *
+	 * @param diagnostics The array to add collected messages to.
+	 */
+	explicit FScopedScanDiagnostics(TArray<FScanDiagnostic>& diagnostics);
+
+	/**
+	 * @brief Stops collecting messages logged on the calling thread.
+	 */
+	~FScopedScanDiagnostics();
+
+	/**
+	 * @brief Writes collected messages to the log. Must only be called from one thread at a time.
+	 *
+	 * @param diagnostics The collected messages.
+	 */
+	static void LogAll(TSpan<const FScanDiagnostic> diagnostics);
+
+	/**
+	 * @brief Collects a message if the calling thread is collecting messages, otherwise writes it to the log.
+	 *
+	 * @param logLevel The message's log level.
+	 * @param message The formatted message.
+	 */
+	static void Write(ELogLevel logLevel, FString message);
+
+private:
+
+	TArray<FScanDiagnostic>* m_PreviousDiagnostics = nullptr;
+};
\ No newline at end of file
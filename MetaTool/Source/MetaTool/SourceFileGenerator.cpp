@@ -1,7 +1,8 @@
 #include "Engine/Logging.h"
-#include "HAL/FileSystem.h"
 #include "HAL/Path.h"
 #include "HAL/TextStreamWriter.h"
+#include "Misc/StringBuilder.h"
+#include "MetaTool/GeneratedFileStream.h"
 #include "MetaTool/SourceFileGenerator.h"
 
 FSourceFileGenerator::~FSourceFileGenerator()
@@ -20,7 +21,7 @@ bool FSourceFileGenerator::Begin(const FStringView sourceFilePath, const FString
 	m_TargetFileDirectory = targetFileDirectory;
 	m_TargetFilePath = GetTargetFilePath(m_SourceFilePath, m_TargetFileDirectory);
 
-	m_FileStream = FFileSystem::OpenWrite(m_TargetFilePath);
+	m_FileStream = MakeShared<FGeneratedFileStream>(m_TargetFilePath);
 	if (m_FileStream.IsNull() || m_FileStream->IsOpen() == false)
 	{
 		return false;
@@ -32,6 +33,7 @@ bool FSourceFileGenerator::Begin(const FStringView sourceFilePath, const FString
 	// Output the initial code common to every source file
 	writer.WriteLine("#include \"{}\""_sv, m_SourceFilePath);
 	writer.WriteLine("#include \"Meta/ArrayTypeInfo.h\""_sv);
+	writer.WriteLine("#include \"Meta/HashMapTypeInfo.h\""_sv);
 	writer.WriteLine("#include \"Templates/CanVisitReferencedObjects.h\""_sv);
 	writer.WriteLine("#include \"Templates/IsConstructible.h\""_sv);
 	writer.WriteLine();
@@ -59,6 +61,8 @@ void FSourceFileGenerator::EmitClass(const FParsedClassInfo& classInfo)
 	m_FileStream->Write("\n"_sv);
 	EmitStructTypeDefinition(classInfo);
 	m_FileStream->Write("\n"_sv);
+	EmitTypeRegistration(classInfo.TypeName);
+	m_FileStream->Write("\n"_sv);
 
 	if (classInfo.BaseTypeName.IsEmpty() || classInfo.HasObjectProperties())
 	{
@@ -71,6 +75,8 @@ void FSourceFileGenerator::EmitEnum(const FParsedEnumInfo& enumInfo)
 {
 	EmitEnumTypeDefinition(enumInfo);
 	m_FileStream->Write("\n"_sv);
+	EmitTypeRegistration(enumInfo.EnumName);
+	m_FileStream->Write("\n"_sv);
 }
 
 void FSourceFileGenerator::EmitStruct(const FParsedStructInfo& structInfo)
@@ -79,6 +85,8 @@ void FSourceFileGenerator::EmitStruct(const FParsedStructInfo& structInfo)
 	m_FileStream->Write("\n"_sv);
 	EmitStructTypeDefinition(structInfo);
 	m_FileStream->Write("\n"_sv);
+	EmitTypeRegistration(structInfo.TypeName);
+	m_FileStream->Write("\n"_sv);
 
 	if (structInfo.BaseTypeName.IsEmpty() || structInfo.HasObjectProperties())
 	{
@@ -244,6 +252,7 @@ void FSourceFileGenerator::EmitStructOrClassStaticTypeFunction(const FParsedStru
 		customWriteCallback(writer);
 	}
 
+	writer.WriteLine("typeInfo.Finalize();"_sv);
 	writer.WriteLine("return typeInfo;"_sv);
 	writer.Unindent();
 
@@ -351,4 +360,17 @@ void FSourceFileGenerator::EmitStructOrClassVisitReferencedObjectsFunction(const
 
 	writer.Unindent();
 	writer.WriteLine("}"_sv);
+}
+
+void FSourceFileGenerator::EmitTypeRegistration(const FStringView typeName)
+{
+	FTextStreamWriter writer;
+	writer.SetFileStream(m_FileStream);
+
+	writer.WriteLine("static const FTypeRegistration GTypeRegistration_{}"_sv, typeName);
+	writer.WriteLine("{"_sv);
+	writer.Indent();
+	writer.WriteLine("[]() -> const FTypeInfo* \\{ return ::GetType<{}>(); }"_sv, typeName);
+	writer.Unindent();
+	writer.WriteLine("};"_sv);
 }
\ No newline at end of file
@@ -10,7 +10,8 @@
 class FTextStreamWriter;
 
 /**
- * @brief Defines a helper for generating source files.
+ * @brief Defines a helper for generating source files. Bump FHeaderFileCache::GeneratorVersion whenever what this emits
+ *        changes, otherwise headers that were already generated keep their stale generated code.
  */
 class FSourceFileGenerator final
 {
@@ -126,6 +127,13 @@ private:
 	 */
 	void EmitStructOrClassVisitReferencedObjectsFunction(const FParsedStructInfo& typeInfo);
 
+	/**
+	 * @brief Emits the registration of a type with the type registry.
+	 *
+	 * @param typeName The type's name.
+	 */
+	void EmitTypeRegistration(FStringView typeName);
+
 	TSharedPtr<IFileStream> m_FileStream;
 	FStringView m_SourceFilePath;
 	FStringView m_TargetFileDirectory;
@@ -1,5 +1,5 @@
-#include "Engine/Logging.h"
 #include "MetaTool/ClassInfo.h"
+#include "MetaTool/ScanDiagnostics.h"
 #include "MetaTool/StructInfo.h"
 #include "Parsing/Scanner.h"
 
@@ -32,27 +32,22 @@ static bool IsObjectOrActorName(const FStringView typeName)
 	       typeName == "FWeakObjectPtr"_sv;
 }
 
-static inline bool IsObjectOrActorName(const FToken& token)
+static bool IsObjectBasedTypeName(const FStringView typeName, const TSpan<const FToken> tokens)
 {
-	return IsObjectOrActorName(token.Text);
-}
-
-static bool IsObjectBasedTypeName(const TSpan<const FToken> tokens)
-{
-	if (IsObjectOrActorName(tokens[0]))
+	if (IsObjectOrActorName(tokens[0].GetText(typeName)))
 	{
 		return true;
 	}
 
-	if (tokens[0].Text == "TArray"_sv)
+	if (tokens[0].GetText(typeName) == "TArray"_sv)
 	{
 		// Ill-formed TArray property
-		if (tokens[1].Text != "<"_sv || tokens[tokens.Num() - 1].Text != ">"_sv)
+		if (tokens[1].GetText(typeName) != "<"_sv || tokens[tokens.Num() - 1].GetText(typeName) != ">"_sv)
 		{
 			return false;
 		}
 
-		return IsObjectBasedTypeName(tokens.Slice(2, tokens.Num() - 3));
+		return IsObjectBasedTypeName(typeName, tokens.Slice(2, tokens.Num() - 3));
 	}
 
 	return false;
@@ -71,15 +66,15 @@ bool FParsedStructInfo::IsObjectBasedName(const FStringView typeName)
 
 	if (scanner.HasErrors())
 	{
-		UM_LOG(Error, "Failed to parse type name \"{}\". Reason(s):", typeName);
+		META_LOG(Error, "Failed to parse type name \"{}\". Reason(s):", typeName);
 		for (const FParseError& error : scanner.GetErrors())
 		{
-			UM_LOG(Error, "  {} {}", error.GetSourceLocation(), error.GetMessage());
+			META_LOG(Error, "  {} {}", error.GetSourceLocation(), error.GetMessage());
 		}
 		return false;
 	}
 
-	return IsObjectBasedTypeName(scanner.GetTokens());
+	return IsObjectBasedTypeName(typeName, scanner.GetTokens());
 }
 
 bool FParsedStructInfo::IsObjectClass() const
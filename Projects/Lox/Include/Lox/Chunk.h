@@ -0,0 +1,307 @@
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/Span.h"
+#include "Engine/MiscMacros.h"
+#include "Lox/SourceLocation.h"
+#include "Lox/Value.h"
+
+/**
+ * @brief An enumeration of Lox virtual machine operations.
+ *
+ * Operands are named after the fields of an instruction. R[x] is the register at index x, and K[x] is the constant at
+ * index x in the chunk's constant pool.
+ */
+enum class ELoxOpCode : uint8
+{
+	/** @brief R[A] = K[Bx] */
+	LoadConstant,
+
+	/** @brief R[A] = null */
+	LoadNull,
+
+	/** @brief R[A] = (B != 0) */
+	LoadBool,
+
+	/** @brief R[A] = R[B] + R[C] */
+	Add,
+
+	/** @brief R[A] = R[B] - R[C] */
+	Subtract,
+
+	/** @brief R[A] = R[B] * R[C] */
+	Multiply,
+
+	/** @brief R[A] = R[B] / R[C] */
+	Divide,
+
+	/** @brief R[A] = R[B] == R[C] */
+	Equal,
+
+	/** @brief R[A] = R[B] != R[C] */
+	NotEqual,
+
+	/** @brief R[A] = R[B] > R[C] */
+	Greater,
+
+	/** @brief R[A] = R[B] >= R[C] */
+	GreaterEqual,
+
+	/** @brief R[A] = R[B] < R[C] */
+	Less,
+
+	/** @brief R[A] = R[B] <= R[C] */
+	LessEqual,
+
+	/** @brief R[A] = -R[B] */
+	Negate,
+
+	/** @brief R[A] = !R[B] */
+	Not,
+
+	/** @brief Continues at instruction Bx. */
+	Jump,
+
+	/** @brief Continues at instruction Bx if R[A] is false. */
+	JumpIfFalse,
+
+	/** @brief Returns R[A]. */
+	Return
+};
+
+/**
+ * @brief The number of Lox virtual machine operations.
+ */
+inline constexpr int32 GLoxOpCodeCount = static_cast<int32>(ELoxOpCode::Return) + 1;
+
+/**
+ * @brief Defines helpers for encoding and decoding Lox virtual machine instructions.
+ *
+ * Each instruction is 32 bits wide. The low 8 bits are the op code, and the next 8 bits are the A operand. The high 16
+ * bits are either two 8-bit operands, B and C, or one 16-bit operand, Bx.
+ */
+class FLoxInstruction final
+{
+public:
+
+	/** @brief The maximum value of the A, B, and C operands. */
+	static constexpr int32 MaxOperand = 0xFF;
+
+	/** @brief The maximum value of the Bx operand. */
+	static constexpr int32 MaxWideOperand = 0xFFFF;
+
+	/**
+	 * @brief Encodes an instruction with A, B, and C operands.
+	 *
+	 * @param opCode The op code.
+	 * @param a The A operand.
+	 * @param b The B operand.
+	 * @param c The C operand.
+	 * @return The encoded instruction.
+	 */
+	[[nodiscard]] static constexpr uint32 Encode(const ELoxOpCode opCode, const int32 a, const int32 b = 0, const int32 c = 0)
+	{
+		return static_cast<uint32>(opCode)
+		     | (static_cast<uint32>(a) << 8)
+		     | (static_cast<uint32>(b) << 16)
+		     | (static_cast<uint32>(c) << 24);
+	}
+
+	/**
+	 * @brief Encodes an instruction with A and Bx operands.
+	 *
+	 * @param opCode The op code.
+	 * @param a The A operand.
+	 * @param bx The Bx operand.
+	 * @return The encoded instruction.
+	 */
+	[[nodiscard]] static constexpr uint32 EncodeWide(const ELoxOpCode opCode, const int32 a, const int32 bx)
+	{
+		return static_cast<uint32>(opCode)
+		     | (static_cast<uint32>(a) << 8)
+		     | (static_cast<uint32>(bx) << 16);
+	}
+
+	/**
+	 * @brief Gets an instruction's op code.
+	 *
+	 * @param instruction The instruction.
+	 * @return The op code.
+	 */
+	[[nodiscard]] static constexpr ELoxOpCode GetOpCode(const uint32 instruction)
+	{
+		return static_cast<ELoxOpCode>(instruction & 0xFF);
+	}
+
+	/**
+	 * @brief Gets an instruction's A operand.
+	 *
+	 * @param instruction The instruction.
+	 * @return The A operand.
+	 */
+	[[nodiscard]] static constexpr int32 GetA(const uint32 instruction)
+	{
+		return static_cast<int32>((instruction >> 8) & 0xFF);
+	}
+
+	/**
+	 * @brief Gets an instruction's B operand.
+	 *
+	 * @param instruction The instruction.
+	 * @return The B operand.
+	 */
+	[[nodiscard]] static constexpr int32 GetB(const uint32 instruction)
+	{
+		return static_cast<int32>((instruction >> 16) & 0xFF);
+	}
+
+	/**
+	 * @brief Gets an instruction's Bx operand.
+	 *
+	 * @param instruction The instruction.
+	 * @return The Bx operand.
+	 */
+	[[nodiscard]] static constexpr int32 GetBx(const uint32 instruction)
+	{
+		return static_cast<int32>(instruction >> 16);
+	}
+
+	/**
+	 * @brief Gets an instruction's C operand.
+	 *
+	 * @param instruction The instruction.
+	 * @return The C operand.
+	 */
+	[[nodiscard]] static constexpr int32 GetC(const uint32 instruction)
+	{
+		return static_cast<int32>(instruction >> 24);
+	}
+};
+
+/**
+ * @brief Defines a chunk of compiled Lox bytecode.
+ */
+class FLoxChunk final
+{
+	UM_DISABLE_COPY(FLoxChunk);
+
+public:
+
+	UM_DEFAULT_MOVE(FLoxChunk);
+
+	/**
+	 * @brief Sets default values for this chunk's properties.
+	 */
+	FLoxChunk() = default;
+
+	/**
+	 * @brief Destroys this chunk.
+	 */
+	~FLoxChunk() = default;
+
+	/**
+	 * @brief Adds a constant to this chunk's constant pool.
+	 *
+	 * @param value The constant value.
+	 * @return The index of the constant.
+	 */
+	[[nodiscard]] int32 AddConstant(FLoxValue value)
+	{
+		return m_Constants.Add(MoveTemp(value));
+	}
+
+	/**
+	 * @brief Adds an instruction to this chunk.
+	 *
+	 * @param instruction The encoded instruction.
+	 * @param sourceLocation The location of the source that the instruction was compiled from.
+	 * @return The index of the instruction.
+	 */
+	[[maybe_unused]] int32 AddInstruction(uint32 instruction, const FLoxSourceLocation& sourceLocation);
+
+	/**
+	 * @brief Gets this chunk's instructions.
+	 *
+	 * @return This chunk's instructions.
+	 */
+	[[nodiscard]] TSpan<const uint32> GetCode() const
+	{
+		return m_Code.AsSpan();
+	}
+
+	/**
+	 * @brief Gets this chunk's constant pool.
+	 *
+	 * @return This chunk's constant pool.
+	 */
+	[[nodiscard]] TSpan<const FLoxValue> GetConstants() const
+	{
+		return m_Constants.AsSpan();
+	}
+
+	/**
+	 * @brief Gets the number of registers needed to run this chunk.
+	 *
+	 * @return The number of registers needed to run this chunk.
+	 */
+	[[nodiscard]] int32 GetNumRegisters() const
+	{
+		return m_NumRegisters;
+	}
+
+	/**
+	 * @brief Gets the location of the source that an instruction was compiled from.
+	 *
+	 * @param instructionIndex The index of the instruction.
+	 * @return The source location.
+	 */
+	[[nodiscard]] const FLoxSourceLocation& GetSourceLocation(const int32 instructionIndex) const
+	{
+		return m_SourceLocations[instructionIndex];
+	}
+
+	/**
+	 * @brief Gets the number of instructions in this chunk.
+	 *
+	 * @return The number of instructions in this chunk.
+	 */
+	[[nodiscard]] int32 NumInstructions() const
+	{
+		return m_Code.Num();
+	}
+
+	/**
+	 * @brief Replaces the Bx operand of an instruction that has already been added.
+	 *
+	 * @param instructionIndex The index of the instruction.
+	 * @param bx The new Bx operand.
+	 */
+	void PatchWideOperand(int32 instructionIndex, int32 bx);
+
+	/**
+	 * @brief Makes sure that this chunk reserves at least the given number of registers.
+	 *
+	 * @param numRegisters The number of registers.
+	 */
+	void ReserveRegisters(const int32 numRegisters)
+	{
+		if (numRegisters > m_NumRegisters)
+		{
+			m_NumRegisters = numRegisters;
+		}
+	}
+
+	/**
+	 * @brief Disassembles this chunk into a human-readable listing.
+	 *
+	 * @return The listing.
+	 */
+	[[nodiscard]] FString ToString() const;
+
+private:
+
+	TArray<uint32> m_Code;
+	TArray<FLoxValue> m_Constants;
+	TArray<FLoxSourceLocation> m_SourceLocations;
+	int32 m_NumRegisters = 0;
+};
\ No newline at end of file
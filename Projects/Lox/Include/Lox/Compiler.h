@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Lox/Chunk.h"
+#include "Lox/Error.h"
+#include "Lox/Expressions.h"
+
+/**
+ * @brief Defines a way to compile Lox expressions into bytecode for the Lox virtual machine.
+ *
+ * Every sub-expression is assigned a register when it is compiled, so the virtual machine never has to look anything up
+ * while running. The result of an expression is always written to the register it was assigned, and its operands use
+ * the registers directly after that one.
+ */
+class FLoxCompiler final : public TLoxExpressionVisitor<TLoxErrorOr<void>>
+{
+public:
+
+	FLoxCompiler() = default;
+	virtual ~FLoxCompiler() override = default;
+
+	/**
+	 * @brief Compiles an expression into a chunk that returns the expression's value.
+	 *
+	 * @param expression The expression.
+	 * @return The compiled chunk, or the first error that was encountered.
+	 */
+	[[nodiscard]] TLoxErrorOr<FLoxChunk> Compile(FLoxExpression& expression);
+
+private:
+
+	/**
+	 * @brief Adds an instruction to the chunk being compiled.
+	 *
+	 * @param instruction The encoded instruction.
+	 * @return The index of the instruction.
+	 */
+	[[maybe_unused]] int32 AddInstruction(uint32 instruction);
+
+	/**
+	 * @brief Compiles an expression so that its value is written to the given register.
+	 *
+	 * @param expression The expression.
+	 * @param targetRegister The register to write the value to.
+	 * @param token The token to report an error at if there are no registers left.
+	 * @return Nothing, or the error that was encountered.
+	 */
+	[[nodiscard]] TLoxErrorOr<void> CompileToRegister(FLoxExpression& expression, int32 targetRegister, const FLoxToken& token);
+
+	/**
+	 * @brief Gets the op code for a binary operator.
+	 *
+	 * @param tokenType The binary operator's token type.
+	 * @param opCode The op code.
+	 * @return True if \p tokenType is a supported binary operator, otherwise false.
+	 */
+	[[nodiscard]] static bool GetBinaryOpCode(ELoxTokenType tokenType, ELoxOpCode& opCode);
+
+	/** @copydoc TLoxExpressionVisitor::VisitBinaryExpression */
+	virtual TLoxErrorOr<void> VisitBinaryExpression(FLoxBinaryExpression& expression) override;
+
+	/** @copydoc TLoxExpressionVisitor::VisitGroupedExpression */
+	virtual TLoxErrorOr<void> VisitGroupedExpression(FLoxGroupedExpression& expression) override;
+
+	/** @copydoc TLoxExpressionVisitor::VisitLiteralExpression */
+	virtual TLoxErrorOr<void> VisitLiteralExpression(FLoxLiteralExpression& expression) override;
+
+	/** @copydoc TLoxExpressionVisitor::VisitTernaryExpression */
+	virtual TLoxErrorOr<void> VisitTernaryExpression(FLoxTernaryExpression& expression) override;
+
+	/** @copydoc TLoxExpressionVisitor::VisitUnaryExpression */
+	virtual TLoxErrorOr<void> VisitUnaryExpression(FLoxUnaryExpression& expression) override;
+
+	FLoxChunk m_Chunk;
+	FLoxSourceLocation m_SourceLocation;
+	int32 m_TargetRegister = 0;
+};
\ No newline at end of file
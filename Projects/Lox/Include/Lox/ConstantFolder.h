@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Containers/Optional.h"
+#include "Lox/Expressions.h"
+#include "Lox/Statements.h"
+
+/**
+ * @brief Defines a pass that evaluates constant sub-expressions ahead of time and replaces them with literals.
+ *
+ * Literal arithmetic, comparisons, and unary operators are folded, grouping parentheses are removed, and ternaries with a
+ * constant condition are replaced by the branch they would take. Folding uses the same value operations as evaluation, so
+ * results are identical. Anything that would fail, such as dividing by zero, is left alone so that the error is still
+ * reported when the expression runs.
+ */
+class FLoxConstantFolder final : public TLoxExpressionVisitor<TOptional<FLoxValue>>
+{
+public:
+
+	FLoxConstantFolder() = default;
+	virtual ~FLoxConstantFolder() override = default;
+
+	/**
+	 * @brief Folds the constant sub-expressions of an expression, replacing the expression itself if it is constant.
+	 *
+	 * @param expression The expression.
+	 */
+	void Fold(TUniquePtr<FLoxExpression>& expression);
+
+	/**
+	 * @brief Folds the constant sub-expressions of every expression in the given statements.
+	 *
+	 * @param statements The statements.
+	 */
+	void Fold(TSpan<TUniquePtr<FLoxStatement>> statements);
+
+private:
+
+	/**
+	 * @brief Folds a child expression, replacing it with a literal if it is constant.
+	 *
+	 * @param expression The child expression.
+	 * @return The value of the child if it is constant, otherwise nothing.
+	 */
+	[[nodiscard]] TOptional<FLoxValue> FoldChild(TUniquePtr<FLoxExpression>& expression);
+
+	/** @copydoc TLoxExpressionVisitor::VisitBinaryExpression */
+	virtual TOptional<FLoxValue> VisitBinaryExpression(FLoxBinaryExpression& expression) override;
+
+	/** @copydoc TLoxExpressionVisitor::VisitGroupedExpression */
+	virtual TOptional<FLoxValue> VisitGroupedExpression(FLoxGroupedExpression& expression) override;
+
+	/** @copydoc TLoxExpressionVisitor::VisitLiteralExpression */
+	virtual TOptional<FLoxValue> VisitLiteralExpression(FLoxLiteralExpression& expression) override;
+
+	/** @copydoc TLoxExpressionVisitor::VisitTernaryExpression */
+	virtual TOptional<FLoxValue> VisitTernaryExpression(FLoxTernaryExpression& expression) override;
+
+	/** @copydoc TLoxExpressionVisitor::VisitUnaryExpression */
+	virtual TOptional<FLoxValue> VisitUnaryExpression(FLoxUnaryExpression& expression) override;
+
+	TUniquePtr<FLoxExpression> m_Replacement;
+	FLoxSourceLocation m_SourceLocation;
+};
\ No newline at end of file
@@ -33,6 +33,16 @@ public:
 		return m_Statements.AsSpan();
 	}
 
+	/**
+	 * @brief Gets the statements parsed by this parser.
+	 *
+	 * @return The parsed statements.
+	 */
+	[[nodiscard]] TSpan<TUniquePtr<FLoxStatement>> GetStatements()
+	{
+		return m_Statements.AsSpan();
+	}
+
 	/**
 	 * @brief Checks to see if this parser encountered any errors.
 	 *
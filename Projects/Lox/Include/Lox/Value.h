@@ -1,8 +1,8 @@
 #pragma once
 
 #include "Containers/String.h"
-#include "Containers/Variant.h"
 #include "Lox/Error.h"
+#include <bit> /* For std::bit_cast */
 
 /**
  * @brief An enumeration of possible value types.
@@ -16,13 +16,111 @@ enum class ELoxValueType : uint8
 	String
 };
 
+/**
+ * @brief An enumeration of the types of reference-counted objects a Lox value can point to.
+ */
+enum class ELoxObjectType : uint8
+{
+	String,
+	BoxedInteger
+};
+
+/**
+ * @brief Defines the header of a reference-counted object that a Lox value can point to.
+ */
+struct FLoxObject
+{
+	/** @brief The number of values that point to this object. */
+	int32 RefCount = 1;
+
+	/** @brief The type of this object. */
+	ELoxObjectType Type = ELoxObjectType::String;
+};
+
 /**
  * @brief Defines a Lox value.
+ *
+ * Values are NaN-boxed into 8 bytes. Floats are stored as is, and everything else is stored in the payload of a
+ * negative quiet NaN, which no arithmetic can produce because NaN floats are all stored as the same positive NaN. The top
+ * 16 bits say what the low 48 bits hold: nothing for null, a Boolean, an integer that fits in 48 bits, or a pointer to a
+ * reference-counted object. Strings are immutable and interned, so copying a string value never copies its characters
+ * and equal strings always point to the same object. Integers that do not fit in 48 bits are boxed.
+ *
+ * Values are not thread-safe; reference counts and the string table are not synchronized.
  */
 class FLoxValue
 {
 public:
 
+	/**
+	 * @brief Sets default values for this value's properties. The default value is null.
+	 */
+	FLoxValue() = default;
+
+	/**
+	 * @brief Copies another value.
+	 *
+	 * @param other The other value.
+	 */
+	FLoxValue(const FLoxValue& other)
+		: m_Bits { other.m_Bits }
+	{
+		AddRef();
+	}
+
+	/**
+	 * @brief Moves another value's contents into this value, leaving the other value null.
+	 *
+	 * @param other The other value.
+	 */
+	FLoxValue(FLoxValue&& other) noexcept
+		: m_Bits { other.m_Bits }
+	{
+		other.m_Bits = NullBits;
+	}
+
+	/**
+	 * @brief Destroys this value.
+	 */
+	~FLoxValue()
+	{
+		Release();
+	}
+
+	/**
+	 * @brief Copies another value.
+	 *
+	 * @param other The other value.
+	 * @return This value.
+	 */
+	FLoxValue& operator=(const FLoxValue& other)
+	{
+		if (m_Bits != other.m_Bits)
+		{
+			other.AddRef();
+			Release();
+			m_Bits = other.m_Bits;
+		}
+		return *this;
+	}
+
+	/**
+	 * @brief Moves another value's contents into this value, leaving the other value null.
+	 *
+	 * @param other The other value.
+	 * @return This value.
+	 */
+	FLoxValue& operator=(FLoxValue&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Release();
+			m_Bits = other.m_Bits;
+			other.m_Bits = NullBits;
+		}
+		return *this;
+	}
+
 	/**
 	 * @brief Adds two values together.
 	 *
@@ -95,7 +193,10 @@ public:
 	 * @param value The value.
 	 * @return The value.
 	 */
-	[[nodiscard]] static FLoxValue FromBool(bool value);
+	[[nodiscard]] static FLoxValue FromBool(const bool value)
+	{
+		return FLoxValue { value ? TrueBits : FalseBits };
+	}
 
 	/**
 	 * @brief Creates a value from a floating-point value.
@@ -103,7 +204,15 @@ public:
 	 * @param value The value.
 	 * @return The value.
 	 */
-	[[nodiscard]] static FLoxValue FromFloat(double value);
+	[[nodiscard]] static FLoxValue FromFloat(const double value)
+	{
+		// Every NaN is stored as the same positive NaN so that no float can be mistaken for a boxed value
+		if (value != value)
+		{
+			return FLoxValue { CanonicalNaNBits };
+		}
+		return FLoxValue { std::bit_cast<uint64>(value) };
+	}
 
 	/**
 	 * @brief Creates a value from an integral value.
@@ -111,7 +220,14 @@ public:
 	 * @param value The value.
 	 * @return The value.
 	 */
-	[[nodiscard]] static FLoxValue FromInt(int64 value);
+	[[nodiscard]] static FLoxValue FromInt(const int64 value)
+	{
+		if (value >= MinSmallInt && value <= MaxSmallInt)
+		{
+			return FLoxValue { SmallIntTag | (static_cast<uint64>(value) & PayloadMask) };
+		}
+		return FromBoxedInt(value);
+	}
 
 	/**
 	 * @brief Creates a value from a string value.
@@ -150,7 +266,7 @@ public:
 	 */
 	[[nodiscard]] bool IsBool() const
 	{
-		return m_Value.Is<bool>();
+		return (m_Bits & TagMask) == BoolTag;
 	}
 
 	/**
@@ -160,7 +276,7 @@ public:
 	 */
 	[[nodiscard]] bool IsFloat() const
 	{
-		return m_Value.Is<double>();
+		return m_Bits < FirstTag;
 	}
 
 	/**
@@ -170,7 +286,7 @@ public:
 	 */
 	[[nodiscard]] bool IsInt() const
 	{
-		return m_Value.Is<int64>();
+		return IsSmallInt() || IsObjectOfType(ELoxObjectType::BoxedInteger);
 	}
 
 	/**
@@ -180,7 +296,7 @@ public:
 	 */
 	[[nodiscard]] bool IsNull() const
 	{
-		return m_Value.Is<FEmptyType>();
+		return m_Bits == NullBits;
 	}
 
 	/**
@@ -200,7 +316,38 @@ public:
 	 */
 	[[nodiscard]] bool IsString() const
 	{
-		return m_Value.Is<FString>();
+		return IsObjectOfType(ELoxObjectType::String);
+	}
+
+	/**
+	 * @brief Checks to see if this value is an integer that is stored inline rather than boxed.
+	 *
+	 * @return True if this value is an inline integer, otherwise false.
+	 */
+	[[nodiscard]] bool IsSmallInt() const
+	{
+		return (m_Bits & TagMask) == SmallIntTag;
+	}
+
+	/**
+	 * @brief Gets the value of an inline integer. Only valid if IsSmallInt returns true.
+	 *
+	 * @return The integer value.
+	 */
+	[[nodiscard]] int64 GetSmallInt() const
+	{
+		// Shift the 48-bit payload to the top and back down to sign-extend it
+		return static_cast<int64>(m_Bits << 16) >> 16;
+	}
+
+	/**
+	 * @brief Gets the value of a float. Only valid if IsFloat returns true.
+	 *
+	 * @return The float value.
+	 */
+	[[nodiscard]] double GetFloat() const
+	{
+		return std::bit_cast<double>(m_Bits);
 	}
 
 	/**
@@ -259,7 +406,66 @@ public:
 
 private:
 
-	using VariantType = TVariant<FEmptyType, bool, int64, double, FString>;
+	static constexpr uint64 TagMask          = 0xFFFF000000000000ull;
+	static constexpr uint64 PayloadMask      = 0x0000FFFFFFFFFFFFull;
+	static constexpr uint64 FirstTag         = 0xFFF9000000000000ull;
+	static constexpr uint64 NullTag          = 0xFFF9000000000000ull;
+	static constexpr uint64 BoolTag          = 0xFFFA000000000000ull;
+	static constexpr uint64 SmallIntTag      = 0xFFFB000000000000ull;
+	static constexpr uint64 ObjectTag        = 0xFFFC000000000000ull;
+	static constexpr uint64 NullBits         = NullTag;
+	static constexpr uint64 FalseBits        = BoolTag;
+	static constexpr uint64 TrueBits         = BoolTag | 1;
+	static constexpr uint64 CanonicalNaNBits = 0x7FF8000000000000ull;
+	static constexpr int64 MinSmallInt       = -(static_cast<int64>(1) << 47);
+	static constexpr int64 MaxSmallInt       = (static_cast<int64>(1) << 47) - 1;
+
+	/**
+	 * @brief Sets default values for this value's properties.
+	 *
+	 * @param bits The value's bits.
+	 */
+	explicit FLoxValue(const uint64 bits)
+		: m_Bits { bits }
+	{
+	}
+
+	/**
+	 * @brief Creates a value that takes ownership of one reference to an object.
+	 *
+	 * @param object The object.
+	 * @return The value.
+	 */
+	[[nodiscard]] static FLoxValue FromObject(FLoxObject* object)
+	{
+		return FLoxValue { ObjectTag | (reinterpret_cast<uint64>(object) & PayloadMask) };
+	}
+
+	/**
+	 * @brief Creates a value that holds a boxed integer.
+	 *
+	 * @param value The integer.
+	 * @return The value.
+	 */
+	[[nodiscard]] static FLoxValue FromBoxedInt(int64 value);
+
+	/**
+	 * @brief Frees an object whose last reference has been released.
+	 *
+	 * @param object The object.
+	 */
+	static void FreeObject(FLoxObject* object);
+
+	/**
+	 * @brief Adds a reference to the object this value points to, if any.
+	 */
+	void AddRef() const
+	{
+		if (IsObject())
+		{
+			++GetObject()->RefCount;
+		}
+	}
 
 	/**
 	 * @brief Appends the underlying value to the given string builder.
@@ -268,15 +474,63 @@ private:
 	 */
 	void AppendValueToStringBuilder(FStringBuilder& builder) const;
 
-	VariantType m_Value;
+	/**
+	 * @brief Gets the object this value points to. Only valid if IsObject returns true.
+	 *
+	 * @return The object.
+	 */
+	[[nodiscard]] FLoxObject* GetObject() const
+	{
+		return reinterpret_cast<FLoxObject*>(m_Bits & PayloadMask);
+	}
+
+	/**
+	 * @brief Checks to see if this value points to an object.
+	 *
+	 * @return True if this value points to an object, otherwise false.
+	 */
+	[[nodiscard]] bool IsObject() const
+	{
+		return (m_Bits & TagMask) == ObjectTag;
+	}
+
+	/**
+	 * @brief Checks to see if this value points to an object of the given type.
+	 *
+	 * @param type The object type.
+	 * @return True if this value points to an object of type \p type, otherwise false.
+	 */
+	[[nodiscard]] bool IsObjectOfType(const ELoxObjectType type) const
+	{
+		return IsObject() && GetObject()->Type == type;
+	}
+
+	/**
+	 * @brief Releases the reference to the object this value points to, if any.
+	 */
+	void Release()
+	{
+		if (IsObject())
+		{
+			FLoxObject* object = GetObject();
+			if (--object->RefCount == 0)
+			{
+				FreeObject(object);
+			}
+		}
+	}
+
+	uint64 m_Bits = NullBits;
 };
 
+static_assert(sizeof(FLoxValue) == 8);
+
 /**
  * @brief Defines a string formatter for a Lox value.
  */
 template<>
 struct TFormatter<FLoxValue>
 {
-	void BuildString(const FLoxValue& value, FStringBuilder& builder);
-	bool Parse(FStringView formatString) const;
+	void BuildString(const FLoxValue& value, FStringBuilder& builder) const;
+	bool Parse(FStringView formatString);
 };
\ No newline at end of file
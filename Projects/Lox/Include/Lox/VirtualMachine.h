@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Containers/Array.h"
+#include "Lox/Chunk.h"
+#include "Lox/Error.h"
+#include "Lox/Value.h"
+
+/**
+ * @brief Defines a register-based virtual machine that runs compiled Lox bytecode.
+ *
+ * The registers are kept between runs, so running many chunks with the same virtual machine does not need to allocate
+ * once the largest chunk has been run.
+ */
+class FLoxVirtualMachine final
+{
+public:
+
+	/**
+	 * @brief Runs a chunk of bytecode.
+	 *
+	 * @param chunk The chunk.
+	 * @return The value returned by the chunk, or the runtime error that was encountered.
+	 */
+	[[nodiscard]] TLoxErrorOr<FLoxValue> Run(const FLoxChunk& chunk);
+
+private:
+
+	TArray<FLoxValue> m_Registers;
+};
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include "Engine/Assert.h"
+#include "Lox/Chunk.h"
+#include "Misc/StringBuilder.h"
+
+/**
+ * @brief Gets the name of an op code.
+ *
+ * @param opCode The op code.
+ * @return The name of the op code.
+ */
+static constexpr FStringView GetOpCodeName(const ELoxOpCode opCode)
+{
+	switch (opCode)
+	{
+	case ELoxOpCode::LoadConstant: return "LoadConstant"_sv;
+	case ELoxOpCode::LoadNull:     return "LoadNull"_sv;
+	case ELoxOpCode::LoadBool:     return "LoadBool"_sv;
+	case ELoxOpCode::Add:          return "Add"_sv;
+	case ELoxOpCode::Subtract:     return "Subtract"_sv;
+	case ELoxOpCode::Multiply:     return "Multiply"_sv;
+	case ELoxOpCode::Divide:       return "Divide"_sv;
+	case ELoxOpCode::Equal:        return "Equal"_sv;
+	case ELoxOpCode::NotEqual:     return "NotEqual"_sv;
+	case ELoxOpCode::Greater:      return "Greater"_sv;
+	case ELoxOpCode::GreaterEqual: return "GreaterEqual"_sv;
+	case ELoxOpCode::Less:         return "Less"_sv;
+	case ELoxOpCode::LessEqual:    return "LessEqual"_sv;
+	case ELoxOpCode::Negate:       return "Negate"_sv;
+	case ELoxOpCode::Not:          return "Not"_sv;
+	case ELoxOpCode::Jump:         return "Jump"_sv;
+	case ELoxOpCode::JumpIfFalse:  return "JumpIfFalse"_sv;
+	case ELoxOpCode::Return:       return "Return"_sv;
+	default:                       return "<unknown>"_sv;
+	}
+}
+
+int32 FLoxChunk::AddInstruction(const uint32 instruction, const FLoxSourceLocation& sourceLocation)
+{
+	(void)m_SourceLocations.Add(sourceLocation);
+	return m_Code.Add(instruction);
+}
+
+void FLoxChunk::PatchWideOperand(const int32 instructionIndex, const int32 bx)
+{
+	UM_ASSERT(m_Code.IsValidIndex(instructionIndex), "Attempting to patch an instruction that does not exist");
+
+	const uint32 instruction = m_Code[instructionIndex];
+	m_Code[instructionIndex] = FLoxInstruction::EncodeWide(FLoxInstruction::GetOpCode(instruction), FLoxInstruction::GetA(instruction), bx);
+}
+
+FString FLoxChunk::ToString() const
+{
+	FStringBuilder builder;
+	builder.Append("registers: {}, constants: {}\n"_sv, m_NumRegisters, m_Constants.Num());
+
+	for (int32 idx = 0; idx < m_Code.Num(); ++idx)
+	{
+		const uint32 instruction = m_Code[idx];
+		const ELoxOpCode opCode = FLoxInstruction::GetOpCode(instruction);
+		const int32 a = FLoxInstruction::GetA(instruction);
+
+		builder.Append("{} {} "_sv, idx, GetOpCodeName(opCode));
+
+		switch (opCode)
+		{
+		case ELoxOpCode::LoadConstant:
+			builder.Append("r{} k{} ({})"_sv, a, FLoxInstruction::GetBx(instruction), m_Constants[FLoxInstruction::GetBx(instruction)]);
+			break;
+
+		case ELoxOpCode::LoadNull:
+		case ELoxOpCode::Return:
+			builder.Append("r{}"_sv, a);
+			break;
+
+		case ELoxOpCode::LoadBool:
+			builder.Append("r{} {}"_sv, a, FLoxInstruction::GetB(instruction) != 0);
+			break;
+
+		case ELoxOpCode::Negate:
+		case ELoxOpCode::Not:
+			builder.Append("r{} r{}"_sv, a, FLoxInstruction::GetB(instruction));
+			break;
+
+		case ELoxOpCode::Jump:
+			builder.Append("{}"_sv, FLoxInstruction::GetBx(instruction));
+			break;
+
+		case ELoxOpCode::JumpIfFalse:
+			builder.Append("r{} {}"_sv, a, FLoxInstruction::GetBx(instruction));
+			break;
+
+		default:
+			builder.Append("r{} r{} r{}"_sv, a, FLoxInstruction::GetB(instruction), FLoxInstruction::GetC(instruction));
+			break;
+		}
+
+		builder.Append("\n"_sv);
+	}
+
+	return builder.ReleaseString();
+}
\ No newline at end of file
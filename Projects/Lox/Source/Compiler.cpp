@@ -0,0 +1,192 @@
+#include "Lox/Compiler.h"
+
+TLoxErrorOr<FLoxChunk> FLoxCompiler::Compile(FLoxExpression& expression)
+{
+	m_Chunk = FLoxChunk {};
+	m_SourceLocation = {};
+	m_TargetRegister = 0;
+	m_Chunk.ReserveRegisters(1);
+
+	TLoxErrorOr<void> result = expression.AcceptVisitor(*this);
+	if (result.IsError())
+	{
+		return result.ReleaseError();
+	}
+
+	AddInstruction(FLoxInstruction::Encode(ELoxOpCode::Return, 0));
+
+	return MoveTemp(m_Chunk);
+}
+
+int32 FLoxCompiler::AddInstruction(const uint32 instruction)
+{
+	return m_Chunk.AddInstruction(instruction, m_SourceLocation);
+}
+
+TLoxErrorOr<void> FLoxCompiler::CompileToRegister(FLoxExpression& expression, const int32 targetRegister, const FLoxToken& token)
+{
+	if (targetRegister > FLoxInstruction::MaxOperand)
+	{
+		return MAKE_LOX_ERROR(token, "Expression is too complex; it needs more than {} registers", FLoxInstruction::MaxOperand + 1);
+	}
+
+	m_Chunk.ReserveRegisters(targetRegister + 1);
+
+	const int32 previousTargetRegister = m_TargetRegister;
+	m_TargetRegister = targetRegister;
+
+	TLoxErrorOr<void> result = expression.AcceptVisitor(*this);
+
+	m_TargetRegister = previousTargetRegister;
+	return result;
+}
+
+bool FLoxCompiler::GetBinaryOpCode(const ELoxTokenType tokenType, ELoxOpCode& opCode)
+{
+	switch (tokenType)
+	{
+	case ELoxTokenType::Plus:         opCode = ELoxOpCode::Add;          return true;
+	case ELoxTokenType::Minus:        opCode = ELoxOpCode::Subtract;     return true;
+	case ELoxTokenType::Asterisk:     opCode = ELoxOpCode::Multiply;     return true;
+	case ELoxTokenType::Slash:        opCode = ELoxOpCode::Divide;       return true;
+	case ELoxTokenType::EqualEqual:   opCode = ELoxOpCode::Equal;        return true;
+	case ELoxTokenType::BangEqual:    opCode = ELoxOpCode::NotEqual;     return true;
+	case ELoxTokenType::Greater:      opCode = ELoxOpCode::Greater;      return true;
+	case ELoxTokenType::GreaterEqual: opCode = ELoxOpCode::GreaterEqual; return true;
+	case ELoxTokenType::Less:         opCode = ELoxOpCode::Less;         return true;
+	case ELoxTokenType::LessEqual:    opCode = ELoxOpCode::LessEqual;    return true;
+	default:                                                             return false;
+	}
+}
+
+TLoxErrorOr<void> FLoxCompiler::VisitBinaryExpression(FLoxBinaryExpression& expression)
+{
+	// TODO FLoxValue::Pow
+	if (expression.Operator.Type == ELoxTokenType::Caret)
+	{
+		return MAKE_LOX_ERROR(expression.Operator, "Power operator (\"^\") not yet implemented");
+	}
+
+	ELoxOpCode opCode = ELoxOpCode::Add;
+	if (GetBinaryOpCode(expression.Operator.Type, opCode) == false)
+	{
+		return MAKE_LOX_ERROR(expression.Operator, "Invalid binary operator \"{}\"", expression.Operator.Text);
+	}
+
+	const int32 targetRegister = m_TargetRegister;
+	const int32 rightRegister = targetRegister + 1;
+
+	TLoxErrorOr<void> leftResult = CompileToRegister(*expression.Left, targetRegister, expression.Operator);
+	if (leftResult.IsError())
+	{
+		return leftResult;
+	}
+
+	TLoxErrorOr<void> rightResult = CompileToRegister(*expression.Right, rightRegister, expression.Operator);
+	if (rightResult.IsError())
+	{
+		return rightResult;
+	}
+
+	m_SourceLocation = expression.Operator.SourceLocation;
+	AddInstruction(FLoxInstruction::Encode(opCode, targetRegister, targetRegister, rightRegister));
+
+	return {};
+}
+
+TLoxErrorOr<void> FLoxCompiler::VisitGroupedExpression(FLoxGroupedExpression& expression)
+{
+	return expression.Inner->AcceptVisitor(*this);
+}
+
+TLoxErrorOr<void> FLoxCompiler::VisitLiteralExpression(FLoxLiteralExpression& expression)
+{
+	const FLoxValue& value = expression.Literal.Value;
+	m_SourceLocation = expression.Literal.SourceLocation;
+
+	if (value.IsNull())
+	{
+		AddInstruction(FLoxInstruction::Encode(ELoxOpCode::LoadNull, m_TargetRegister));
+		return {};
+	}
+
+	if (value.IsBool())
+	{
+		AddInstruction(FLoxInstruction::Encode(ELoxOpCode::LoadBool, m_TargetRegister, value.AsBool() ? 1 : 0));
+		return {};
+	}
+
+	const int32 constantIndex = m_Chunk.AddConstant(value);
+	if (constantIndex > FLoxInstruction::MaxWideOperand)
+	{
+		return MAKE_LOX_ERROR(expression.Literal, "Expression has more than {} constants", FLoxInstruction::MaxWideOperand + 1);
+	}
+
+	AddInstruction(FLoxInstruction::EncodeWide(ELoxOpCode::LoadConstant, m_TargetRegister, constantIndex));
+	return {};
+}
+
+TLoxErrorOr<void> FLoxCompiler::VisitTernaryExpression(FLoxTernaryExpression& expression)
+{
+	TLoxErrorOr<void> conditionResult = expression.Condition->AcceptVisitor(*this);
+	if (conditionResult.IsError())
+	{
+		return conditionResult;
+	}
+
+	// Both branches write to the same register as the condition, so only one jump is needed to skip over each of them
+	const int32 jumpToFalseIndex = AddInstruction(FLoxInstruction::EncodeWide(ELoxOpCode::JumpIfFalse, m_TargetRegister, 0));
+
+	TLoxErrorOr<void> trueResult = expression.TrueExpression->AcceptVisitor(*this);
+	if (trueResult.IsError())
+	{
+		return trueResult;
+	}
+
+	const int32 jumpToEndIndex = AddInstruction(FLoxInstruction::EncodeWide(ELoxOpCode::Jump, 0, 0));
+	m_Chunk.PatchWideOperand(jumpToFalseIndex, m_Chunk.NumInstructions());
+
+	TLoxErrorOr<void> falseResult = expression.FalseExpression->AcceptVisitor(*this);
+	if (falseResult.IsError())
+	{
+		return falseResult;
+	}
+
+	// Reserve room for the return instruction, which may be the jump target
+	if (m_Chunk.NumInstructions() >= FLoxInstruction::MaxWideOperand)
+	{
+		return FLoxError { m_SourceLocation, "Expression is too long to compile"_s };
+	}
+
+	m_Chunk.PatchWideOperand(jumpToEndIndex, m_Chunk.NumInstructions());
+	return {};
+}
+
+TLoxErrorOr<void> FLoxCompiler::VisitUnaryExpression(FLoxUnaryExpression& expression)
+{
+	ELoxOpCode opCode = ELoxOpCode::Negate;
+	switch (expression.Operator.Type)
+	{
+	case ELoxTokenType::Minus:
+		opCode = ELoxOpCode::Negate;
+		break;
+
+	case ELoxTokenType::Bang:
+		opCode = ELoxOpCode::Not;
+		break;
+
+	default:
+		return MAKE_LOX_ERROR(expression.Operator, "Invalid unary operator \"{}\"", expression.Operator.Text);
+	}
+
+	TLoxErrorOr<void> rightResult = expression.Right->AcceptVisitor(*this);
+	if (rightResult.IsError())
+	{
+		return rightResult;
+	}
+
+	m_SourceLocation = expression.Operator.SourceLocation;
+	AddInstruction(FLoxInstruction::Encode(opCode, m_TargetRegister, m_TargetRegister));
+
+	return {};
+}
\ No newline at end of file
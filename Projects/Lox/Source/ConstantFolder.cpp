@@ -0,0 +1,201 @@
+#include "Engine/Cast.h"
+#include "Lox/ConstantFolder.h"
+
+/**
+ * @brief Applies a binary operator to two constant values.
+ *
+ * @param operatorType The operator's token type.
+ * @param left The left value.
+ * @param right The right value.
+ * @return The result, or nothing if the operation fails or cannot be folded.
+ */
+static TOptional<FLoxValue> FoldBinaryOperator(const ELoxTokenType operatorType, const FLoxValue& left, const FLoxValue& right)
+{
+	TErrorOr<FLoxValue> arithmeticResult;
+	switch (operatorType)
+	{
+	case ELoxTokenType::Plus:     arithmeticResult = FLoxValue::Add(left, right);      break;
+	case ELoxTokenType::Minus:    arithmeticResult = FLoxValue::Subtract(left, right); break;
+	case ELoxTokenType::Asterisk: arithmeticResult = FLoxValue::Multiply(left, right); break;
+	case ELoxTokenType::Slash:    arithmeticResult = FLoxValue::Divide(left, right);   break;
+
+	case ELoxTokenType::Greater:
+	case ELoxTokenType::GreaterEqual:
+	case ELoxTokenType::Less:
+	case ELoxTokenType::LessEqual:
+	case ELoxTokenType::EqualEqual:
+	case ELoxTokenType::BangEqual:
+	{
+		const TErrorOr<ECompareResult> compareResult = FLoxValue::Compare(left, right);
+		if (compareResult.IsError())
+		{
+			return nullopt;
+		}
+
+		const ECompareResult comparison = compareResult.GetValue();
+		switch (operatorType)
+		{
+		case ELoxTokenType::Greater:      return FLoxValue::FromBool(comparison == ECompareResult::GreaterThan);
+		case ELoxTokenType::GreaterEqual: return FLoxValue::FromBool(comparison != ECompareResult::LessThan);
+		case ELoxTokenType::Less:         return FLoxValue::FromBool(comparison == ECompareResult::LessThan);
+		case ELoxTokenType::LessEqual:    return FLoxValue::FromBool(comparison != ECompareResult::GreaterThan);
+		case ELoxTokenType::EqualEqual:   return FLoxValue::FromBool(comparison == ECompareResult::Equals);
+		default:                          return FLoxValue::FromBool(comparison != ECompareResult::Equals);
+		}
+	}
+
+	default:
+		return nullopt;
+	}
+
+	if (arithmeticResult.IsError())
+	{
+		return nullopt;
+	}
+
+	return arithmeticResult.ReleaseValue();
+}
+
+/**
+ * @brief Makes a literal expression for a constant value.
+ *
+ * @param value The value.
+ * @param sourceLocation The location of the source the value was folded from.
+ * @return The literal expression.
+ */
+static TUniquePtr<FLoxExpression> MakeLiteralExpression(FLoxValue value, const FLoxSourceLocation& sourceLocation)
+{
+	FLoxToken literal;
+	literal.Text = value.AsString();
+	literal.SourceLocation = sourceLocation;
+
+	switch (value.GetType())
+	{
+	case ELoxValueType::Null:    literal.Type = ELoxTokenType::Null; break;
+	case ELoxValueType::Boolean: literal.Type = value.AsBool() ? ELoxTokenType::True : ELoxTokenType::False; break;
+	case ELoxValueType::Float:   literal.Type = ELoxTokenType::Float; break;
+	case ELoxValueType::Integer: literal.Type = ELoxTokenType::Integer; break;
+	case ELoxValueType::String:  literal.Type = ELoxTokenType::String; break;
+	}
+
+	literal.Value = MoveTemp(value);
+	return MakeUnique<FLoxLiteralExpression>(MoveTemp(literal));
+}
+
+void FLoxConstantFolder::Fold(TUniquePtr<FLoxExpression>& expression)
+{
+	(void)FoldChild(expression);
+}
+
+void FLoxConstantFolder::Fold(TSpan<TUniquePtr<FLoxStatement>> statements)
+{
+	for (TUniquePtr<FLoxStatement>& statement : statements)
+	{
+		if (FLoxExpressionStatement* expressionStatement = Cast<FLoxExpressionStatement>(statement.Get()))
+		{
+			Fold(expressionStatement->Expression);
+		}
+	}
+}
+
+TOptional<FLoxValue> FLoxConstantFolder::FoldChild(TUniquePtr<FLoxExpression>& expression)
+{
+	if (expression.IsNull())
+	{
+		return nullopt;
+	}
+
+	TOptional<FLoxValue> value = expression->AcceptVisitor(*this);
+	TUniquePtr<FLoxExpression> replacement = MoveTemp(m_Replacement);
+
+	if (value.HasValue())
+	{
+		// Literals are already as simple as they can be
+		if (Cast<FLoxLiteralExpression>(expression.Get()) == nullptr)
+		{
+			expression = MakeLiteralExpression(value.GetValue(), m_SourceLocation);
+		}
+	}
+	else if (replacement.IsValid())
+	{
+		expression = MoveTemp(replacement);
+	}
+
+	return value;
+}
+
+TOptional<FLoxValue> FLoxConstantFolder::VisitBinaryExpression(FLoxBinaryExpression& expression)
+{
+	const TOptional<FLoxValue> left = FoldChild(expression.Left);
+	const TOptional<FLoxValue> right = FoldChild(expression.Right);
+	if (left.IsEmpty() || right.IsEmpty())
+	{
+		return nullopt;
+	}
+
+	m_SourceLocation = expression.Operator.SourceLocation;
+	return FoldBinaryOperator(expression.Operator.Type, left.GetValue(), right.GetValue());
+}
+
+TOptional<FLoxValue> FLoxConstantFolder::VisitGroupedExpression(FLoxGroupedExpression& expression)
+{
+	TOptional<FLoxValue> inner = FoldChild(expression.Inner);
+	if (inner.IsEmpty())
+	{
+		// The tree already encodes the grouping, so the parentheses themselves can go
+		m_Replacement = MoveTemp(expression.Inner);
+	}
+
+	return inner;
+}
+
+TOptional<FLoxValue> FLoxConstantFolder::VisitLiteralExpression(FLoxLiteralExpression& expression)
+{
+	m_SourceLocation = expression.Literal.SourceLocation;
+	return expression.Literal.Value;
+}
+
+TOptional<FLoxValue> FLoxConstantFolder::VisitTernaryExpression(FLoxTernaryExpression& expression)
+{
+	const TOptional<FLoxValue> condition = FoldChild(expression.Condition);
+	if (condition.IsEmpty())
+	{
+		(void)FoldChild(expression.TrueExpression);
+		(void)FoldChild(expression.FalseExpression);
+		return nullopt;
+	}
+
+	TUniquePtr<FLoxExpression>& branch = condition.GetValue().AsBool() ? expression.TrueExpression : expression.FalseExpression;
+	TOptional<FLoxValue> result = FoldChild(branch);
+	if (result.IsEmpty())
+	{
+		m_Replacement = MoveTemp(branch);
+	}
+
+	return result;
+}
+
+TOptional<FLoxValue> FLoxConstantFolder::VisitUnaryExpression(FLoxUnaryExpression& expression)
+{
+	const TOptional<FLoxValue> right = FoldChild(expression.Right);
+	if (right.IsEmpty())
+	{
+		return nullopt;
+	}
+
+	TErrorOr<FLoxValue> result;
+	switch (expression.Operator.Type)
+	{
+	case ELoxTokenType::Minus: result = FLoxValue::Negate(right.GetValue());     break;
+	case ELoxTokenType::Bang:  result = FLoxValue::LogicalNot(right.GetValue()); break;
+	default:                   return nullopt;
+	}
+
+	if (result.IsError())
+	{
+		return nullopt;
+	}
+
+	m_SourceLocation = expression.Operator.SourceLocation;
+	return result.ReleaseValue();
+}
\ No newline at end of file
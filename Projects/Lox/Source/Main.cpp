@@ -4,8 +4,11 @@
 #include "HAL/File.h"
 #include "HAL/Path.h"
 #include "HAL/Timer.h"
+#include "Lox/Compiler.h"
+#include "Lox/ConstantFolder.h"
 #include "Lox/Scanner.h"
 #include "Lox/Parser.h"
+#include "Lox/VirtualMachine.h"
 #include "Main/Main.h"
 #include "Templates/VariadicTraits.h"
 #include <cstdio>
@@ -42,7 +45,7 @@ private:
 	{
 		FStringBuilder builder;
 		builder.Append("("_sv).Append(name);
-		TVariadicForEach<ExpressionTypes...>::Visit([&, this](auto expression)
+		TVariadicForEach<ExpressionTypes...>::Visit([&, this](auto& expression)
 		{
 			builder.Append(" "_sv);
 
@@ -359,20 +362,37 @@ static void RunLoxCode(const FString& code)
 		return;
 	}
 
-	for (const TUniquePtr<FLoxStatement>& statement : parser.GetStatements())
+	timer.Restart();
+		FLoxConstantFolder constantFolder;
+		constantFolder.Fold(parser.GetStatements());
+	const FTimeSpan foldDuration = timer.Stop();
+
+	for (TUniquePtr<FLoxStatement>& statement : parser.GetStatements())
 	{
-		if (const FLoxExpressionStatement* expressionStatement = Cast<FLoxExpressionStatement>(statement.Get()))
+		if (FLoxExpressionStatement* expressionStatement = Cast<FLoxExpressionStatement>(statement.Get()))
 		{
 #if 0
 			FLoxAstPrinter printer;
-			FString expressionAst = printer.PrintToString(const_cast<FLoxExpression&>(*expressionStatement->Expression));
+			FString expressionAst = printer.PrintToString(*expressionStatement->Expression);
 			UM_LOG(Info, "{}", expressionAst);
 #endif
 #if 1
 			timer.Restart();
 
-			FLoxExpressionEvaluator evaluator;
-			TLoxErrorOr<FLoxValue> result = evaluator.Evaluate(const_cast<FLoxExpression&>(*expressionStatement->Expression));
+			FLoxCompiler compiler;
+			TLoxErrorOr<FLoxChunk> chunk = compiler.Compile(*expressionStatement->Expression);
+			if (chunk.IsError())
+			{
+				FScopedConsoleForegroundColor redForeground { EConsoleColor::Red };
+				FConsole::WriteLine("{}"_sv, chunk.GetError());
+				continue;
+			}
+
+			const FTimeSpan compileDuration = timer.Stop();
+			timer.Restart();
+
+			FLoxVirtualMachine virtualMachine;
+			TLoxErrorOr<FLoxValue> result = virtualMachine.Run(chunk.GetValue());
 			if (result.IsError())
 			{
 				FScopedConsoleForegroundColor redForeground { EConsoleColor::Red };
@@ -383,14 +403,167 @@ static void RunLoxCode(const FString& code)
 				FConsole::WriteLine("{}"_sv, result.GetValue().AsString());
 			}
 
-			const FTimeSpan evalDuration = timer.Stop();
-			FConsole::WriteLine("Evaluation took {} microseconds"_sv, evalDuration.GetTotalMilliseconds() * 1000.0);
+			const FTimeSpan runDuration = timer.Stop();
+			FConsole::WriteLine("Compilation took {} microseconds"_sv, compileDuration.GetTotalMilliseconds() * 1000.0);
+			FConsole::WriteLine("Evaluation took {} microseconds"_sv, runDuration.GetTotalMilliseconds() * 1000.0);
 #endif
 		}
 	}
 
 	FConsole::WriteLine("Tokenization took {} microseconds"_sv, scanDuration.GetTotalMilliseconds() * 1000.0);
 	FConsole::WriteLine("Parsing took {} microseconds"_sv, parseDuration.GetTotalMilliseconds() * 1000.0);
+	FConsole::WriteLine("Constant folding took {} microseconds"_sv, foldDuration.GetTotalMilliseconds() * 1000.0);
+}
+
+/**
+ * @brief Defines a script used to compare the tree-walking evaluator with the virtual machine.
+ */
+struct FLoxBenchmark
+{
+	/** @brief The name of the benchmark. */
+	FStringView Name;
+
+	/** @brief The benchmark's code. */
+	FStringView Code;
+};
+
+static const FLoxBenchmark GBenchmarks[] =
+{
+	{ "integer arithmetic"_sv, "1 + 2 * 3 - 4 / 2 + (5 * 6 - 7) * 8 - 9 / 3 + 10 * (11 - 12) + 13 * 14 - 15 * (16 + 17) / 18"_sv },
+	{ "float arithmetic"_sv,   "1.5 * 2.25 + 3.75 / 1.25 - (4.5 - 0.5) * 2.0 + 6.125 * (7.5 - 2.5) / 3.0 - 8.25 * 0.5"_sv },
+	{ "mixed arithmetic"_sv,   "1 * 2.5 + 3 / 1.5 - 4 * (0.25 + 6) - -7 * 8.75 / (9 - 0.5) + 10 * 11 - 12.5"_sv },
+	{ "comparisons"_sv,        "(1 < 2) == (3 >= 3) ? (4 > 5) != (6 <= 7) : (8 == 9) == (10 != 11)"_sv },
+	{ "nested ternaries"_sv,   "1 > 2 ? 1 : 2 > 3 ? 2 : 3 > 4 ? 3 : 4 > 5 ? 4 : 5 > 6 ? 5 : 6 > 7 ? 6 : 7 > 8 ? 7 : 8"_sv },
+	{ "unary operators"_sv,    "-(-(-(1 + 2))) * -(-3) + -(4 - -5) * -(-(-6)) - -(-(-(-7)))"_sv },
+	{ "string building"_sv,    "\"x = \" + 1 + \", y = \" + 2.5 + \", z = \" + true + \", w = \" + null"_sv }
+};
+
+static constexpr int32 GBenchmarkIterations = 100000;
+
+/**
+ * @brief Runs a benchmark with both the tree-walking evaluator and the virtual machine.
+ *
+ * @param benchmark The benchmark.
+ */
+static void RunBenchmark(const FLoxBenchmark& benchmark)
+{
+	FLoxScanner scanner;
+	scanner.ScanTextForTokens(benchmark.Code);
+
+	FLoxParser parser;
+	parser.ParseTokens(scanner.GetTokens());
+
+	FLoxExpressionStatement* expressionStatement = nullptr;
+	if (scanner.HasErrors() == false && parser.HasErrors() == false && parser.GetStatements().Num() == 1)
+	{
+		expressionStatement = Cast<FLoxExpressionStatement>(parser.GetStatements()[0].Get());
+	}
+
+	if (expressionStatement == nullptr)
+	{
+		FScopedConsoleForegroundColor redForeground { EConsoleColor::Red };
+		FConsole::WriteLine("{}: failed to parse benchmark code"_sv, benchmark.Name);
+		return;
+	}
+
+	FLoxExpression& expression = *expressionStatement->Expression;
+	FTimer timer;
+
+	timer.Restart();
+	FLoxExpressionEvaluator evaluator;
+	TLoxErrorOr<FLoxValue> treeWalkResult;
+	for (int32 iteration = 0; iteration < GBenchmarkIterations; ++iteration)
+	{
+		treeWalkResult = evaluator.Evaluate(expression);
+	}
+	const FTimeSpan treeWalkDuration = timer.Stop();
+
+	timer.Restart();
+	FLoxCompiler compiler;
+	TLoxErrorOr<FLoxChunk> chunk = compiler.Compile(expression);
+	const FTimeSpan compileDuration = timer.Stop();
+
+	if (chunk.IsError())
+	{
+		FScopedConsoleForegroundColor redForeground { EConsoleColor::Red };
+		FConsole::WriteLine("{}: {}"_sv, benchmark.Name, chunk.GetError());
+		return;
+	}
+
+	timer.Restart();
+	FLoxVirtualMachine virtualMachine;
+	TLoxErrorOr<FLoxValue> virtualMachineResult;
+	for (int32 iteration = 0; iteration < GBenchmarkIterations; ++iteration)
+	{
+		virtualMachineResult = virtualMachine.Run(chunk.GetValue());
+	}
+	const FTimeSpan virtualMachineDuration = timer.Stop();
+
+	// Fold last so that the tree walker and the unfolded chunk still see the original expression
+	timer.Restart();
+	FLoxConstantFolder constantFolder;
+	constantFolder.Fold(expressionStatement->Expression);
+	TLoxErrorOr<FLoxChunk> foldedChunk = compiler.Compile(*expressionStatement->Expression);
+	const FTimeSpan foldedCompileDuration = timer.Stop();
+
+	if (foldedChunk.IsError())
+	{
+		FScopedConsoleForegroundColor redForeground { EConsoleColor::Red };
+		FConsole::WriteLine("{}: {}"_sv, benchmark.Name, foldedChunk.GetError());
+		return;
+	}
+
+	timer.Restart();
+	TLoxErrorOr<FLoxValue> foldedResult;
+	for (int32 iteration = 0; iteration < GBenchmarkIterations; ++iteration)
+	{
+		foldedResult = virtualMachine.Run(foldedChunk.GetValue());
+	}
+	const FTimeSpan foldedDuration = timer.Stop();
+
+	const FString treeWalkText = treeWalkResult.IsError() ? FString::Format("{}"_sv, treeWalkResult.GetError()) : treeWalkResult.GetValue().AsString();
+	const FString virtualMachineText = virtualMachineResult.IsError() ? FString::Format("{}"_sv, virtualMachineResult.GetError()) : virtualMachineResult.GetValue().AsString();
+	if (treeWalkText != virtualMachineText)
+	{
+		FScopedConsoleForegroundColor redForeground { EConsoleColor::Red };
+		FConsole::WriteLine("{}: tree walker returned \"{}\" but the virtual machine returned \"{}\""_sv, benchmark.Name, treeWalkText, virtualMachineText);
+		return;
+	}
+
+	const FString foldedText = foldedResult.IsError() ? FString::Format("{}"_sv, foldedResult.GetError()) : foldedResult.GetValue().AsString();
+	if (foldedText != virtualMachineText)
+	{
+		FScopedConsoleForegroundColor redForeground { EConsoleColor::Red };
+		FConsole::WriteLine("{}: folding changed the result from \"{}\" to \"{}\""_sv, benchmark.Name, virtualMachineText, foldedText);
+		return;
+	}
+
+	const double treeWalkMilliseconds = treeWalkDuration.GetTotalMilliseconds();
+	const double virtualMachineMilliseconds = virtualMachineDuration.GetTotalMilliseconds();
+	FConsole::WriteLine("{} = {}"_sv, benchmark.Name, virtualMachineText);
+	FConsole::WriteLine("    tree walker:     {} ms"_sv, treeWalkMilliseconds);
+	FConsole::WriteLine("    virtual machine: {} ms (compiled in {} microseconds, {}x faster)"_sv,
+		virtualMachineMilliseconds,
+		compileDuration.GetTotalMilliseconds() * 1000.0,
+		virtualMachineMilliseconds > 0.0 ? treeWalkMilliseconds / virtualMachineMilliseconds : 0.0);
+	FConsole::WriteLine("    folded:          {} ms (folded and compiled in {} microseconds, {} instructions instead of {})"_sv,
+		foldedDuration.GetTotalMilliseconds(),
+		foldedCompileDuration.GetTotalMilliseconds() * 1000.0,
+		foldedChunk.GetValue().NumInstructions(),
+		chunk.GetValue().NumInstructions());
+}
+
+/**
+ * @brief Runs every benchmark.
+ */
+static void RunBenchmarks()
+{
+	FConsole::WriteLine("Running each benchmark {} times"_sv, GBenchmarkIterations);
+
+	for (const FLoxBenchmark& benchmark : GBenchmarks)
+	{
+		RunBenchmark(benchmark);
+	}
 }
 
 /**
@@ -400,7 +573,7 @@ static void RunLoxCode(const FString& code)
  */
 static void RunFile(const FStringView filePath)
 {
-	const TErrorOr<FString> fileContent = FFile::ReadAllText(filePath);
+	const TErrorOr<FString> fileContent = FFile::ReadText(filePath);
 	if (fileContent.IsError())
 	{
 		FScopedConsoleForegroundColor redForeground { EConsoleColor::Red };
@@ -440,7 +613,14 @@ int32 UmbralMain()
 		break;
 
 	case 2:
-		RunFile(FCommandLine::GetArgument(1));
+		if (FCommandLine::GetArgument(1) == "--benchmark"_sv)
+		{
+			RunBenchmarks();
+		}
+		else
+		{
+			RunFile(FCommandLine::GetArgument(1));
+		}
 		break;
 
 	default:
@@ -448,8 +628,8 @@ int32 UmbralMain()
 		FScopedConsoleForegroundColor redForeground { EConsoleColor::Red };
 
 		const FStringView exePath = FCommandLine::GetArgument(0);
-		const FStringView exeName = FPath::GetBaseFileName(exePath);
-		FConsole::WriteLine("Usage: {} [script]"_sv, exeName);
+		const FStringView exeName = FPath::GetBaseFileNameAsView(exePath);
+		FConsole::WriteLine("Usage: {} [script | --benchmark]"_sv, exeName);
 		break;
 	}
 	}
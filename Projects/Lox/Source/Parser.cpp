@@ -84,7 +84,7 @@ TUniquePtr<FLoxExpression> FLoxParser::ParseExpression()
 
 TUniquePtr<FLoxExpression> FLoxParser::ParseTernaryExpression()
 {
-	TUniquePtr<FLoxExpression> expr = ParseComparisonExpression();
+	TUniquePtr<FLoxExpression> expr = ParseEqualityExpression();
 	if (expr.IsNull())
 	{
 		return nullptr;
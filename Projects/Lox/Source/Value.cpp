@@ -1,7 +1,115 @@
+#include "Containers/HashMap.h"
+#include "Engine/Assert.h"
 #include "Lox/Value.h"
 #include "Math/Math.h"
+#include "Memory/Memory.h"
 #include "Misc/StringBuilder.h"
 
+/**
+ * @brief Defines an immutable, interned Lox string. The characters are stored directly after the object.
+ */
+struct FLoxStringObject : FLoxObject
+{
+	/** @brief The number of characters in the string. */
+	int32 Length = 0;
+
+	/**
+	 * @brief Gets the string's characters.
+	 *
+	 * @return The string's characters.
+	 */
+	[[nodiscard]] FStringView GetChars() const
+	{
+		return FStringView { reinterpret_cast<const char*>(this + 1), Length };
+	}
+};
+
+/**
+ * @brief Defines a boxed integer that is too large to be stored inline in a Lox value.
+ */
+struct FLoxBoxedIntObject : FLoxObject
+{
+	/** @brief The integer value. */
+	int64 Value = 0;
+};
+
+/**
+ * @brief Defines the table of interned Lox strings.
+ *
+ * Each string has exactly one object, so strings with the same characters can be compared by pointer. Objects are removed
+ * from the table when the last value referencing them is destroyed.
+ */
+class FLoxStringTable final
+{
+	UM_DISABLE_COPY(FLoxStringTable);
+	UM_DISABLE_MOVE(FLoxStringTable);
+
+public:
+
+	/**
+	 * @brief Gets the string table.
+	 *
+	 * @return The string table.
+	 */
+	[[nodiscard]] static FLoxStringTable& Get()
+	{
+		static FLoxStringTable GStringTable;
+		return GStringTable;
+	}
+
+	/**
+	 * @brief Finds the object for a string, creating one if there is not one yet.
+	 *
+	 * @param string The string.
+	 * @return The string's object, with a reference added for the caller.
+	 */
+	[[nodiscard]] FLoxStringObject* FindOrAdd(const FStringView string)
+	{
+		if (FLoxStringObject** existingObject = m_Strings.Find(string))
+		{
+			++(*existingObject)->RefCount;
+			return *existingObject;
+		}
+
+		void* memory = FMemory::Allocate(static_cast<FMemory::SizeType>(sizeof(FLoxStringObject)) + string.Length());
+		FLoxStringObject* object = new (memory) FLoxStringObject {};
+		object->Type = ELoxObjectType::String;
+		object->Length = string.Length();
+		FMemory::Copy(object + 1, string.GetChars(), string.Length());
+
+		(void)m_Strings.Add(object->GetChars(), object);
+		return object;
+	}
+
+	/**
+	 * @brief Removes a string's object from the table and frees it.
+	 *
+	 * @param object The string's object.
+	 */
+	void Remove(FLoxStringObject* object)
+	{
+		(void)m_Strings.Remove(object->GetChars());
+		FMemory::Free(object);
+	}
+
+private:
+
+	FLoxStringTable() = default;
+
+	THashMap<FStringView, FLoxStringObject*> m_Strings;
+};
+
+/**
+ * @brief Gets the string object a value points to. Only valid if the value is a string.
+ *
+ * @param object The value's object.
+ * @return The string object.
+ */
+static const FLoxStringObject* AsStringObject(const FLoxObject* object)
+{
+	return static_cast<const FLoxStringObject*>(object);
+}
+
 /**
  * @brief Compares two floating-point values.
  *
@@ -21,12 +129,17 @@ static constexpr ECompareResult CompareFloatValues(const double first, const dou
 
 TErrorOr<FLoxValue> FLoxValue::Add(const FLoxValue& first, const FLoxValue& second)
 {
+	if (first.IsSmallInt() && second.IsSmallInt())
+	{
+		return FLoxValue::FromInt(first.GetSmallInt() + second.GetSmallInt());
+	}
+
 	const auto AddValuesAsString = [&]()
 	{
 		FStringBuilder result;
 		first.AppendValueToStringBuilder(result);
 		second.AppendValueToStringBuilder(result);
-		return FLoxValue::FromString(result.ReleaseString());
+		return FLoxValue::FromString(result.AsStringView());
 	};
 
 	if (first.IsNull() || first.IsBool())
@@ -53,13 +166,9 @@ TErrorOr<FLoxValue> FLoxValue::Add(const FLoxValue& first, const FLoxValue& seco
 	}
 	else if (first.IsFloat())
 	{
-		if (second.IsInt())
-		{
-			return FLoxValue::FromInt(first.AsInt() + second.AsInt());
-		}
-		if (second.IsFloat())
+		if (second.IsNumber())
 		{
-			return FLoxValue::FromFloat(first.AsFloat() + second.AsFloat());
+			return FLoxValue::FromFloat(first.GetFloat() + second.AsFloat());
 		}
 		if (second.IsString())
 		{
@@ -76,65 +185,72 @@ TErrorOr<FLoxValue> FLoxValue::Add(const FLoxValue& first, const FLoxValue& seco
 
 bool FLoxValue::AsBool() const
 {
-	return m_Value.Visit<bool>(FVariantVisitor
-	{
-		[](const FEmptyType) { return false; },
-		[](const bool value) { return value; },
-		[](const int64 value) { return value != 0; },
-		[](const double value) { return FMath::IsNearlyZero(value) == false; },
-		[](const FString& value) { return value.Length() > 0; }
-	});
+	switch (GetType())
+	{
+	case ELoxValueType::Boolean: return m_Bits == TrueBits;
+	case ELoxValueType::Float:   return FMath::IsNearlyZero(GetFloat()) == false;
+	case ELoxValueType::Integer: return AsInt() != 0;
+	case ELoxValueType::String:  return AsStringObject(GetObject())->Length > 0;
+	default:                     return false;
+	}
 }
 
 double FLoxValue::AsFloat() const
 {
-	return m_Value.Visit<double>(FVariantVisitor
-	{
-		[](const FEmptyType) { return 0.0; },
-		[](const bool value) { return value ? 1.0 : 0.0; },
-		[](const int64 value) { return static_cast<double>(value); },
-		[](const double value) { return value; },
-		[](const FString&) { return 0.0; }
-	});
+	switch (GetType())
+	{
+	case ELoxValueType::Boolean: return m_Bits == TrueBits ? 1.0 : 0.0;
+	case ELoxValueType::Float:   return GetFloat();
+	case ELoxValueType::Integer: return static_cast<double>(AsInt());
+	default:                     return 0.0;
+	}
 }
 
 int64 FLoxValue::AsInt() const
 {
-	return m_Value.Visit<int64>(FVariantVisitor
-	{
-		[](const FEmptyType) -> int64 { return 0; },
-		[](const bool value) -> int64 { return value ? 1 : 0; },
-		[](const int64 value) -> int64 { return value; },
-		[](const double value) -> int64 { return static_cast<int64>(value); },
-		[](const FString&) -> int64 { return 0; }
-	});
+	if (IsSmallInt())
+	{
+		return GetSmallInt();
+	}
+
+	switch (GetType())
+	{
+	case ELoxValueType::Boolean: return m_Bits == TrueBits ? 1 : 0;
+	case ELoxValueType::Float:   return static_cast<int64>(GetFloat());
+	case ELoxValueType::Integer: return static_cast<const FLoxBoxedIntObject*>(GetObject())->Value;
+	default:                     return 0;
+	}
 }
 
 FString FLoxValue::AsString() const
 {
-	FStringBuilder result;
-
-	m_Value.Visit(FVariantVisitor
+	if (IsString())
 	{
-		[&](const FEmptyType) { result.Append("null"_sv); },
-		[&](const bool value) { result.Append(value ? "true"_sv : "false"_sv); },
-		[&](const auto& value) { result.Append(value); }
-	});
+		return FString { AsStringView() };
+	}
 
+	FStringBuilder result;
+	AppendValueToStringBuilder(result);
 	return result.ReleaseString();
 }
 
 FStringView FLoxValue::AsStringView() const
 {
-	return m_Value.Visit<FStringView>(FVariantVisitor
+	if (IsString())
 	{
-		[&](const FString& value) { return value.AsStringView(); },
-		[&](const auto&) -> FStringView { return {}; }
-	});
+		return AsStringObject(GetObject())->GetChars();
+	}
+
+	return {};
 }
 
 TErrorOr<ECompareResult> FLoxValue::Compare(const FLoxValue& first, const FLoxValue& second)
 {
+	if (first.IsSmallInt() && second.IsSmallInt())
+	{
+		return TComparisonTraits<int64>::Compare(first.GetSmallInt(), second.GetSmallInt());
+	}
+
 	if (first.IsBool())
 	{
 		if (second.IsBool())
@@ -172,6 +288,12 @@ TErrorOr<ECompareResult> FLoxValue::Compare(const FLoxValue& first, const FLoxVa
 	{
 		if (second.IsString())
 		{
+			// Strings are interned, so equal strings are always the same object
+			if (first.m_Bits == second.m_Bits)
+			{
+				return ECompareResult::Equals;
+			}
+
 			const FStringView firstValue = first.AsStringView();
 			const FStringView secondValue = second.AsStringView();
 			return firstValue.Compare(secondValue);
@@ -223,51 +345,26 @@ TErrorOr<FLoxValue> FLoxValue::Divide(const FLoxValue& first, const FLoxValue& s
 	return MAKE_ERROR("Cannot divide \"{}\" by \"{}\"", first.GetTypeName(), second.GetTypeName());
 }
 
-FLoxValue FLoxValue::FromBool(bool value)
-{
-	FLoxValue result;
-	result.m_Value.ResetToType<bool>(value);
-	return result;
-}
-
-FLoxValue FLoxValue::FromFloat(const double value)
-{
-	FLoxValue result;
-	result.m_Value.ResetToType<double>(value);
-	return result;
-}
-
-FLoxValue FLoxValue::FromInt(const int64 value)
-{
-	FLoxValue result;
-	result.m_Value.ResetToType<int64>(value);
-	return result;
-}
-
 FLoxValue FLoxValue::FromString(const FStringView value)
 {
-	FLoxValue result;
-	result.m_Value.ResetToType<FString>(value);
-	return result;
+	return FromObject(FLoxStringTable::Get().FindOrAdd(value));
 }
 
 FLoxValue FLoxValue::FromString(FString&& value)
 {
-	FLoxValue result;
-	result.m_Value.ResetToType<FString>(MoveTemp(value));
-	return result;
+	return FromString(value.AsStringView());
 }
 
 ELoxValueType FLoxValue::GetType() const
 {
-	return m_Value.Visit<ELoxValueType>(FVariantVisitor
-	{
-		[](const FEmptyType) { return ELoxValueType::Null; },
-		[](const bool) { return ELoxValueType::Boolean; },
-		[](const int64) { return ELoxValueType::Integer; },
-		[](const double) { return ELoxValueType::Float; },
-		[](const FString&) { return ELoxValueType::String; }
-	});
+	switch (m_Bits & TagMask)
+	{
+	case NullTag:     return ELoxValueType::Null;
+	case BoolTag:     return ELoxValueType::Boolean;
+	case SmallIntTag: return ELoxValueType::Integer;
+	case ObjectTag:   return GetObject()->Type == ELoxObjectType::String ? ELoxValueType::String : ELoxValueType::Integer;
+	default:          return ELoxValueType::Float;
+	}
 }
 
 FStringView FLoxValue::GetTypeName() const
@@ -351,6 +448,11 @@ TErrorOr<FLoxValue> FLoxValue::Negate(const FLoxValue& value)
 
 TErrorOr<FLoxValue> FLoxValue::Subtract(const FLoxValue& first, const FLoxValue& second)
 {
+	if (first.IsSmallInt() && second.IsSmallInt())
+	{
+		return FLoxValue::FromInt(first.GetSmallInt() - second.GetSmallInt());
+	}
+
 	if (first.IsInt())
 	{
 		if (second.IsInt())
@@ -373,17 +475,45 @@ TErrorOr<FLoxValue> FLoxValue::Subtract(const FLoxValue& first, const FLoxValue&
 	return MAKE_ERROR("Cannot subtract \"{}\" from \"{}\"", first.GetTypeName(), second.GetTypeName());
 }
 
+FLoxValue FLoxValue::FromBoxedInt(const int64 value)
+{
+	FLoxBoxedIntObject* object = FMemory::AllocateObject<FLoxBoxedIntObject>();
+	object->Type = ELoxObjectType::BoxedInteger;
+	object->Value = value;
+	return FromObject(object);
+}
+
+void FLoxValue::FreeObject(FLoxObject* object)
+{
+	switch (object->Type)
+	{
+	case ELoxObjectType::String:
+		FLoxStringTable::Get().Remove(static_cast<FLoxStringObject*>(object));
+		break;
+
+	case ELoxObjectType::BoxedInteger:
+		FMemory::FreeObject(static_cast<FLoxBoxedIntObject*>(object));
+		break;
+
+	default:
+		UM_ASSERT_NOT_REACHED_MSG("Unknown Lox object type");
+	}
+}
+
 void FLoxValue::AppendValueToStringBuilder(FStringBuilder& builder) const
 {
-	m_Value.Visit(FVariantVisitor
+	switch (GetType())
 	{
-		[&](const FEmptyType) { builder.Append("null"_sv); },
-		[&](const bool value) { builder.Append(value ? "true"_sv : "false"_sv); },
-		[&](const auto& value) { builder.Append(value); }
-	});
+	case ELoxValueType::Null:    builder.Append("null"_sv); break;
+	case ELoxValueType::Boolean: builder.Append(m_Bits == TrueBits ? "true"_sv : "false"_sv); break;
+	case ELoxValueType::Float:   builder.Append(GetFloat()); break;
+	case ELoxValueType::Integer: builder.Append(AsInt()); break;
+	case ELoxValueType::String:  builder.Append(AsStringView()); break;
+	default:                     break;
+	}
 }
 
-void TFormatter<FLoxValue>::BuildString(const FLoxValue& value, FStringBuilder& builder)
+void TFormatter<FLoxValue>::BuildString(const FLoxValue& value, FStringBuilder& builder) const
 {
 	builder.Append(value.GetTypeName());
 	builder.Append(":"_sv);
@@ -391,7 +521,7 @@ void TFormatter<FLoxValue>::BuildString(const FLoxValue& value, FStringBuilder&
 	if (value.IsString())
 	{
 		builder.Append('"', 1);
-		builder.Append(value.AsString());
+		builder.Append(value.AsStringView());
 		builder.Append('"', 1);
 	}
 	else
@@ -400,7 +530,7 @@ void TFormatter<FLoxValue>::BuildString(const FLoxValue& value, FStringBuilder&
 	}
 }
 
-bool TFormatter<FLoxValue>::Parse(const FStringView formatString) const
+bool TFormatter<FLoxValue>::Parse(const FStringView formatString)
 {
 	return formatString.IsEmpty();
 }
\ No newline at end of file
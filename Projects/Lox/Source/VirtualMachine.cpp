@@ -0,0 +1,258 @@
+#include "Engine/Platform.h"
+#include "Lox/VirtualMachine.h"
+
+// GCC and Clang can jump straight from one instruction's handler to the next through a table of label addresses,
+// which gives the branch predictor one indirect jump per handler instead of a single shared one
+#if UMBRAL_COMPILER != UMBRAL_COMPILER_MSVC
+#	define LOX_VM_USE_COMPUTED_GOTO 1
+	// Label addresses and computed gotos are compiler extensions
+	PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_CLANG("-Wpedantic")
+	PRAGMA_WARNING_DISABLE_GCC("-Wpedantic")
+#else
+#	define LOX_VM_USE_COMPUTED_GOTO 0
+#endif
+
+/**
+ * @brief Makes a runtime error for the instruction that is currently running.
+ *
+ * @param chunk The chunk being run.
+ * @param instructionPointer The instruction pointer, which has already been advanced past the current instruction.
+ * @param error The error returned by the value operation.
+ * @return The runtime error.
+ */
+static FLoxError MakeRuntimeError(const FLoxChunk& chunk, const uint32* instructionPointer, const FError& error)
+{
+	const int32 instructionIndex = static_cast<int32>(instructionPointer - chunk.GetCode().GetData()) - 1;
+	return FLoxError { chunk.GetSourceLocation(instructionIndex), error.GetMessage() };
+}
+
+TLoxErrorOr<FLoxValue> FLoxVirtualMachine::Run(const FLoxChunk& chunk)
+{
+	if (chunk.NumInstructions() == 0)
+	{
+		return FLoxValue {};
+	}
+
+	if (m_Registers.Num() < chunk.GetNumRegisters())
+	{
+		m_Registers.AddDefault(chunk.GetNumRegisters() - m_Registers.Num());
+	}
+
+	const FLoxValue* const constants = chunk.GetConstants().GetData();
+	const uint32* const code = chunk.GetCode().GetData();
+	FLoxValue* const registers = m_Registers.GetData();
+
+	const uint32* instructionPointer = code;
+	uint32 instruction = 0;
+
+#define LOX_VM_REGISTER_A registers[FLoxInstruction::GetA(instruction)]
+#define LOX_VM_REGISTER_B registers[FLoxInstruction::GetB(instruction)]
+#define LOX_VM_REGISTER_C registers[FLoxInstruction::GetC(instruction)]
+
+#if LOX_VM_USE_COMPUTED_GOTO
+	// Must be in the same order as ELoxOpCode
+	static const void* const dispatchTable[] =
+	{
+		&&Op_LoadConstant,
+		&&Op_LoadNull,
+		&&Op_LoadBool,
+		&&Op_Add,
+		&&Op_Subtract,
+		&&Op_Multiply,
+		&&Op_Divide,
+		&&Op_Equal,
+		&&Op_NotEqual,
+		&&Op_Greater,
+		&&Op_GreaterEqual,
+		&&Op_Less,
+		&&Op_LessEqual,
+		&&Op_Negate,
+		&&Op_Not,
+		&&Op_Jump,
+		&&Op_JumpIfFalse,
+		&&Op_Return
+	};
+	static_assert(UM_ARRAY_SIZE(dispatchTable) == GLoxOpCodeCount);
+
+#	define LOX_VM_CASE(OpCode)  Op_##OpCode:
+#	define LOX_VM_DISPATCH()    instruction = *instructionPointer++; goto *dispatchTable[instruction & 0xFF]
+
+	LOX_VM_DISPATCH();
+#else
+#	define LOX_VM_CASE(OpCode)  case ELoxOpCode::OpCode:
+#	define LOX_VM_DISPATCH()    continue
+
+	while (true)
+	{
+	instruction = *instructionPointer++;
+	switch (FLoxInstruction::GetOpCode(instruction))
+	{
+#endif
+
+	// Inline integer and float operands are handled in place. Everything else, including errors, goes through FLoxValue.
+	// Inline integers are only 48 bits, so integer arithmetic is done unsigned to wrap instead of overflowing
+#define LOX_VM_ARITHMETIC(OpCode, Operator, SlowFunction)                                                              \
+	LOX_VM_CASE(OpCode)                                                                                                \
+	{                                                                                                                  \
+		const FLoxValue& left = LOX_VM_REGISTER_B;                                                                     \
+		const FLoxValue& right = LOX_VM_REGISTER_C;                                                                    \
+		if (left.IsSmallInt() && right.IsSmallInt())                                                                   \
+		{                                                                                                              \
+			const uint64 leftValue = static_cast<uint64>(left.GetSmallInt());                                          \
+			const uint64 rightValue = static_cast<uint64>(right.GetSmallInt());                                        \
+			LOX_VM_REGISTER_A = FLoxValue::FromInt(static_cast<int64>(leftValue Operator rightValue));                 \
+		}                                                                                                              \
+		else if (left.IsFloat() && right.IsFloat())                                                                    \
+		{                                                                                                              \
+			LOX_VM_REGISTER_A = FLoxValue::FromFloat(left.GetFloat() Operator right.GetFloat());                       \
+		}                                                                                                              \
+		else                                                                                                           \
+		{                                                                                                              \
+			TErrorOr<FLoxValue> result = FLoxValue::SlowFunction(left, right);                                         \
+			if (result.IsError())                                                                                      \
+			{                                                                                                          \
+				return MakeRuntimeError(chunk, instructionPointer, result.GetError());                                 \
+			}                                                                                                          \
+			LOX_VM_REGISTER_A = result.ReleaseValue();                                                                 \
+		}                                                                                                              \
+		LOX_VM_DISPATCH();                                                                                             \
+	}
+
+#define LOX_VM_COMPARISON(OpCode, IntOperator, Condition)                                                              \
+	LOX_VM_CASE(OpCode)                                                                                                \
+	{                                                                                                                  \
+		const FLoxValue& left = LOX_VM_REGISTER_B;                                                                     \
+		const FLoxValue& right = LOX_VM_REGISTER_C;                                                                    \
+		if (left.IsSmallInt() && right.IsSmallInt())                                                                   \
+		{                                                                                                              \
+			LOX_VM_REGISTER_A = FLoxValue::FromBool(left.GetSmallInt() IntOperator right.GetSmallInt());               \
+		}                                                                                                              \
+		else                                                                                                           \
+		{                                                                                                              \
+			const TErrorOr<ECompareResult> result = FLoxValue::Compare(left, right);                                   \
+			if (result.IsError())                                                                                      \
+			{                                                                                                          \
+				return MakeRuntimeError(chunk, instructionPointer, result.GetError());                                 \
+			}                                                                                                          \
+			LOX_VM_REGISTER_A = FLoxValue::FromBool(result.GetValue() Condition);                                      \
+		}                                                                                                              \
+		LOX_VM_DISPATCH();                                                                                             \
+	}
+
+	LOX_VM_CASE(LoadConstant)
+	{
+		LOX_VM_REGISTER_A = constants[FLoxInstruction::GetBx(instruction)];
+		LOX_VM_DISPATCH();
+	}
+
+	LOX_VM_CASE(LoadNull)
+	{
+		LOX_VM_REGISTER_A = FLoxValue {};
+		LOX_VM_DISPATCH();
+	}
+
+	LOX_VM_CASE(LoadBool)
+	{
+		LOX_VM_REGISTER_A = FLoxValue::FromBool(FLoxInstruction::GetB(instruction) != 0);
+		LOX_VM_DISPATCH();
+	}
+
+	LOX_VM_ARITHMETIC(Add, +, Add)
+	LOX_VM_ARITHMETIC(Subtract, -, Subtract)
+	LOX_VM_ARITHMETIC(Multiply, *, Multiply)
+
+	LOX_VM_CASE(Divide)
+	{
+		const FLoxValue& left = LOX_VM_REGISTER_B;
+		const FLoxValue& right = LOX_VM_REGISTER_C;
+		if (left.IsSmallInt() && right.IsSmallInt() && right.GetSmallInt() != 0)
+		{
+			LOX_VM_REGISTER_A = FLoxValue::FromInt(left.GetSmallInt() / right.GetSmallInt());
+		}
+		else
+		{
+			TErrorOr<FLoxValue> result = FLoxValue::Divide(left, right);
+			if (result.IsError())
+			{
+				return MakeRuntimeError(chunk, instructionPointer, result.GetError());
+			}
+			LOX_VM_REGISTER_A = result.ReleaseValue();
+		}
+		LOX_VM_DISPATCH();
+	}
+
+	LOX_VM_COMPARISON(Equal,        ==, == ECompareResult::Equals)
+	LOX_VM_COMPARISON(NotEqual,     !=, != ECompareResult::Equals)
+	LOX_VM_COMPARISON(Greater,      >,  == ECompareResult::GreaterThan)
+	LOX_VM_COMPARISON(GreaterEqual, >=, != ECompareResult::LessThan)
+	LOX_VM_COMPARISON(Less,         <,  == ECompareResult::LessThan)
+	LOX_VM_COMPARISON(LessEqual,    <=, != ECompareResult::GreaterThan)
+
+	LOX_VM_CASE(Negate)
+	{
+		const FLoxValue& value = LOX_VM_REGISTER_B;
+		if (value.IsSmallInt())
+		{
+			LOX_VM_REGISTER_A = FLoxValue::FromInt(-value.GetSmallInt());
+		}
+		else
+		{
+			TErrorOr<FLoxValue> result = FLoxValue::Negate(value);
+			if (result.IsError())
+			{
+				return MakeRuntimeError(chunk, instructionPointer, result.GetError());
+			}
+			LOX_VM_REGISTER_A = result.ReleaseValue();
+		}
+		LOX_VM_DISPATCH();
+	}
+
+	LOX_VM_CASE(Not)
+	{
+		TErrorOr<FLoxValue> result = FLoxValue::LogicalNot(LOX_VM_REGISTER_B);
+		if (result.IsError())
+		{
+			return MakeRuntimeError(chunk, instructionPointer, result.GetError());
+		}
+		LOX_VM_REGISTER_A = result.ReleaseValue();
+		LOX_VM_DISPATCH();
+	}
+
+	LOX_VM_CASE(Jump)
+	{
+		instructionPointer = code + FLoxInstruction::GetBx(instruction);
+		LOX_VM_DISPATCH();
+	}
+
+	LOX_VM_CASE(JumpIfFalse)
+	{
+		if (LOX_VM_REGISTER_A.AsBool() == false)
+		{
+			instructionPointer = code + FLoxInstruction::GetBx(instruction);
+		}
+		LOX_VM_DISPATCH();
+	}
+
+	LOX_VM_CASE(Return)
+	{
+		return LOX_VM_REGISTER_A;
+	}
+
+#if LOX_VM_USE_COMPUTED_GOTO == 0
+	}
+	}
+#endif
+
+#undef LOX_VM_COMPARISON
+#undef LOX_VM_ARITHMETIC
+#undef LOX_VM_DISPATCH
+#undef LOX_VM_CASE
+#undef LOX_VM_REGISTER_C
+#undef LOX_VM_REGISTER_B
+#undef LOX_VM_REGISTER_A
+}
+
+#if LOX_VM_USE_COMPUTED_GOTO
+	PRAGMA_WARNING_POP
+#endif
\ No newline at end of file